@@ -212,6 +212,7 @@ public:
 
 	uint64_t get_static_memory_usage() const;
 	uint64_t get_static_memory_peak_usage() const;
+	TypedArray<Dictionary> get_static_memory_size_classes() const;
 	Dictionary get_memory_info() const;
 
 	void delay_usec(int p_usec) const;
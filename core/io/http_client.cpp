@@ -57,6 +57,14 @@ void HTTPClient::set_https_proxy(const String &p_host, int p_port) {
 	WARN_PRINT("HTTPS proxy feature is not available");
 }
 
+void HTTPClient::read_response_body_into(LocalVector<uint8_t> &r_buffer) {
+	const PackedByteArray chunk = read_response_body_chunk();
+	r_buffer.resize(chunk.size());
+	if (chunk.size()) {
+		memcpy(r_buffer.ptr(), chunk.ptr(), chunk.size());
+	}
+}
+
 Error HTTPClient::_request_raw(Method p_method, const String &p_url, const Vector<String> &p_headers, const Vector<uint8_t> &p_body) {
 	int size = p_body.size();
 	return request(p_method, p_url, p_headers, size > 0 ? p_body.ptr() : nullptr, size);
@@ -36,6 +36,7 @@
 #include "core/io/stream_peer.h"
 #include "core/io/stream_peer_tcp.h"
 #include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
 
 class HTTPClient : public RefCounted {
 	GDCLASS(HTTPClient, RefCounted);
@@ -185,6 +186,8 @@ public:
 	virtual int64_t get_response_body_length() const = 0;
 
 	virtual PackedByteArray read_response_body_chunk() = 0; // Can't get body as partial text because of most encodings UTF8, gzip, etc.
+	// Same as above, but reuses the memory of r_buffer instead of allocating a new array for each chunk.
+	virtual void read_response_body_into(LocalVector<uint8_t> &r_buffer);
 
 	virtual void set_blocking_mode(bool p_enable) = 0; // Useful mostly if running in a thread
 	virtual bool is_blocking_mode_enabled() const = 0;
@@ -568,147 +568,190 @@ int64_t HTTPClientTCP::get_response_body_length() const {
 	return body_size;
 }
 
-PackedByteArray HTTPClientTCP::read_response_body_chunk() {
-	ERR_FAIL_COND_V(status != STATUS_BODY, PackedByteArray());
-
-	PackedByteArray ret;
+Error HTTPClientTCP::_read_chunk_data(int &r_size) {
+	// On success, chunk holds r_size bytes of data followed by the CRLF, until cleared by the caller.
 	Error err = OK;
+	r_size = 0;
+	while (true) {
+		if (chunk_trailer_part) {
+			// We need to consume the trailer part too or keep-alive will break.
+			uint8_t b;
+			int rec = 0;
+			err = _get_http_data(&b, 1, rec);
 
-	if (chunked) {
-		while (true) {
-			if (chunk_trailer_part) {
-				// We need to consume the trailer part too or keep-alive will break.
-				uint8_t b;
-				int rec = 0;
-				err = _get_http_data(&b, 1, rec);
+			if (rec == 0) {
+				break;
+			}
 
-				if (rec == 0) {
+			chunk.push_back(b);
+			int cs = chunk.size();
+			if ((cs >= 2 && chunk[cs - 2] == '\r' && chunk[cs - 1] == '\n')) {
+				if (cs == 2) {
+					// Finally over.
+					chunk_trailer_part = false;
+					status = STATUS_CONNECTED;
+					chunk.clear();
 					break;
+				} else {
+					// We do not process nor return the trailer data.
+					chunk.clear();
 				}
+			}
+		} else if (chunk_left == 0) {
+			// Reading length.
+			uint8_t b;
+			int rec = 0;
+			err = _get_http_data(&b, 1, rec);
 
-				chunk.push_back(b);
-				int cs = chunk.size();
-				if ((cs >= 2 && chunk[cs - 2] == '\r' && chunk[cs - 1] == '\n')) {
-					if (cs == 2) {
-						// Finally over.
-						chunk_trailer_part = false;
-						status = STATUS_CONNECTED;
-						chunk.clear();
-						break;
+			if (rec == 0) {
+				break;
+			}
+
+			chunk.push_back(b);
+
+			if (chunk.size() > 32) {
+				ERR_PRINT("HTTP Invalid chunk hex len");
+				status = STATUS_CONNECTION_ERROR;
+				break;
+			}
+
+			if (chunk.size() > 2 && chunk[chunk.size() - 2] == '\r' && chunk[chunk.size() - 1] == '\n') {
+				int len = 0;
+				for (uint32_t i = 0; i < chunk.size() - 2; i++) {
+					char c = chunk[i];
+					int v = 0;
+					if (is_digit(c)) {
+						v = c - '0';
+					} else if (c >= 'a' && c <= 'f') {
+						v = c - 'a' + 10;
+					} else if (c >= 'A' && c <= 'F') {
+						v = c - 'A' + 10;
 					} else {
-						// We do not process nor return the trailer data.
-						chunk.clear();
+						ERR_PRINT("HTTP Chunk len not in hex!!");
+						status = STATUS_CONNECTION_ERROR;
+						break;
+					}
+					len <<= 4;
+					len |= v;
+					if (len > (1 << 24)) {
+						ERR_PRINT("HTTP Chunk too big!! >16mb");
+						status = STATUS_CONNECTION_ERROR;
+						break;
 					}
 				}
-			} else if (chunk_left == 0) {
-				// Reading length.
-				uint8_t b;
-				int rec = 0;
-				err = _get_http_data(&b, 1, rec);
 
-				if (rec == 0) {
+				if (len == 0) {
+					// End reached!
+					chunk_trailer_part = true;
+					chunk.clear();
 					break;
 				}
 
-				chunk.push_back(b);
+				chunk_left = len + 2;
+				chunk.resize(chunk_left);
+			}
+		} else {
+			int rec = 0;
+			err = _get_http_data(&chunk[chunk.size() - chunk_left], chunk_left, rec);
+			if (rec == 0) {
+				break;
+			}
+			chunk_left -= rec;
 
-				if (chunk.size() > 32) {
-					ERR_PRINT("HTTP Invalid chunk hex len");
+			if (chunk_left == 0) {
+				if (chunk[chunk.size() - 2] != '\r' || chunk[chunk.size() - 1] != '\n') {
+					ERR_PRINT("HTTP Invalid chunk terminator (not \\r\\n)");
 					status = STATUS_CONNECTION_ERROR;
 					break;
 				}
 
-				if (chunk.size() > 2 && chunk[chunk.size() - 2] == '\r' && chunk[chunk.size() - 1] == '\n') {
-					int len = 0;
-					for (int i = 0; i < chunk.size() - 2; i++) {
-						char c = chunk[i];
-						int v = 0;
-						if (is_digit(c)) {
-							v = c - '0';
-						} else if (c >= 'a' && c <= 'f') {
-							v = c - 'a' + 10;
-						} else if (c >= 'A' && c <= 'F') {
-							v = c - 'A' + 10;
-						} else {
-							ERR_PRINT("HTTP Chunk len not in hex!!");
-							status = STATUS_CONNECTION_ERROR;
-							break;
-						}
-						len <<= 4;
-						len |= v;
-						if (len > (1 << 24)) {
-							ERR_PRINT("HTTP Chunk too big!! >16mb");
-							status = STATUS_CONNECTION_ERROR;
-							break;
-						}
-					}
-
-					if (len == 0) {
-						// End reached!
-						chunk_trailer_part = true;
-						chunk.clear();
-						break;
-					}
+				r_size = chunk.size() - 2;
+			}
 
-					chunk_left = len + 2;
-					chunk.resize(chunk_left);
-				}
-			} else {
-				int rec = 0;
-				err = _get_http_data(&chunk.write[chunk.size() - chunk_left], chunk_left, rec);
-				if (rec == 0) {
-					break;
-				}
-				chunk_left -= rec;
+			break;
+		}
+	}
+	return err;
+}
 
-				if (chunk_left == 0) {
-					if (chunk[chunk.size() - 2] != '\r' || chunk[chunk.size() - 1] != '\n') {
-						ERR_PRINT("HTTP Invalid chunk terminator (not \\r\\n)");
-						status = STATUS_CONNECTION_ERROR;
-						break;
-					}
+PackedByteArray HTTPClientTCP::read_response_body_chunk() {
+	ERR_FAIL_COND_V(status != STATUS_BODY, PackedByteArray());
 
-					ret.resize(chunk.size() - 2);
-					uint8_t *w = ret.ptrw();
-					memcpy(w, chunk.ptr(), chunk.size() - 2);
-					chunk.clear();
-				}
+	PackedByteArray ret;
+	Error err = OK;
 
-				break;
-			}
+	if (chunked) {
+		int size = 0;
+		err = _read_chunk_data(size);
+		if (size) {
+			ret.resize(size);
+			memcpy(ret.ptrw(), chunk.ptr(), size);
+			chunk.clear();
 		}
-
 	} else {
 		int to_read = !read_until_eof ? MIN(body_left, read_chunk_size) : read_chunk_size;
 		ret.resize(to_read);
-		int _offset = 0;
-		while (to_read > 0) {
-			int rec = 0;
-			{
-				uint8_t *w = ret.ptrw();
-				err = _get_http_data(w + _offset, to_read, rec);
-			}
-			if (rec <= 0) { // Ended up reading less.
-				ret.resize(_offset);
-				break;
-			} else {
-				_offset += rec;
-				to_read -= rec;
-				if (!read_until_eof) {
-					body_left -= rec;
-				}
-			}
-			if (err != OK) {
-				ret.resize(_offset);
-				break;
-			}
+		int read = 0;
+		err = _read_body_data(ret.ptrw(), to_read, read);
+		ret.resize(read);
+	}
+
+	_body_read_done(err);
+
+	return ret;
+}
+
+void HTTPClientTCP::read_response_body_into(LocalVector<uint8_t> &r_buffer) {
+	r_buffer.clear();
+	ERR_FAIL_COND(status != STATUS_BODY);
+
+	// LocalVector keeps its capacity when shrinking, so reading into the same buffer again does not allocate.
+	Error err = OK;
+	if (chunked) {
+		int size = 0;
+		err = _read_chunk_data(size);
+		if (size) {
+			r_buffer.resize(size);
+			memcpy(r_buffer.ptr(), chunk.ptr(), size);
+			chunk.clear();
+		}
+	} else {
+		int to_read = !read_until_eof ? MIN(body_left, read_chunk_size) : read_chunk_size;
+		r_buffer.resize(to_read);
+		int read = 0;
+		err = _read_body_data(r_buffer.ptr(), to_read, read);
+		r_buffer.resize(read);
+	}
+
+	_body_read_done(err);
+}
+
+Error HTTPClientTCP::_read_body_data(uint8_t *r_buffer, int p_bytes, int &r_read) {
+	Error err = OK;
+	r_read = 0;
+	while (p_bytes > 0) {
+		int rec = 0;
+		err = _get_http_data(r_buffer + r_read, p_bytes, rec);
+		if (rec <= 0) { // Ended up reading less.
+			break;
+		}
+		r_read += rec;
+		p_bytes -= rec;
+		if (!read_until_eof) {
+			body_left -= rec;
+		}
+		if (err != OK) {
+			break;
 		}
 	}
+	return err;
+}
 
-	if (err != OK) {
+void HTTPClientTCP::_body_read_done(Error p_err) {
+	if (p_err != OK) {
 		close();
 
-		if (err == ERR_FILE_EOF) {
+		if (p_err == ERR_FILE_EOF) {
 			status = STATUS_DISCONNECTED; // Server disconnected.
 		} else {
 			status = STATUS_CONNECTION_ERROR;
@@ -716,8 +759,6 @@ PackedByteArray HTTPClientTCP::read_response_body_chunk() {
 	} else if (body_left == 0 && !chunked && !read_until_eof) {
 		status = STATUS_CONNECTED;
 	}
-
-	return ret;
 }
 
 HTTPClientTCP::Status HTTPClientTCP::get_status() const {
@@ -56,7 +56,7 @@ private:
 	Vector<uint8_t> response_str;
 
 	bool chunked = false;
-	Vector<uint8_t> chunk;
+	LocalVector<uint8_t> chunk; // Keeps its capacity, so chunks of similar sizes don't allocate.
 	int chunk_left = 0;
 	bool chunk_trailer_part = false;
 	int64_t body_size = -1;
@@ -74,6 +74,9 @@ private:
 	int read_chunk_size = 65536;
 
 	Error _get_http_data(uint8_t *p_buffer, int p_bytes, int &r_received);
+	Error _read_chunk_data(int &r_size);
+	Error _read_body_data(uint8_t *r_buffer, int p_bytes, int &r_read);
+	void _body_read_done(Error p_err);
 
 public:
 	static HTTPClient *_create_func(bool p_notify_postinitialize);
@@ -91,6 +94,7 @@ public:
 	Error get_response_headers(List<String> *r_response) override;
 	int64_t get_response_body_length() const override;
 	PackedByteArray read_response_body_chunk() override;
+	void read_response_body_into(LocalVector<uint8_t> &r_buffer) override;
 	void set_blocking_mode(bool p_enable) override;
 	bool is_blocking_mode_enabled() const override;
 	void set_read_chunk_size(int p_size) override;
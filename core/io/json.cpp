@@ -191,6 +191,21 @@ Error JSON::_get_token(const char32_t *p_str, int &index, int p_len, Token &r_to
 			case '"': {
 				index++;
 				String str;
+
+				// Copy the run of characters up to the first quote or escape sequence
+				// at once, most strings don't need the character-wise loop below.
+				int run_end = index;
+				while (p_str[run_end] != 0 && p_str[run_end] != '"' && p_str[run_end] != '\\') {
+					if (p_str[run_end] == '\n') {
+						line++;
+					}
+					run_end++;
+				}
+				if (run_end > index) {
+					str = String(&p_str[index], run_end - index);
+					index = run_end;
+				}
+
 				while (true) {
 					if (p_str[index] == 0) {
 						r_err_str = "Unterminated String";
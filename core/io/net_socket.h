@@ -33,6 +33,7 @@
 
 #include "core/io/ip.h"
 #include "core/object/ref_counted.h"
+#include "core/templates/local_vector.h"
 
 class NetSocket : public RefCounted {
 protected:
@@ -78,4 +79,24 @@ public:
 	virtual Error leave_multicast_group(const IPAddress &p_multi_address, const String &p_if_name) = 0;
 };
 
+class NetSocketPoller : public RefCounted {
+protected:
+	static NetSocketPoller *(*_create)();
+
+public:
+	// Returns nullptr if the platform has no multi-socket readiness API.
+	static NetSocketPoller *create();
+
+	// Sockets are reported by the id they were added with. Sockets in error or hung up are always reported as ready.
+	// Watched sockets are referenced by the poller, and should be removed before being closed.
+	virtual Error add(const Ref<NetSocket> &p_sock, NetSocket::PollType p_type, uint64_t p_id) = 0;
+	virtual void remove(const Ref<NetSocket> &p_sock) = 0;
+	virtual bool has(const Ref<NetSocket> &p_sock) const = 0;
+	virtual int get_socket_count() const = 0;
+	virtual void clear() = 0;
+
+	// Waits up to p_timeout milliseconds (forever if negative) for any socket to be ready, and stores the ids of the ready ones.
+	virtual Error wait(int p_timeout, LocalVector<uint64_t> &r_ready) = 0;
+};
+
 #endif // NET_SOCKET_H
@@ -246,7 +246,27 @@ StreamPeerTCP::Status StreamPeerTCP::get_status() const {
 	return status;
 }
 
+Error StreamPeerTCP::watch(const Ref<NetSocketPoller> &p_poller, NetSocket::PollType p_type, uint64_t p_id) {
+	ERR_FAIL_COND_V(p_poller.is_null(), ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V(_poller.is_valid(), ERR_ALREADY_IN_USE);
+	ERR_FAIL_COND_V(_sock.is_null() || !_sock->is_open(), ERR_UNAVAILABLE);
+
+	Error err = p_poller->add(_sock, p_type, p_id);
+	if (err == OK) {
+		_poller = p_poller;
+	}
+	return err;
+}
+
+void StreamPeerTCP::unwatch() {
+	if (_poller.is_valid()) {
+		_poller->remove(_sock);
+		_poller.unref();
+	}
+}
+
 void StreamPeerTCP::disconnect_from_host() {
+	unwatch();
 	if (_sock.is_valid() && _sock->is_open()) {
 		_sock->close();
 	}
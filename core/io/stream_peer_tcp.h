@@ -49,6 +49,7 @@ public:
 
 protected:
 	Ref<NetSocket> _sock;
+	Ref<NetSocketPoller> _poller;
 	uint64_t timeout = 0;
 	Status status = STATUS_NONE;
 	IPAddress peer_host;
@@ -75,6 +76,10 @@ public:
 
 	void set_no_delay(bool p_enabled);
 
+	// Reports p_id from p_poller when the socket is ready for p_type, until unwatched or disconnected.
+	Error watch(const Ref<NetSocketPoller> &p_poller, NetSocket::PollType p_type, uint64_t p_id);
+	void unwatch();
+
 	// Poll socket updating its state.
 	Error poll();
 
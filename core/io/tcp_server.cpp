@@ -117,7 +117,27 @@ Ref<StreamPeerTCP> TCPServer::take_connection() {
 	return conn;
 }
 
+Error TCPServer::watch(const Ref<NetSocketPoller> &p_poller, uint64_t p_id) {
+	ERR_FAIL_COND_V(p_poller.is_null(), ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V(_poller.is_valid(), ERR_ALREADY_IN_USE);
+	ERR_FAIL_COND_V(!is_listening(), ERR_UNCONFIGURED);
+
+	Error err = p_poller->add(_sock, NetSocket::POLL_TYPE_IN, p_id);
+	if (err == OK) {
+		_poller = p_poller;
+	}
+	return err;
+}
+
+void TCPServer::unwatch() {
+	if (_poller.is_valid()) {
+		_poller->remove(_sock);
+		_poller.unref();
+	}
+}
+
 void TCPServer::stop() {
+	unwatch();
 	if (_sock.is_valid()) {
 		_sock->close();
 	}
@@ -45,6 +45,7 @@ protected:
 	};
 
 	Ref<NetSocket> _sock;
+	Ref<NetSocketPoller> _poller;
 	static void _bind_methods();
 
 public:
@@ -54,6 +55,10 @@ public:
 	bool is_connection_available() const;
 	Ref<StreamPeerTCP> take_connection();
 
+	// Reports p_id from p_poller when a connection is available, until unwatched or stopped.
+	Error watch(const Ref<NetSocketPoller> &p_poller, uint64_t p_id);
+	void unwatch();
+
 	void stop(); // Stop listening
 
 	TCPServer();
@@ -1425,7 +1425,7 @@ bool Expression::_execute(const Array &p_inputs, Object *p_instance, Expression:
 
 		} break;
 		case Expression::ENode::TYPE_CALL: {
-			const Expression::CallNode *call = static_cast<const Expression::CallNode *>(p_node);
+			Expression::CallNode *call = static_cast<Expression::CallNode *>(p_node);
 
 			Variant base;
 			bool ret = _execute(p_inputs, p_instance, call->base, base, p_const_calls_only, r_error_str);
@@ -1453,6 +1453,12 @@ bool Expression::_execute(const Array &p_inputs, Object *p_instance, Expression:
 			Callable::CallError ce;
 			if (p_const_calls_only) {
 				base.call_const(call->method, (const Variant **)argp.ptr(), argp.size(), r_ret, ce);
+			} else if (base.get_type() != Variant::OBJECT) {
+				if (call->builtin_type != base.get_type()) {
+					call->builtin_type = base.get_type();
+					call->builtin_method_index = Variant::get_builtin_method_index(base.get_type(), call->method);
+				}
+				base.call_builtin_method(call->builtin_method_index, (const Variant **)argp.ptr(), argp.size(), r_ret, ce);
 			} else {
 				base.callp(call->method, (const Variant **)argp.ptr(), argp.size(), r_ret, ce);
 			}
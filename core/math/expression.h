@@ -216,6 +216,10 @@ private:
 		StringName method;
 		Vector<ENode *> arguments;
 
+		// Method last called on a builtin base, to skip the lookup when the base type doesn't change.
+		Variant::Type builtin_type = Variant::VARIANT_MAX;
+		int builtin_method_index = -1;
+
 		CallNode() {
 			type = TYPE_CALL;
 		}
@@ -225,11 +225,14 @@ Vector<Vector2> Transform2D::xform(const Vector<Vector2> &p_array) const {
 	Vector<Vector2> array;
 	array.resize(p_array.size());
 
+	const int64_t size = p_array.size();
 	const Vector2 *r = p_array.ptr();
 	Vector2 *w = array.ptrw();
+	// Local copy, so the compiler knows writing to the array can't modify it.
+	const Transform2D transform = *this;
 
-	for (int i = 0; i < p_array.size(); ++i) {
-		w[i] = xform(r[i]);
+	for (int64_t i = 0; i < size; ++i) {
+		w[i] = transform.xform(r[i]);
 	}
 	return array;
 }
@@ -238,11 +241,14 @@ Vector<Vector2> Transform2D::xform_inv(const Vector<Vector2> &p_array) const {
 	Vector<Vector2> array;
 	array.resize(p_array.size());
 
+	const int64_t size = p_array.size();
 	const Vector2 *r = p_array.ptr();
 	Vector2 *w = array.ptrw();
+	// Local copy, so the compiler knows writing to the array can't modify it.
+	const Transform2D transform = *this;
 
-	for (int i = 0; i < p_array.size(); ++i) {
-		w[i] = xform_inv(r[i]);
+	for (int64_t i = 0; i < size; ++i) {
+		w[i] = transform.xform_inv(r[i]);
 	}
 	return array;
 }
@@ -215,11 +215,14 @@ Vector<Vector3> Transform3D::xform(const Vector<Vector3> &p_array) const {
 	Vector<Vector3> array;
 	array.resize(p_array.size());
 
+	const int64_t size = p_array.size();
 	const Vector3 *r = p_array.ptr();
 	Vector3 *w = array.ptrw();
+	// Local copy, so the compiler knows writing to the array can't modify it.
+	const Transform3D transform = *this;
 
-	for (int i = 0; i < p_array.size(); ++i) {
-		w[i] = xform(r[i]);
+	for (int64_t i = 0; i < size; ++i) {
+		w[i] = transform.xform(r[i]);
 	}
 	return array;
 }
@@ -228,11 +231,14 @@ Vector<Vector3> Transform3D::xform_inv(const Vector<Vector3> &p_array) const {
 	Vector<Vector3> array;
 	array.resize(p_array.size());
 
+	const int64_t size = p_array.size();
 	const Vector3 *r = p_array.ptr();
 	Vector3 *w = array.ptrw();
+	// Local copy, so the compiler knows writing to the array can't modify it.
+	const Transform3D transform = *this;
 
-	for (int i = 0; i < p_array.size(); ++i) {
-		w[i] = xform_inv(r[i]);
+	for (int64_t i = 0; i < size; ++i) {
+		w[i] = transform.xform_inv(r[i]);
 	}
 	return array;
 }
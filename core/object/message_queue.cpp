@@ -110,6 +110,7 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 	msg->args = p_argcount;
 	msg->callable = p_callable;
 	msg->type = TYPE_CALL;
+	last_set_message = nullptr;
 	if (p_show_error) {
 		msg->type |= FLAG_SHOW_ERROR;
 	}
@@ -135,6 +136,14 @@ Error CallQueue::push_callablep(const Callable &p_callable, const Variant **p_ar
 
 Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant &p_value) {
 	LOCK_MUTEX;
+
+	if (last_set_message && last_set_message->callable.get_object_id() == p_id && last_set_message->callable.get_method() == p_prop) {
+		// Nothing was queued since, so only the last value matters.
+		*(Variant *)(last_set_message + 1) = p_value;
+		UNLOCK_MUTEX;
+		return OK;
+	}
+
 	uint32_t room_needed = sizeof(Message) + sizeof(Variant);
 
 	_ensure_first_page();
@@ -166,6 +175,7 @@ Error CallQueue::push_set(ObjectID p_id, const StringName &p_prop, const Variant
 
 	Variant *v = memnew_placement(buffer_end, Variant);
 	*v = p_value;
+	last_set_message = msg;
 
 	page_bytes[pages_used - 1] += room_needed;
 	UNLOCK_MUTEX;
@@ -196,6 +206,7 @@ Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 	Message *msg = memnew_placement(buffer_end, Message);
 
 	msg->type = TYPE_NOTIFICATION;
+	last_set_message = nullptr;
 	msg->callable = Callable(p_id, CoreStringName(notification)); //name is meaningless but callable needs it
 	//msg->target;
 	msg->notification = p_notification;
@@ -206,6 +217,59 @@ Error CallQueue::push_notification(ObjectID p_id, int p_notification) {
 	return OK;
 }
 
+Error CallQueue::_push_native_call(const NativeCall &p_call, uint32_t p_size) {
+	// Keep the following messages aligned.
+	const uint32_t native_size = (p_size + alignof(Message) - 1) & ~uint32_t(alignof(Message) - 1);
+	uint32_t room_needed = sizeof(Message) + native_size;
+
+	LOCK_MUTEX;
+
+	_ensure_first_page();
+
+	if ((page_bytes[pages_used - 1] + room_needed) > uint32_t(PAGE_SIZE_BYTES)) {
+		if (pages_used == max_pages) {
+			fprintf(stderr, "Failed native call on target ID: %s. Message queue out of memory. %s\n", itos(p_call.object_id).utf8().get_data(), error_text.utf8().get_data());
+			statistics();
+			UNLOCK_MUTEX;
+			return ERR_OUT_OF_MEMORY;
+		}
+		_add_page();
+	}
+
+	Page *page = pages[pages_used - 1];
+	uint8_t *buffer_end = &page->data[page_bytes[pages_used - 1]];
+
+	Message *msg = memnew_placement(buffer_end, Message);
+	msg->type = TYPE_NATIVE;
+	last_set_message = nullptr;
+	msg->args = native_size;
+
+	p_call.copy_to(buffer_end + sizeof(Message));
+
+	page_bytes[pages_used - 1] += room_needed;
+	UNLOCK_MUTEX;
+
+	return OK;
+}
+
+void CallQueue::_destroy_message(Message *p_message) {
+	switch (p_message->type & FLAG_MASK) {
+		case TYPE_NOTIFICATION: {
+		} break;
+		case TYPE_NATIVE: {
+			((NativeCall *)(p_message + 1))->~NativeCall();
+		} break;
+		default: {
+			Variant *args = (Variant *)(p_message + 1);
+			for (int k = 0; k < p_message->args; k++) {
+				args[k].~Variant();
+			}
+		} break;
+	}
+
+	p_message->~Message();
+}
+
 void CallQueue::_call_function(const Callable &p_callable, const Variant *p_args, int p_argcount, bool p_show_error) {
 	const Variant **argptrs = nullptr;
 	if (p_argcount) {
@@ -249,15 +313,20 @@ Error CallQueue::flush() {
 
 		Message *message = (Message *)&page->data[offset];
 
-		uint32_t advance = sizeof(Message);
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			advance += sizeof(Variant) * message->args;
-		}
-
 		//pre-advance so this function is reentrant
-		offset += advance;
+		offset += _get_message_size(message);
+
+		Object *target;
+		if ((message->type & FLAG_MASK) == TYPE_NATIVE) {
+			target = ObjectDB::get_instance(((NativeCall *)(message + 1))->object_id);
+		} else {
+			target = message->callable.get_object();
+		}
 
-		Object *target = message->callable.get_object();
+		if (message == last_set_message) {
+			// Its value is read while unlocked, setting it again needs a new message.
+			last_set_message = nullptr;
+		}
 
 		UNLOCK_MUTEX;
 
@@ -279,16 +348,14 @@ Error CallQueue::flush() {
 					target->set(message->callable.get_method(), *arg);
 				}
 			} break;
+			case TYPE_NATIVE: {
+				if (target) {
+					((NativeCall *)(message + 1))->call(target);
+				}
+			} break;
 		}
 
-		if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-			Variant *args = (Variant *)(message + 1);
-			for (int k = 0; k < message->args; k++) {
-				args[k].~Variant();
-			}
-		}
-
-		message->~Message();
+		_destroy_message(message);
 
 		LOCK_MUTEX;
 		if (offset == page_bytes[i]) {
@@ -322,26 +389,15 @@ void CallQueue::clear() {
 
 			Message *message = (Message *)&page->data[offset];
 
-			uint32_t advance = sizeof(Message);
-			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-				advance += sizeof(Variant) * message->args;
-			}
-
-			offset += advance;
-
-			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-				Variant *args = (Variant *)(message + 1);
-				for (int k = 0; k < message->args; k++) {
-					args[k].~Variant();
-				}
-			}
+			offset += _get_message_size(message);
 
-			message->~Message();
+			_destroy_message(message);
 		}
 	}
 
 	pages_used = 1;
 	page_bytes[0] = 0;
+	last_set_message = nullptr;
 
 	UNLOCK_MUTEX;
 }
@@ -351,6 +407,7 @@ void CallQueue::statistics() {
 	HashMap<StringName, int> set_count;
 	HashMap<int, int> notify_count;
 	HashMap<Callable, int> call_count;
+	int native_count = 0;
 	int null_count = 0;
 
 	for (uint32_t i = 0; i < pages_used; i++) {
@@ -362,12 +419,14 @@ void CallQueue::statistics() {
 
 			Message *message = (Message *)&page->data[offset];
 
-			uint32_t advance = sizeof(Message);
-			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-				advance += sizeof(Variant) * message->args;
-			}
+			uint32_t advance = _get_message_size(message);
 
-			Object *target = message->callable.get_object();
+			Object *target;
+			if ((message->type & FLAG_MASK) == TYPE_NATIVE) {
+				target = ObjectDB::get_instance(((NativeCall *)(message + 1))->object_id);
+			} else {
+				target = message->callable.get_object();
+			}
 
 			bool null_target = true;
 			switch (message->type & FLAG_MASK) {
@@ -402,6 +461,12 @@ void CallQueue::statistics() {
 						null_target = false;
 					}
 				} break;
+				case TYPE_NATIVE: {
+					if (target) {
+						native_count++;
+						null_target = false;
+					}
+				} break;
 			}
 			if (null_target) {
 				// Object was deleted.
@@ -412,16 +477,11 @@ void CallQueue::statistics() {
 
 			offset += advance;
 
-			if ((message->type & FLAG_MASK) != TYPE_NOTIFICATION) {
-				Variant *args = (Variant *)(message + 1);
-				for (int k = 0; k < message->args; k++) {
-					args[k].~Variant();
-				}
-			}
-
-			message->~Message();
+			_destroy_message(message);
 		}
 	}
+	// The queued messages were destroyed above.
+	last_set_message = nullptr;
 
 	fprintf(stdout, "TOTAL PAGES: %d (%d bytes).\n", pages_used, pages_used * PAGE_SIZE_BYTES);
 	fprintf(stdout, "NULL count: %d.\n", null_count);
@@ -438,6 +498,8 @@ void CallQueue::statistics() {
 		fprintf(stdout, "NOTIFY %d: %d.\n", E.key, E.value);
 	}
 
+	fprintf(stdout, "NATIVE CALLS: %d.\n", native_count);
+
 	UNLOCK_MUTEX;
 }
 
@@ -60,6 +60,7 @@ private:
 		TYPE_CALL,
 		TYPE_NOTIFICATION,
 		TYPE_SET,
+		TYPE_NATIVE,
 		TYPE_END, // End marker.
 		FLAG_NULL_IS_OK = 1 << 13,
 		FLAG_SHOW_ERROR = 1 << 14,
@@ -86,10 +87,52 @@ private:
 		int16_t type;
 		union {
 			int16_t notification;
-			int16_t args;
+			int16_t args; // Size in bytes of the NativeCall for TYPE_NATIVE.
 		};
 	};
 
+	// Calls pushed with push_method(), stored right after their Message.
+	// They don't need a Callable nor Variant arguments.
+	struct NativeCall {
+		ObjectID object_id;
+		virtual void call(Object *p_object) = 0;
+		virtual void copy_to(void *p_dst) const = 0;
+		virtual ~NativeCall() {}
+	};
+
+	template <typename T, typename F>
+	struct NativeMethodCall : public NativeCall {
+		F function;
+		virtual void call(Object *p_object) override {
+			function(static_cast<T *>(p_object));
+		}
+		virtual void copy_to(void *p_dst) const override {
+			new (p_dst) NativeMethodCall(*this);
+		}
+		NativeMethodCall(ObjectID p_object_id, const F &p_function) :
+				function(p_function) {
+			object_id = p_object_id;
+		}
+	};
+
+	// Last message of the queue if it was pushed by push_set(), so setting the
+	// same property again right away only updates its value. Any other message
+	// pushed after it, or running it, resets it.
+	Message *last_set_message = nullptr;
+
+	static _FORCE_INLINE_ uint32_t _get_message_size(const Message *p_message) {
+		switch (p_message->type & FLAG_MASK) {
+			case TYPE_NOTIFICATION:
+				return sizeof(Message);
+			case TYPE_NATIVE:
+				return sizeof(Message) + p_message->args;
+			default:
+				return sizeof(Message) + sizeof(Variant) * p_message->args;
+		}
+	}
+
+	void _destroy_message(Message *p_message);
+
 	_FORCE_INLINE_ void _ensure_first_page() {
 		if (unlikely(pages.is_empty())) {
 			pages.push_back(allocator->alloc());
@@ -101,6 +144,7 @@ private:
 	void _add_page();
 
 	void _call_function(const Callable &p_callable, const Variant *p_args, int p_argcount, bool p_show_error);
+	Error _push_native_call(const NativeCall &p_call, uint32_t p_size);
 
 	String error_text;
 
@@ -144,6 +188,20 @@ public:
 	Error push_notification(Object *p_object, int p_notification);
 	Error push_set(Object *p_object, const StringName &p_prop, const Variant &p_value);
 
+	// Defers a call to a method of p_object, like callable_mp(p_object, p_method).call_deferred(p_args...)
+	// would, but stores the method and arguments natively instead of in a Callable and Variants.
+	// The call is skipped if the object is freed in the meantime.
+	template <typename T, typename M, typename... VarArgs>
+	Error push_method(T *p_object, M p_method, VarArgs... p_args) {
+		auto function = [p_method, p_args...](T *p_instance) {
+			(p_instance->*p_method)(p_args...);
+		};
+		typedef NativeMethodCall<T, decltype(function)> Call;
+		static_assert(sizeof(Message) + sizeof(Call) <= PAGE_SIZE_BYTES, "Native call is too large to fit on a page.");
+		static_assert(alignof(Call) <= alignof(Message), "Native call arguments are over-aligned.");
+		return _push_native_call(Call(p_object->get_instance_id(), function), sizeof(Call));
+	}
+
 	Error flush();
 	void clear();
 	void statistics();
@@ -44,18 +44,6 @@
 
 #ifdef DEBUG_ENABLED
 
-struct _ObjectDebugLock {
-	Object *obj;
-
-	_ObjectDebugLock(Object *p_obj) {
-		obj = p_obj;
-		obj->_lock_index.ref();
-	}
-	~_ObjectDebugLock() {
-		obj->_lock_index.unref();
-	}
-};
-
 #define OBJ_DEBUG_LOCK _ObjectDebugLock _debug_lock(this);
 
 #else
@@ -1141,35 +1129,34 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		return ERR_UNAVAILABLE;
 	}
 
+	if (s->slot_map.is_empty()) {
+		return OK;
+	}
+
 	// If this is a ref-counted object, prevent it from being destroyed during signal emission,
 	// which is needed in certain edge cases; e.g., https://github.com/godotengine/godot/issues/73889.
 	Ref<RefCounted> rc = Ref<RefCounted>(Object::cast_to<RefCounted>(this));
 
 	// Ensure that disconnecting the signal or even deleting the object
-	// will not affect the signal calling.
-	Callable *slot_callables = (Callable *)alloca(sizeof(Callable) * s->slot_map.size());
-	uint32_t *slot_flags = (uint32_t *)alloca(sizeof(uint32_t) * s->slot_map.size());
-	uint32_t slot_count = 0;
-
-	for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-		memnew_placement(&slot_callables[slot_count], Callable(slot_kv.value.conn.callable));
-		slot_flags[slot_count] = slot_kv.value.conn.flags;
-		++slot_count;
-	}
+	// will not affect the signal calling. This doesn't copy the targets,
+	// (dis)connecting during the emission does.
+	const Vector<SignalData::EmitTarget> targets = s->emit_targets;
+	const SignalData::EmitTarget *targets_ptr = targets.ptr();
+	const uint32_t slot_count = targets.size();
 
 	DEV_ASSERT(slot_count == s->slot_map.size());
 
 	// Disconnect all one-shot connections before emitting to prevent recursion.
 	for (uint32_t i = 0; i < slot_count; ++i) {
-		bool disconnect = slot_flags[i] & CONNECT_ONE_SHOT;
+		bool disconnect = targets_ptr[i].flags & CONNECT_ONE_SHOT;
 #ifdef TOOLS_ENABLED
-		if (disconnect && (slot_flags[i] & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
+		if (disconnect && (targets_ptr[i].flags & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
 			// This signal was connected from the editor, and is being edited. Just don't disconnect for now.
 			disconnect = false;
 		}
 #endif
 		if (disconnect) {
-			_disconnect(p_name, slot_callables[i]);
+			_disconnect(p_name, targets_ptr[i].callable);
 		}
 	}
 
@@ -1178,8 +1165,8 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 	Error err = OK;
 
 	for (uint32_t i = 0; i < slot_count; ++i) {
-		const Callable &callable = slot_callables[i];
-		const uint32_t &flags = slot_flags[i];
+		const Callable &callable = targets_ptr[i].callable;
+		const uint32_t &flags = targets_ptr[i].flags;
 
 		if (!callable.is_valid()) {
 			// Target might have been deleted during signal callback, this is expected and OK.
@@ -1215,10 +1202,6 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		}
 	}
 
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		slot_callables[i].~Callable();
-	}
-
 	return err;
 }
 
@@ -1433,6 +1416,11 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 	//use callable version as key, so binds can be ignored
 	s->slot_map[*p_callable.get_base_comparator()] = slot;
 
+	SignalData::EmitTarget target;
+	target.callable = p_callable;
+	target.flags = p_flags;
+	s->emit_targets.push_back(target);
+
 	return OK;
 }
 
@@ -1490,6 +1478,13 @@ bool Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 
 	s->slot_map.erase(*p_callable.get_base_comparator());
 
+	for (int i = 0; i < s->emit_targets.size(); i++) {
+		if (*s->emit_targets[i].callable.get_base_comparator() == *p_callable.get_base_comparator()) {
+			s->emit_targets.remove_at(i);
+			break;
+		}
+	}
+
 	if (s->slot_map.is_empty() && ClassDB::has_signal(get_class_name(), p_signal)) {
 		//not user signal, delete
 		signal_map.erase(p_signal);
@@ -2174,9 +2169,10 @@ void postinitialize_handler(Object *p_object) {
 void ObjectDB::debug_objects(DebugFunc p_func) {
 	spin_lock.lock();
 
-	for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-		if (object_slots[i].validator) {
-			p_func(object_slots[i].object);
+	for (uint32_t i = 0, count = slot_count; i < slot_max.get() && count != 0; i++) {
+		ObjectSlot &object_slot = _get_slot(i);
+		if (object_slot.validator.load(std::memory_order_relaxed)) {
+			p_func(object_slot.object.load(std::memory_order_relaxed));
 			count--;
 		}
 	}
@@ -2231,8 +2227,9 @@ void Object::get_argument_options(const StringName &p_function, int p_idx, List<
 
 SpinLock ObjectDB::spin_lock;
 uint32_t ObjectDB::slot_count = 0;
-uint32_t ObjectDB::slot_max = 0;
-ObjectDB::ObjectSlot *ObjectDB::object_slots = nullptr;
+SafeNumeric<uint32_t> ObjectDB::slot_max;
+ObjectDB::ObjectSlot *ObjectDB::object_slot_chunks[OBJECTDB_SLOT_CHUNK_MAX_COUNT] = {};
+uint32_t *ObjectDB::free_slots = nullptr;
 uint64_t ObjectDB::validator_counter = 0;
 
 int ObjectDB::get_object_count() {
@@ -2241,41 +2238,51 @@ int ObjectDB::get_object_count() {
 
 ObjectID ObjectDB::add_instance(Object *p_object) {
 	spin_lock.lock();
-	if (unlikely(slot_count == slot_max)) {
+	uint32_t current_slot_max = slot_max.get();
+	if (unlikely(slot_count == current_slot_max)) {
 		CRASH_COND(slot_count == (1 << OBJECTDB_SLOT_MAX_COUNT_BITS));
 
-		uint32_t new_slot_max = slot_max > 0 ? slot_max * 2 : 1;
-		object_slots = (ObjectSlot *)memrealloc(object_slots, sizeof(ObjectSlot) * new_slot_max);
-		for (uint32_t i = slot_max; i < new_slot_max; i++) {
-			object_slots[i].object = nullptr;
-			object_slots[i].is_ref_counted = false;
-			object_slots[i].next_free = i;
-			object_slots[i].validator = 0;
+		// Chunks are never moved nor freed until cleanup, since other threads may be reading them.
+		ObjectSlot *chunk = (ObjectSlot *)memalloc(sizeof(ObjectSlot) * OBJECTDB_SLOT_CHUNK_SIZE);
+		for (uint32_t i = 0; i < OBJECTDB_SLOT_CHUNK_SIZE; i++) {
+			memnew_placement(&chunk[i].validator, std::atomic<uint64_t>(0));
+			memnew_placement(&chunk[i].object, std::atomic<Object *>(nullptr));
 		}
-		slot_max = new_slot_max;
+		object_slot_chunks[current_slot_max >> OBJECTDB_SLOT_CHUNK_BITS] = chunk;
+
+		uint32_t new_slot_max = current_slot_max + OBJECTDB_SLOT_CHUNK_SIZE;
+		free_slots = (uint32_t *)memrealloc(free_slots, sizeof(uint32_t) * new_slot_max);
+		for (uint32_t i = current_slot_max; i < new_slot_max; i++) {
+			free_slots[i] = i;
+		}
+		slot_max.set(new_slot_max);
 	}
 
-	uint32_t slot = object_slots[slot_count].next_free;
-	if (object_slots[slot].object != nullptr) {
+	uint32_t slot = free_slots[slot_count];
+	ObjectSlot &object_slot = _get_slot(slot);
+	if (object_slot.object.load(std::memory_order_relaxed) != nullptr) {
 		spin_lock.unlock();
-		ERR_FAIL_COND_V(object_slots[slot].object != nullptr, ObjectID());
+		ERR_FAIL_COND_V(object_slot.object.load(std::memory_order_relaxed) != nullptr, ObjectID());
 	}
-	object_slots[slot].object = p_object;
-	object_slots[slot].is_ref_counted = p_object->is_ref_counted();
 	validator_counter = (validator_counter + 1) & OBJECTDB_VALIDATOR_MASK;
 	if (unlikely(validator_counter == 0)) {
 		validator_counter = 1;
 	}
-	object_slots[slot].validator = validator_counter;
 
 	uint64_t id = validator_counter;
 	id <<= OBJECTDB_SLOT_MAX_COUNT_BITS;
 	id |= uint64_t(slot);
 
+	uint64_t validator = validator_counter;
 	if (p_object->is_ref_counted()) {
 		id |= OBJECTDB_REFERENCE_BIT;
+		validator |= OBJECTDB_REFERENCE_BIT;
 	}
 
+	// Publish the object before the validator, see get_instance().
+	object_slot.object.store(p_object, std::memory_order_release);
+	object_slot.validator.store(validator, std::memory_order_release);
+
 	slot_count++;
 
 	spin_lock.unlock();
@@ -2289,17 +2296,19 @@ void ObjectDB::remove_instance(Object *p_object) {
 
 	spin_lock.lock();
 
+	ObjectSlot &object_slot = _get_slot(slot);
+
 #ifdef DEBUG_ENABLED
 
-	if (object_slots[slot].object != p_object) {
+	if (object_slot.object.load(std::memory_order_relaxed) != p_object) {
 		spin_lock.unlock();
-		ERR_FAIL_COND(object_slots[slot].object != p_object);
+		ERR_FAIL_COND(object_slot.object.load(std::memory_order_relaxed) != p_object);
 	}
 	{
 		uint64_t validator = (t >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
-		if (object_slots[slot].validator != validator) {
+		if ((object_slot.validator.load(std::memory_order_relaxed) & OBJECTDB_VALIDATOR_MASK) != validator) {
 			spin_lock.unlock();
-			ERR_FAIL_COND(object_slots[slot].validator != validator);
+			ERR_FAIL_COND((object_slot.validator.load(std::memory_order_relaxed) & OBJECTDB_VALIDATOR_MASK) != validator);
 		}
 	}
 
@@ -2307,11 +2316,10 @@ void ObjectDB::remove_instance(Object *p_object) {
 	//decrease slot count
 	slot_count--;
 	//set the free slot properly
-	object_slots[slot_count].next_free = slot;
-	//invalidate, so checks against it fail
-	object_slots[slot].validator = 0;
-	object_slots[slot].is_ref_counted = false;
-	object_slots[slot].object = nullptr;
+	free_slots[slot_count] = slot;
+	//invalidate first, so checks against it fail, see get_instance()
+	object_slot.validator.store(0, std::memory_order_relaxed);
+	object_slot.object.store(nullptr, std::memory_order_release);
 
 	spin_lock.unlock();
 }
@@ -2333,9 +2341,10 @@ void ObjectDB::cleanup() {
 			MethodBind *resource_get_path = ClassDB::get_method("Resource", "get_path");
 			Callable::CallError call_error;
 
-			for (uint32_t i = 0, count = slot_count; i < slot_max && count != 0; i++) {
-				if (object_slots[i].validator) {
-					Object *obj = object_slots[i].object;
+			for (uint32_t i = 0, count = slot_count; i < slot_max.get() && count != 0; i++) {
+				const uint64_t validator = _get_slot(i).validator.load(std::memory_order_relaxed);
+				if (validator) {
+					Object *obj = _get_slot(i).object.load(std::memory_order_relaxed);
 
 					String extra_info;
 					if (obj->is_class("Node")) {
@@ -2345,7 +2354,7 @@ void ObjectDB::cleanup() {
 						extra_info = " - Resource path: " + String(resource_get_path->call(obj, nullptr, 0, call_error));
 					}
 
-					uint64_t id = uint64_t(i) | (uint64_t(object_slots[i].validator) << OBJECTDB_SLOT_MAX_COUNT_BITS) | (object_slots[i].is_ref_counted ? OBJECTDB_REFERENCE_BIT : 0);
+					uint64_t id = uint64_t(i) | ((validator & OBJECTDB_VALIDATOR_MASK) << OBJECTDB_SLOT_MAX_COUNT_BITS) | (validator & OBJECTDB_REFERENCE_BIT);
 					DEV_ASSERT(id == (uint64_t)obj->get_instance_id()); // We could just use the id from the object, but this check may help catching memory corruption catastrophes.
 					print_line("Leaked instance: " + String(obj->get_class()) + ":" + uitos(id) + extra_info);
 
@@ -2356,8 +2365,14 @@ void ObjectDB::cleanup() {
 		}
 	}
 
-	if (object_slots) {
-		memfree(object_slots);
+	for (uint32_t i = 0; i < slot_max.get(); i += OBJECTDB_SLOT_CHUNK_SIZE) {
+		memfree(object_slot_chunks[i >> OBJECTDB_SLOT_CHUNK_BITS]);
+		object_slot_chunks[i >> OBJECTDB_SLOT_CHUNK_BITS] = nullptr;
+	}
+	slot_max.set(0);
+	if (free_slots) {
+		memfree(free_slots);
+		free_slots = nullptr;
 	}
 
 	spin_lock.unlock();
@@ -605,8 +605,17 @@ private:
 			List<Connection>::Element *cE = nullptr;
 		};
 
+		struct EmitTarget {
+			Callable callable;
+			uint32_t flags = 0;
+		};
+
 		MethodInfo user;
 		HashMap<Callable, Slot, HashableHasher<Callable>> slot_map;
+		// Flat copy of slot_map, in the same order, used for emission.
+		// Emitting only takes a reference to it, and copy-on-write keeps it unchanged
+		// for the ongoing emissions if slots are (dis)connected in the meantime.
+		Vector<EmitTarget> emit_targets;
 		bool removable = false;
 	};
 
@@ -990,6 +999,22 @@ public:
 	virtual ~Object();
 };
 
+#ifdef DEBUG_ENABLED
+// Prevents an object from being freed while one of its methods is running.
+// Used by Object::callp(), and by callers that dispatch to methods directly.
+struct _ObjectDebugLock {
+	Object *obj;
+
+	_ObjectDebugLock(Object *p_obj) {
+		obj = p_obj;
+		obj->_lock_index.ref();
+	}
+	~_ObjectDebugLock() {
+		obj->_lock_index.unref();
+	}
+};
+#endif
+
 bool predelete_handler(Object *p_object);
 void postinitialize_handler(Object *p_object);
 
@@ -1000,20 +1025,32 @@ class ObjectDB {
 #define OBJECTDB_SLOT_MAX_COUNT_BITS 24
 #define OBJECTDB_SLOT_MAX_COUNT_MASK ((uint64_t(1) << OBJECTDB_SLOT_MAX_COUNT_BITS) - 1)
 #define OBJECTDB_REFERENCE_BIT (uint64_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS + OBJECTDB_VALIDATOR_BITS))
+// Slots are allocated in chunks that never move, so they can be read without locking.
+#define OBJECTDB_SLOT_CHUNK_BITS 12
+#define OBJECTDB_SLOT_CHUNK_SIZE (uint32_t(1) << OBJECTDB_SLOT_CHUNK_BITS)
+#define OBJECTDB_SLOT_CHUNK_MASK (OBJECTDB_SLOT_CHUNK_SIZE - 1)
+#define OBJECTDB_SLOT_CHUNK_MAX_COUNT (uint32_t(1) << (OBJECTDB_SLOT_MAX_COUNT_BITS - OBJECTDB_SLOT_CHUNK_BITS))
 
 	struct ObjectSlot { // 128 bits per slot.
-		uint64_t validator : OBJECTDB_VALIDATOR_BITS;
-		uint64_t next_free : OBJECTDB_SLOT_MAX_COUNT_BITS;
-		uint64_t is_ref_counted : 1;
-		Object *object = nullptr;
+		// Validator, and OBJECTDB_REFERENCE_BIT if ref counted. Zero if the slot is free.
+		std::atomic<uint64_t> validator;
+		std::atomic<Object *> object;
 	};
 
+	// Slots are only written with the lock held. Writers set the object before the validator
+	// when adding an instance, and clear the validator first when removing it, so that
+	// get_instance() can check the validator before and after reading the object instead.
 	static SpinLock spin_lock;
 	static uint32_t slot_count;
-	static uint32_t slot_max;
-	static ObjectSlot *object_slots;
+	static SafeNumeric<uint32_t> slot_max;
+	static ObjectSlot *object_slot_chunks[OBJECTDB_SLOT_CHUNK_MAX_COUNT];
+	static uint32_t *free_slots;
 	static uint64_t validator_counter;
 
+	_ALWAYS_INLINE_ static ObjectSlot &_get_slot(uint32_t p_slot) {
+		return object_slot_chunks[p_slot >> OBJECTDB_SLOT_CHUNK_BITS][p_slot & OBJECTDB_SLOT_CHUNK_MASK];
+	}
+
 	friend class Object;
 	friend void unregister_core_types();
 	static void cleanup();
@@ -1031,20 +1068,21 @@ public:
 		uint64_t id = p_instance_id;
 		uint32_t slot = id & OBJECTDB_SLOT_MAX_COUNT_MASK;
 
-		ERR_FAIL_COND_V(slot >= slot_max, nullptr); // This should never happen unless RID is corrupted.
-
-		spin_lock.lock();
+		ERR_FAIL_COND_V(slot >= slot_max.get(), nullptr); // This should never happen unless RID is corrupted.
 
 		uint64_t validator = (id >> OBJECTDB_SLOT_MAX_COUNT_BITS) & OBJECTDB_VALIDATOR_MASK;
+		ObjectSlot &object_slot = _get_slot(slot);
 
-		if (unlikely(object_slots[slot].validator != validator)) {
-			spin_lock.unlock();
+		if (unlikely((object_slot.validator.load(std::memory_order_acquire) & OBJECTDB_VALIDATOR_MASK) != validator)) {
 			return nullptr;
 		}
 
-		Object *object = object_slots[slot].object;
+		Object *object = object_slot.object.load(std::memory_order_acquire);
 
-		spin_lock.unlock();
+		// The slot may have been freed, or even reused, while reading the object.
+		if (unlikely((object_slot.validator.load(std::memory_order_relaxed) & OBJECTDB_VALIDATOR_MASK) != validator)) {
+			return nullptr;
+		}
 
 		return object;
 	}
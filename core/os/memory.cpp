@@ -33,6 +33,10 @@
 #include "core/error/error_macros.h"
 #include "core/templates/safe_refcount.h"
 
+#ifdef SMALL_OBJECT_ALLOCATOR_ENABLED
+#include "core/os/small_object_allocator.h"
+#endif
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -98,6 +102,66 @@ void Memory::free_aligned_static(void *p_memory) {
 	free(p);
 }
 
+#ifdef SMALL_OBJECT_ALLOCATOR_ENABLED
+// Small blocks come from the size-class allocator, which can tell its own blocks
+// and their size class apart from the pointer alone, so no size has to be stored.
+
+static _FORCE_INLINE_ void *_block_alloc(size_t p_size) {
+	const uint32_t size_class = SmallObjectAllocator::get_size_class(p_size);
+	if (size_class != SmallObjectAllocator::INVALID_SIZE_CLASS) {
+		void *mem = SmallObjectAllocator::alloc(size_class);
+		if (mem) {
+			return mem;
+		}
+	}
+	return malloc(p_size);
+}
+
+static _FORCE_INLINE_ void _block_free(void *p_mem) {
+	const uint32_t size_class = SmallObjectAllocator::get_pointer_size_class(p_mem);
+	if (size_class != SmallObjectAllocator::INVALID_SIZE_CLASS) {
+		SmallObjectAllocator::free(p_mem, size_class);
+	} else {
+		free(p_mem);
+	}
+}
+
+static void *_block_realloc(void *p_mem, size_t p_size) {
+	const uint32_t old_class = SmallObjectAllocator::get_pointer_size_class(p_mem);
+	if (old_class == SmallObjectAllocator::INVALID_SIZE_CLASS) {
+		// Blocks from malloc stay there, their size isn't known to copy them elsewhere.
+		return realloc(p_mem, p_size);
+	}
+	if (p_size == 0) {
+		SmallObjectAllocator::free(p_mem, old_class);
+		return nullptr;
+	}
+	if (SmallObjectAllocator::get_size_class(p_size) == old_class) {
+		return p_mem;
+	}
+
+	void *new_mem = _block_alloc(p_size);
+	if (new_mem == nullptr) {
+		return nullptr;
+	}
+	memcpy(new_mem, p_mem, MIN(SmallObjectAllocator::get_block_size(old_class), p_size));
+	SmallObjectAllocator::free(p_mem, old_class);
+	return new_mem;
+}
+#else
+static _FORCE_INLINE_ void *_block_alloc(size_t p_size) {
+	return malloc(p_size);
+}
+
+static _FORCE_INLINE_ void _block_free(void *p_mem) {
+	free(p_mem);
+}
+
+static _FORCE_INLINE_ void *_block_realloc(void *p_mem, size_t p_size) {
+	return realloc(p_mem, p_size);
+}
+#endif
+
 void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 #ifdef DEBUG_ENABLED
 	bool prepad = true;
@@ -105,7 +169,7 @@ void *Memory::alloc_static(size_t p_bytes, bool p_pad_align) {
 	bool prepad = p_pad_align;
 #endif
 
-	void *mem = malloc(p_bytes + (prepad ? DATA_OFFSET : 0));
+	void *mem = _block_alloc(p_bytes + (prepad ? DATA_OFFSET : 0));
 
 	ERR_FAIL_NULL_V(mem, nullptr);
 
@@ -154,12 +218,12 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 #endif
 
 		if (p_bytes == 0) {
-			free(mem);
+			_block_free(mem);
 			return nullptr;
 		} else {
 			*s = p_bytes;
 
-			mem = (uint8_t *)realloc(mem, p_bytes + DATA_OFFSET);
+			mem = (uint8_t *)_block_realloc(mem, p_bytes + DATA_OFFSET);
 			ERR_FAIL_NULL_V(mem, nullptr);
 
 			s = (uint64_t *)(mem + SIZE_OFFSET);
@@ -169,7 +233,7 @@ void *Memory::realloc_static(void *p_memory, size_t p_bytes, bool p_pad_align) {
 			return mem + DATA_OFFSET;
 		}
 	} else {
-		mem = (uint8_t *)realloc(mem, p_bytes);
+		mem = (uint8_t *)_block_realloc(mem, p_bytes);
 
 		ERR_FAIL_COND_V(mem == nullptr && p_bytes > 0, nullptr);
 
@@ -198,9 +262,9 @@ void Memory::free_static(void *p_ptr, bool p_pad_align) {
 		mem_usage.sub(*s);
 #endif
 
-		free(mem);
+		_block_free(mem);
 	} else {
-		free(mem);
+		_block_free(mem);
 	}
 }
 
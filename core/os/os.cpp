@@ -36,6 +36,8 @@
 #include "core/io/file_access.h"
 #include "core/io/json.h"
 #include "core/os/midi_driver.h"
+#include "core/os/small_object_allocator.h"
+#include "core/variant/typed_array.h"
 #include "core/version_generated.gen.h"
 
 #include <stdarg.h>
@@ -326,6 +328,22 @@ uint64_t OS::get_static_memory_peak_usage() const {
 	return Memory::get_mem_max_usage();
 }
 
+TypedArray<Dictionary> OS::get_static_memory_size_classes() const {
+	TypedArray<Dictionary> size_classes;
+#ifdef SMALL_OBJECT_ALLOCATOR_ENABLED
+	SmallObjectAllocator::SizeClassStats stats[SmallObjectAllocator::SIZE_CLASS_COUNT];
+	SmallObjectAllocator::get_stats(stats);
+	for (const SmallObjectAllocator::SizeClassStats &E : stats) {
+		Dictionary size_class;
+		size_class["block_size"] = (uint64_t)E.block_size;
+		size_class["reserved_blocks"] = E.reserved_blocks;
+		size_class["used_blocks"] = E.used_blocks;
+		size_classes.push_back(size_class);
+	}
+#endif
+	return size_classes;
+}
+
 Error OS::set_cwd(const String &p_cwd) {
 	return ERR_CANT_OPEN;
 }
@@ -43,6 +43,9 @@
 #include <stdarg.h>
 #include <stdlib.h>
 
+template <typename T>
+class TypedArray;
+
 class OS {
 	static OS *singleton;
 	static uint64_t target_ticks;
@@ -260,6 +263,7 @@ public:
 
 	virtual uint64_t get_static_memory_usage() const;
 	virtual uint64_t get_static_memory_peak_usage() const;
+	TypedArray<Dictionary> get_static_memory_size_classes() const;
 	virtual Dictionary get_memory_info() const;
 
 	RenderThreadMode get_render_thread_mode() const { return _render_thread_mode; }
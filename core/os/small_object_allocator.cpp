@@ -0,0 +1,290 @@
+/**************************************************************************/
+/*  small_object_allocator.cpp                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "small_object_allocator.h"
+
+#include "core/os/spin_lock.h"
+
+#include <stdlib.h>
+#include <atomic>
+
+static constexpr uint32_t CHUNK_SHIFT = 16;
+static constexpr size_t CHUNK_SIZE = size_t(1) << CHUNK_SHIFT;
+// Chunks are carved from larger regions, so aligning them wastes at most one chunk per region.
+static constexpr size_t REGION_CHUNKS = 16;
+
+// Size class (plus one, zero if unused) of every chunk, indexed by address. The two levels cover
+// the bits 32 to 47 and 16 to 31 of the address. Leaves are created on demand, only written with
+// `chunk_lock` held before any block of the chunk is handed out, and never freed.
+static constexpr uint32_t ADDRESS_BITS = 48;
+static std::atomic<uint8_t *> chunk_size_classes[1 << (ADDRESS_BITS - 32)];
+
+static SpinLock chunk_lock;
+static uint8_t *region_pos = nullptr;
+static uint8_t *region_end = nullptr;
+static bool regions_unavailable = false;
+
+// Returns a new chunk serving the given size class, or nullptr.
+static uint8_t *alloc_chunk(uint32_t p_size_class) {
+	chunk_lock.lock();
+
+	if (region_pos == region_end) {
+		uint8_t *region = regions_unavailable ? nullptr : (uint8_t *)malloc(CHUNK_SIZE * (REGION_CHUNKS + 1));
+		if (region == nullptr || ((uint64_t)(uintptr_t)(region + CHUNK_SIZE * (REGION_CHUNKS + 1)) >> ADDRESS_BITS) != 0) {
+			// Addresses past the chunk map can't be served, so leave those allocations to malloc from now on.
+			regions_unavailable = regions_unavailable || region != nullptr;
+			::free(region);
+			chunk_lock.unlock();
+			return nullptr;
+		}
+		region_pos = (uint8_t *)(((uintptr_t)region + CHUNK_SIZE - 1) & ~(uintptr_t)(CHUNK_SIZE - 1));
+		region_end = region_pos + CHUNK_SIZE * REGION_CHUNKS;
+	}
+
+	const uint64_t address = (uint64_t)(uintptr_t)region_pos;
+	std::atomic<uint8_t *> &leaf_ref = chunk_size_classes[address >> 32];
+	uint8_t *leaf = leaf_ref.load(std::memory_order_relaxed);
+	if (leaf == nullptr) {
+		leaf = (uint8_t *)calloc(size_t(1) << (32 - CHUNK_SHIFT), 1);
+		if (leaf == nullptr) {
+			chunk_lock.unlock();
+			return nullptr;
+		}
+		leaf_ref.store(leaf, std::memory_order_release);
+	}
+
+	uint8_t *chunk = region_pos;
+	region_pos += CHUNK_SIZE;
+	leaf[(address >> CHUNK_SHIFT) & ((1 << (32 - CHUNK_SHIFT)) - 1)] = (uint8_t)(p_size_class + 1);
+
+	chunk_lock.unlock();
+	return chunk;
+}
+
+struct FreeBlock {
+	FreeBlock *next;
+};
+
+// Shared pool of a size class, only accessed with `lock` held. The pools are
+// constant-initialized, so they can be used before static constructors run,
+// and are never destroyed.
+struct SizeClassPool {
+	SpinLock lock;
+	FreeBlock *free_list = nullptr;
+	uint32_t free_count = 0;
+	uint8_t *chunk_pos = nullptr;
+	uint8_t *chunk_end = nullptr;
+	uint64_t reserved_blocks = 0;
+	int64_t used_blocks = 0;
+};
+
+static SizeClassPool pools[SmallObjectAllocator::SIZE_CLASS_COUNT];
+
+// How many blocks a thread takes from or gives back to the shared pool at once.
+static _FORCE_INLINE_ uint32_t get_batch_size(uint32_t p_size_class) {
+	return CLAMP((uint32_t)(4096 / SmallObjectAllocator::get_block_size(p_size_class)), 8u, 64u);
+}
+
+// Kept apart from the cache, as it is read after the cache was destroyed.
+static thread_local bool thread_cache_finalized = false;
+
+struct ThreadCache {
+	struct Bin {
+		FreeBlock *head = nullptr;
+		uint32_t count = 0;
+		int64_t used_delta = 0;
+	};
+
+	Bin bins[SmallObjectAllocator::SIZE_CLASS_COUNT];
+
+	bool refill(uint32_t p_size_class);
+	void flush(uint32_t p_size_class, uint32_t p_count);
+
+	~ThreadCache() {
+		for (uint32_t i = 0; i < SmallObjectAllocator::SIZE_CLASS_COUNT; i++) {
+			flush(i, bins[i].count);
+		}
+		// Allocations made by later thread_local destructors go straight to the pools.
+		thread_cache_finalized = true;
+	}
+};
+
+static thread_local ThreadCache thread_cache;
+
+// Takes up to `p_count` blocks from the pool, returns the number taken. Must be called with the pool locked.
+static uint32_t take_blocks(SizeClassPool &p_pool, uint32_t p_size_class, uint32_t p_count, FreeBlock *&r_head) {
+	const size_t block_size = SmallObjectAllocator::get_block_size(p_size_class);
+	uint32_t taken = 0;
+
+	while (taken < p_count) {
+		FreeBlock *block = p_pool.free_list;
+		if (block) {
+			p_pool.free_list = block->next;
+			p_pool.free_count--;
+		} else {
+			if ((size_t)(p_pool.chunk_end - p_pool.chunk_pos) < block_size) {
+				uint8_t *chunk = alloc_chunk(p_size_class);
+				if (!chunk) {
+					break;
+				}
+				p_pool.chunk_pos = chunk;
+				p_pool.chunk_end = chunk + CHUNK_SIZE;
+				p_pool.reserved_blocks += CHUNK_SIZE / block_size;
+			}
+			block = (FreeBlock *)p_pool.chunk_pos;
+			p_pool.chunk_pos += block_size;
+		}
+
+		block->next = r_head;
+		r_head = block;
+		taken++;
+	}
+
+	return taken;
+}
+
+bool ThreadCache::refill(uint32_t p_size_class) {
+	Bin &bin = bins[p_size_class];
+	SizeClassPool &pool = pools[p_size_class];
+
+	pool.lock.lock();
+	pool.used_blocks += bin.used_delta;
+	bin.used_delta = 0;
+	bin.count += take_blocks(pool, p_size_class, get_batch_size(p_size_class), bin.head);
+	pool.lock.unlock();
+
+	return bin.head != nullptr;
+}
+
+void ThreadCache::flush(uint32_t p_size_class, uint32_t p_count) {
+	Bin &bin = bins[p_size_class];
+	SizeClassPool &pool = pools[p_size_class];
+
+	// Detach the blocks before locking.
+	FreeBlock *first = nullptr;
+	FreeBlock *last = nullptr;
+	for (uint32_t i = 0; i < p_count && bin.head; i++) {
+		FreeBlock *block = bin.head;
+		bin.head = block->next;
+		block->next = first;
+		first = block;
+		if (!last) {
+			last = block;
+		}
+	}
+	const uint32_t flushed = MIN(p_count, bin.count);
+	bin.count -= flushed;
+
+	pool.lock.lock();
+	if (last) {
+		last->next = pool.free_list;
+		pool.free_list = first;
+		pool.free_count += flushed;
+	}
+	pool.used_blocks += bin.used_delta;
+	bin.used_delta = 0;
+	pool.lock.unlock();
+}
+
+void *SmallObjectAllocator::alloc(uint32_t p_size_class) {
+	if (unlikely(thread_cache_finalized)) {
+		SizeClassPool &pool = pools[p_size_class];
+		FreeBlock *block = nullptr;
+		pool.lock.lock();
+		if (take_blocks(pool, p_size_class, 1, block)) {
+			pool.used_blocks++;
+		}
+		pool.lock.unlock();
+		return block;
+	}
+
+	ThreadCache &cache = thread_cache;
+	ThreadCache::Bin &bin = cache.bins[p_size_class];
+	if (unlikely(!bin.head) && !cache.refill(p_size_class)) {
+		return nullptr;
+	}
+
+	FreeBlock *block = bin.head;
+	bin.head = block->next;
+	bin.count--;
+	bin.used_delta++;
+	return block;
+}
+
+void SmallObjectAllocator::free(void *p_ptr, uint32_t p_size_class) {
+	FreeBlock *block = (FreeBlock *)p_ptr;
+
+	if (unlikely(thread_cache_finalized)) {
+		SizeClassPool &pool = pools[p_size_class];
+		pool.lock.lock();
+		block->next = pool.free_list;
+		pool.free_list = block;
+		pool.free_count++;
+		pool.used_blocks--;
+		pool.lock.unlock();
+		return;
+	}
+
+	ThreadCache &cache = thread_cache;
+	ThreadCache::Bin &bin = cache.bins[p_size_class];
+	block->next = bin.head;
+	bin.head = block;
+	bin.count++;
+	bin.used_delta--;
+
+	const uint32_t batch_size = get_batch_size(p_size_class);
+	if (unlikely(bin.count > batch_size * 2)) {
+		cache.flush(p_size_class, batch_size);
+	}
+}
+
+uint32_t SmallObjectAllocator::get_pointer_size_class(const void *p_ptr) {
+	const uint64_t address = (uint64_t)(uintptr_t)p_ptr;
+	if ((address >> ADDRESS_BITS) != 0) {
+		return INVALID_SIZE_CLASS;
+	}
+	const uint8_t *leaf = chunk_size_classes[address >> 32].load(std::memory_order_acquire);
+	if (leaf == nullptr) {
+		return INVALID_SIZE_CLASS;
+	}
+	const uint8_t size_class = leaf[(address >> CHUNK_SHIFT) & ((1 << (32 - CHUNK_SHIFT)) - 1)];
+	return size_class == 0 ? INVALID_SIZE_CLASS : size_class - 1;
+}
+
+void SmallObjectAllocator::get_stats(SizeClassStats r_stats[SIZE_CLASS_COUNT]) {
+	for (uint32_t i = 0; i < SIZE_CLASS_COUNT; i++) {
+		SizeClassPool &pool = pools[i];
+		pool.lock.lock();
+		r_stats[i].block_size = get_block_size(i);
+		r_stats[i].reserved_blocks = pool.reserved_blocks;
+		r_stats[i].used_blocks = (uint64_t)MAX(pool.used_blocks, (int64_t)0);
+		pool.lock.unlock();
+	}
+}
@@ -0,0 +1,96 @@
+/**************************************************************************/
+/*  small_object_allocator.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef SMALL_OBJECT_ALLOCATOR_H
+#define SMALL_OBJECT_ALLOCATOR_H
+
+#include "core/typedefs.h"
+
+// Size-class allocator used by Memory::alloc_static for small blocks when
+// built with `small_object_allocator=yes`.
+//
+// Every thread keeps a free list per size class, so allocating and freeing
+// don't touch any shared state most of the time. Blocks freed by a thread are
+// kept in that thread's cache regardless of which thread allocated them, and
+// are handed back to the shared pool of their size class in batches once the
+// cache holds too many. Chunks backing the pools are never released.
+//
+// Chunks are aligned to their size and each one only serves a single size
+// class, which is recorded per chunk. Blocks therefore carry no header: the
+// size class of a block is found from its address alone.
+
+class SmallObjectAllocator {
+public:
+	static constexpr uint32_t SIZE_CLASS_COUNT = 16;
+	static constexpr uint32_t INVALID_SIZE_CLASS = SIZE_CLASS_COUNT;
+	static constexpr size_t MAX_BLOCK_SIZE = 512;
+
+	struct SizeClassStats {
+		size_t block_size = 0;
+		uint64_t reserved_blocks = 0;
+		// Blocks currently allocated. Approximate, threads only report
+		// their allocations when exchanging blocks with the shared pool.
+		uint64_t used_blocks = 0;
+	};
+
+	// Size classes are 16 bytes apart up to 128 bytes, 32 bytes apart up to
+	// 256 bytes and 64 bytes apart up to MAX_BLOCK_SIZE.
+	static _FORCE_INLINE_ uint32_t get_size_class(size_t p_bytes) {
+		if (p_bytes <= 128) {
+			return p_bytes == 0 ? 0 : (uint32_t)((p_bytes - 1) >> 4);
+		} else if (p_bytes <= 256) {
+			return 8 + (uint32_t)((p_bytes - 129) >> 5);
+		} else if (p_bytes <= MAX_BLOCK_SIZE) {
+			return 12 + (uint32_t)((p_bytes - 257) >> 6);
+		}
+		return INVALID_SIZE_CLASS;
+	}
+
+	static _FORCE_INLINE_ size_t get_block_size(uint32_t p_size_class) {
+		if (p_size_class < 8) {
+			return (p_size_class + 1) << 4;
+		} else if (p_size_class < 12) {
+			return 128 + ((p_size_class - 7) << 5);
+		}
+		return 256 + ((p_size_class - 11) << 6);
+	}
+
+	// Returns nullptr if no memory could be reserved for the size class.
+	static void *alloc(uint32_t p_size_class);
+	static void free(void *p_ptr, uint32_t p_size_class);
+
+	// Returns the size class of a block returned by alloc(), or
+	// INVALID_SIZE_CLASS if the pointer wasn't allocated here.
+	static uint32_t get_pointer_size_class(const void *p_ptr);
+
+	static void get_stats(SizeClassStats r_stats[SIZE_CLASS_COUNT]);
+};
+
+#endif // SMALL_OBJECT_ALLOCATOR_H
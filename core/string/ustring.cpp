@@ -1731,7 +1731,44 @@ String String::to_lower() const {
 	return lower;
 }
 
+// Strings made of a single Latin-1 character share static buffers that are
+// never freed, so creating them (e.g. when iterating over a String or
+// splitting it into characters) doesn't allocate.
+// Copies still update the shared reference count, so each buffer gets its own
+// cache line (16 KiB in total) to keep threads using different characters from
+// contending. Threads hammering the same character still share its line.
+String String::_single_char_string(char32_t p_char) {
+	typedef CowData<char32_t> CD;
+	static constexpr size_t BUFFER_SIZE = 64;
+	static_assert(CD::DATA_OFFSET + 2 * sizeof(char32_t) <= BUFFER_SIZE);
+
+	struct SingleCharBuffers {
+		alignas(64) uint8_t data[256][BUFFER_SIZE];
+
+		SingleCharBuffers() {
+			for (int i = 0; i < 256; i++) {
+				// The reference count never drops to zero, and writing triggers a copy.
+				new (CD::_get_refcount_ptr(data[i])) SafeNumeric<CD::USize>(CD::MAX_INT / 2);
+				*CD::_get_size_ptr(data[i]) = 2;
+				char32_t *chars = CD::_get_data_ptr(data[i]);
+				chars[0] = i;
+				chars[1] = 0;
+			}
+		}
+	};
+	static SingleCharBuffers buffers;
+
+	DEV_ASSERT(p_char > 0 && p_char < 256);
+	String s;
+	s._cowdata._ptr = CD::_get_data_ptr(buffers.data[p_char]);
+	s._cowdata._get_refcount()->increment();
+	return s;
+}
+
 String String::chr(char32_t p_char) {
+	if (p_char > 0 && p_char < 256) {
+		return _single_char_string(p_char);
+	}
 	char32_t c[2] = { p_char, 0 };
 	return String(c);
 }
@@ -3256,6 +3293,10 @@ String String::substr(int p_from, int p_chars) const {
 		return String(*this);
 	}
 
+	if (p_chars == 1 && get_data()[p_from] > 0 && get_data()[p_from] < 256) {
+		return _single_char_string(get_data()[p_from]);
+	}
+
 	String s;
 	s.copy_from_unchecked(&get_data()[p_from], p_chars);
 	return s;
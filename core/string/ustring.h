@@ -196,6 +196,8 @@ class String {
 
 	void copy_from_unchecked(const char32_t *p_char, const int p_length);
 
+	static String _single_char_string(char32_t p_char);
+
 	bool _base_is_subsequence_of(const String &p_string, bool case_insensitive) const;
 	int _count(const String &p_string, int p_from, int p_to, bool p_case_insensitive) const;
 	int _count(const char *p_string, int p_from, int p_to, bool p_case_insensitive) const;
@@ -0,0 +1,739 @@
+/**************************************************************************/
+/*  a_hash_map.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef A_HASH_MAP_H
+#define A_HASH_MAP_H
+
+#include "core/os/memory.h"
+#include "core/templates/hashfuncs.h"
+#include "core/templates/pair.h"
+
+/**
+ * An array-based HashMap, with the same API as HashMap.
+ *
+ * Keys and values are stored by insertion order in a single contiguous array,
+ * and an open addressing index table (using Robin Hood hashing and backward
+ * shift deletion, like HashMap) maps hashes to positions in that array. Lookups
+ * touch the index table plus a single entry, and iterating walks linear memory,
+ * which is much friendlier to the cache than HashMap's linked list of
+ * individually allocated elements.
+ *
+ * Erasing leaves a hole in the entry array, so insertion order is preserved;
+ * holes are reclaimed when the array has to grow.
+ *
+ * Unlike HashMap, entries are relocated when the map grows, so pointers and
+ * references to keys and values (as returned by getptr() and operator[]) are
+ * invalidated by inserting. Iterators store an index instead, so they survive
+ * insertion and erasure of other entries, but entries may be skipped if the
+ * array is compacted while iterating. Inserting at the front is O(n).
+ *
+ * Entries are relocated bitwise, the same way LocalVector and CowData move
+ * their elements.
+ *
+ * The assignment operator copy the pairs from one map to the other.
+ */
+
+template <typename TKey, typename TValue,
+		typename Hasher = HashMapHasherDefault,
+		typename Comparator = HashMapComparatorDefault<TKey>>
+class AHashMap {
+public:
+	static constexpr uint32_t MIN_CAPACITY_INDEX = 2; // Use a prime.
+	static constexpr float MAX_OCCUPANCY = 0.75;
+	static constexpr uint32_t EMPTY_HASH = 0;
+	static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+private:
+	struct Metadata {
+		uint32_t hash = EMPTY_HASH;
+		uint32_t element_index = 0;
+	};
+
+	// Entries by insertion order, including erased ones up to `used_elements`.
+	KeyValue<TKey, TValue> *elements = nullptr;
+	// Hash of each entry in `elements`, EMPTY_HASH for erased ones.
+	uint32_t *element_hashes = nullptr;
+	// Open addressing table pointing into `elements`.
+	Metadata *metadata = nullptr;
+
+	uint32_t capacity_index = 0;
+	uint32_t num_elements = 0;
+	uint32_t used_elements = 0;
+
+	_FORCE_INLINE_ uint32_t _hash(const TKey &p_key) const {
+		uint32_t hash = Hasher::hash(p_key);
+
+		if (unlikely(hash == EMPTY_HASH)) {
+			hash = EMPTY_HASH + 1;
+		}
+
+		return hash;
+	}
+
+	static _FORCE_INLINE_ uint32_t _get_element_capacity(uint32_t p_capacity_index) {
+		return (uint32_t)(hash_table_size_primes[p_capacity_index] * MAX_OCCUPANCY);
+	}
+
+	static _FORCE_INLINE_ uint32_t _get_probe_length(const uint32_t p_pos, const uint32_t p_hash, const uint32_t p_capacity, const uint64_t p_capacity_inv) {
+		const uint32_t original_pos = fastmod(p_hash, p_capacity_inv, p_capacity);
+		return fastmod(p_pos - original_pos + p_capacity, p_capacity_inv, p_capacity);
+	}
+
+	bool _lookup_pos(const TKey &p_key, uint32_t &r_pos) const {
+		if (metadata == nullptr || num_elements == 0) {
+			return false; // Failed lookups, no elements
+		}
+
+		const uint32_t capacity = hash_table_size_primes[capacity_index];
+		const uint64_t capacity_inv = hash_table_size_primes_inv[capacity_index];
+		uint32_t hash = _hash(p_key);
+		uint32_t pos = fastmod(hash, capacity_inv, capacity);
+		uint32_t distance = 0;
+
+		while (true) {
+			const Metadata &m = metadata[pos];
+			if (m.hash == EMPTY_HASH) {
+				return false;
+			}
+
+			if (distance > _get_probe_length(pos, m.hash, capacity, capacity_inv)) {
+				return false;
+			}
+
+			if (m.hash == hash && Comparator::compare(elements[m.element_index].key, p_key)) {
+				r_pos = pos;
+				return true;
+			}
+
+			pos = fastmod((pos + 1), capacity_inv, capacity);
+			distance++;
+		}
+	}
+
+	void _insert_metadata(uint32_t p_hash, uint32_t p_element_index) {
+		const uint32_t capacity = hash_table_size_primes[capacity_index];
+		const uint64_t capacity_inv = hash_table_size_primes_inv[capacity_index];
+		Metadata m;
+		m.hash = p_hash;
+		m.element_index = p_element_index;
+		uint32_t distance = 0;
+		uint32_t pos = fastmod(p_hash, capacity_inv, capacity);
+
+		while (true) {
+			if (metadata[pos].hash == EMPTY_HASH) {
+				metadata[pos] = m;
+				return;
+			}
+
+			// Not an empty slot, let's check the probing length of the existing one.
+			uint32_t existing_probe_len = _get_probe_length(pos, metadata[pos].hash, capacity, capacity_inv);
+			if (existing_probe_len < distance) {
+				SWAP(m, metadata[pos]);
+				distance = existing_probe_len;
+			}
+
+			pos = fastmod((pos + 1), capacity_inv, capacity);
+			distance++;
+		}
+	}
+
+	void _erase_metadata(uint32_t p_pos) {
+		const uint32_t capacity = hash_table_size_primes[capacity_index];
+		const uint64_t capacity_inv = hash_table_size_primes_inv[capacity_index];
+		uint32_t pos = p_pos;
+		uint32_t next_pos = fastmod((pos + 1), capacity_inv, capacity);
+		while (metadata[next_pos].hash != EMPTY_HASH && _get_probe_length(next_pos, metadata[next_pos].hash, capacity, capacity_inv) != 0) {
+			SWAP(metadata[next_pos], metadata[pos]);
+			pos = next_pos;
+			next_pos = fastmod((pos + 1), capacity_inv, capacity);
+		}
+
+		metadata[pos].hash = EMPTY_HASH;
+	}
+
+	void _rebuild_metadata() {
+		const uint32_t capacity = hash_table_size_primes[capacity_index];
+		for (uint32_t i = 0; i < capacity; i++) {
+			metadata[i].hash = EMPTY_HASH;
+		}
+		for (uint32_t i = 0; i < used_elements; i++) {
+			_insert_metadata(element_hashes[i], i);
+		}
+	}
+
+	// Moves the live entries to the start of the array, keeping their order.
+	void _compact() {
+		uint32_t dst = 0;
+		for (uint32_t i = 0; i < used_elements; i++) {
+			if (element_hashes[i] == EMPTY_HASH) {
+				continue;
+			}
+			if (i != dst) {
+				memcpy((void *)&elements[dst], (const void *)&elements[i], sizeof(KeyValue<TKey, TValue>));
+				element_hashes[dst] = element_hashes[i];
+			}
+			dst++;
+		}
+		used_elements = dst;
+	}
+
+	void _allocate(uint32_t p_capacity_index) {
+		const uint32_t capacity = hash_table_size_primes[p_capacity_index];
+		metadata = reinterpret_cast<Metadata *>(Memory::alloc_static(sizeof(Metadata) * capacity));
+		for (uint32_t i = 0; i < capacity; i++) {
+			metadata[i].hash = EMPTY_HASH;
+		}
+
+		const uint32_t element_capacity = _get_element_capacity(p_capacity_index);
+		elements = reinterpret_cast<KeyValue<TKey, TValue> *>(Memory::alloc_static(sizeof(KeyValue<TKey, TValue>) * element_capacity));
+		element_hashes = reinterpret_cast<uint32_t *>(Memory::alloc_static(sizeof(uint32_t) * element_capacity));
+	}
+
+	void _resize_and_rehash(uint32_t p_new_capacity_index) {
+		// Capacity can't be 0.
+		p_new_capacity_index = MAX((uint32_t)MIN_CAPACITY_INDEX, p_new_capacity_index);
+
+		if (metadata == nullptr) {
+			capacity_index = p_new_capacity_index;
+			_allocate(capacity_index);
+			return;
+		}
+
+		_compact();
+
+		Metadata *old_metadata = metadata;
+		KeyValue<TKey, TValue> *old_elements = elements;
+		uint32_t *old_element_hashes = element_hashes;
+
+		capacity_index = p_new_capacity_index;
+		_allocate(capacity_index);
+
+		if (used_elements > 0) {
+			memcpy((void *)elements, (const void *)old_elements, sizeof(KeyValue<TKey, TValue>) * used_elements);
+			memcpy(element_hashes, old_element_hashes, sizeof(uint32_t) * used_elements);
+		}
+
+		for (uint32_t i = 0; i < used_elements; i++) {
+			_insert_metadata(element_hashes[i], i);
+		}
+
+		Memory::free_static(old_metadata);
+		Memory::free_static(old_elements);
+		Memory::free_static(old_element_hashes);
+	}
+
+	// Makes room for one more entry at the end of the array, reusing the holes
+	// left by erased entries when there are enough of them.
+	bool _make_room() {
+		if (metadata == nullptr) {
+			_resize_and_rehash(capacity_index);
+			return true;
+		}
+
+		if (used_elements < _get_element_capacity(capacity_index)) {
+			return true;
+		}
+
+		if (used_elements - num_elements >= used_elements / 4 + 1) {
+			_compact();
+			_rebuild_metadata();
+			return true;
+		}
+
+		ERR_FAIL_COND_V_MSG(capacity_index + 1 == HASH_TABLE_SIZE_MAX, false, "Hash table maximum capacity reached, aborting insertion.");
+		_resize_and_rehash(capacity_index + 1);
+		return true;
+	}
+
+	uint32_t _insert_element(const TKey &p_key, const TValue &p_value, uint32_t p_hash, bool p_front_insert) {
+		uint32_t index = used_elements;
+
+		if (p_front_insert && used_elements > 0) {
+			// Shift every entry up by one, then fix the indices in the table.
+			memmove((void *)&elements[1], (const void *)&elements[0], sizeof(KeyValue<TKey, TValue>) * used_elements);
+			memmove(&element_hashes[1], &element_hashes[0], sizeof(uint32_t) * used_elements);
+			const uint32_t capacity = hash_table_size_primes[capacity_index];
+			for (uint32_t i = 0; i < capacity; i++) {
+				if (metadata[i].hash != EMPTY_HASH) {
+					metadata[i].element_index++;
+				}
+			}
+			index = 0;
+		}
+
+		new (&elements[index]) KeyValue<TKey, TValue>(p_key, p_value);
+		element_hashes[index] = p_hash;
+		used_elements++;
+		num_elements++;
+
+		_insert_metadata(p_hash, index);
+		return index;
+	}
+
+	uint32_t _insert(const TKey &p_key, const TValue &p_value, bool p_front_insert = false) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+
+		if (exists) {
+			uint32_t index = metadata[pos].element_index;
+			elements[index].value = p_value;
+			return index;
+		}
+
+		uint32_t hash = _hash(p_key);
+
+		const bool needs_room = metadata == nullptr || used_elements == _get_element_capacity(capacity_index);
+		if (needs_room || (p_front_insert && used_elements > 0)) {
+			// The key and value may be stored in this map, copy them before moving the entries.
+			const KeyValue<TKey, TValue> kv(p_key, p_value);
+			if (needs_room && !_make_room()) {
+				return INVALID_INDEX;
+			}
+			return _insert_element(kv.key, kv.value, hash, p_front_insert);
+		}
+
+		return _insert_element(p_key, p_value, hash, p_front_insert);
+	}
+
+	_FORCE_INLINE_ uint32_t _next_index(uint32_t p_index) const {
+		for (uint32_t i = p_index + 1; i < used_elements; i++) {
+			if (element_hashes[i] != EMPTY_HASH) {
+				return i;
+			}
+		}
+		return INVALID_INDEX;
+	}
+
+	_FORCE_INLINE_ uint32_t _prev_index(uint32_t p_index) const {
+		for (uint32_t i = MIN(p_index, used_elements); i > 0; i--) {
+			if (element_hashes[i - 1] != EMPTY_HASH) {
+				return i - 1;
+			}
+		}
+		return INVALID_INDEX;
+	}
+
+	_FORCE_INLINE_ uint32_t _first_index() const {
+		return num_elements == 0 ? INVALID_INDEX : _next_index(INVALID_INDEX);
+	}
+
+	_FORCE_INLINE_ uint32_t _last_index() const {
+		return num_elements == 0 ? INVALID_INDEX : _prev_index(used_elements);
+	}
+
+public:
+	_FORCE_INLINE_ uint32_t get_capacity() const { return hash_table_size_primes[capacity_index]; }
+	_FORCE_INLINE_ uint32_t size() const { return num_elements; }
+
+	/* Standard Godot Container API */
+
+	bool is_empty() const {
+		return num_elements == 0;
+	}
+
+	void clear() {
+		if (metadata == nullptr || used_elements == 0) {
+			return;
+		}
+		const uint32_t capacity = hash_table_size_primes[capacity_index];
+		for (uint32_t i = 0; i < capacity; i++) {
+			metadata[i].hash = EMPTY_HASH;
+		}
+
+		for (uint32_t i = 0; i < used_elements; i++) {
+			if (element_hashes[i] != EMPTY_HASH) {
+				elements[i].~KeyValue<TKey, TValue>();
+			}
+		}
+
+		num_elements = 0;
+		used_elements = 0;
+	}
+
+	TValue &get(const TKey &p_key) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND_MSG(!exists, "AHashMap key not found.");
+		return elements[metadata[pos].element_index].value;
+	}
+
+	const TValue &get(const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND_MSG(!exists, "AHashMap key not found.");
+		return elements[metadata[pos].element_index].value;
+	}
+
+	const TValue *getptr(const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+
+		if (exists) {
+			return &elements[metadata[pos].element_index].value;
+		}
+		return nullptr;
+	}
+
+	TValue *getptr(const TKey &p_key) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+
+		if (exists) {
+			return &elements[metadata[pos].element_index].value;
+		}
+		return nullptr;
+	}
+
+	_FORCE_INLINE_ bool has(const TKey &p_key) const {
+		uint32_t _pos = 0;
+		return _lookup_pos(p_key, _pos);
+	}
+
+	bool erase(const TKey &p_key) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+
+		if (!exists) {
+			return false;
+		}
+
+		uint32_t index = metadata[pos].element_index;
+		_erase_metadata(pos);
+
+		elements[index].~KeyValue<TKey, TValue>();
+		element_hashes[index] = EMPTY_HASH;
+		num_elements--;
+
+		if (num_elements == 0) {
+			used_elements = 0;
+		} else {
+			// Trailing holes can be reused right away.
+			while (used_elements > 0 && element_hashes[used_elements - 1] == EMPTY_HASH) {
+				used_elements--;
+			}
+		}
+
+		return true;
+	}
+
+	// Replace the key of an entry in-place, without invalidating iterators or changing the entries position during iteration.
+	// p_old_key must exist in the map and p_new_key must not, unless it is equal to p_old_key.
+	bool replace_key(const TKey &p_old_key, const TKey &p_new_key) {
+		if (p_old_key == p_new_key) {
+			return true;
+		}
+		uint32_t pos = 0;
+		ERR_FAIL_COND_V(_lookup_pos(p_new_key, pos), false);
+		ERR_FAIL_COND_V(!_lookup_pos(p_old_key, pos), false);
+		uint32_t index = metadata[pos].element_index;
+		_erase_metadata(pos);
+
+		const_cast<TKey &>(elements[index].key) = p_new_key;
+		uint32_t hash = _hash(p_new_key);
+		element_hashes[index] = hash;
+		_insert_metadata(hash, index);
+
+		return true;
+	}
+
+	// Reserves space for a number of elements, useful to avoid many resizes and rehashes.
+	// If adding a known (possibly large) number of elements at once, must be larger than old capacity.
+	void reserve(uint32_t p_new_capacity) {
+		uint32_t new_index = capacity_index;
+
+		while (hash_table_size_primes[new_index] < p_new_capacity) {
+			ERR_FAIL_COND_MSG(new_index + 1 == (uint32_t)HASH_TABLE_SIZE_MAX, nullptr);
+			new_index++;
+		}
+
+		if (new_index == capacity_index) {
+			return;
+		}
+
+		if (metadata == nullptr) {
+			capacity_index = new_index;
+			return; // Unallocated yet.
+		}
+		_resize_and_rehash(new_index);
+	}
+
+	/** Iterator API **/
+
+	struct ConstIterator {
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> &operator*() const {
+			return map->elements[index];
+		}
+		_FORCE_INLINE_ const KeyValue<TKey, TValue> *operator->() const { return &map->elements[index]; }
+		_FORCE_INLINE_ ConstIterator &operator++() {
+			if (map) {
+				index = map->_next_index(index);
+				if (index == INVALID_INDEX) {
+					map = nullptr;
+				}
+			}
+			return *this;
+		}
+		_FORCE_INLINE_ ConstIterator &operator--() {
+			if (map) {
+				index = map->_prev_index(index);
+				if (index == INVALID_INDEX) {
+					map = nullptr;
+				}
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const ConstIterator &b) const { return map == b.map && (map == nullptr || index == b.index); }
+		_FORCE_INLINE_ bool operator!=(const ConstIterator &b) const { return !(*this == b); }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return map != nullptr;
+		}
+
+		_FORCE_INLINE_ ConstIterator(const AHashMap *p_map, uint32_t p_index) {
+			if (p_index != INVALID_INDEX) {
+				map = p_map;
+				index = p_index;
+			}
+		}
+		_FORCE_INLINE_ ConstIterator() {}
+		_FORCE_INLINE_ ConstIterator(const ConstIterator &p_it) {
+			map = p_it.map;
+			index = p_it.index;
+		}
+		_FORCE_INLINE_ void operator=(const ConstIterator &p_it) {
+			map = p_it.map;
+			index = p_it.index;
+		}
+
+	private:
+		const AHashMap *map = nullptr;
+		uint32_t index = 0;
+	};
+
+	struct Iterator {
+		_FORCE_INLINE_ KeyValue<TKey, TValue> &operator*() const {
+			return map->elements[index];
+		}
+		_FORCE_INLINE_ KeyValue<TKey, TValue> *operator->() const { return &map->elements[index]; }
+		_FORCE_INLINE_ Iterator &operator++() {
+			if (map) {
+				index = map->_next_index(index);
+				if (index == INVALID_INDEX) {
+					map = nullptr;
+				}
+			}
+			return *this;
+		}
+		_FORCE_INLINE_ Iterator &operator--() {
+			if (map) {
+				index = map->_prev_index(index);
+				if (index == INVALID_INDEX) {
+					map = nullptr;
+				}
+			}
+			return *this;
+		}
+
+		_FORCE_INLINE_ bool operator==(const Iterator &b) const { return map == b.map && (map == nullptr || index == b.index); }
+		_FORCE_INLINE_ bool operator!=(const Iterator &b) const { return !(*this == b); }
+
+		_FORCE_INLINE_ explicit operator bool() const {
+			return map != nullptr;
+		}
+
+		_FORCE_INLINE_ Iterator(AHashMap *p_map, uint32_t p_index) {
+			if (p_index != INVALID_INDEX) {
+				map = p_map;
+				index = p_index;
+			}
+		}
+		_FORCE_INLINE_ Iterator() {}
+		_FORCE_INLINE_ Iterator(const Iterator &p_it) {
+			map = p_it.map;
+			index = p_it.index;
+		}
+		_FORCE_INLINE_ void operator=(const Iterator &p_it) {
+			map = p_it.map;
+			index = p_it.index;
+		}
+
+		operator ConstIterator() const {
+			return ConstIterator(map, map ? index : INVALID_INDEX);
+		}
+
+	private:
+		AHashMap *map = nullptr;
+		uint32_t index = 0;
+	};
+
+	_FORCE_INLINE_ Iterator begin() {
+		return Iterator(this, _first_index());
+	}
+	_FORCE_INLINE_ Iterator end() {
+		return Iterator();
+	}
+	_FORCE_INLINE_ Iterator last() {
+		return Iterator(this, _last_index());
+	}
+
+	_FORCE_INLINE_ Iterator find(const TKey &p_key) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		if (!exists) {
+			return end();
+		}
+		return Iterator(this, metadata[pos].element_index);
+	}
+
+	_FORCE_INLINE_ void remove(const Iterator &p_iter) {
+		if (p_iter) {
+			erase(p_iter->key);
+		}
+	}
+
+	_FORCE_INLINE_ ConstIterator begin() const {
+		return ConstIterator(this, _first_index());
+	}
+	_FORCE_INLINE_ ConstIterator end() const {
+		return ConstIterator();
+	}
+	_FORCE_INLINE_ ConstIterator last() const {
+		return ConstIterator(this, _last_index());
+	}
+
+	_FORCE_INLINE_ ConstIterator find(const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		if (!exists) {
+			return end();
+		}
+		return ConstIterator(this, metadata[pos].element_index);
+	}
+
+	/* Indexing */
+
+	const TValue &operator[](const TKey &p_key) const {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		CRASH_COND(!exists);
+		return elements[metadata[pos].element_index].value;
+	}
+
+	TValue &operator[](const TKey &p_key) {
+		uint32_t pos = 0;
+		bool exists = _lookup_pos(p_key, pos);
+		if (!exists) {
+			uint32_t index = _insert(p_key, TValue());
+			CRASH_COND(index == INVALID_INDEX);
+			return elements[index].value;
+		} else {
+			return elements[metadata[pos].element_index].value;
+		}
+	}
+
+	/* Insert */
+
+	Iterator insert(const TKey &p_key, const TValue &p_value, bool p_front_insert = false) {
+		return Iterator(this, _insert(p_key, p_value, p_front_insert));
+	}
+
+	/* Constructors */
+
+	AHashMap(const AHashMap &p_other) {
+		capacity_index = p_other.capacity_index;
+
+		if (p_other.num_elements == 0) {
+			return;
+		}
+
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			insert(E.key, E.value);
+		}
+	}
+
+	void operator=(const AHashMap &p_other) {
+		if (this == &p_other) {
+			return; // Ignore self assignment.
+		}
+		if (num_elements != 0) {
+			clear();
+		}
+
+		reserve(hash_table_size_primes[p_other.capacity_index]);
+
+		if (p_other.num_elements == 0) {
+			return; // Nothing to copy.
+		}
+
+		for (const KeyValue<TKey, TValue> &E : p_other) {
+			insert(E.key, E.value);
+		}
+	}
+
+	AHashMap(uint32_t p_initial_capacity) {
+		// Capacity can't be 0.
+		capacity_index = 0;
+		reserve(p_initial_capacity);
+	}
+	AHashMap() {
+		capacity_index = MIN_CAPACITY_INDEX;
+	}
+
+	uint32_t debug_get_hash(uint32_t p_index) {
+		if (num_elements == 0) {
+			return 0;
+		}
+		ERR_FAIL_INDEX_V(p_index, get_capacity(), 0);
+		return metadata[p_index].hash;
+	}
+	Iterator debug_get_element(uint32_t p_index) {
+		if (num_elements == 0) {
+			return Iterator();
+		}
+		ERR_FAIL_INDEX_V(p_index, get_capacity(), Iterator());
+		if (metadata[p_index].hash == EMPTY_HASH) {
+			return Iterator();
+		}
+		return Iterator(this, metadata[p_index].element_index);
+	}
+
+	~AHashMap() {
+		clear();
+
+		if (metadata != nullptr) {
+			Memory::free_static(metadata);
+			Memory::free_static(elements);
+			Memory::free_static(element_hashes);
+		}
+	}
+};
+
+#endif // A_HASH_MAP_H
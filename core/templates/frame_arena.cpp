@@ -0,0 +1,232 @@
+/**************************************************************************/
+/*  frame_arena.cpp                                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "frame_arena.h"
+
+#include "core/templates/safe_refcount.h"
+
+static constexpr size_t ARENA_ALIGNMENT = alignof(max_align_t);
+
+static _FORCE_INLINE_ size_t _arena_align(size_t p_size) {
+	return (p_size + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1);
+}
+
+struct FrameArenaChunk {
+	FrameArenaChunk *prev = nullptr;
+	size_t size = 0;
+	size_t used = 0;
+
+	_FORCE_INLINE_ uint8_t *get_data() { return (uint8_t *)this + _arena_align(sizeof(FrameArenaChunk)); }
+};
+
+struct FrameArenaThread;
+
+struct FrameArenaBlock {
+	FrameArenaThread *arena = nullptr;
+	size_t size = 0;
+};
+
+static constexpr size_t CHUNK_HEADER_SIZE = (sizeof(FrameArenaChunk) + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1);
+static constexpr size_t BLOCK_HEADER_SIZE = (sizeof(FrameArenaBlock) + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1);
+
+static SafeNumeric<uint64_t> current_frame;
+static SafeNumeric<uint64_t> frame_allocations;
+static SafeNumeric<uint64_t> frame_chunk_allocations;
+static FrameArena::Stats last_frame_stats;
+
+struct FrameArenaThread {
+	FrameArenaChunk *chunk = nullptr;
+	uint32_t live_blocks = 0;
+	// Size to use for the next chunk, so that it holds everything the previous chunks held.
+	size_t next_chunk_size = 0;
+	size_t frame_peak = 0;
+	uint64_t frame = 0;
+	uint64_t allocations = 0;
+	uint64_t chunk_allocations = 0;
+
+	FrameArenaChunk *add_chunk(size_t p_min_size) {
+		const size_t size = MAX(MAX(FrameArena::CHUNK_SIZE, next_chunk_size), p_min_size);
+		FrameArenaChunk *new_chunk = (FrameArenaChunk *)Memory::alloc_static(CHUNK_HEADER_SIZE + size);
+		ERR_FAIL_NULL_V(new_chunk, nullptr);
+		memnew_placement(new_chunk, FrameArenaChunk);
+		new_chunk->prev = chunk;
+		new_chunk->size = size;
+		chunk = new_chunk;
+		next_chunk_size = 0;
+		chunk_allocations++;
+		return new_chunk;
+	}
+
+	void free_chunks() {
+		while (chunk) {
+			FrameArenaChunk *prev = chunk->prev;
+			Memory::free_static(chunk);
+			chunk = prev;
+		}
+	}
+
+	// Called when the last live block is freed.
+	void rewind() {
+		if (chunk->prev) {
+			size_t total_size = 0;
+			for (FrameArenaChunk *E = chunk; E; E = E->prev) {
+				total_size += E->size;
+			}
+			free_chunks();
+			next_chunk_size = total_size;
+		} else {
+			frame_peak = MAX(frame_peak, chunk->used);
+			chunk->used = 0;
+		}
+
+		const uint64_t global_frame = current_frame.get();
+		if (frame != global_frame) {
+			// Give memory back if this thread needed much less than its chunk during the last frame.
+			if (chunk && chunk->size > FrameArena::CHUNK_SIZE && frame_peak < chunk->size / 4) {
+				next_chunk_size = frame_peak;
+				free_chunks();
+			}
+			frame_peak = 0;
+			frame = global_frame;
+		}
+
+		frame_allocations.add(allocations);
+		frame_chunk_allocations.add(chunk_allocations);
+		allocations = 0;
+		chunk_allocations = 0;
+	}
+
+	~FrameArenaThread() {
+		if (live_blocks == 0) {
+			free_chunks();
+		}
+	}
+};
+
+static thread_local FrameArenaThread thread_arena;
+
+void *FrameArena::alloc(size_t p_bytes) {
+	FrameArenaThread &arena = thread_arena;
+	const size_t size = BLOCK_HEADER_SIZE + _arena_align(p_bytes);
+
+	FrameArenaChunk *chunk = arena.chunk;
+	if (unlikely(chunk == nullptr || chunk->size - chunk->used < size)) {
+		chunk = arena.add_chunk(size);
+		if (chunk == nullptr) {
+			return nullptr;
+		}
+	}
+
+	uint8_t *block = chunk->get_data() + chunk->used;
+	chunk->used += size;
+
+	FrameArenaBlock *header = (FrameArenaBlock *)block;
+	header->arena = &arena;
+	header->size = p_bytes;
+
+	arena.live_blocks++;
+	arena.allocations++;
+	return block + BLOCK_HEADER_SIZE;
+}
+
+void *FrameArena::realloc(void *p_ptr, size_t p_bytes) {
+	if (p_ptr == nullptr) {
+		return alloc(p_bytes);
+	}
+	if (p_bytes == 0) {
+		free(p_ptr);
+		return nullptr;
+	}
+
+	FrameArenaThread &arena = thread_arena;
+	uint8_t *block = (uint8_t *)p_ptr - BLOCK_HEADER_SIZE;
+	FrameArenaBlock *header = (FrameArenaBlock *)block;
+	ERR_FAIL_COND_V_MSG(header->arena != &arena, nullptr, "FrameArena memory must be reallocated by the thread that allocated it.");
+
+	// Grow or shrink in place if this is the most recent block.
+	FrameArenaChunk *chunk = arena.chunk;
+	const size_t old_size = BLOCK_HEADER_SIZE + _arena_align(header->size);
+	const size_t new_size = BLOCK_HEADER_SIZE + _arena_align(p_bytes);
+	if (block + old_size == chunk->get_data() + chunk->used && chunk->size - (chunk->used - old_size) >= new_size) {
+		chunk->used = chunk->used - old_size + new_size;
+		header->size = p_bytes;
+		return p_ptr;
+	}
+
+	void *new_ptr = alloc(p_bytes);
+	if (new_ptr == nullptr) {
+		return nullptr;
+	}
+	memcpy(new_ptr, p_ptr, MIN(header->size, p_bytes));
+	free(p_ptr);
+	return new_ptr;
+}
+
+void FrameArena::free(void *p_ptr) {
+	FrameArenaThread &arena = thread_arena;
+	uint8_t *block = (uint8_t *)p_ptr - BLOCK_HEADER_SIZE;
+	FrameArenaBlock *header = (FrameArenaBlock *)block;
+	ERR_FAIL_COND_MSG(header->arena != &arena, "FrameArena memory must be freed by the thread that allocated it.");
+
+	FrameArenaChunk *chunk = arena.chunk;
+	const size_t size = BLOCK_HEADER_SIZE + _arena_align(header->size);
+	if (block + size == chunk->get_data() + chunk->used) {
+		arena.frame_peak = MAX(arena.frame_peak, chunk->used);
+		chunk->used -= size;
+	}
+
+	arena.live_blocks--;
+	if (arena.live_blocks == 0) {
+		arena.rewind();
+	}
+}
+
+void FrameArena::end_frame() {
+#ifdef DEBUG_ENABLED
+	if (thread_arena.live_blocks > 0) {
+		WARN_PRINT_ONCE("FrameArena blocks are still allocated at the end of the frame on the main thread, they must be freed within the frame.");
+	}
+#endif
+
+	last_frame_stats.allocations = frame_allocations.get();
+	frame_allocations.sub(last_frame_stats.allocations);
+	last_frame_stats.chunk_allocations = frame_chunk_allocations.get();
+	frame_chunk_allocations.sub(last_frame_stats.chunk_allocations);
+
+	current_frame.increment();
+}
+
+uint64_t FrameArena::get_frame() {
+	return current_frame.get();
+}
+
+FrameArena::Stats FrameArena::get_last_frame_stats() {
+	return last_frame_stats;
+}
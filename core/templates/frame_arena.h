@@ -0,0 +1,84 @@
+/**************************************************************************/
+/*  frame_arena.h                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef FRAME_ARENA_H
+#define FRAME_ARENA_H
+
+#include "core/os/memory.h"
+#include "core/templates/local_vector.h"
+
+// Per-thread bump allocator for transient buffers, such as scratch vectors
+// that are filled and dropped within a single call.
+//
+// Allocating bumps a pointer in a chunk owned by the calling thread. Freeing
+// the most recent block gives its memory back right away, and once every
+// block of a thread is freed, its chunks are rewound at once. A thread that
+// needed several chunks gets a single one big enough for all of them next
+// time, and chunks that turn out to be much larger than what a thread used
+// over a whole frame are released again.
+//
+// Memory must be freed by the thread that allocated it, and before the end
+// of the frame, otherwise the arena of that thread can't be rewound.
+//
+// FrameArena can be used as the allocator of LocalVector (see
+// FrameLocalVector), List and RBMap, and FrameArenaTypedAllocator as the
+// element allocator of HashMap.
+class FrameArena {
+public:
+	static constexpr size_t CHUNK_SIZE = 64 * 1024;
+
+	struct Stats {
+		uint64_t allocations = 0; // Blocks served by the arenas.
+		uint64_t chunk_allocations = 0; // Chunks allocated by the arenas, the only allocations reaching Memory.
+	};
+
+	static void *alloc(size_t p_bytes);
+	static void *realloc(void *p_ptr, size_t p_bytes);
+	static void free(void *p_ptr);
+
+	// Marks a frame boundary, called once per frame by Main::iteration().
+	static void end_frame();
+	static uint64_t get_frame();
+	// Statistics of the last frame, threads report theirs whenever their arena is rewound.
+	static Stats get_last_frame_stats();
+};
+
+template <typename T>
+class FrameArenaTypedAllocator {
+public:
+	template <typename... Args>
+	_FORCE_INLINE_ T *new_allocation(const Args &&...p_args) { return memnew_allocator(T(p_args...), FrameArena); }
+	_FORCE_INLINE_ void delete_allocation(T *p_allocation) { memdelete_allocator<T, FrameArena>(p_allocation); }
+};
+
+template <typename T, typename U = uint32_t, bool force_trivial = false>
+using FrameLocalVector = LocalVector<T, U, force_trivial, false, FrameArena>;
+
+#endif // FRAME_ARENA_H
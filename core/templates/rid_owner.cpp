@@ -30,4 +30,16 @@
 
 #include "rid_owner.h"
 
+#include "core/object/worker_thread_pool.h"
+
 SafeNumeric<uint64_t> RID_AllocBase::base_id{ 1 };
+
+bool RID_AllocBase::_run_parallel(void (*p_function)(void *, uint32_t), void *p_userdata, uint32_t p_count) {
+	WorkerThreadPool *pool = WorkerThreadPool::get_singleton();
+	if (!pool) {
+		return false;
+	}
+	WorkerThreadPool::GroupID group_task = pool->add_native_group_task(p_function, p_userdata, p_count, -1, true, String("RIDForEachOwned"));
+	pool->wait_for_group_task_completion(group_task);
+	return true;
+}
@@ -41,8 +41,13 @@
 #include "core/templates/safe_refcount.h"
 
 #include <stdio.h>
+#include <atomic>
 #include <typeinfo>
 
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
 class RID_AllocBase {
 	static SafeNumeric<uint64_t> base_id;
 
@@ -63,58 +68,124 @@ protected:
 		return base_id.increment();
 	}
 
+	// Calls p_function(p_userdata, i) for every i below p_count on the WorkerThreadPool, and waits for them.
+	// Returns false without calling anything if there is no thread pool.
+	static bool _run_parallel(void (*p_function)(void *, uint32_t), void *p_userdata, uint32_t p_count);
+
 public:
 	virtual ~RID_AllocBase() {}
 };
 
 template <typename T, bool THREAD_SAFE = false>
 class RID_Alloc : public RID_AllocBase {
-	T **chunks = nullptr;
-	uint32_t **free_list_chunks = nullptr;
-	uint32_t **validator_chunks = nullptr;
+	// Chunk tables are only replaced by larger copies while allocating, and replaced
+	// tables are kept until destruction, so lookups can use them without locking.
+	struct ChunkTable {
+		T **chunks = nullptr;
+		std::atomic<uint32_t> **validator_chunks = nullptr;
+		uint32_t capacity = 0;
+		ChunkTable *prev = nullptr;
+	};
+
+	static constexpr std::memory_order ACQUIRE = THREAD_SAFE ? std::memory_order_acquire : std::memory_order_relaxed;
+	static constexpr std::memory_order RELEASE = THREAD_SAFE ? std::memory_order_release : std::memory_order_relaxed;
+
+	std::atomic<ChunkTable *> table = nullptr;
+	std::atomic<uint32_t> max_alloc = 0;
+
+	// One bit per element, set while it is free. Allocation always takes the lowest free
+	// index, so live elements stay packed at the start of the chunks.
+	uint64_t *free_mask = nullptr;
+	uint32_t free_mask_words = 0;
+	uint32_t free_hint = 0; // No word below this one has free bits.
 
 	uint32_t elements_in_chunk;
-	uint32_t max_alloc = 0;
 	uint32_t alloc_count = 0;
 
 	const char *description = nullptr;
 
 	mutable SpinLock spin_lock;
 
-	_FORCE_INLINE_ RID _allocate_rid() {
-		if constexpr (THREAD_SAFE) {
-			spin_lock.lock();
+	static _FORCE_INLINE_ uint32_t _lowest_bit(uint64_t p_mask) {
+#if defined(__GNUC__)
+		return __builtin_ctzll(p_mask);
+#elif defined(_MSC_VER) && defined(_WIN64)
+		unsigned long index;
+		_BitScanForward64(&index, p_mask);
+		return index;
+#else
+		uint32_t bit = 0;
+		while (!(p_mask & 1)) {
+			p_mask >>= 1;
+			bit++;
 		}
+		return bit;
+#endif
+	}
 
-		if (alloc_count == max_alloc) {
-			//allocate a new chunk
-			uint32_t chunk_count = alloc_count == 0 ? 0 : (max_alloc / elements_in_chunk);
-
-			//grow chunks
-			chunks = (T **)memrealloc(chunks, sizeof(T *) * (chunk_count + 1));
-			chunks[chunk_count] = (T *)memalloc(sizeof(T) * elements_in_chunk); //but don't initialize
+	_FORCE_INLINE_ std::atomic<uint32_t> &_get_validator(const ChunkTable *p_table, uint32_t p_index) const {
+		return p_table->validator_chunks[p_index / elements_in_chunk][p_index % elements_in_chunk];
+	}
 
-			//grow validators
-			validator_chunks = (uint32_t **)memrealloc(validator_chunks, sizeof(uint32_t *) * (chunk_count + 1));
-			validator_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
-			//grow free lists
-			free_list_chunks = (uint32_t **)memrealloc(free_list_chunks, sizeof(uint32_t *) * (chunk_count + 1));
-			free_list_chunks[chunk_count] = (uint32_t *)memalloc(sizeof(uint32_t) * elements_in_chunk);
+	void _grow() {
+		uint32_t ma = max_alloc.load(std::memory_order_relaxed);
+		uint32_t chunk_count = ma / elements_in_chunk;
+		ChunkTable *t = table.load(std::memory_order_relaxed);
 
-			//initialize
-			for (uint32_t i = 0; i < elements_in_chunk; i++) {
-				// Don't initialize chunk.
-				validator_chunks[chunk_count][i] = 0xFFFFFFFF;
-				free_list_chunks[chunk_count][i] = alloc_count + i;
+		if (!t || chunk_count == t->capacity) {
+			//grow chunk table
+			ChunkTable *new_table = memnew(ChunkTable);
+			new_table->capacity = t ? t->capacity * 2 : 1;
+			new_table->chunks = (T **)memalloc(sizeof(T *) * new_table->capacity);
+			new_table->validator_chunks = (std::atomic<uint32_t> **)memalloc(sizeof(std::atomic<uint32_t> *) * new_table->capacity);
+			for (uint32_t i = 0; i < chunk_count; i++) {
+				new_table->chunks[i] = t->chunks[i];
+				new_table->validator_chunks[i] = t->validator_chunks[i];
 			}
+			new_table->prev = t;
+			table.store(new_table, RELEASE);
+			t = new_table;
+		}
+
+		t->chunks[chunk_count] = (T *)memalloc(sizeof(T) * elements_in_chunk); //but don't initialize
+		t->validator_chunks[chunk_count] = (std::atomic<uint32_t> *)memalloc(sizeof(std::atomic<uint32_t>) * elements_in_chunk);
+		for (uint32_t i = 0; i < elements_in_chunk; i++) {
+			memnew_placement(&t->validator_chunks[chunk_count][i], std::atomic<uint32_t>(0xFFFFFFFF));
+		}
 
-			max_alloc += elements_in_chunk;
+		//grow free mask
+		uint32_t new_max = ma + elements_in_chunk;
+		uint32_t words = (new_max + 63) / 64;
+		free_mask = (uint64_t *)memrealloc(free_mask, sizeof(uint64_t) * words);
+		for (uint32_t i = free_mask_words; i < words; i++) {
+			free_mask[i] = 0;
+		}
+		free_mask_words = words;
+		for (uint32_t i = ma; i < new_max; i++) {
+			free_mask[i / 64] |= uint64_t(1) << (i % 64);
+		}
+		if (ma / 64 < free_hint) {
+			free_hint = ma / 64;
 		}
 
-		uint32_t free_index = free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk];
+		// Publish the new chunk last, lookups check the index against this before touching the table.
+		max_alloc.store(new_max, RELEASE);
+	}
 
-		uint32_t free_chunk = free_index / elements_in_chunk;
-		uint32_t free_element = free_index % elements_in_chunk;
+	_FORCE_INLINE_ RID _allocate_rid() {
+		if constexpr (THREAD_SAFE) {
+			spin_lock.lock();
+		}
+
+		if (alloc_count == max_alloc.load(std::memory_order_relaxed)) {
+			_grow();
+		}
+
+		while (free_mask[free_hint] == 0) {
+			free_hint++;
+		}
+		uint32_t free_index = free_hint * 64 + _lowest_bit(free_mask[free_hint]);
+		free_mask[free_hint] &= ~(uint64_t(1) << (free_index % 64));
 
 		uint32_t validator = (uint32_t)(_gen_id() & 0x7FFFFFFF);
 		CRASH_COND_MSG(validator == 0x7FFFFFFF, "Overflow in RID validator");
@@ -122,9 +193,7 @@ class RID_Alloc : public RID_AllocBase {
 		id <<= 32;
 		id |= free_index;
 
-		validator_chunks[free_chunk][free_element] = validator;
-
-		validator_chunks[free_chunk][free_element] |= 0x80000000; //mark uninitialized bit
+		_get_validator(table.load(std::memory_order_relaxed), free_index).store(validator | 0x80000000, RELEASE); //mark uninitialized bit
 
 		alloc_count++;
 
@@ -135,6 +204,41 @@ class RID_Alloc : public RID_AllocBase {
 		return _make_from_id(id);
 	}
 
+	// Returns the amount of allocated slots found in the chunk, initialized or not.
+	template <typename C>
+	uint32_t _for_each_in_chunk(const ChunkTable *p_table, uint32_t p_chunk, uint32_t p_max_alloc, C &p_callback) const {
+		uint32_t from = p_chunk * elements_in_chunk;
+		uint32_t to = MIN(from + elements_in_chunk, p_max_alloc);
+		const std::atomic<uint32_t> *validators = p_table->validator_chunks[p_chunk];
+		T *elements = p_table->chunks[p_chunk];
+		uint32_t allocated = 0;
+		for (uint32_t i = from; i < to; i++) {
+			uint64_t validator = validators[i - from].load(ACQUIRE);
+			if (validator == 0xFFFFFFFF) {
+				continue;
+			}
+			allocated++;
+			if (validator & 0x80000000) {
+				continue; //uninitialized
+			}
+			p_callback(_make_from_id((validator << 32) | i), &elements[i - from]);
+		}
+		return allocated;
+	}
+
+	template <typename C>
+	struct ForEachTask {
+		const RID_Alloc *alloc = nullptr;
+		const ChunkTable *table = nullptr;
+		uint32_t max_alloc = 0;
+		C *callback = nullptr;
+
+		static void run(void *p_userdata, uint32_t p_chunk) {
+			ForEachTask *task = (ForEachTask *)p_userdata;
+			task->alloc->_for_each_in_chunk(task->table, p_chunk, task->max_alloc, *task->callback);
+		}
+	};
+
 public:
 	RID make_rid() {
 		RID rid = _allocate_rid();
@@ -152,62 +256,43 @@ public:
 		return _allocate_rid();
 	}
 
+	// Lookups don't lock, even when THREAD_SAFE. The returned pointer stays valid until the RID is freed.
 	_FORCE_INLINE_ T *get_or_null(const RID &p_rid, bool p_initialize = false) {
 		if (p_rid == RID()) {
 			return nullptr;
 		}
-		if constexpr (THREAD_SAFE) {
-			spin_lock.lock();
-		}
 
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if constexpr (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
+		if (unlikely(idx >= max_alloc.load(ACQUIRE))) {
 			return nullptr;
 		}
 
-		uint32_t idx_chunk = idx / elements_in_chunk;
-		uint32_t idx_element = idx % elements_in_chunk;
+		const ChunkTable *t = table.load(ACQUIRE);
+		std::atomic<uint32_t> &slot_validator = _get_validator(t, idx);
 
 		uint32_t validator = uint32_t(id >> 32);
 
 		if (unlikely(p_initialize)) {
-			if (unlikely(!(validator_chunks[idx_chunk][idx_element] & 0x80000000))) {
-				if constexpr (THREAD_SAFE) {
-					spin_lock.unlock();
-				}
-				ERR_FAIL_V_MSG(nullptr, "Initializing already initialized RID");
-			}
-
-			if (unlikely((validator_chunks[idx_chunk][idx_element] & 0x7FFFFFFF) != validator)) {
-				if constexpr (THREAD_SAFE) {
-					spin_lock.unlock();
+			uint32_t expected = validator | 0x80000000;
+			if (unlikely(!slot_validator.compare_exchange_strong(expected, validator, std::memory_order_acq_rel))) {
+				if (unlikely(!(expected & 0x80000000))) {
+					ERR_FAIL_V_MSG(nullptr, "Initializing already initialized RID");
 				}
 				ERR_FAIL_V_MSG(nullptr, "Attempting to initialize the wrong RID");
 			}
 
-			validator_chunks[idx_chunk][idx_element] &= 0x7FFFFFFF; //initialized
-
-		} else if (unlikely(validator_chunks[idx_chunk][idx_element] != validator)) {
-			if constexpr (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
-			if ((validator_chunks[idx_chunk][idx_element] & 0x80000000) && validator_chunks[idx_chunk][idx_element] != 0xFFFFFFFF) {
-				ERR_FAIL_V_MSG(nullptr, "Attempting to use an uninitialized RID");
+		} else {
+			uint32_t current = slot_validator.load(ACQUIRE);
+			if (unlikely(current != validator)) {
+				if ((current & 0x80000000) && current != 0xFFFFFFFF) {
+					ERR_FAIL_V_MSG(nullptr, "Attempting to use an uninitialized RID");
+				}
+				return nullptr;
 			}
-			return nullptr;
 		}
 
-		T *ptr = &chunks[idx_chunk][idx_element];
-
-		if constexpr (THREAD_SAFE) {
-			spin_lock.unlock();
-		}
-
-		return ptr;
+		return &t->chunks[idx / elements_in_chunk][idx % elements_in_chunk];
 	}
 	void initialize_rid(RID p_rid) {
 		T *mem = get_or_null(p_rid, true);
@@ -221,31 +306,15 @@ public:
 	}
 
 	_FORCE_INLINE_ bool owns(const RID &p_rid) const {
-		if constexpr (THREAD_SAFE) {
-			spin_lock.lock();
-		}
-
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
-			if constexpr (THREAD_SAFE) {
-				spin_lock.unlock();
-			}
+		if (unlikely(idx >= max_alloc.load(ACQUIRE))) {
 			return false;
 		}
 
-		uint32_t idx_chunk = idx / elements_in_chunk;
-		uint32_t idx_element = idx % elements_in_chunk;
-
 		uint32_t validator = uint32_t(id >> 32);
 
-		bool owned = (validator != 0x7FFFFFFF) && (validator_chunks[idx_chunk][idx_element] & 0x7FFFFFFF) == validator;
-
-		if constexpr (THREAD_SAFE) {
-			spin_lock.unlock();
-		}
-
-		return owned;
+		return (validator != 0x7FFFFFFF) && (_get_validator(table.load(ACQUIRE), idx).load(ACQUIRE) & 0x7FFFFFFF) == validator;
 	}
 
 	_FORCE_INLINE_ void free(const RID &p_rid) {
@@ -255,34 +324,38 @@ public:
 
 		uint64_t id = p_rid.get_id();
 		uint32_t idx = uint32_t(id & 0xFFFFFFFF);
-		if (unlikely(idx >= max_alloc)) {
+		if (unlikely(idx >= max_alloc.load(std::memory_order_relaxed))) {
 			if constexpr (THREAD_SAFE) {
 				spin_lock.unlock();
 			}
 			ERR_FAIL();
 		}
 
-		uint32_t idx_chunk = idx / elements_in_chunk;
-		uint32_t idx_element = idx % elements_in_chunk;
+		const ChunkTable *t = table.load(std::memory_order_relaxed);
+		std::atomic<uint32_t> &slot_validator = _get_validator(t, idx);
 
 		uint32_t validator = uint32_t(id >> 32);
-		if (unlikely(validator_chunks[idx_chunk][idx_element] & 0x80000000)) {
+		uint32_t current = slot_validator.load(std::memory_order_relaxed);
+		if (unlikely(current & 0x80000000)) {
 			if constexpr (THREAD_SAFE) {
 				spin_lock.unlock();
 			}
 			ERR_FAIL_MSG("Attempted to free an uninitialized or invalid RID.");
-		} else if (unlikely(validator_chunks[idx_chunk][idx_element] != validator)) {
+		} else if (unlikely(current != validator)) {
 			if constexpr (THREAD_SAFE) {
 				spin_lock.unlock();
 			}
 			ERR_FAIL();
 		}
 
-		chunks[idx_chunk][idx_element].~T();
-		validator_chunks[idx_chunk][idx_element] = 0xFFFFFFFF; // go invalid
+		t->chunks[idx / elements_in_chunk][idx % elements_in_chunk].~T();
+		slot_validator.store(0xFFFFFFFF, RELEASE); // go invalid
 
+		free_mask[idx / 64] |= uint64_t(1) << (idx % 64);
+		if (idx / 64 < free_hint) {
+			free_hint = idx / 64;
+		}
 		alloc_count--;
-		free_list_chunks[alloc_count / elements_in_chunk][alloc_count % elements_in_chunk] = idx;
 
 		if constexpr (THREAD_SAFE) {
 			spin_lock.unlock();
@@ -296,10 +369,14 @@ public:
 		if constexpr (THREAD_SAFE) {
 			spin_lock.lock();
 		}
-		for (size_t i = 0; i < max_alloc; i++) {
-			uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk];
+		const ChunkTable *t = table.load(std::memory_order_relaxed);
+		uint32_t ma = max_alloc.load(std::memory_order_relaxed);
+		uint32_t found = 0;
+		for (uint32_t i = 0; i < ma && found < alloc_count; i++) {
+			uint64_t validator = _get_validator(t, i).load(std::memory_order_relaxed);
 			if (validator != 0xFFFFFFFF) {
 				p_owned->push_back(_make_from_id((validator << 32) | i));
+				found++;
 			}
 		}
 		if constexpr (THREAD_SAFE) {
@@ -312,9 +389,11 @@ public:
 		if constexpr (THREAD_SAFE) {
 			spin_lock.lock();
 		}
+		const ChunkTable *t = table.load(std::memory_order_relaxed);
+		uint32_t ma = max_alloc.load(std::memory_order_relaxed);
 		uint32_t idx = 0;
-		for (size_t i = 0; i < max_alloc; i++) {
-			uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk];
+		for (uint32_t i = 0; i < ma && idx < alloc_count; i++) {
+			uint64_t validator = _get_validator(t, i).load(std::memory_order_relaxed);
 			if (validator != 0xFFFFFFFF) {
 				p_rid_buffer[idx] = _make_from_id((validator << 32) | i);
 				idx++;
@@ -325,6 +404,41 @@ public:
 		}
 	}
 
+	// Calls p_callback(const RID &, T *) for every initialized element. With p_parallel, chunks are
+	// processed by the WorkerThreadPool, so the callback must be safe to call from several threads.
+	// The lock is only held to take a snapshot of the chunk table, so the callback may make RIDs of
+	// this owner (they may or may not be visited), but must not free the ones being visited.
+	template <typename C>
+	void for_each_owned(C p_callback, bool p_parallel = false) {
+		if constexpr (THREAD_SAFE) {
+			spin_lock.lock();
+		}
+		const ChunkTable *t = table.load(std::memory_order_relaxed);
+		uint32_t ma = max_alloc.load(std::memory_order_relaxed);
+		uint32_t count = alloc_count;
+		if constexpr (THREAD_SAFE) {
+			spin_lock.unlock();
+		}
+
+		uint32_t chunk_count = ma / elements_in_chunk;
+		if (p_parallel && chunk_count > 1) {
+			ForEachTask<C> task;
+			task.alloc = this;
+			task.table = t;
+			task.max_alloc = ma;
+			task.callback = &p_callback;
+			if (_run_parallel(&ForEachTask<C>::run, &task, chunk_count)) {
+				return;
+			}
+		}
+
+		// Freed slots are reused from the lowest index, so allocated ones tend to be at the start.
+		for (uint32_t i = 0; i < chunk_count && count > 0; i++) {
+			uint32_t allocated = _for_each_in_chunk(t, i, ma, p_callback);
+			count -= MIN(allocated, count);
+		}
+	}
+
 	void set_description(const char *p_descrption) {
 		description = p_descrption;
 	}
@@ -334,32 +448,38 @@ public:
 	}
 
 	~RID_Alloc() {
+		ChunkTable *t = table.load(std::memory_order_relaxed);
+		uint32_t ma = max_alloc.load(std::memory_order_relaxed);
+
 		if (alloc_count) {
 			print_error(vformat("ERROR: %d RID allocations of type '%s' were leaked at exit.",
 					alloc_count, description ? description : typeid(T).name()));
 
-			for (size_t i = 0; i < max_alloc; i++) {
-				uint64_t validator = validator_chunks[i / elements_in_chunk][i % elements_in_chunk];
+			for (uint32_t i = 0; i < ma; i++) {
+				uint32_t validator = _get_validator(t, i).load(std::memory_order_relaxed);
 				if (validator & 0x80000000) {
-					continue; //uninitialized
-				}
-				if (validator != 0xFFFFFFFF) {
-					chunks[i / elements_in_chunk][i % elements_in_chunk].~T();
+					continue; //uninitialized or free
 				}
+				t->chunks[i / elements_in_chunk][i % elements_in_chunk].~T();
 			}
 		}
 
-		uint32_t chunk_count = max_alloc / elements_in_chunk;
+		uint32_t chunk_count = ma / elements_in_chunk;
 		for (uint32_t i = 0; i < chunk_count; i++) {
-			memfree(chunks[i]);
-			memfree(validator_chunks[i]);
-			memfree(free_list_chunks[i]);
+			memfree(t->chunks[i]);
+			memfree(t->validator_chunks[i]);
+		}
+
+		while (t) {
+			ChunkTable *prev = t->prev;
+			memfree(t->chunks);
+			memfree(t->validator_chunks);
+			memdelete(t);
+			t = prev;
 		}
 
-		if (chunks) {
-			memfree(chunks);
-			memfree(free_list_chunks);
-			memfree(validator_chunks);
+		if (free_mask) {
+			memfree(free_mask);
 		}
 	}
 };
@@ -415,6 +535,11 @@ public:
 		alloc.fill_owned_buffer(p_rid_buffer);
 	}
 
+	template <typename C>
+	void for_each_owned(C p_callback, bool p_parallel = false) {
+		alloc.for_each_owned([&p_callback](const RID &p_rid, T **p_ptr) { p_callback(p_rid, *p_ptr); }, p_parallel);
+	}
+
 	void set_description(const char *p_descrption) {
 		alloc.set_description(p_descrption);
 	}
@@ -470,6 +595,11 @@ public:
 		alloc.fill_owned_buffer(p_rid_buffer);
 	}
 
+	template <typename C>
+	void for_each_owned(C p_callback, bool p_parallel = false) {
+		alloc.for_each_owned(p_callback, p_parallel);
+	}
+
 	void set_description(const char *p_descrption) {
 		alloc.set_description(p_descrption);
 	}
@@ -129,6 +129,14 @@ public:
 		return -1;
 	}
 
+	// Returns the next p_size elements in place, or nullptr if they are not available or wrap around.
+	const T *get_read_ptr(int p_size) const {
+		if (p_size > data_left() || read_pos + p_size > size()) {
+			return nullptr;
+		}
+		return data.ptr() + read_pos;
+	}
+
 	inline int advance_read(int p_n) {
 		p_n = MIN(p_n, data_left());
 		inc(read_pos, p_n);
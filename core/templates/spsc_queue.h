@@ -0,0 +1,95 @@
+/**************************************************************************/
+/*  spsc_queue.h                                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+
+// Bounded queue for passing values from exactly one producer thread to
+// exactly one consumer thread, without locks.
+//
+// The producer owns the tail and the consumer owns the head, each side only
+// reads the other's index, so pushing and popping never wait. The capacity is
+// rounded up to a power of two and must be set while neither thread uses the
+// queue.
+template <typename T>
+class SPSCQueue {
+	LocalVector<T> buffer;
+	uint32_t mask = 0;
+	alignas(64) SafeNumeric<uint32_t> head; // Written by the consumer.
+	alignas(64) SafeNumeric<uint32_t> tail; // Written by the producer.
+
+public:
+	// Producer only. Returns false if the queue is full.
+	_FORCE_INLINE_ bool push(const T &p_value) {
+		const uint32_t t = tail.get();
+		if (t - head.get() > mask || buffer.is_empty()) {
+			return false;
+		}
+		buffer[t & mask] = p_value;
+		tail.set(t + 1);
+		return true;
+	}
+
+	// Consumer only. Returns false if the queue is empty.
+	_FORCE_INLINE_ bool pop(T &r_value) {
+		const uint32_t h = head.get();
+		if (h == tail.get()) {
+			return false;
+		}
+		r_value = buffer[h & mask];
+		head.set(h + 1);
+		return true;
+	}
+
+	// Exact when called by either side, as the other can only make it grow (producer) or shrink (consumer).
+	_FORCE_INLINE_ uint32_t size() const { return tail.get() - head.get(); }
+	_FORCE_INLINE_ bool is_empty() const { return size() == 0; }
+	_FORCE_INLINE_ uint32_t get_capacity() const { return buffer.size(); }
+
+	void set_capacity(uint32_t p_capacity) {
+		ERR_FAIL_COND(p_capacity == 0);
+		buffer.clear();
+		buffer.resize(next_power_of_2(p_capacity));
+		mask = buffer.size() - 1;
+		head.set(0);
+		tail.set(0);
+	}
+
+	SPSCQueue(uint32_t p_capacity = 0) {
+		if (p_capacity > 0) {
+			set_capacity(p_capacity);
+		}
+	}
+};
+
+#endif // SPSC_QUEUE_H
@@ -586,7 +586,12 @@ public:
 	static int get_builtin_method_count(Variant::Type p_type);
 	static uint32_t get_builtin_method_hash(Variant::Type p_type, const StringName &p_method);
 
+	// Indices don't change once the methods are registered, so they can be cached together with the type
+	// and passed to call_builtin_method() to avoid looking the method up by name on every call.
+	static int get_builtin_method_index(Variant::Type p_type, const StringName &p_method);
+
 	void callp(const StringName &p_method, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error);
+	void call_builtin_method(int p_method_index, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error);
 
 	template <typename... VarArgs>
 	Variant call(const StringName &p_method, VarArgs... p_args) {
@@ -657,6 +657,53 @@ static _FORCE_INLINE_ void vc_ptrcall(void (*method)(T *, P...), void *p_base, c
 		}                                                                                                                                                         \
 	};
 
+// Bulk math on packed arrays processes vectors and colors as flat arrays of components,
+// which keeps the loops simple enough for the compiler to vectorize them.
+template <typename T>
+struct PackedArrayComponents {
+	typedef T Scalar;
+	static constexpr int COUNT = 1;
+};
+
+template <>
+struct PackedArrayComponents<Vector2> {
+	typedef real_t Scalar;
+	static constexpr int COUNT = 2;
+};
+
+template <>
+struct PackedArrayComponents<Vector3> {
+	typedef real_t Scalar;
+	static constexpr int COUNT = 3;
+};
+
+template <>
+struct PackedArrayComponents<Color> {
+	typedef float Scalar;
+	static constexpr int COUNT = 4;
+};
+
+static_assert(sizeof(Vector2) == 2 * sizeof(real_t));
+static_assert(sizeof(Vector3) == 3 * sizeof(real_t));
+static_assert(sizeof(Color) == 4 * sizeof(float));
+
+template <typename T>
+static _FORCE_INLINE_ T packed_array_clamp(const T &p_value, const T &p_min, const T &p_max) {
+	return CLAMP(p_value, p_min, p_max);
+}
+
+static _FORCE_INLINE_ Vector2 packed_array_clamp(const Vector2 &p_value, const Vector2 &p_min, const Vector2 &p_max) {
+	return p_value.clamp(p_min, p_max);
+}
+
+static _FORCE_INLINE_ Vector3 packed_array_clamp(const Vector3 &p_value, const Vector3 &p_min, const Vector3 &p_max) {
+	return p_value.clamp(p_min, p_max);
+}
+
+static _FORCE_INLINE_ Color packed_array_clamp(const Color &p_value, const Color &p_min, const Color &p_max) {
+	return p_value.clamp(p_min, p_max);
+}
+
 struct _VariantCall {
 	static String func_PackedByteArray_get_string_from_ascii(PackedByteArray *p_instance) {
 		String s;
@@ -1018,6 +1065,167 @@ struct _VariantCall {
 		return len;
 	}
 
+	template <typename T>
+	static void func_Packed_add_array(Vector<T> *p_instance, const Vector<T> &p_array) {
+		typedef typename PackedArrayComponents<T>::Scalar S;
+		ERR_FAIL_COND_MSG(p_instance->size() != p_array.size(), vformat("Both arrays must have the same size (%d and %d).", p_instance->size(), p_array.size()));
+		if (p_array.is_empty()) {
+			return;
+		}
+		const int64_t count = p_array.size() * PackedArrayComponents<T>::COUNT;
+		const S *r = (const S *)p_array.ptr();
+		S *w = (S *)p_instance->ptrw();
+		for (int64_t i = 0; i < count; i++) {
+			w[i] += r[i];
+		}
+	}
+
+	template <typename T>
+	static void func_Packed_multiply_array(Vector<T> *p_instance, const Vector<T> &p_array) {
+		typedef typename PackedArrayComponents<T>::Scalar S;
+		ERR_FAIL_COND_MSG(p_instance->size() != p_array.size(), vformat("Both arrays must have the same size (%d and %d).", p_instance->size(), p_array.size()));
+		if (p_array.is_empty()) {
+			return;
+		}
+		const int64_t count = p_array.size() * PackedArrayComponents<T>::COUNT;
+		const S *r = (const S *)p_array.ptr();
+		S *w = (S *)p_instance->ptrw();
+		for (int64_t i = 0; i < count; i++) {
+			w[i] *= r[i];
+		}
+	}
+
+	template <typename T>
+	static void func_Packed_scale(Vector<T> *p_instance, double p_factor) {
+		typedef typename PackedArrayComponents<T>::Scalar S;
+		if (p_instance->is_empty()) {
+			return;
+		}
+		const int64_t count = p_instance->size() * PackedArrayComponents<T>::COUNT;
+		const S factor = p_factor;
+		S *w = (S *)p_instance->ptrw();
+		for (int64_t i = 0; i < count; i++) {
+			w[i] *= factor;
+		}
+	}
+
+	template <typename T>
+	static void func_Packed_lerp_array(Vector<T> *p_instance, const Vector<T> &p_to, double p_weight) {
+		typedef typename PackedArrayComponents<T>::Scalar S;
+		ERR_FAIL_COND_MSG(p_instance->size() != p_to.size(), vformat("Both arrays must have the same size (%d and %d).", p_instance->size(), p_to.size()));
+		if (p_to.is_empty()) {
+			return;
+		}
+		const int64_t count = p_to.size() * PackedArrayComponents<T>::COUNT;
+		const S weight = p_weight;
+		const S *r = (const S *)p_to.ptr();
+		S *w = (S *)p_instance->ptrw();
+		for (int64_t i = 0; i < count; i++) {
+			w[i] += (r[i] - w[i]) * weight;
+		}
+	}
+
+	template <typename T>
+	static void func_Packed_clamp(Vector<T> *p_instance, const T &p_min, const T &p_max) {
+		if (p_instance->is_empty()) {
+			return;
+		}
+		const int64_t size = p_instance->size();
+		const T min = p_min;
+		const T max = p_max;
+		T *w = p_instance->ptrw();
+		for (int64_t i = 0; i < size; i++) {
+			w[i] = packed_array_clamp(w[i], min, max);
+		}
+	}
+
+	// Floating-point additions can't be reordered by the compiler, so use independent partial sums.
+	template <typename T>
+	static T func_Packed_sum(Vector<T> *p_instance) {
+		const int64_t size = p_instance->size();
+		const T *r = p_instance->ptr();
+		T sums[4] = { T(), T(), T(), T() };
+		int64_t i = 0;
+		for (; i + 4 <= size; i += 4) {
+			sums[0] += r[i];
+			sums[1] += r[i + 1];
+			sums[2] += r[i + 2];
+			sums[3] += r[i + 3];
+		}
+		for (; i < size; i++) {
+			sums[0] += r[i];
+		}
+		return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+	}
+
+	template <typename T>
+	static T func_Packed_dot(Vector<T> *p_instance, const Vector<T> &p_array) {
+		ERR_FAIL_COND_V_MSG(p_instance->size() != p_array.size(), 0, vformat("Both arrays must have the same size (%d and %d).", p_instance->size(), p_array.size()));
+		const int64_t size = p_instance->size();
+		const T *a = p_instance->ptr();
+		const T *b = p_array.ptr();
+		T sums[4] = { 0, 0, 0, 0 };
+		int64_t i = 0;
+		for (; i + 4 <= size; i += 4) {
+			sums[0] += a[i] * b[i];
+			sums[1] += a[i + 1] * b[i + 1];
+			sums[2] += a[i + 2] * b[i + 2];
+			sums[3] += a[i + 3] * b[i + 3];
+		}
+		for (; i < size; i++) {
+			sums[0] += a[i] * b[i];
+		}
+		return (sums[0] + sums[1]) + (sums[2] + sums[3]);
+	}
+
+	template <typename T>
+	static T func_Packed_min(Vector<T> *p_instance) {
+		ERR_FAIL_COND_V_MSG(p_instance->is_empty(), 0, "Can't get the minimum value of an empty array.");
+		const int64_t size = p_instance->size();
+		const T *r = p_instance->ptr();
+		T result = r[0];
+		for (int64_t i = 1; i < size; i++) {
+			result = MIN(result, r[i]);
+		}
+		return result;
+	}
+
+	template <typename T>
+	static T func_Packed_max(Vector<T> *p_instance) {
+		ERR_FAIL_COND_V_MSG(p_instance->is_empty(), 0, "Can't get the maximum value of an empty array.");
+		const int64_t size = p_instance->size();
+		const T *r = p_instance->ptr();
+		T result = r[0];
+		for (int64_t i = 1; i < size; i++) {
+			result = MAX(result, r[i]);
+		}
+		return result;
+	}
+
+	static void func_PackedVector2Array_transform(PackedVector2Array *p_instance, const Transform2D &p_transform) {
+		if (p_instance->is_empty()) {
+			return;
+		}
+		const int64_t size = p_instance->size();
+		const Transform2D transform = p_transform; // Local copy, so it's known not to alias the array.
+		Vector2 *w = p_instance->ptrw();
+		for (int64_t i = 0; i < size; i++) {
+			w[i] = transform.xform(w[i]);
+		}
+	}
+
+	static void func_PackedVector3Array_transform(PackedVector3Array *p_instance, const Transform3D &p_transform) {
+		if (p_instance->is_empty()) {
+			return;
+		}
+		const int64_t size = p_instance->size();
+		const Transform3D transform = p_transform; // Local copy, so it's known not to alias the array.
+		Vector3 *w = p_instance->ptrw();
+		for (int64_t i = 0; i < size; i++) {
+			w[i] = transform.xform(w[i]);
+		}
+	}
+
 	static void func_Callable_call(Variant *v, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error) {
 		Callable *callable = VariantGetInternalPtr<Callable>::get_ptr(v);
 		callable->callp(p_args, p_argcount, r_ret, r_error);
@@ -1159,15 +1367,23 @@ struct VariantBuiltInMethodInfo {
 	}
 };
 
-typedef OAHashMap<StringName, VariantBuiltInMethodInfo> BuiltinMethodMap;
-static BuiltinMethodMap *builtin_method_info;
+// Methods are stored densely per type, in registration order, so callers can cache their index and
+// skip the name lookup when calling them again (see Variant::get_builtin_method_index()).
+typedef OAHashMap<StringName, int> BuiltinMethodMap;
+static BuiltinMethodMap *builtin_method_indices;
+static LocalVector<VariantBuiltInMethodInfo> *builtin_method_info;
 static List<StringName> *builtin_method_names;
 
+static _FORCE_INLINE_ const VariantBuiltInMethodInfo *get_builtin_method(Variant::Type p_type, const StringName &p_method) {
+	const int *index = builtin_method_indices[p_type].lookup_ptr(p_method);
+	return index ? &builtin_method_info[p_type][*index] : nullptr;
+}
+
 template <typename T>
 static void register_builtin_method(const Vector<String> &p_argnames, const Vector<Variant> &p_def_args) {
 	StringName name = T::get_name();
 
-	ERR_FAIL_COND(builtin_method_info[T::get_base_type()].has(name));
+	ERR_FAIL_COND(builtin_method_indices[T::get_base_type()].has(name));
 
 	VariantBuiltInMethodInfo imi;
 
@@ -1189,7 +1405,8 @@ static void register_builtin_method(const Vector<String> &p_argnames, const Vect
 	ERR_FAIL_COND(!imi.is_vararg && imi.argument_count != imi.argument_names.size());
 #endif
 
-	builtin_method_info[T::get_base_type()].insert(name, imi);
+	builtin_method_indices[T::get_base_type()].insert(name, int(builtin_method_info[T::get_base_type()].size()));
+	builtin_method_info[T::get_base_type()].push_back(imi);
 	builtin_method_names[T::get_base_type()].push_back(name);
 }
 
@@ -1213,7 +1430,7 @@ void Variant::callp(const StringName &p_method, const Variant **p_args, int p_ar
 	} else {
 		r_error.error = Callable::CallError::CALL_OK;
 
-		const VariantBuiltInMethodInfo *imf = builtin_method_info[type].lookup_ptr(p_method);
+		const VariantBuiltInMethodInfo *imf = get_builtin_method(type, p_method);
 
 		if (!imf) {
 			r_error.error = Callable::CallError::CALL_ERROR_INVALID_METHOD;
@@ -1224,6 +1441,24 @@ void Variant::callp(const StringName &p_method, const Variant **p_args, int p_ar
 	}
 }
 
+int Variant::get_builtin_method_index(Variant::Type p_type, const StringName &p_method) {
+	ERR_FAIL_INDEX_V(p_type, Variant::VARIANT_MAX, -1);
+	const int *index = builtin_method_indices[p_type].lookup_ptr(p_method);
+	return index ? *index : -1;
+}
+
+void Variant::call_builtin_method(int p_method_index, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error) {
+	if (unlikely(type == Variant::OBJECT || p_method_index < 0 || uint32_t(p_method_index) >= builtin_method_info[type].size())) {
+		r_error.error = Callable::CallError::CALL_ERROR_INVALID_METHOD;
+		return;
+	}
+
+	r_error.error = Callable::CallError::CALL_OK;
+
+	const VariantBuiltInMethodInfo &imf = builtin_method_info[type][p_method_index];
+	imf.call(this, p_args, p_argcount, r_ret, imf.default_arguments, r_error);
+}
+
 void Variant::call_const(const StringName &p_method, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error) {
 	if (type == Variant::OBJECT) {
 		//call object
@@ -1245,7 +1480,7 @@ void Variant::call_const(const StringName &p_method, const Variant **p_args, int
 	} else {
 		r_error.error = Callable::CallError::CALL_OK;
 
-		const VariantBuiltInMethodInfo *imf = builtin_method_info[type].lookup_ptr(p_method);
+		const VariantBuiltInMethodInfo *imf = get_builtin_method(type, p_method);
 
 		if (!imf) {
 			r_error.error = Callable::CallError::CALL_ERROR_INVALID_METHOD;
@@ -1264,7 +1499,7 @@ void Variant::call_const(const StringName &p_method, const Variant **p_args, int
 void Variant::call_static(Variant::Type p_type, const StringName &p_method, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_error) {
 	r_error.error = Callable::CallError::CALL_OK;
 
-	const VariantBuiltInMethodInfo *imf = builtin_method_info[p_type].lookup_ptr(p_method);
+	const VariantBuiltInMethodInfo *imf = get_builtin_method(p_type, p_method);
 
 	if (!imf) {
 		r_error.error = Callable::CallError::CALL_ERROR_INVALID_METHOD;
@@ -1289,45 +1524,45 @@ bool Variant::has_method(const StringName &p_method) const {
 		return obj->has_method(p_method);
 	}
 
-	return builtin_method_info[type].has(p_method);
+	return builtin_method_indices[type].has(p_method);
 }
 
 bool Variant::has_builtin_method(Variant::Type p_type, const StringName &p_method) {
 	ERR_FAIL_INDEX_V(p_type, Variant::VARIANT_MAX, false);
-	return builtin_method_info[p_type].has(p_method);
+	return builtin_method_indices[p_type].has(p_method);
 }
 
 Variant::ValidatedBuiltInMethod Variant::get_validated_builtin_method(Variant::Type p_type, const StringName &p_method) {
 	ERR_FAIL_INDEX_V(p_type, Variant::VARIANT_MAX, nullptr);
-	const VariantBuiltInMethodInfo *method = builtin_method_info[p_type].lookup_ptr(p_method);
+	const VariantBuiltInMethodInfo *method = get_builtin_method(p_type, p_method);
 	ERR_FAIL_NULL_V(method, nullptr);
 	return method->validated_call;
 }
 
 Variant::PTRBuiltInMethod Variant::get_ptr_builtin_method(Variant::Type p_type, const StringName &p_method) {
 	ERR_FAIL_INDEX_V(p_type, Variant::VARIANT_MAX, nullptr);
-	const VariantBuiltInMethodInfo *method = builtin_method_info[p_type].lookup_ptr(p_method);
+	const VariantBuiltInMethodInfo *method = get_builtin_method(p_type, p_method);
 	ERR_FAIL_NULL_V(method, nullptr);
 	return method->ptrcall;
 }
 
 MethodInfo Variant::get_builtin_method_info(Variant::Type p_type, const StringName &p_method) {
 	ERR_FAIL_INDEX_V(p_type, Variant::VARIANT_MAX, MethodInfo());
-	const VariantBuiltInMethodInfo *method = builtin_method_info[p_type].lookup_ptr(p_method);
+	const VariantBuiltInMethodInfo *method = get_builtin_method(p_type, p_method);
 	ERR_FAIL_NULL_V(method, MethodInfo());
 	return method->get_method_info(p_method);
 }
 
 int Variant::get_builtin_method_argument_count(Variant::Type p_type, const StringName &p_method) {
 	ERR_FAIL_INDEX_V(p_type, Variant::VARIANT_MAX, 0);
-	const VariantBuiltInMethodInfo *method = builtin_method_info[p_type].lookup_ptr(p_method);
+	const VariantBuiltInMethodInfo *method = get_builtin_method(p_type, p_method);
 	ERR_FAIL_NULL_V(method, 0);
 	return method->argument_count;
 }
 
 Variant::Type Variant::get_builtin_method_argument_type(Variant::Type p_type, const StringName &p_method, int p_argument) {
 	ERR_FAIL_INDEX_V(p_type, Variant::VARIANT_MAX, Variant::NIL);
-	const VariantBuiltInMethodInfo *method = builtin_method_info[p_type].lookup_ptr(p_method);
+	const VariantBuiltInMethodInfo *method = get_builtin_method(p_type, p_method);
 	ERR_FAIL_NULL_V(method, Variant::NIL);
 	ERR_FAIL_INDEX_V(p_argument, method->argument_count, Variant::NIL);
 	return method->get_argument_type(p_argument);
@@ -1335,7 +1570,7 @@ Variant::Type Variant::get_builtin_method_argument_type(Variant::Type p_type, co
 
 String Variant::get_builtin_method_argument_name(Variant::Type p_type, const StringName &p_method, int p_argument) {
 	ERR_FAIL_INDEX_V(p_type, Variant::VARIANT_MAX, String());
-	const VariantBuiltInMethodInfo *method = builtin_method_info[p_type].lookup_ptr(p_method);
+	const VariantBuiltInMethodInfo *method = get_builtin_method(p_type, p_method);
 	ERR_FAIL_NULL_V(method, String());
 #ifdef DEBUG_METHODS_ENABLED
 	ERR_FAIL_INDEX_V(p_argument, method->argument_count, String());
@@ -1347,14 +1582,14 @@ String Variant::get_builtin_method_argument_name(Variant::Type p_type, const Str
 
 Vector<Variant> Variant::get_builtin_method_default_arguments(Variant::Type p_type, const StringName &p_method) {
 	ERR_FAIL_INDEX_V(p_type, Variant::VARIANT_MAX, Vector<Variant>());
-	const VariantBuiltInMethodInfo *method = builtin_method_info[p_type].lookup_ptr(p_method);
+	const VariantBuiltInMethodInfo *method = get_builtin_method(p_type, p_method);
 	ERR_FAIL_NULL_V(method, Vector<Variant>());
 	return method->default_arguments;
 }
 
 bool Variant::has_builtin_method_return_value(Variant::Type p_type, const StringName &p_method) {
 	ERR_FAIL_INDEX_V(p_type, Variant::VARIANT_MAX, false);
-	const VariantBuiltInMethodInfo *method = builtin_method_info[p_type].lookup_ptr(p_method);
+	const VariantBuiltInMethodInfo *method = get_builtin_method(p_type, p_method);
 	ERR_FAIL_NULL_V(method, false);
 	return method->has_return_type;
 }
@@ -1373,35 +1608,35 @@ int Variant::get_builtin_method_count(Variant::Type p_type) {
 
 Variant::Type Variant::get_builtin_method_return_type(Variant::Type p_type, const StringName &p_method) {
 	ERR_FAIL_INDEX_V(p_type, Variant::VARIANT_MAX, Variant::NIL);
-	const VariantBuiltInMethodInfo *method = builtin_method_info[p_type].lookup_ptr(p_method);
+	const VariantBuiltInMethodInfo *method = get_builtin_method(p_type, p_method);
 	ERR_FAIL_NULL_V(method, Variant::NIL);
 	return method->return_type;
 }
 
 bool Variant::is_builtin_method_const(Variant::Type p_type, const StringName &p_method) {
 	ERR_FAIL_INDEX_V(p_type, Variant::VARIANT_MAX, false);
-	const VariantBuiltInMethodInfo *method = builtin_method_info[p_type].lookup_ptr(p_method);
+	const VariantBuiltInMethodInfo *method = get_builtin_method(p_type, p_method);
 	ERR_FAIL_NULL_V(method, false);
 	return method->is_const;
 }
 
 bool Variant::is_builtin_method_static(Variant::Type p_type, const StringName &p_method) {
 	ERR_FAIL_INDEX_V(p_type, Variant::VARIANT_MAX, false);
-	const VariantBuiltInMethodInfo *method = builtin_method_info[p_type].lookup_ptr(p_method);
+	const VariantBuiltInMethodInfo *method = get_builtin_method(p_type, p_method);
 	ERR_FAIL_NULL_V(method, false);
 	return method->is_static;
 }
 
 bool Variant::is_builtin_method_vararg(Variant::Type p_type, const StringName &p_method) {
 	ERR_FAIL_INDEX_V(p_type, Variant::VARIANT_MAX, false);
-	const VariantBuiltInMethodInfo *method = builtin_method_info[p_type].lookup_ptr(p_method);
+	const VariantBuiltInMethodInfo *method = get_builtin_method(p_type, p_method);
 	ERR_FAIL_NULL_V(method, false);
 	return method->is_vararg;
 }
 
 uint32_t Variant::get_builtin_method_hash(Variant::Type p_type, const StringName &p_method) {
 	ERR_FAIL_INDEX_V(p_type, Variant::VARIANT_MAX, 0);
-	const VariantBuiltInMethodInfo *method = builtin_method_info[p_type].lookup_ptr(p_method);
+	const VariantBuiltInMethodInfo *method = get_builtin_method(p_type, p_method);
 	ERR_FAIL_NULL_V(method, 0);
 	uint32_t hash = hash_murmur3_one_32(method->is_const);
 	hash = hash_murmur3_one_32(method->is_static, hash);
@@ -1426,7 +1661,7 @@ void Variant::get_method_list(List<MethodInfo> *p_list) const {
 		}
 	} else {
 		for (const StringName &E : builtin_method_names[type]) {
-			const VariantBuiltInMethodInfo *method = builtin_method_info[type].lookup_ptr(E);
+			const VariantBuiltInMethodInfo *method = get_builtin_method(type, E);
 			ERR_CONTINUE(!method);
 			p_list->push_back(method->get_method_info(E));
 		}
@@ -1634,7 +1869,8 @@ int Variant::get_enum_value(Variant::Type p_type, const StringName &p_enum_name,
 static void _register_variant_builtin_methods_string() {
 	_VariantCall::constant_data = memnew_arr(_VariantCall::ConstantData, Variant::VARIANT_MAX);
 	_VariantCall::enum_data = memnew_arr(_VariantCall::EnumData, Variant::VARIANT_MAX);
-	builtin_method_info = memnew_arr(BuiltinMethodMap, Variant::VARIANT_MAX);
+	builtin_method_indices = memnew_arr(BuiltinMethodMap, Variant::VARIANT_MAX);
+	builtin_method_info = memnew_arr(LocalVector<VariantBuiltInMethodInfo>, Variant::VARIANT_MAX);
 	builtin_method_names = memnew_arr(List<StringName>, Variant::VARIANT_MAX);
 
 	/* String */
@@ -2470,6 +2706,15 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedFloat32Array, find, sarray("value", "from"), varray(0));
 	bind_method(PackedFloat32Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedFloat32Array, count, sarray("value"), varray());
+	bind_functionnc(PackedFloat32Array, add_array, _VariantCall::func_Packed_add_array<float>, sarray("array"), varray());
+	bind_functionnc(PackedFloat32Array, multiply_array, _VariantCall::func_Packed_multiply_array<float>, sarray("array"), varray());
+	bind_functionnc(PackedFloat32Array, scale, _VariantCall::func_Packed_scale<float>, sarray("factor"), varray());
+	bind_functionnc(PackedFloat32Array, lerp_array, _VariantCall::func_Packed_lerp_array<float>, sarray("to", "weight"), varray());
+	bind_functionnc(PackedFloat32Array, clamp, _VariantCall::func_Packed_clamp<float>, sarray("min", "max"), varray());
+	bind_function(PackedFloat32Array, sum, _VariantCall::func_Packed_sum<float>, sarray(), varray());
+	bind_function(PackedFloat32Array, min, _VariantCall::func_Packed_min<float>, sarray(), varray());
+	bind_function(PackedFloat32Array, max, _VariantCall::func_Packed_max<float>, sarray(), varray());
+	bind_function(PackedFloat32Array, dot, _VariantCall::func_Packed_dot<float>, sarray("array"), varray());
 
 	/* Float64 Array */
 
@@ -2494,6 +2739,15 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedFloat64Array, find, sarray("value", "from"), varray(0));
 	bind_method(PackedFloat64Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedFloat64Array, count, sarray("value"), varray());
+	bind_functionnc(PackedFloat64Array, add_array, _VariantCall::func_Packed_add_array<double>, sarray("array"), varray());
+	bind_functionnc(PackedFloat64Array, multiply_array, _VariantCall::func_Packed_multiply_array<double>, sarray("array"), varray());
+	bind_functionnc(PackedFloat64Array, scale, _VariantCall::func_Packed_scale<double>, sarray("factor"), varray());
+	bind_functionnc(PackedFloat64Array, lerp_array, _VariantCall::func_Packed_lerp_array<double>, sarray("to", "weight"), varray());
+	bind_functionnc(PackedFloat64Array, clamp, _VariantCall::func_Packed_clamp<double>, sarray("min", "max"), varray());
+	bind_function(PackedFloat64Array, sum, _VariantCall::func_Packed_sum<double>, sarray(), varray());
+	bind_function(PackedFloat64Array, min, _VariantCall::func_Packed_min<double>, sarray(), varray());
+	bind_function(PackedFloat64Array, max, _VariantCall::func_Packed_max<double>, sarray(), varray());
+	bind_function(PackedFloat64Array, dot, _VariantCall::func_Packed_dot<double>, sarray("array"), varray());
 
 	/* String Array */
 
@@ -2542,6 +2796,13 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedVector2Array, find, sarray("value", "from"), varray(0));
 	bind_method(PackedVector2Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedVector2Array, count, sarray("value"), varray());
+	bind_functionnc(PackedVector2Array, add_array, _VariantCall::func_Packed_add_array<Vector2>, sarray("array"), varray());
+	bind_functionnc(PackedVector2Array, multiply_array, _VariantCall::func_Packed_multiply_array<Vector2>, sarray("array"), varray());
+	bind_functionnc(PackedVector2Array, scale, _VariantCall::func_Packed_scale<Vector2>, sarray("factor"), varray());
+	bind_functionnc(PackedVector2Array, lerp_array, _VariantCall::func_Packed_lerp_array<Vector2>, sarray("to", "weight"), varray());
+	bind_functionnc(PackedVector2Array, clamp, _VariantCall::func_Packed_clamp<Vector2>, sarray("min", "max"), varray());
+	bind_function(PackedVector2Array, sum, _VariantCall::func_Packed_sum<Vector2>, sarray(), varray());
+	bind_functionnc(PackedVector2Array, transform, _VariantCall::func_PackedVector2Array_transform, sarray("transform"), varray());
 
 	/* Vector3 Array */
 
@@ -2566,6 +2827,13 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedVector3Array, find, sarray("value", "from"), varray(0));
 	bind_method(PackedVector3Array, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedVector3Array, count, sarray("value"), varray());
+	bind_functionnc(PackedVector3Array, add_array, _VariantCall::func_Packed_add_array<Vector3>, sarray("array"), varray());
+	bind_functionnc(PackedVector3Array, multiply_array, _VariantCall::func_Packed_multiply_array<Vector3>, sarray("array"), varray());
+	bind_functionnc(PackedVector3Array, scale, _VariantCall::func_Packed_scale<Vector3>, sarray("factor"), varray());
+	bind_functionnc(PackedVector3Array, lerp_array, _VariantCall::func_Packed_lerp_array<Vector3>, sarray("to", "weight"), varray());
+	bind_functionnc(PackedVector3Array, clamp, _VariantCall::func_Packed_clamp<Vector3>, sarray("min", "max"), varray());
+	bind_function(PackedVector3Array, sum, _VariantCall::func_Packed_sum<Vector3>, sarray(), varray());
+	bind_functionnc(PackedVector3Array, transform, _VariantCall::func_PackedVector3Array_transform, sarray("transform"), varray());
 
 	/* Color Array */
 
@@ -2590,6 +2858,11 @@ static void _register_variant_builtin_methods_array() {
 	bind_method(PackedColorArray, find, sarray("value", "from"), varray(0));
 	bind_method(PackedColorArray, rfind, sarray("value", "from"), varray(-1));
 	bind_method(PackedColorArray, count, sarray("value"), varray());
+	bind_functionnc(PackedColorArray, add_array, _VariantCall::func_Packed_add_array<Color>, sarray("array"), varray());
+	bind_functionnc(PackedColorArray, multiply_array, _VariantCall::func_Packed_multiply_array<Color>, sarray("array"), varray());
+	bind_functionnc(PackedColorArray, scale, _VariantCall::func_Packed_scale<Color>, sarray("factor"), varray());
+	bind_functionnc(PackedColorArray, lerp_array, _VariantCall::func_Packed_lerp_array<Color>, sarray("to", "weight"), varray());
+	bind_functionnc(PackedColorArray, clamp, _VariantCall::func_Packed_clamp<Color>, sarray("min", "max"), varray());
 
 	/* Vector4 Array */
 
@@ -2785,6 +3058,7 @@ void Variant::_unregister_variant_methods() {
 	//clear methods
 	memdelete_arr(builtin_method_names);
 	memdelete_arr(builtin_method_info);
+	memdelete_arr(builtin_method_indices);
 	memdelete_arr(_VariantCall::constant_data);
 	memdelete_arr(_VariantCall::enum_data);
 }
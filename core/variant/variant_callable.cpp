@@ -79,12 +79,19 @@ int VariantCallable::get_argument_count(bool &r_is_valid) const {
 
 void VariantCallable::call(const Variant **p_arguments, int p_argcount, Variant &r_return_value, Callable::CallError &r_call_error) const {
 	Variant v = variant;
-	v.callp(method, p_arguments, p_argcount, r_return_value, r_call_error);
+	if (method_index >= 0) {
+		v.call_builtin_method(method_index, p_arguments, p_argcount, r_return_value, r_call_error);
+	} else {
+		v.callp(method, p_arguments, p_argcount, r_return_value, r_call_error);
+	}
 }
 
 VariantCallable::VariantCallable(const Variant &p_variant, const StringName &p_method) {
 	variant = p_variant;
 	method = p_method;
+	if (variant.get_type() != Variant::OBJECT) {
+		method_index = Variant::get_builtin_method_index(variant.get_type(), method);
+	}
 	h = variant.hash();
 	h = hash_murmur3_one_64(Variant::get_builtin_method_hash(variant.get_type(), method), h);
 }
@@ -37,6 +37,7 @@
 class VariantCallable : public CallableCustom {
 	Variant variant;
 	StringName method;
+	int method_index = -1;
 	uint32_t h = 0;
 
 	static bool compare_equal(const CallableCustom *p_a, const CallableCustom *p_b);
@@ -69,6 +69,7 @@
 #define SOCK_IOCTL ioctl
 #define SOCK_CLOSE ::close
 #define SOCK_CONNECT(p_sock, p_addr, p_addr_len) ::connect(p_sock, p_addr, p_addr_len)
+#define SOCK_POLL ::poll
 
 /* Windows */
 #elif defined(WINDOWS_ENABLED)
@@ -85,6 +86,7 @@
 // connect is broken on windows under certain conditions, reasons unknown:
 // See https://github.com/godotengine/webrtc-native/issues/6
 #define SOCK_CONNECT(p_sock, p_addr, p_addr_len) ::WSAConnect(p_sock, p_addr, p_addr_len, nullptr, nullptr, nullptr, nullptr)
+#define SOCK_POLL ::WSAPoll
 
 // Workaround missing flag in MinGW
 #if defined(__MINGW32__) && !defined(SIO_UDP_NETRESET)
@@ -160,6 +162,7 @@ void NetSocketPosix::make_default() {
 	}
 #endif
 	_create = _create_func;
+	NetSocketPollerPosix::make_default();
 }
 
 void NetSocketPosix::cleanup() {
@@ -795,4 +798,132 @@ Error NetSocketPosix::leave_multicast_group(const IPAddress &p_multi_address, co
 	return _change_multicast_group(p_multi_address, p_if_name, false);
 }
 
+NetSocketPoller *NetSocketPollerPosix::_create_func() {
+	return memnew(NetSocketPollerPosix);
+}
+
+void NetSocketPollerPosix::make_default() {
+	_create = _create_func;
+}
+
+Error NetSocketPollerPosix::add(const Ref<NetSocket> &p_sock, NetSocket::PollType p_type, uint64_t p_id) {
+	ERR_FAIL_COND_V(p_sock.is_null() || !p_sock->is_open(), ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V(watches.has(p_sock.ptr()), ERR_ALREADY_EXISTS);
+
+	Watch watch;
+	watch.ref = p_sock;
+	watch.sock = static_cast<const NetSocketPosix *>(p_sock.ptr())->_sock;
+	watch.id = p_id;
+	watch.type = p_type;
+
+#ifdef __linux__
+	ERR_FAIL_COND_V(epoll_fd == -1, ERR_UNAVAILABLE);
+	struct epoll_event ev = {};
+	ev.events = (p_type == NetSocket::POLL_TYPE_OUT ? 0 : EPOLLIN | EPOLLRDHUP) | (p_type == NetSocket::POLL_TYPE_IN ? 0 : EPOLLOUT);
+	ev.data.u64 = p_id;
+	if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, watch.sock, &ev) != 0) {
+		ERR_FAIL_V_MSG(FAILED, "Unable to watch socket, errno: " + itos(errno) + ".");
+	}
+#endif
+
+	watches.insert(p_sock.ptr(), watch);
+	return OK;
+}
+
+void NetSocketPollerPosix::remove(const Ref<NetSocket> &p_sock) {
+	ERR_FAIL_COND(p_sock.is_null());
+	HashMap<const NetSocket *, Watch>::Iterator E = watches.find(p_sock.ptr());
+	if (!E) {
+		return;
+	}
+#ifdef __linux__
+	// Closing a socket already removes it from the epoll set, and its descriptor might have been reused since.
+	if (static_cast<const NetSocketPosix *>(p_sock.ptr())->_sock == E->value.sock) {
+		epoll_ctl(epoll_fd, EPOLL_CTL_DEL, E->value.sock, nullptr);
+	}
+#endif
+	watches.remove(E);
+}
+
+bool NetSocketPollerPosix::has(const Ref<NetSocket> &p_sock) const {
+	return p_sock.is_valid() && watches.has(p_sock.ptr());
+}
+
+int NetSocketPollerPosix::get_socket_count() const {
+	return watches.size();
+}
+
+void NetSocketPollerPosix::clear() {
+#ifdef __linux__
+	if (epoll_fd != -1) {
+		::close(epoll_fd);
+	}
+	epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+#endif
+	watches.clear();
+}
+
+Error NetSocketPollerPosix::wait(int p_timeout, LocalVector<uint64_t> &r_ready) {
+	r_ready.clear();
+	if (watches.is_empty()) {
+		return OK;
+	}
+
+#ifdef __linux__
+	ERR_FAIL_COND_V(epoll_fd == -1, ERR_UNAVAILABLE);
+	events.resize(watches.size());
+	int ret = epoll_wait(epoll_fd, events.ptr(), events.size(), p_timeout);
+	if (ret < 0) {
+		return errno == EINTR ? OK : FAILED;
+	}
+	for (int i = 0; i < ret; i++) {
+		r_ready.push_back(events[i].data.u64);
+	}
+#else
+	poll_fds.clear();
+	poll_ids.clear();
+	for (const KeyValue<const NetSocket *, Watch> &E : watches) {
+		if (static_cast<const NetSocketPosix *>(E.key)->_sock != E.value.sock) {
+			r_ready.push_back(E.value.id); // Closed while watched.
+			continue;
+		}
+		struct pollfd pfd;
+		pfd.fd = E.value.sock;
+		pfd.events = (E.value.type == NetSocket::POLL_TYPE_OUT ? 0 : POLLIN) | (E.value.type == NetSocket::POLL_TYPE_IN ? 0 : POLLOUT);
+		pfd.revents = 0;
+		poll_fds.push_back(pfd);
+		poll_ids.push_back(E.value.id);
+	}
+	if (!r_ready.is_empty()) {
+		p_timeout = 0;
+	}
+	int ret = SOCK_POLL(poll_fds.ptr(), poll_fds.size(), p_timeout);
+	if (ret < 0) {
+		return FAILED;
+	}
+	for (uint32_t i = 0; i < poll_fds.size() && ret > 0; i++) {
+		if (poll_fds[i].revents != 0) {
+			r_ready.push_back(poll_ids[i]);
+			ret--;
+		}
+	}
+#endif
+	return OK;
+}
+
+NetSocketPollerPosix::NetSocketPollerPosix() {
+#ifdef __linux__
+	epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+	ERR_FAIL_COND_MSG(epoll_fd == -1, "Unable to create epoll instance, errno: " + itos(errno) + ".");
+#endif
+}
+
+NetSocketPollerPosix::~NetSocketPollerPosix() {
+#ifdef __linux__
+	if (epoll_fd != -1) {
+		::close(epoll_fd);
+	}
+#endif
+}
+
 #endif // UNIX_SOCKET_UNAVAILABLE
@@ -32,6 +32,7 @@
 #define NET_SOCKET_POSIX_H
 
 #include "core/io/net_socket.h"
+#include "core/templates/hash_map.h"
 
 #if defined(WINDOWS_ENABLED)
 #include <winsock2.h>
@@ -40,11 +41,18 @@
 
 #else
 #include <sys/socket.h>
+#ifdef __linux__
+#include <sys/epoll.h>
+#else
+#include <poll.h>
+#endif
 #define SOCKET_TYPE int
 
 #endif
 
 class NetSocketPosix : public NetSocket {
+	friend class NetSocketPollerPosix;
+
 private:
 	SOCKET_TYPE _sock; // NOLINT - the default value is defined in the .cpp
 	IP::Type _ip_type = IP::TYPE_NONE;
@@ -105,4 +113,41 @@ public:
 	~NetSocketPosix();
 };
 
+// Uses epoll on Linux, so waiting costs as much as the number of ready sockets. Falls back to a single poll() call over all the sockets elsewhere.
+class NetSocketPollerPosix : public NetSocketPoller {
+private:
+	struct Watch {
+		Ref<NetSocket> ref;
+		SOCKET_TYPE sock; // NOLINT - sockets are never watched while closed.
+		uint64_t id = 0;
+		NetSocket::PollType type = NetSocket::POLL_TYPE_IN;
+	};
+
+	// Watched sockets are kept alive, so their address can't be reused by another socket until they are removed.
+	HashMap<const NetSocket *, Watch> watches;
+#ifdef __linux__
+	int epoll_fd = -1;
+	LocalVector<struct epoll_event> events;
+#else
+	LocalVector<struct pollfd> poll_fds;
+	LocalVector<uint64_t> poll_ids;
+#endif
+
+protected:
+	static NetSocketPoller *_create_func();
+
+public:
+	static void make_default();
+
+	virtual Error add(const Ref<NetSocket> &p_sock, NetSocket::PollType p_type, uint64_t p_id) override;
+	virtual void remove(const Ref<NetSocket> &p_sock) override;
+	virtual bool has(const Ref<NetSocket> &p_sock) const override;
+	virtual int get_socket_count() const override;
+	virtual void clear() override;
+	virtual Error wait(int p_timeout, LocalVector<uint64_t> &r_ready) override;
+
+	NetSocketPollerPosix();
+	~NetSocketPollerPosix();
+};
+
 #endif // NET_SOCKET_POSIX_H
@@ -159,10 +159,7 @@ ENetConnection::EventType ENetConnection::_parse_event(const ENetEvent &p_event,
 	}
 }
 
-ENetConnection::EventType ENetConnection::service(int p_timeout, Event &r_event) {
-	ERR_FAIL_NULL_V_MSG(host, EVENT_ERROR, "The ENetConnection instance isn't currently active.");
-	ERR_FAIL_COND_V(r_event.peer.is_valid(), EVENT_ERROR);
-
+void ENetConnection::_drop_inactive_peers() {
 	// Drop peers that have already been disconnected.
 	// NOTE: Forcibly disconnected peers (i.e. peers disconnected via
 	// enet_peer_disconnect*) do not trigger DISCONNECTED events.
@@ -173,6 +170,13 @@ ENetConnection::EventType ENetConnection::service(int p_timeout, Event &r_event)
 		}
 		E = E->next();
 	}
+}
+
+ENetConnection::EventType ENetConnection::service(int p_timeout, Event &r_event) {
+	ERR_FAIL_NULL_V_MSG(host, EVENT_ERROR, "The ENetConnection instance isn't currently active.");
+	ERR_FAIL_COND_V(r_event.peer.is_valid(), EVENT_ERROR);
+
+	_drop_inactive_peers();
 
 	ENetEvent event;
 	int ret = enet_host_service(host, &event, p_timeout);
@@ -197,6 +201,23 @@ int ENetConnection::check_events(EventType &r_type, Event &r_event) {
 	return ret;
 }
 
+int ENetConnection::service_raw(ENetEvent &r_event) {
+	ERR_FAIL_NULL_V_MSG(host, -1, "The ENetConnection instance isn't currently active.");
+	return enet_host_service(host, &r_event, 0);
+}
+
+int ENetConnection::check_events_raw(ENetEvent &r_event) {
+	ERR_FAIL_NULL_V_MSG(host, -1, "The ENetConnection instance isn't currently active.");
+	return enet_host_check_events(host, &r_event);
+}
+
+ENetConnection::EventType ENetConnection::parse_event(const ENetEvent &p_event, Event &r_event) {
+	if (p_event.type == ENET_EVENT_TYPE_CONNECT || p_event.type == ENET_EVENT_TYPE_DISCONNECT) {
+		_drop_inactive_peers(); // Done on every service otherwise.
+	}
+	return _parse_event(p_event, r_event);
+}
+
 void ENetConnection::flush() {
 	ERR_FAIL_NULL_MSG(host, "The ENetConnection instance isn't currently active.");
 	enet_host_flush(host);
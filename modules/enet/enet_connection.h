@@ -83,6 +83,7 @@ private:
 	List<Ref<ENetPacketPeer>> peers;
 
 	EventType _parse_event(const ENetEvent &p_event, Event &r_event);
+	void _drop_inactive_peers();
 	Error _create(ENetAddress *p_address, int p_max_peers, int p_max_channels, int p_in_bandwidth, int p_out_bandwidth);
 	Array _service(int p_timeout = 0);
 	void _broadcast(int p_channel, PackedByteArray p_packet, int p_flags);
@@ -128,6 +129,12 @@ public:
 	void get_peers(List<Ref<ENetPacketPeer>> &r_peers);
 	int get_local_port() const;
 
+	// For hosts serviced by another thread (see ENetMultiplayerPeer::set_io_thread_enabled).
+	// That thread gets raw events, which the thread owning the connection passes to parse_event(), in order.
+	int service_raw(ENetEvent &r_event);
+	int check_events_raw(ENetEvent &r_event);
+	EventType parse_event(const ENetEvent &p_event, Event &r_event);
+
 	// Godot additions
 	Error dtls_server_setup(const Ref<TLSOptions> &p_options);
 	Error dtls_client_setup(const String &p_hostname, const Ref<TLSOptions> &p_options);
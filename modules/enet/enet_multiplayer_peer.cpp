@@ -75,6 +75,9 @@ Error ENetMultiplayerPeer::create_server(int p_port, int p_max_clients, int p_ma
 	unique_id = 1;
 	connection_status = CONNECTION_CONNECTED;
 	hosts[0] = host;
+	if (io_thread_enabled) {
+		_start_io_thread();
+	}
 	return OK;
 }
 
@@ -106,6 +109,9 @@ Error ENetMultiplayerPeer::create_client(const String &p_address, int p_port, in
 	active_mode = MODE_CLIENT;
 	peers[1] = peer;
 	hosts[0] = host;
+	if (io_thread_enabled) {
+		_start_io_thread();
+	}
 
 	return OK;
 }
@@ -165,9 +171,50 @@ void ENetMultiplayerPeer::_disconnect_inactive_peers() {
 	}
 }
 
+bool ENetMultiplayerPeer::_next_event(bool p_first, ENetConnection::EventType &r_type, ENetConnection::Event &r_event) {
+	if (!hosts.has(0)) {
+		return false;
+	}
+	r_event = ENetConnection::Event();
+
+	// Events left by a stopped I/O thread are processed before servicing again.
+	if (io_thread.is_started() || !io_events.is_empty()) {
+		if (io_thread_error.is_set()) {
+			io_thread_error.clear();
+			r_type = ENetConnection::EVENT_ERROR;
+			return true;
+		}
+		IOEvent ev;
+		if (!io_events.pop(ev)) {
+			return false;
+		}
+		const uint64_t latency = OS::get_singleton()->get_ticks_usec() - ev.time;
+		io_max_event_latency_usec = MAX(io_max_event_latency_usec, latency);
+		if (ev.event.type != ENET_EVENT_TYPE_CONNECT && ev.event.peer->data == nullptr) {
+			// The peer was reset after the event was queued.
+			if (ev.event.packet) {
+				enet_packet_destroy(ev.event.packet);
+			}
+			r_type = ENetConnection::EVENT_NONE;
+			return true;
+		}
+		r_type = hosts[0]->parse_event(ev.event, r_event);
+		return true;
+	}
+
+	if (p_first) {
+		r_type = hosts[0]->service(0, r_event);
+		return true;
+	}
+	return hosts[0]->check_events(r_type, r_event) > 0;
+}
+
 void ENetMultiplayerPeer::poll() {
 	ERR_FAIL_COND_MSG(!_is_active(), "The multiplayer instance isn't currently active.");
 
+	// The I/O thread (if any) skips servicing the host while its events are processed.
+	MutexLock lock(host_mutex);
+
 	_pop_current_packet();
 
 	_disconnect_inactive_peers();
@@ -179,8 +226,10 @@ void ENetMultiplayerPeer::poll() {
 				return;
 			}
 			ENetConnection::Event event;
-			ENetConnection::EventType ret = hosts[0]->service(0, event);
-			do {
+			ENetConnection::EventType ret = ENetConnection::EVENT_NONE;
+			bool first = true;
+			while (_next_event(first, ret, event)) {
+				first = false;
 				if (ret == ENetConnection::EVENT_CONNECT) {
 					connection_status = CONNECTION_CONNECTED;
 					emit_signal(SNAME("peer_connected"), 1);
@@ -195,12 +244,14 @@ void ENetMultiplayerPeer::poll() {
 				} else if (ret != ENetConnection::EVENT_NONE) {
 					close(); // Error.
 				}
-			} while (hosts.has(0) && hosts[0]->check_events(ret, event) > 0);
+			}
 		} break;
 		case MODE_SERVER: {
 			ENetConnection::Event event;
-			ENetConnection::EventType ret = hosts[0]->service(0, event);
-			do {
+			ENetConnection::EventType ret = ENetConnection::EVENT_NONE;
+			bool first = true;
+			while (_next_event(first, ret, event)) {
+				first = false;
 				if (ret == ENetConnection::EVENT_CONNECT) {
 					if (is_refusing_new_connections()) {
 						event.peer->reset();
@@ -229,7 +280,7 @@ void ENetMultiplayerPeer::poll() {
 				} else if (ret != ENetConnection::EVENT_NONE) {
 					close(); // Error
 				}
-			} while (hosts.has(0) && hosts[0]->check_events(ret, event) > 0);
+			}
 		} break;
 		case MODE_MESH: {
 			HashSet<int> to_drop;
@@ -272,6 +323,7 @@ bool ENetMultiplayerPeer::is_server_relay_supported() const {
 
 void ENetMultiplayerPeer::disconnect_peer(int p_peer, bool p_force) {
 	ERR_FAIL_COND(!_is_active() || !peers.has(p_peer));
+	MutexLock lock(host_mutex);
 	peers[p_peer]->peer_disconnect(0); // Will be removed during next poll.
 	if (active_mode == MODE_CLIENT || active_mode == MODE_SERVER) {
 		hosts[0]->flush();
@@ -296,6 +348,7 @@ void ENetMultiplayerPeer::close() {
 		return;
 	}
 
+	_stop_io_thread(true);
 	_pop_current_packet();
 
 	for (KeyValue<int, Ref<ENetPacketPeer>> &E : peers) {
@@ -340,6 +393,8 @@ Error ENetMultiplayerPeer::put_packet(const uint8_t *p_buffer, int p_buffer_size
 	ERR_FAIL_COND_V_MSG(target_peer != 0 && !peers.has(ABS(target_peer)), ERR_INVALID_PARAMETER, vformat("Invalid target peer: %d", target_peer));
 	ERR_FAIL_COND_V(active_mode == MODE_CLIENT && !peers.has(1), ERR_BUG);
 
+	MutexLock lock(host_mutex);
+
 	int packet_flags = 0;
 	int channel = SYSCH_RELIABLE;
 	int tr_channel = get_transfer_channel();
@@ -443,6 +498,7 @@ int ENetMultiplayerPeer::get_unique_id() const {
 void ENetMultiplayerPeer::set_refuse_new_connections(bool p_enabled) {
 #ifdef GODOT_ENET
 	if (_is_active()) {
+		MutexLock lock(host_mutex);
 		for (KeyValue<int, Ref<ENetConnection>> &E : hosts) {
 			E.value->refuse_new_connections(p_enabled);
 		}
@@ -470,6 +526,102 @@ void ENetMultiplayerPeer::_destroy_unused(ENetPacket *p_packet) {
 	}
 }
 
+void ENetMultiplayerPeer::_io_thread_func(void *p_user) {
+	ENetMultiplayerPeer *mp = static_cast<ENetMultiplayerPeer *>(p_user);
+	const OS *os = OS::get_singleton();
+	while (!mp->io_thread_exit.is_set()) {
+		// Never wait for the main thread, nor service when there is no room left for events.
+		if (mp->io_events.size() < mp->io_events.get_capacity() && mp->host_mutex.try_lock()) {
+			const uint64_t begin = os->get_ticks_usec();
+			IOEvent ev;
+			int ret = mp->io_host->service_raw(ev.event);
+			while (ret > 0) {
+				ev.time = os->get_ticks_usec();
+				mp->io_events.push(ev);
+				if (mp->io_events.size() == mp->io_events.get_capacity()) {
+					break; // Remaining events are dispatched on the next service.
+				}
+				ret = mp->io_host->check_events_raw(ev.event);
+			}
+			mp->host_mutex.unlock();
+
+			mp->io_max_service_usec.exchange_if_greater(os->get_ticks_usec() - begin);
+			mp->io_max_queued_events.exchange_if_greater(mp->io_events.size());
+			if (ret < 0) {
+				mp->io_thread_error.set(); // Closes the peer on the next poll.
+				return;
+			}
+		}
+		os->delay_usec(IO_THREAD_INTERVAL_USEC);
+	}
+}
+
+void ENetMultiplayerPeer::_start_io_thread() {
+	if (io_thread.is_started() || !hosts.has(0) || (active_mode != MODE_SERVER && active_mode != MODE_CLIENT)) {
+		return;
+	}
+	io_host = hosts[0];
+	if (io_events.get_capacity() == 0) {
+		io_events.set_capacity(IO_THREAD_QUEUE_SIZE);
+	}
+	io_thread_exit.clear();
+	io_thread_error.clear();
+	io_thread.start(_io_thread_func, this);
+}
+
+void ENetMultiplayerPeer::_stop_io_thread(bool p_discard_events) {
+	if (io_thread.is_started()) {
+		io_thread_exit.set();
+		io_thread.wait_to_finish();
+		io_host.unref();
+	}
+	if (!p_discard_events) {
+		return; // Processed by the next poll.
+	}
+	io_thread_error.clear();
+	IOEvent ev;
+	while (io_events.pop(ev)) {
+		if (ev.event.type == ENET_EVENT_TYPE_RECEIVE) {
+			enet_packet_destroy(ev.event.packet);
+		}
+	}
+}
+
+void ENetMultiplayerPeer::set_io_thread_enabled(bool p_enabled) {
+	io_thread_enabled = p_enabled;
+	if (p_enabled) {
+		_start_io_thread();
+	} else {
+		_stop_io_thread(false);
+	}
+}
+
+bool ENetMultiplayerPeer::is_io_thread_enabled() const {
+	return io_thread_enabled;
+}
+
+double ENetMultiplayerPeer::pop_io_thread_statistic(IOThreadStatistic p_stat) {
+	uint64_t value = 0;
+	switch (p_stat) {
+		case IO_THREAD_QUEUED_EVENTS:
+			value = io_events.size();
+			break;
+		case IO_THREAD_MAX_QUEUED_EVENTS:
+			value = io_max_queued_events.get();
+			io_max_queued_events.set(0);
+			break;
+		case IO_THREAD_MAX_SERVICE_USEC:
+			value = io_max_service_usec.get();
+			io_max_service_usec.set(0);
+			break;
+		case IO_THREAD_MAX_EVENT_LATENCY_USEC:
+			value = io_max_event_latency_usec;
+			io_max_event_latency_usec = 0;
+			break;
+	}
+	return value;
+}
+
 void ENetMultiplayerPeer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("create_server", "port", "max_clients", "max_channels", "in_bandwidth", "out_bandwidth"), &ENetMultiplayerPeer::create_server, DEFVAL(32), DEFVAL(0), DEFVAL(0), DEFVAL(0));
 	ClassDB::bind_method(D_METHOD("create_client", "address", "port", "channel_count", "in_bandwidth", "out_bandwidth", "local_port"), &ENetMultiplayerPeer::create_client, DEFVAL(0), DEFVAL(0), DEFVAL(0), DEFVAL(0));
@@ -480,7 +632,17 @@ void ENetMultiplayerPeer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_host"), &ENetMultiplayerPeer::get_host);
 	ClassDB::bind_method(D_METHOD("get_peer", "id"), &ENetMultiplayerPeer::get_peer);
 
+	ClassDB::bind_method(D_METHOD("set_io_thread_enabled", "enabled"), &ENetMultiplayerPeer::set_io_thread_enabled);
+	ClassDB::bind_method(D_METHOD("is_io_thread_enabled"), &ENetMultiplayerPeer::is_io_thread_enabled);
+	ClassDB::bind_method(D_METHOD("pop_io_thread_statistic", "statistic"), &ENetMultiplayerPeer::pop_io_thread_statistic);
+
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "host", PROPERTY_HINT_RESOURCE_TYPE, "ENetConnection", PROPERTY_USAGE_NONE), "", "get_host");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "io_thread"), "set_io_thread_enabled", "is_io_thread_enabled");
+
+	BIND_ENUM_CONSTANT(IO_THREAD_QUEUED_EVENTS);
+	BIND_ENUM_CONSTANT(IO_THREAD_MAX_QUEUED_EVENTS);
+	BIND_ENUM_CONSTANT(IO_THREAD_MAX_SERVICE_USEC);
+	BIND_ENUM_CONSTANT(IO_THREAD_MAX_EVENT_LATENCY_USEC);
 }
 
 ENetMultiplayerPeer::ENetMultiplayerPeer() {
@@ -491,6 +653,7 @@ ENetMultiplayerPeer::~ENetMultiplayerPeer() {
 	if (_is_active()) {
 		close();
 	}
+	_stop_io_thread(true);
 }
 
 // Sets IP for ENet to bind when using create_server or create_client
@@ -34,6 +34,10 @@
 #include "enet_connection.h"
 
 #include "core/crypto/crypto.h"
+#include "core/os/mutex.h"
+#include "core/os/thread.h"
+#include "core/templates/safe_refcount.h"
+#include "core/templates/spsc_queue.h"
 #include "scene/main/multiplayer_peer.h"
 
 #include <enet/enet.h>
@@ -41,6 +45,14 @@
 class ENetMultiplayerPeer : public MultiplayerPeer {
 	GDCLASS(ENetMultiplayerPeer, MultiplayerPeer);
 
+public:
+	enum IOThreadStatistic {
+		IO_THREAD_QUEUED_EVENTS,
+		IO_THREAD_MAX_QUEUED_EVENTS,
+		IO_THREAD_MAX_SERVICE_USEC,
+		IO_THREAD_MAX_EVENT_LATENCY_USEC,
+	};
+
 private:
 	enum {
 		SYSMSG_ADD_PEER,
@@ -82,6 +94,34 @@ private:
 
 	Packet current_packet;
 
+	// Services the host of clients and servers while the main thread is busy, events are handed over in order through io_events.
+	// The host is only used with host_mutex locked while the thread runs, the thread never waits for it.
+	enum {
+		IO_THREAD_QUEUE_SIZE = 4096,
+		IO_THREAD_INTERVAL_USEC = 1000,
+	};
+
+	struct IOEvent {
+		ENetEvent event = {};
+		uint64_t time = 0;
+	};
+
+	bool io_thread_enabled = false;
+	Thread io_thread;
+	SafeFlag io_thread_exit;
+	SafeFlag io_thread_error;
+	Mutex host_mutex;
+	Ref<ENetConnection> io_host;
+	SPSCQueue<IOEvent> io_events;
+	SafeNumeric<uint64_t> io_max_queued_events;
+	SafeNumeric<uint64_t> io_max_service_usec;
+	uint64_t io_max_event_latency_usec = 0;
+
+	static void _io_thread_func(void *p_user);
+	void _start_io_thread();
+	void _stop_io_thread(bool p_discard_events);
+	bool _next_event(bool p_first, ENetConnection::EventType &r_type, ENetConnection::Event &r_event);
+
 	void _store_packet(int32_t p_source, ENetConnection::Event &p_event);
 	void _pop_current_packet();
 	void _disconnect_inactive_peers();
@@ -126,6 +166,10 @@ public:
 
 	void set_bind_ip(const IPAddress &p_ip);
 
+	void set_io_thread_enabled(bool p_enabled);
+	bool is_io_thread_enabled() const;
+	double pop_io_thread_statistic(IOThreadStatistic p_stat);
+
 	Ref<ENetConnection> get_host() const;
 	Ref<ENetPacketPeer> get_peer(int p_id) const;
 
@@ -133,4 +177,6 @@ public:
 	~ENetMultiplayerPeer();
 };
 
+VARIANT_ENUM_CAST(ENetMultiplayerPeer::IOThreadStatistic);
+
 #endif // ENET_MULTIPLAYER_PEER_H
@@ -0,0 +1,132 @@
+/**************************************************************************/
+/*  test_enet_multiplayer_peer.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_ENET_MULTIPLAYER_PEER_H
+#define TEST_ENET_MULTIPLAYER_PEER_H
+
+#include "../enet_multiplayer_peer.h"
+
+#include "core/os/os.h"
+
+#include "tests/test_macros.h"
+
+namespace TestENetMultiplayerPeer {
+
+// Polls the active peers until the condition is met, for up to 5 seconds.
+template <typename F>
+static bool poll_until(const LocalVector<Ref<ENetMultiplayerPeer>> &p_peers, F p_condition) {
+	for (int i = 0; i < 5000; i++) {
+		for (const Ref<ENetMultiplayerPeer> &peer : p_peers) {
+			if (peer->get_connection_status() != MultiplayerPeer::CONNECTION_DISCONNECTED) {
+				peer->poll();
+			}
+		}
+		if (p_condition()) {
+			return true;
+		}
+		OS::get_singleton()->delay_usec(1000);
+	}
+	return false;
+}
+
+static int get_host_peer_count(const Ref<ENetMultiplayerPeer> &p_peer) {
+	List<Ref<ENetPacketPeer>> peers;
+	p_peer->get_host()->get_peers(peers);
+	return peers.size();
+}
+
+TEST_CASE("[ENetMultiplayerPeer] Serviced by the I/O thread") {
+	Ref<ENetMultiplayerPeer> server;
+	server.instantiate();
+	server->set_io_thread_enabled(true);
+	REQUIRE(server->create_server(0) == OK);
+	const int port = server->get_host()->get_local_port();
+	REQUIRE(port > 0);
+
+	LocalVector<Ref<ENetMultiplayerPeer>> all_peers;
+	all_peers.push_back(server);
+	Ref<ENetMultiplayerPeer> clients[2];
+	for (Ref<ENetMultiplayerPeer> &client : clients) {
+		client.instantiate();
+		client->set_io_thread_enabled(true);
+		REQUIRE(client->create_client("127.0.0.1", port) == OK);
+		all_peers.push_back(client);
+	}
+	REQUIRE(poll_until(all_peers, [&]() {
+		return clients[0]->get_connection_status() == MultiplayerPeer::CONNECTION_CONNECTED && clients[1]->get_connection_status() == MultiplayerPeer::CONNECTION_CONNECTED;
+	}));
+	CHECK(get_host_peer_count(server) == 2);
+
+	SUBCASE("Packets are received while the main thread is busy") {
+		clients[0]->set_target_peer(MultiplayerPeer::TARGET_PEER_SERVER);
+		for (uint8_t i = 0; i < 10; i++) {
+			REQUIRE(clients[0]->put_packet(&i, 1) == OK);
+		}
+		// Neither peer is polled, their threads send and receive the packets.
+		for (int i = 0; i < 1000 && server->pop_io_thread_statistic(ENetMultiplayerPeer::IO_THREAD_QUEUED_EVENTS) < 10; i++) {
+			OS::get_singleton()->delay_usec(1000);
+		}
+		CHECK(server->pop_io_thread_statistic(ENetMultiplayerPeer::IO_THREAD_QUEUED_EVENTS) == 10);
+
+		server->poll();
+		REQUIRE(server->get_available_packet_count() == 10);
+		for (uint8_t i = 0; i < 10; i++) {
+			CHECK(server->get_packet_peer() == clients[0]->get_unique_id());
+			const uint8_t *buffer = nullptr;
+			int size = 0;
+			REQUIRE(server->get_packet(&buffer, size) == OK);
+			REQUIRE(size == 1);
+			CHECK(buffer[0] == i);
+		}
+		CHECK(server->pop_io_thread_statistic(ENetMultiplayerPeer::IO_THREAD_QUEUED_EVENTS) == 0);
+		CHECK(server->pop_io_thread_statistic(ENetMultiplayerPeer::IO_THREAD_MAX_QUEUED_EVENTS) >= 10);
+	}
+
+	SUBCASE("Reset peers are dropped along with disconnected ones") {
+		// Resetting a peer doesn't generate any event. Done with the thread stopped, since it services the host.
+		server->set_io_thread_enabled(false);
+		server->get_peer(clients[0]->get_unique_id())->peer_disconnect_now();
+		server->set_io_thread_enabled(true);
+		CHECK(get_host_peer_count(server) == 2);
+
+		clients[1]->close();
+		CHECK(poll_until(all_peers, [&]() {
+			return get_host_peer_count(server) == 0;
+		}));
+	}
+
+	for (Ref<ENetMultiplayerPeer> &peer : all_peers) {
+		peer->close();
+	}
+}
+
+} // namespace TestENetMultiplayerPeer
+
+#endif // TEST_ENET_MULTIPLAYER_PEER_H
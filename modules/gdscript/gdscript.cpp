@@ -31,6 +31,7 @@
 #include "gdscript.h"
 
 #include "gdscript_analyzer.h"
+#include "gdscript_bytecode_cache.h"
 #include "gdscript_cache.h"
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
@@ -592,6 +593,7 @@ bool GDScript::_update_exports(bool *r_err, bool p_recursive_call, PlaceHolderSc
 				}
 				valid = false; // to show error in the editor
 				base_cache->valid = false;
+				GDScriptFunction::invalidate_lookup_caches();
 				base_cache->inheriters_cache.clear(); // to prevent future stackoverflows
 				base_cache.unref();
 				base.unref();
@@ -764,31 +766,38 @@ Error GDScript::reload(bool p_keep_state) {
 	}
 #endif
 
-	{
-		String source_path = path;
-		if (source_path.is_empty()) {
-			source_path = get_path();
-		}
-		if (!source_path.is_empty()) {
-			if (GDScriptCache::get_cached_script(source_path).is_null()) {
-				MutexLock lock(GDScriptCache::singleton->mutex);
-				GDScriptCache::singleton->shallow_gdscript_cache[source_path] = Ref<GDScript>(this);
+	String source_path = path;
+	if (source_path.is_empty()) {
+		source_path = get_path();
+	}
+	if (!source_path.is_empty()) {
+		if (GDScriptCache::get_cached_script(source_path).is_null()) {
+			MutexLock lock(GDScriptCache::singleton->mutex);
+			GDScriptCache::singleton->shallow_gdscript_cache[source_path] = Ref<GDScript>(this);
+		}
+		if (GDScriptCache::has_parser(source_path)) {
+			Error err = OK;
+			Ref<GDScriptParserRef> parser_ref = GDScriptCache::get_parser(source_path, GDScriptParserRef::EMPTY, err);
+			if (parser_ref.is_valid() && parser_ref->get_source_hash() != _get_source_hash()) {
+				GDScriptCache::remove_parser(source_path);
 			}
-			if (GDScriptCache::has_parser(source_path)) {
-				Error err = OK;
-				Ref<GDScriptParserRef> parser_ref = GDScriptCache::get_parser(source_path, GDScriptParserRef::EMPTY, err);
-				if (parser_ref.is_valid()) {
-					uint32_t source_hash;
-					if (!binary_tokens.is_empty()) {
-						source_hash = hash_djb2_buffer(binary_tokens.ptr(), binary_tokens.size());
-					} else {
-						source_hash = source.hash();
-					}
-					if (parser_ref->get_source_hash() != source_hash) {
-						GDScriptCache::remove_parser(source_path);
-					}
-				}
+		}
+	}
+
+	if (!has_instances && !valid && !source_path.is_empty() && GDScriptCache::is_bytecode_cache_enabled()) {
+		// First load, skip compiling if the bytecode from a previous run is still up to date.
+		Vector<uint8_t> bytecode = GDScriptCache::get_bytecode(source_path, _get_source_hash());
+		bool add_static_script = false;
+		if (!bytecode.is_empty() && GDScriptBytecodeCache::deserialize(this, bytecode, add_static_script) == OK) {
+			if (add_static_script) {
+				GDScriptCache::add_static_script(this);
+			}
+			Error err = GDScriptCache::finish_compiling(path);
+			if (err == OK && (ScriptServer::is_scripting_enabled() || is_tool())) {
+				err = _static_init();
 			}
+			reloading = false;
+			return err;
 		}
 	}
 
@@ -801,6 +810,7 @@ Error GDScript::reload(bool p_keep_state) {
 #endif
 
 	valid = false;
+	GDScriptFunction::invalidate_lookup_caches();
 	GDScriptParser parser;
 	Error err;
 	if (!binary_tokens.is_empty()) {
@@ -886,6 +896,13 @@ Error GDScript::reload(bool p_keep_state) {
 	return OK;
 }
 
+uint32_t GDScript::_get_source_hash() const {
+	if (!binary_tokens.is_empty()) {
+		return hash_djb2_buffer(binary_tokens.ptr(), binary_tokens.size());
+	}
+	return source.hash();
+}
+
 ScriptLanguage *GDScript::get_language() const {
 	return GDScriptLanguage::get_singleton();
 }
@@ -1554,6 +1571,7 @@ void GDScript::clear(ClearData *p_clear_data) {
 		clear_data->functions.insert(E.value);
 	}
 	member_functions.clear();
+	GDScriptFunction::invalidate_lookup_caches();
 
 	for (KeyValue<StringName, MemberInfo> &E : member_indices) {
 		clear_data->scripts.insert(E.value.data_type.script_type_ref);
@@ -2934,6 +2952,9 @@ GDScriptLanguage::GDScriptLanguage() {
 		_debug_max_call_stack = 0;
 	}
 
+	GLOBAL_DEF("gdscript/bytecode_cache/enabled", false);
+	GLOBAL_DEF(PropertyInfo(Variant::STRING, "gdscript/bytecode_cache/path", PROPERTY_HINT_DIR), "user://gdscript_bytecode_cache");
+
 #ifdef DEBUG_ENABLED
 	GLOBAL_DEF("debug/gdscript/warnings/enable", true);
 	GLOBAL_DEF("debug/gdscript/warnings/exclude_addons", true);
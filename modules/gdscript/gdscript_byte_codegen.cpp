@@ -186,8 +186,13 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 #endif
 	append_opcode(GDScriptFunction::OPCODE_END);
 
+	// Temporaries that fused instructions no longer reference get no stack slot.
+	int temporary_slot_count = 0;
 	for (int i = 0; i < temporaries.size(); i++) {
-		int stack_index = i + max_locals + GDScriptFunction::FIXED_ADDRESSES_MAX;
+		if (temporaries[i].bytecode_indices.is_empty()) {
+			continue;
+		}
+		int stack_index = temporary_slot_count++ + max_locals + GDScriptFunction::FIXED_ADDRESSES_MAX;
 		for (int j = 0; j < temporaries[i].bytecode_indices.size(); j++) {
 			opcodes.write[temporaries[i].bytecode_indices[j]] = stack_index | (GDScriptFunction::ADDR_TYPE_STACK << GDScriptFunction::ADDR_BITS);
 		}
@@ -216,9 +221,13 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 		}
 		function->_global_names_count = function->global_names.size();
 
+		function->lookup_caches.resize(name_map.size() * GDScriptFunction::LOOKUP_CACHE_MAX);
+		function->_lookup_caches_ptr = function->lookup_caches.ptr();
+
 	} else {
 		function->_global_names_ptr = nullptr;
 		function->_global_names_count = 0;
+		function->_lookup_caches_ptr = nullptr;
 	}
 
 	if (opcodes.size()) {
@@ -398,7 +407,7 @@ GDScriptFunction *GDScriptByteCodeGenerator::write_end() {
 	if (debug_stack) {
 		function->stack_debug = stack_debug;
 	}
-	function->_stack_size = GDScriptFunction::FIXED_ADDRESSES_MAX + max_locals + temporaries.size();
+	function->_stack_size = GDScriptFunction::FIXED_ADDRESSES_MAX + max_locals + temporary_slot_count;
 	function->_instruction_args_size = instr_args_max;
 
 #ifdef DEBUG_ENABLED
@@ -598,6 +607,8 @@ void GDScriptByteCodeGenerator::write_binary_operator(const Address &p_target, V
 		// Gather specific operator.
 		Variant::ValidatedOperatorEvaluator op_func = Variant::get_validated_operator_evaluator(p_operator, p_left_operand.type.builtin_type, p_right_operand.type.builtin_type);
 
+		last_operator_pos = opcodes.size();
+		last_operator_target = p_target;
 		append_opcode(GDScriptFunction::OPCODE_OPERATOR_VALIDATED);
 		append(p_left_operand);
 		append(p_right_operand);
@@ -675,16 +686,39 @@ void GDScriptByteCodeGenerator::write_type_test(const Address &p_target, const A
 	}
 }
 
-void GDScriptByteCodeGenerator::write_and_left_operand(const Address &p_left_operand) {
+bool GDScriptByteCodeGenerator::_is_last_operator_writing_to(const Address &p_target) const {
+#ifdef TESTS_ENABLED
+	if (peephole_disabled) {
+		return false;
+	}
+#endif
+	if (last_operator_pos < 0 || last_operator_pos + 5 != opcodes.size() || last_label_pos > last_operator_pos) {
+		// Not the last instruction, or something may jump in between.
+		return false;
+	}
+	return opcodes[last_operator_pos] == GDScriptFunction::OPCODE_OPERATOR_VALIDATED && last_operator_target.mode == p_target.mode && last_operator_target.address == p_target.address;
+}
+
+void GDScriptByteCodeGenerator::_write_jump_if_not(const Address &p_condition) {
+	// Fuse a boolean comparison that is immediately tested into a single compare-and-branch instruction.
+	// The result is still written to the temporary, so later reads of the condition stay valid.
+	if (p_condition.mode == Address::TEMPORARY && temporaries[p_condition.address].type == Variant::BOOL && _is_last_operator_writing_to(p_condition)) {
+		opcodes.write[last_operator_pos] = GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT;
+		last_operator_pos = -1;
+		return;
+	}
 	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_left_operand);
+	append(p_condition);
+}
+
+void GDScriptByteCodeGenerator::write_and_left_operand(const Address &p_left_operand) {
+	_write_jump_if_not(p_left_operand);
 	logic_op_jump_pos1.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
 
 void GDScriptByteCodeGenerator::write_and_right_operand(const Address &p_right_operand) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_right_operand);
+	_write_jump_if_not(p_right_operand);
 	logic_op_jump_pos2.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
@@ -703,6 +737,7 @@ void GDScriptByteCodeGenerator::write_end_and(const Address &p_target) {
 	logic_op_jump_pos2.pop_back();
 	append_opcode(GDScriptFunction::OPCODE_ASSIGN_FALSE);
 	append(p_target);
+	last_label_pos = opcodes.size();
 }
 
 void GDScriptByteCodeGenerator::write_or_left_operand(const Address &p_left_operand) {
@@ -733,6 +768,7 @@ void GDScriptByteCodeGenerator::write_end_or(const Address &p_target) {
 	logic_op_jump_pos2.pop_back();
 	append_opcode(GDScriptFunction::OPCODE_ASSIGN_TRUE);
 	append(p_target);
+	last_label_pos = opcodes.size();
 }
 
 void GDScriptByteCodeGenerator::write_start_ternary(const Address &p_target) {
@@ -740,8 +776,7 @@ void GDScriptByteCodeGenerator::write_start_ternary(const Address &p_target) {
 }
 
 void GDScriptByteCodeGenerator::write_ternary_condition(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	_write_jump_if_not(p_condition);
 	ternary_jump_fail_pos.push_back(opcodes.size());
 	append(0); // Jump target, will be patched.
 }
@@ -951,6 +986,18 @@ void GDScriptByteCodeGenerator::write_assign_with_conversion(const Address &p_ta
 }
 
 void GDScriptByteCodeGenerator::write_assign(const Address &p_target, const Address &p_source) {
+	// Fuse `x = x op y` and `x = y op x` on a typed numeric local into an in-place operation, dropping the move from the temporary.
+	// Only done for scalars, since their validated evaluators read both operands before writing the result. The target must be
+	// one of the operands: validated evaluators expect the result to already hold the right type, which an operand is known to,
+	// while a local that was just declared may still be null.
+	if (p_source.mode == Address::TEMPORARY && (p_target.mode == Address::LOCAL_VARIABLE || p_target.mode == Address::FUNCTION_PARAMETER) && p_target.type.kind == GDScriptDataType::BUILTIN && (p_target.type.builtin_type == Variant::INT || p_target.type.builtin_type == Variant::FLOAT) && temporaries[p_source.address].type == p_target.type.builtin_type && _is_last_operator_writing_to(p_source) && (opcodes[last_operator_pos + 1] == address_of(p_target) || opcodes[last_operator_pos + 2] == address_of(p_target))) {
+		// The temporary is no longer referenced by this instruction, so it must not be patched over the new target.
+		temporaries.write[p_source.address].bytecode_indices.erase(last_operator_pos + 3);
+		opcodes.write[last_operator_pos + 3] = address_of(p_target);
+		last_operator_pos = -1;
+		return;
+	}
+
 	if (p_target.type.kind == GDScriptDataType::BUILTIN && p_target.type.builtin_type == Variant::ARRAY && p_target.type.has_container_element_type(0)) {
 		const GDScriptDataType &element_type = p_target.type.get_container_element_type(0);
 		append_opcode(GDScriptFunction::OPCODE_ASSIGN_TYPED_ARRAY);
@@ -1011,6 +1058,7 @@ void GDScriptByteCodeGenerator::write_assign_default_parameter(const Address &p_
 void GDScriptByteCodeGenerator::write_store_global(const Address &p_dst, int p_global_index) {
 	append_opcode(GDScriptFunction::OPCODE_STORE_GLOBAL);
 	append(p_dst);
+	function->global_index_positions.push_back(opcodes.size());
 	append(p_global_index);
 }
 
@@ -1495,8 +1543,7 @@ void GDScriptByteCodeGenerator::write_await(const Address &p_target, const Addre
 }
 
 void GDScriptByteCodeGenerator::write_if(const Address &p_condition) {
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	_write_jump_if_not(p_condition);
 	if_jmp_addrs.push_back(opcodes.size());
 	append(0); // Jump destination, will be patched.
 }
@@ -1661,6 +1708,7 @@ void GDScriptByteCodeGenerator::write_for(const Address &p_variable, bool p_use_
 	// Next iteration.
 	int continue_addr = opcodes.size();
 	continue_addrs.push_back(continue_addr);
+	last_label_pos = continue_addr;
 	append_opcode(iterate_opcode);
 	append(counter);
 	append(container);
@@ -1702,12 +1750,12 @@ void GDScriptByteCodeGenerator::write_endfor() {
 void GDScriptByteCodeGenerator::start_while_condition() {
 	current_breaks_to_patch.push_back(List<int>());
 	continue_addrs.push_back(opcodes.size());
+	last_label_pos = opcodes.size();
 }
 
 void GDScriptByteCodeGenerator::write_while(const Address &p_condition) {
 	// Condition check.
-	append_opcode(GDScriptFunction::OPCODE_JUMP_IF_NOT);
-	append(p_condition);
+	_write_jump_if_not(p_condition);
 	while_jmp_addrs.push_back(opcodes.size());
 	append(0); // End of loop address, will be patched.
 }
@@ -158,6 +158,11 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	List<List<int>> current_breaks_to_patch;
 
+	// Peephole state, used to fuse instructions as they are emitted.
+	int last_operator_pos = -1; // Position of the last validated binary operator instruction.
+	Address last_operator_target;
+	int last_label_pos = -1; // Last position that was made a jump target.
+
 	void add_stack_identifier(const StringName &p_id, int p_stackpos) {
 		if (locals.size() > max_locals) {
 			max_locals = locals.size();
@@ -449,9 +454,18 @@ class GDScriptByteCodeGenerator : public GDScriptCodeGenerator {
 
 	void patch_jump(int p_address) {
 		opcodes.write[p_address] = opcodes.size();
+		last_label_pos = opcodes.size();
 	}
 
+	bool _is_last_operator_writing_to(const Address &p_target) const;
+	void _write_jump_if_not(const Address &p_condition);
+
 public:
+#ifdef TESTS_ENABLED
+	// Lets benchmarks compare against bytecode without fused instructions.
+	static inline bool peephole_disabled = false;
+#endif
+
 	virtual uint32_t add_parameter(const StringName &p_name, bool p_is_optional, const GDScriptDataType &p_type) override;
 	virtual uint32_t add_local(const StringName &p_name, const GDScriptDataType &p_type) override;
 	virtual uint32_t add_local_constant(const StringName &p_name, const Variant &p_constant) override;
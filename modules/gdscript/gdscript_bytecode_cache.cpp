@@ -0,0 +1,2100 @@
+/**************************************************************************/
+/*  gdscript_bytecode_cache.cpp                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#include "gdscript_bytecode_cache.h"
+
+#include "gdscript_cache.h"
+#include "gdscript_utility_functions.h"
+
+#include "core/config/engine.h"
+#include "core/debugger/engine_debugger.h"
+#include "core/io/marshalls.h"
+#include "core/io/resource_loader.h"
+#include "core/object/class_db.h"
+#include "core/version.h"
+
+static const uint8_t BYTECODE_MAGIC[4] = { 'G', 'D', 'B', 'C' };
+static const int MAX_NESTING_DEPTH = 64;
+
+enum VariantTag {
+	VARIANT_TAG_VALUE,
+	VARIANT_TAG_ARRAY,
+	VARIANT_TAG_DICTIONARY,
+	VARIANT_TAG_OBJECT,
+};
+
+enum ObjectTag {
+	OBJECT_TAG_NULL,
+	OBJECT_TAG_GLOBAL, // An entry of the global array, e.g. a native class or an engine singleton.
+	OBJECT_TAG_LOCAL_CLASS, // A class in the script being stored.
+	OBJECT_TAG_EXTERNAL_CLASS, // A class in another script file.
+	OBJECT_TAG_RESOURCE,
+};
+
+enum DataTypeScript {
+	DATA_TYPE_SCRIPT_NONE,
+	DATA_TYPE_SCRIPT_WEAK, // Local class, not referenced to avoid cycles.
+	DATA_TYPE_SCRIPT_STRONG,
+};
+
+template <typename K, typename V>
+static const V *_find_validated_name(const RBMap<K, V> &p_map, const K &p_key) {
+	const typename RBMap<K, V>::Element *E = p_map.find(p_key);
+	return E ? &E->value() : nullptr;
+}
+
+enum FunctionRole {
+	FUNCTION_ROLE_MEMBER,
+	FUNCTION_ROLE_IMPLICIT_INITIALIZER,
+	FUNCTION_ROLE_IMPLICIT_READY,
+	FUNCTION_ROLE_STATIC_INITIALIZER,
+};
+
+struct GDScriptBytecodeCache::Writer {
+	LocalVector<uint8_t> data;
+	GDScript *root = nullptr;
+	HashMap<int, StringName> global_names; // Global array index to name, for `OPCODE_STORE_GLOBAL`.
+	HashMap<ObjectID, StringName> global_objects;
+	bool failed = false;
+
+	void put_8(uint8_t p_value) {
+		data.push_back(p_value);
+	}
+
+	void put_32(uint32_t p_value) {
+		uint32_t pos = data.size();
+		data.resize(pos + 4);
+		encode_uint32(p_value, &data[pos]);
+	}
+
+	void put_buffer(const uint8_t *p_buffer, uint32_t p_size) {
+		if (p_size == 0) {
+			return;
+		}
+		uint32_t pos = data.size();
+		data.resize(pos + p_size);
+		memcpy(&data[pos], p_buffer, p_size);
+	}
+
+	void put_string(const String &p_string) {
+		CharString utf8 = p_string.utf8();
+		put_32(utf8.length());
+		put_buffer((const uint8_t *)utf8.get_data(), utf8.length());
+	}
+};
+
+struct GDScriptBytecodeCache::Reader {
+	const uint8_t *data = nullptr;
+	uint32_t size = 0;
+	uint32_t pos = 0;
+	GDScript *root = nullptr;
+	bool failed = false;
+
+	bool has(uint32_t p_bytes) {
+		if (failed || size - pos < p_bytes) {
+			failed = true;
+			return false;
+		}
+		return true;
+	}
+
+	uint8_t get_8() {
+		if (!has(1)) {
+			return 0;
+		}
+		return data[pos++];
+	}
+
+	uint32_t get_32() {
+		if (!has(4)) {
+			return 0;
+		}
+		uint32_t value = decode_uint32(&data[pos]);
+		pos += 4;
+		return value;
+	}
+
+	// Element counts are bounded by the remaining size, so a corrupt count can't make us allocate too much.
+	uint32_t get_count() {
+		uint32_t count = get_32();
+		if (failed || count > size - pos) {
+			failed = true;
+			return 0;
+		}
+		return count;
+	}
+
+	Variant::Type get_type() {
+		uint32_t type = get_32();
+		if (type >= Variant::VARIANT_MAX) {
+			failed = true;
+			return Variant::NIL;
+		}
+		return Variant::Type(type);
+	}
+
+	String get_string() {
+		uint32_t length = get_32();
+		if (length == 0 || !has(length)) {
+			return String();
+		}
+		String string;
+		string.parse_utf8((const char *)&data[pos], length);
+		pos += length;
+		return string;
+	}
+
+	Reader(const Vector<uint8_t> &p_buffer, GDScript *p_root) {
+		data = p_buffer.ptr();
+		size = p_buffer.size();
+		root = p_root;
+	}
+};
+
+struct GDScriptBytecodeCache::ClassData {
+	GDScript *script = nullptr;
+	bool tool = false;
+	Ref<GDScriptNativeClass> native;
+	Ref<GDScript> base;
+	LocalVector<Pair<StringName, GDScript::MemberInfo>> members;
+	LocalVector<Pair<StringName, GDScript::MemberInfo>> static_variables;
+	HashMap<StringName, Variant> constants;
+	HashMap<StringName, MethodInfo> signals;
+	Dictionary rpc_config;
+	LocalVector<Pair<FunctionRole, GDScriptFunction *>> functions;
+	HashMap<GDScriptFunction *, GDScript::LambdaInfo> lambda_info;
+	int member_base_index = -1;
+	int used_member_count = 0; // Highest member address in the code plus one, checked once the base classes are known.
+	bool applied = false;
+};
+
+// The argument counts accepted by the callees in the tables of a function. The VM passes the arguments
+// of native and validated calls without checking their count in release builds.
+struct GDScriptBytecodeCache::CalleeArguments {
+	struct Range {
+		int min;
+		int max;
+		bool vararg;
+	};
+
+	LocalVector<Range> builtin_methods;
+	LocalVector<Range> constructors;
+	LocalVector<Range> utilities;
+	LocalVector<Range> gds_utilities;
+	LocalVector<Range> methods;
+};
+
+Mutex GDScriptBytecodeCache::validated_names_mutex;
+GDScriptBytecodeCache::ValidatedNames *GDScriptBytecodeCache::validated_names = nullptr;
+
+const GDScriptBytecodeCache::ValidatedNames &GDScriptBytecodeCache::_get_validated_names() {
+	MutexLock lock(validated_names_mutex);
+	if (validated_names) {
+		return *validated_names;
+	}
+
+	validated_names = memnew(ValidatedNames);
+
+	for (int type_a = 0; type_a < Variant::VARIANT_MAX; type_a++) {
+		for (int type_b = 0; type_b < Variant::VARIANT_MAX; type_b++) {
+			for (int op = 0; op < Variant::OP_MAX; op++) {
+				Variant::ValidatedOperatorEvaluator evaluator = Variant::get_validated_operator_evaluator(Variant::Operator(op), Variant::Type(type_a), Variant::Type(type_b));
+				if (evaluator && !validated_names->operators.has(evaluator)) {
+					validated_names->operators.insert(evaluator, (op << 16) | (type_a << 8) | type_b);
+				}
+			}
+		}
+	}
+
+	for (int i = 0; i < Variant::VARIANT_MAX; i++) {
+		Variant::Type type = Variant::Type(i);
+
+		List<StringName> members;
+		Variant::get_member_list(type, &members);
+		for (const StringName &member : members) {
+			Variant::ValidatedSetter setter = Variant::get_member_validated_setter(type, member);
+			if (setter && !validated_names->setters.has(setter)) {
+				validated_names->setters.insert(setter, Pair<Variant::Type, StringName>(type, member));
+			}
+			Variant::ValidatedGetter getter = Variant::get_member_validated_getter(type, member);
+			if (getter && !validated_names->getters.has(getter)) {
+				validated_names->getters.insert(getter, Pair<Variant::Type, StringName>(type, member));
+			}
+		}
+
+		Variant::ValidatedKeyedSetter keyed_setter = Variant::get_member_validated_keyed_setter(type);
+		if (keyed_setter && !validated_names->keyed_setters.has(keyed_setter)) {
+			validated_names->keyed_setters.insert(keyed_setter, type);
+		}
+		Variant::ValidatedKeyedGetter keyed_getter = Variant::get_member_validated_keyed_getter(type);
+		if (keyed_getter && !validated_names->keyed_getters.has(keyed_getter)) {
+			validated_names->keyed_getters.insert(keyed_getter, type);
+		}
+		Variant::ValidatedIndexedSetter indexed_setter = Variant::get_member_validated_indexed_setter(type);
+		if (indexed_setter && !validated_names->indexed_setters.has(indexed_setter)) {
+			validated_names->indexed_setters.insert(indexed_setter, type);
+		}
+		Variant::ValidatedIndexedGetter indexed_getter = Variant::get_member_validated_indexed_getter(type);
+		if (indexed_getter && !validated_names->indexed_getters.has(indexed_getter)) {
+			validated_names->indexed_getters.insert(indexed_getter, type);
+		}
+
+		List<StringName> methods;
+		Variant::get_builtin_method_list(type, &methods);
+		for (const StringName &method : methods) {
+			Variant::ValidatedBuiltInMethod builtin_method = Variant::get_validated_builtin_method(type, method);
+			if (builtin_method && !validated_names->builtin_methods.has(builtin_method)) {
+				validated_names->builtin_methods.insert(builtin_method, Pair<Variant::Type, StringName>(type, method));
+			}
+		}
+
+		for (int j = 0; j < Variant::get_constructor_count(type); j++) {
+			Variant::ValidatedConstructor constructor = Variant::get_validated_constructor(type, j);
+			if (constructor && !validated_names->constructors.has(constructor)) {
+				validated_names->constructors.insert(constructor, Pair<Variant::Type, int>(type, j));
+			}
+		}
+	}
+
+	List<StringName> utilities;
+	Variant::get_utility_function_list(&utilities);
+	for (const StringName &utility : utilities) {
+		Variant::ValidatedUtilityFunction function = Variant::get_validated_utility_function(utility);
+		if (function && !validated_names->utilities.has(function)) {
+			validated_names->utilities.insert(function, utility);
+		}
+	}
+
+	List<StringName> gds_utilities;
+	GDScriptUtilityFunctions::get_function_list(&gds_utilities);
+	for (const StringName &utility : gds_utilities) {
+		GDScriptUtilityFunctions::FunctionPtr function = GDScriptUtilityFunctions::get_function(utility);
+		if (function && !validated_names->gds_utilities.has(function)) {
+			validated_names->gds_utilities.insert(function, utility);
+		}
+	}
+
+	return *validated_names;
+}
+
+String GDScriptBytecodeCache::_get_engine_id() {
+	String id = String(VERSION_FULL_BUILD) + " " + String(VERSION_HASH);
+#ifdef DEBUG_ENABLED
+	id += " debug";
+#endif
+#ifdef TOOLS_ENABLED
+	id += " tools";
+#endif
+#ifdef REAL_T_IS_DOUBLE
+	id += " double";
+#endif
+	id += " " + itos(sizeof(void *) * 8);
+	return id;
+}
+
+// The version hash is empty in builds made outside of a Git checkout, and custom modules change the API without
+// changing the version. `ClassDB::get_api_hash()` is only computed when debug methods are enabled.
+uint32_t GDScriptBytecodeCache::_get_api_hash() {
+	uint32_t hash = ClassDB::get_api_hash(ClassDB::API_CORE);
+#ifdef TOOLS_ENABLED
+	hash = hash_murmur3_one_32(ClassDB::get_api_hash(ClassDB::API_EDITOR), hash);
+#endif
+	return hash_fmix32(hash);
+}
+
+Error GDScriptBytecodeCache::_read_header(Reader &r_reader, uint32_t &r_source_hash, HashMap<String, uint32_t> &r_dependencies) {
+	if (!r_reader.has(4) || memcmp(r_reader.data, BYTECODE_MAGIC, 4) != 0) {
+		return ERR_FILE_UNRECOGNIZED;
+	}
+	r_reader.pos += 4;
+
+	if (r_reader.get_32() != FORMAT_VERSION) {
+		return ERR_FILE_UNRECOGNIZED;
+	}
+	// Covers everything after it, so a truncated or partially overwritten file is rejected before anything is read.
+	uint32_t checksum = r_reader.get_32();
+	if (r_reader.failed || checksum != hash_murmur3_buffer(r_reader.data + r_reader.pos, r_reader.size - r_reader.pos)) {
+		return ERR_FILE_CORRUPT;
+	}
+	if (r_reader.get_string() != _get_engine_id() || r_reader.get_32() != _get_api_hash()) {
+		return ERR_FILE_UNRECOGNIZED;
+	}
+	// Stack debug info is only generated when the debugger is active.
+	if (bool(r_reader.get_8()) != EngineDebugger::is_active()) {
+		return ERR_FILE_UNRECOGNIZED;
+	}
+
+	r_source_hash = r_reader.get_32();
+	uint32_t dependency_count = r_reader.get_count();
+	for (uint32_t i = 0; i < dependency_count && !r_reader.failed; i++) {
+		String path = r_reader.get_string();
+		r_dependencies[path] = r_reader.get_32();
+	}
+
+	return r_reader.failed ? ERR_FILE_CORRUPT : OK;
+}
+
+/* Writing */
+
+void GDScriptBytecodeCache::_put_variant(Writer &r_writer, const Variant &p_value, int p_depth) {
+	if (p_depth > MAX_NESTING_DEPTH) {
+		r_writer.failed = true;
+		return;
+	}
+
+	switch (p_value.get_type()) {
+		case Variant::OBJECT: {
+			r_writer.put_8(VARIANT_TAG_OBJECT);
+			_put_object(r_writer, p_value.get_validated_object());
+		} break;
+		case Variant::ARRAY: {
+			Array array = p_value;
+			r_writer.put_8(VARIANT_TAG_ARRAY);
+			r_writer.put_8(array.is_read_only());
+			r_writer.put_32(array.get_typed_builtin());
+			r_writer.put_string(array.get_typed_class_name());
+			_put_variant(r_writer, array.get_typed_script(), p_depth + 1);
+			r_writer.put_32(array.size());
+			for (int i = 0; i < array.size(); i++) {
+				_put_variant(r_writer, array[i], p_depth + 1);
+			}
+		} break;
+		case Variant::DICTIONARY: {
+			Dictionary dictionary = p_value;
+			r_writer.put_8(VARIANT_TAG_DICTIONARY);
+			r_writer.put_8(dictionary.is_read_only());
+			r_writer.put_32(dictionary.get_typed_key_builtin());
+			r_writer.put_string(dictionary.get_typed_key_class_name());
+			_put_variant(r_writer, dictionary.get_typed_key_script(), p_depth + 1);
+			r_writer.put_32(dictionary.get_typed_value_builtin());
+			r_writer.put_string(dictionary.get_typed_value_class_name());
+			_put_variant(r_writer, dictionary.get_typed_value_script(), p_depth + 1);
+			Array keys = dictionary.keys();
+			r_writer.put_32(keys.size());
+			for (int i = 0; i < keys.size(); i++) {
+				_put_variant(r_writer, keys[i], p_depth + 1);
+				_put_variant(r_writer, dictionary[keys[i]], p_depth + 1);
+			}
+		} break;
+		case Variant::CALLABLE:
+		case Variant::SIGNAL:
+		case Variant::RID: {
+			// Bound to objects that only exist for this session.
+			r_writer.failed = true;
+		} break;
+		default: {
+			int length = 0;
+			Error err = encode_variant(p_value, nullptr, length);
+			if (err != OK) {
+				r_writer.failed = true;
+				return;
+			}
+			r_writer.put_8(VARIANT_TAG_VALUE);
+			r_writer.put_32(length);
+			uint32_t pos = r_writer.data.size();
+			r_writer.data.resize(pos + length);
+			encode_variant(p_value, &r_writer.data[pos], length);
+		} break;
+	}
+}
+
+void GDScriptBytecodeCache::_put_object(Writer &r_writer, Object *p_object) {
+	if (p_object == nullptr) {
+		r_writer.put_8(OBJECT_TAG_NULL);
+		return;
+	}
+
+	if (const StringName *global_name = r_writer.global_objects.getptr(p_object->get_instance_id())) {
+		r_writer.put_8(OBJECT_TAG_GLOBAL);
+		r_writer.put_string(*global_name);
+		return;
+	}
+
+	if (GDScript *script = Object::cast_to<GDScript>(p_object)) {
+		GDScript *script_root = script->get_root_script();
+		if (script_root == r_writer.root) {
+			r_writer.put_8(OBJECT_TAG_LOCAL_CLASS);
+			r_writer.put_string(script->fully_qualified_name);
+			return;
+		}
+		if (!script_root->path.begins_with("res://") || script_root->path.contains("::")) {
+			r_writer.failed = true; // Built-in script.
+			return;
+		}
+		r_writer.put_8(OBJECT_TAG_EXTERNAL_CLASS);
+		r_writer.put_string(script_root->path);
+		r_writer.put_string(script->fully_qualified_name);
+		return;
+	}
+
+	if (Resource *resource = Object::cast_to<Resource>(p_object)) {
+		const String &path = resource->get_path();
+		if (!path.begins_with("res://") || path.contains("::")) {
+			r_writer.failed = true; // Built-in or unsaved resource.
+			return;
+		}
+		r_writer.put_8(OBJECT_TAG_RESOURCE);
+		r_writer.put_string(path);
+		return;
+	}
+
+	r_writer.failed = true;
+}
+
+void GDScriptBytecodeCache::_put_property_info(Writer &r_writer, const PropertyInfo &p_info) {
+	r_writer.put_32(p_info.type);
+	r_writer.put_string(p_info.name);
+	r_writer.put_string(p_info.class_name);
+	r_writer.put_32(p_info.hint);
+	r_writer.put_string(p_info.hint_string);
+	r_writer.put_32(p_info.usage);
+}
+
+void GDScriptBytecodeCache::_put_method_info(Writer &r_writer, const MethodInfo &p_info) {
+	r_writer.put_string(p_info.name);
+	_put_property_info(r_writer, p_info.return_val);
+	r_writer.put_32(p_info.flags);
+	r_writer.put_32(p_info.id);
+	r_writer.put_32(p_info.arguments.size());
+	for (const PropertyInfo &argument : p_info.arguments) {
+		_put_property_info(r_writer, argument);
+	}
+	r_writer.put_32(p_info.default_arguments.size());
+	for (const Variant &default_argument : p_info.default_arguments) {
+		_put_variant(r_writer, default_argument);
+	}
+	r_writer.put_32(p_info.return_val_metadata);
+	r_writer.put_32(p_info.arguments_metadata.size());
+	for (int metadata : p_info.arguments_metadata) {
+		r_writer.put_32(metadata);
+	}
+}
+
+void GDScriptBytecodeCache::_put_data_type(Writer &r_writer, const GDScriptDataType &p_type, int p_depth) {
+	if (p_depth > MAX_NESTING_DEPTH) {
+		r_writer.failed = true;
+		return;
+	}
+
+	r_writer.put_8(p_type.kind);
+	r_writer.put_8(p_type.has_type);
+	r_writer.put_32(p_type.builtin_type);
+	r_writer.put_string(p_type.native_type);
+	if (p_type.script_type_ref.is_valid()) {
+		r_writer.put_8(DATA_TYPE_SCRIPT_STRONG);
+		_put_object(r_writer, p_type.script_type_ref.ptr());
+	} else if (p_type.script_type) {
+		r_writer.put_8(DATA_TYPE_SCRIPT_WEAK);
+		_put_object(r_writer, p_type.script_type);
+	} else {
+		r_writer.put_8(DATA_TYPE_SCRIPT_NONE);
+	}
+	r_writer.put_32(p_type.container_element_types.size());
+	for (const GDScriptDataType &element_type : p_type.container_element_types) {
+		_put_data_type(r_writer, element_type, p_depth + 1);
+	}
+}
+
+void GDScriptBytecodeCache::_put_member_info(Writer &r_writer, const GDScript::MemberInfo &p_info) {
+	r_writer.put_32(p_info.index);
+	r_writer.put_string(p_info.setter);
+	r_writer.put_string(p_info.getter);
+	_put_data_type(r_writer, p_info.data_type);
+	_put_property_info(r_writer, p_info.property_info);
+}
+
+void GDScriptBytecodeCache::_put_class_tree(Writer &r_writer, GDScript *p_script) {
+	r_writer.put_string(p_script->fully_qualified_name);
+	r_writer.put_string(p_script->local_name);
+	r_writer.put_string(p_script->global_name);
+	r_writer.put_string(p_script->simplified_icon_path);
+	r_writer.put_32(p_script->subclasses.size());
+	for (const KeyValue<StringName, Ref<GDScript>> &E : p_script->subclasses) {
+		_put_class_tree(r_writer, E.value.ptr());
+	}
+}
+
+void GDScriptBytecodeCache::_put_class(Writer &r_writer, GDScript *p_script) {
+	r_writer.put_string(p_script->fully_qualified_name);
+	r_writer.put_8(p_script->tool);
+	r_writer.put_string(p_script->native.is_valid() ? String(p_script->native->get_name()) : String());
+	_put_object(r_writer, p_script->base.ptr());
+
+	r_writer.put_32(p_script->members.size());
+	for (const StringName &member : p_script->members) {
+		r_writer.put_string(member);
+		_put_member_info(r_writer, p_script->member_indices[member]);
+	}
+
+	r_writer.put_32(p_script->static_variables_indices.size());
+	for (const KeyValue<StringName, GDScript::MemberInfo> &E : p_script->static_variables_indices) {
+		r_writer.put_string(E.key);
+		_put_member_info(r_writer, E.value);
+	}
+
+	r_writer.put_32(p_script->constants.size());
+	for (const KeyValue<StringName, Variant> &E : p_script->constants) {
+		r_writer.put_string(E.key);
+		_put_variant(r_writer, E.value);
+	}
+
+	r_writer.put_32(p_script->_signals.size());
+	for (const KeyValue<StringName, MethodInfo> &E : p_script->_signals) {
+		r_writer.put_string(E.key);
+		_put_method_info(r_writer, E.value);
+	}
+
+	_put_variant(r_writer, p_script->rpc_config);
+
+	LocalVector<Pair<FunctionRole, GDScriptFunction *>> functions;
+	for (const KeyValue<StringName, GDScriptFunction *> &E : p_script->member_functions) {
+		functions.push_back(Pair<FunctionRole, GDScriptFunction *>(FUNCTION_ROLE_MEMBER, E.value));
+	}
+	if (p_script->implicit_initializer) {
+		functions.push_back(Pair<FunctionRole, GDScriptFunction *>(FUNCTION_ROLE_IMPLICIT_INITIALIZER, p_script->implicit_initializer));
+	}
+	if (p_script->implicit_ready) {
+		functions.push_back(Pair<FunctionRole, GDScriptFunction *>(FUNCTION_ROLE_IMPLICIT_READY, p_script->implicit_ready));
+	}
+	if (p_script->static_initializer) {
+		functions.push_back(Pair<FunctionRole, GDScriptFunction *>(FUNCTION_ROLE_STATIC_INITIALIZER, p_script->static_initializer));
+	}
+	r_writer.put_32(functions.size());
+	for (const Pair<FunctionRole, GDScriptFunction *> &function : functions) {
+		r_writer.put_8(function.first);
+		_put_function(r_writer, function.second);
+	}
+
+	for (const KeyValue<StringName, Ref<GDScript>> &E : p_script->subclasses) {
+		_put_class(r_writer, E.value.ptr());
+	}
+}
+
+void GDScriptBytecodeCache::_put_function(Writer &r_writer, const GDScriptFunction *p_function) {
+	const ValidatedNames &names = _get_validated_names();
+
+	r_writer.put_string(p_function->name);
+	r_writer.put_8(p_function->_static);
+	r_writer.put_32(p_function->argument_types.size());
+	for (const GDScriptDataType &argument_type : p_function->argument_types) {
+		_put_data_type(r_writer, argument_type);
+	}
+	_put_data_type(r_writer, p_function->return_type);
+	_put_method_info(r_writer, p_function->method_info);
+	_put_variant(r_writer, p_function->rpc_config);
+
+	r_writer.put_32(p_function->_initial_line);
+	r_writer.put_32(p_function->_argument_count);
+	r_writer.put_32(p_function->_stack_size);
+	r_writer.put_32(p_function->_instruction_args_size);
+
+	r_writer.put_32(p_function->temporary_slots.size());
+	for (const KeyValue<int, Variant::Type> &E : p_function->temporary_slots) {
+		r_writer.put_32(E.key);
+		r_writer.put_32(E.value);
+	}
+
+	r_writer.put_32(p_function->stack_debug.size());
+	for (const GDScriptFunction::StackDebug &stack_debug : p_function->stack_debug) {
+		r_writer.put_32(stack_debug.line);
+		r_writer.put_32(stack_debug.pos);
+		r_writer.put_8(stack_debug.added);
+		r_writer.put_string(stack_debug.identifier);
+	}
+
+	r_writer.put_32(p_function->code.size());
+	for (int code : p_function->code) {
+		r_writer.put_32(code);
+	}
+
+	// Global array indices depend on the order singletons and global classes were registered in.
+	r_writer.put_32(p_function->global_index_positions.size());
+	for (int position : p_function->global_index_positions) {
+		const StringName *global_name = r_writer.global_names.getptr(p_function->code[position]);
+		if (global_name == nullptr) {
+			r_writer.failed = true;
+			return;
+		}
+		r_writer.put_32(position);
+		r_writer.put_string(*global_name);
+	}
+
+	r_writer.put_32(p_function->default_arguments.size());
+	for (int default_argument : p_function->default_arguments) {
+		r_writer.put_32(default_argument);
+	}
+
+	r_writer.put_32(p_function->constants.size());
+	for (const Variant &constant : p_function->constants) {
+		_put_variant(r_writer, constant);
+	}
+
+	r_writer.put_32(p_function->global_names.size());
+	for (const StringName &global_name : p_function->global_names) {
+		r_writer.put_string(global_name);
+	}
+
+	r_writer.put_32(p_function->operator_funcs.size());
+	for (Variant::ValidatedOperatorEvaluator evaluator : p_function->operator_funcs) {
+		const uint32_t *key = _find_validated_name(names.operators, evaluator);
+		if (key == nullptr) {
+			r_writer.failed = true;
+			return;
+		}
+		r_writer.put_32(*key);
+	}
+
+	r_writer.put_32(p_function->setters.size());
+	for (Variant::ValidatedSetter setter : p_function->setters) {
+		const Pair<Variant::Type, StringName> *key = _find_validated_name(names.setters, setter);
+		if (key == nullptr) {
+			r_writer.failed = true;
+			return;
+		}
+		r_writer.put_32(key->first);
+		r_writer.put_string(key->second);
+	}
+
+	r_writer.put_32(p_function->getters.size());
+	for (Variant::ValidatedGetter getter : p_function->getters) {
+		const Pair<Variant::Type, StringName> *key = _find_validated_name(names.getters, getter);
+		if (key == nullptr) {
+			r_writer.failed = true;
+			return;
+		}
+		r_writer.put_32(key->first);
+		r_writer.put_string(key->second);
+	}
+
+	r_writer.put_32(p_function->keyed_setters.size());
+	for (Variant::ValidatedKeyedSetter keyed_setter : p_function->keyed_setters) {
+		const Variant::Type *key = _find_validated_name(names.keyed_setters, keyed_setter);
+		if (key == nullptr) {
+			r_writer.failed = true;
+			return;
+		}
+		r_writer.put_32(*key);
+	}
+
+	r_writer.put_32(p_function->keyed_getters.size());
+	for (Variant::ValidatedKeyedGetter keyed_getter : p_function->keyed_getters) {
+		const Variant::Type *key = _find_validated_name(names.keyed_getters, keyed_getter);
+		if (key == nullptr) {
+			r_writer.failed = true;
+			return;
+		}
+		r_writer.put_32(*key);
+	}
+
+	r_writer.put_32(p_function->indexed_setters.size());
+	for (Variant::ValidatedIndexedSetter indexed_setter : p_function->indexed_setters) {
+		const Variant::Type *key = _find_validated_name(names.indexed_setters, indexed_setter);
+		if (key == nullptr) {
+			r_writer.failed = true;
+			return;
+		}
+		r_writer.put_32(*key);
+	}
+
+	r_writer.put_32(p_function->indexed_getters.size());
+	for (Variant::ValidatedIndexedGetter indexed_getter : p_function->indexed_getters) {
+		const Variant::Type *key = _find_validated_name(names.indexed_getters, indexed_getter);
+		if (key == nullptr) {
+			r_writer.failed = true;
+			return;
+		}
+		r_writer.put_32(*key);
+	}
+
+	r_writer.put_32(p_function->builtin_methods.size());
+	for (Variant::ValidatedBuiltInMethod builtin_method : p_function->builtin_methods) {
+		const Pair<Variant::Type, StringName> *key = _find_validated_name(names.builtin_methods, builtin_method);
+		if (key == nullptr) {
+			r_writer.failed = true;
+			return;
+		}
+		r_writer.put_32(key->first);
+		r_writer.put_string(key->second);
+	}
+
+	r_writer.put_32(p_function->constructors.size());
+	for (Variant::ValidatedConstructor constructor : p_function->constructors) {
+		const Pair<Variant::Type, int> *key = _find_validated_name(names.constructors, constructor);
+		if (key == nullptr) {
+			r_writer.failed = true;
+			return;
+		}
+		r_writer.put_32(key->first);
+		r_writer.put_32(key->second);
+	}
+
+	r_writer.put_32(p_function->utilities.size());
+	for (Variant::ValidatedUtilityFunction utility : p_function->utilities) {
+		const StringName *key = _find_validated_name(names.utilities, utility);
+		if (key == nullptr) {
+			r_writer.failed = true;
+			return;
+		}
+		r_writer.put_string(*key);
+	}
+
+	r_writer.put_32(p_function->gds_utilities.size());
+	for (GDScriptUtilityFunctions::FunctionPtr gds_utility : p_function->gds_utilities) {
+		const StringName *key = _find_validated_name(names.gds_utilities, gds_utility);
+		if (key == nullptr) {
+			r_writer.failed = true;
+			return;
+		}
+		r_writer.put_string(*key);
+	}
+
+	r_writer.put_32(p_function->methods.size());
+	for (MethodBind *method : p_function->methods) {
+		r_writer.put_string(method->get_instance_class());
+		r_writer.put_string(method->get_name());
+		r_writer.put_32(method->get_hash());
+	}
+
+	r_writer.put_32(p_function->lambdas.size());
+	for (GDScriptFunction *lambda : p_function->lambdas) {
+		const GDScript::LambdaInfo *lambda_info = lambda->_script->lambda_info.getptr(lambda);
+		if (lambda_info == nullptr) {
+			r_writer.failed = true;
+			return;
+		}
+		r_writer.put_32(lambda_info->capture_count);
+		r_writer.put_8(lambda_info->use_self);
+		_put_function(r_writer, lambda);
+	}
+
+#ifdef DEBUG_ENABLED
+	const Vector<String> *debug_names[] = {
+		&p_function->operator_names,
+		&p_function->setter_names,
+		&p_function->getter_names,
+		&p_function->builtin_methods_names,
+		&p_function->constructors_names,
+		&p_function->utilities_names,
+		&p_function->gds_utilities_names,
+	};
+	for (const Vector<String> *debug_name_list : debug_names) {
+		r_writer.put_32(debug_name_list->size());
+		for (const String &debug_name : *debug_name_list) {
+			r_writer.put_string(debug_name);
+		}
+	}
+	r_writer.put_string(p_function->profile.signature);
+#endif
+}
+
+Error GDScriptBytecodeCache::parse_header(const Vector<uint8_t> &p_buffer, uint32_t p_source_hash, HashMap<String, uint32_t> &r_dependencies) {
+	Reader reader(p_buffer, nullptr);
+	uint32_t source_hash = 0;
+	Error err = _read_header(reader, source_hash, r_dependencies);
+	if (err != OK) {
+		return err;
+	}
+	return source_hash == p_source_hash ? OK : ERR_FILE_UNRECOGNIZED;
+}
+
+Vector<uint8_t> GDScriptBytecodeCache::serialize(GDScript *p_script, uint32_t p_source_hash, const HashMap<String, uint32_t> &p_dependencies, bool p_add_static_script) {
+	ERR_FAIL_COND_V(!p_script->is_root_script() || !p_script->is_valid(), Vector<uint8_t>());
+
+	Writer writer;
+	writer.root = p_script;
+	for (const KeyValue<StringName, int> &E : GDScriptLanguage::get_singleton()->get_global_map()) {
+		writer.global_names[E.value] = E.key;
+		Object *global = GDScriptLanguage::get_singleton()->get_global_array()[E.value].get_validated_object();
+		if (global) {
+			writer.global_objects[global->get_instance_id()] = E.key;
+		}
+	}
+
+	writer.put_buffer(BYTECODE_MAGIC, 4);
+	writer.put_32(FORMAT_VERSION);
+	uint32_t checksum_pos = writer.data.size();
+	writer.put_32(0); // Checksum, filled in at the end.
+	writer.put_string(_get_engine_id());
+	writer.put_32(_get_api_hash());
+	writer.put_8(EngineDebugger::is_active());
+	writer.put_32(p_source_hash);
+	writer.put_32(p_dependencies.size());
+	for (const KeyValue<String, uint32_t> &E : p_dependencies) {
+		writer.put_string(E.key);
+		writer.put_32(E.value);
+	}
+
+	writer.put_8(p_add_static_script);
+	_put_class_tree(writer, p_script);
+	_put_class(writer, p_script);
+
+	if (writer.failed) {
+		return Vector<uint8_t>();
+	}
+
+	uint32_t payload_pos = checksum_pos + 4;
+	encode_uint32(hash_murmur3_buffer(&writer.data[payload_pos], writer.data.size() - payload_pos), &writer.data[checksum_pos]);
+
+	Vector<uint8_t> buffer;
+	buffer.resize(writer.data.size());
+	memcpy(buffer.ptrw(), writer.data.ptr(), writer.data.size());
+	return buffer;
+}
+
+/* Reading */
+
+Variant GDScriptBytecodeCache::_get_variant(Reader &r_reader, int p_depth) {
+	if (p_depth > MAX_NESTING_DEPTH) {
+		r_reader.failed = true;
+		return Variant();
+	}
+
+	switch (r_reader.get_8()) {
+		case VARIANT_TAG_VALUE: {
+			uint32_t length = r_reader.get_32();
+			if (!r_reader.has(length)) {
+				return Variant();
+			}
+			Variant value;
+			int read = 0;
+			Error err = decode_variant(value, &r_reader.data[r_reader.pos], length, &read);
+			if (err != OK || uint32_t(read) != length) {
+				r_reader.failed = true;
+				return Variant();
+			}
+			r_reader.pos += length;
+			return value;
+		}
+		case VARIANT_TAG_ARRAY: {
+			bool read_only = r_reader.get_8();
+			Variant::Type type = r_reader.get_type();
+			StringName class_name = r_reader.get_string();
+			Variant script = _get_variant(r_reader, p_depth + 1);
+			uint32_t size = r_reader.get_count();
+			if (r_reader.failed) {
+				return Variant();
+			}
+
+			Array array;
+			if (type != Variant::NIL) {
+				array.set_typed(type, class_name, script);
+			}
+			for (uint32_t i = 0; i < size && !r_reader.failed; i++) {
+				array.push_back(_get_variant(r_reader, p_depth + 1));
+			}
+			if (read_only) {
+				array.make_read_only();
+			}
+			return array;
+		}
+		case VARIANT_TAG_DICTIONARY: {
+			bool read_only = r_reader.get_8();
+			Variant::Type key_type = r_reader.get_type();
+			StringName key_class_name = r_reader.get_string();
+			Variant key_script = _get_variant(r_reader, p_depth + 1);
+			Variant::Type value_type = r_reader.get_type();
+			StringName value_class_name = r_reader.get_string();
+			Variant value_script = _get_variant(r_reader, p_depth + 1);
+			uint32_t size = r_reader.get_count();
+			if (r_reader.failed) {
+				return Variant();
+			}
+
+			Dictionary dictionary;
+			if (key_type != Variant::NIL || value_type != Variant::NIL) {
+				dictionary.set_typed(key_type, key_class_name, key_script, value_type, value_class_name, value_script);
+			}
+			for (uint32_t i = 0; i < size && !r_reader.failed; i++) {
+				Variant key = _get_variant(r_reader, p_depth + 1);
+				dictionary[key] = _get_variant(r_reader, p_depth + 1);
+			}
+			if (read_only) {
+				dictionary.make_read_only();
+			}
+			return dictionary;
+		}
+		case VARIANT_TAG_OBJECT: {
+			return _get_object(r_reader);
+		}
+		default: {
+			r_reader.failed = true;
+			return Variant();
+		}
+	}
+}
+
+Variant GDScriptBytecodeCache::_get_object(Reader &r_reader, bool p_local_only) {
+	uint8_t tag = r_reader.get_8();
+	if (p_local_only && tag != OBJECT_TAG_LOCAL_CLASS) {
+		r_reader.failed = true;
+		return Variant();
+	}
+
+	switch (tag) {
+		case OBJECT_TAG_NULL: {
+			return Variant((Object *)nullptr);
+		}
+		case OBJECT_TAG_GLOBAL: {
+			StringName name = r_reader.get_string();
+			const int *global_index = GDScriptLanguage::get_singleton()->get_global_map().getptr(name);
+			if (global_index == nullptr) {
+				r_reader.failed = true;
+				return Variant();
+			}
+			const Variant &global = GDScriptLanguage::get_singleton()->get_global_array()[*global_index];
+			if (global.get_validated_object() == nullptr) {
+				r_reader.failed = true;
+				return Variant();
+			}
+			return global;
+		}
+		case OBJECT_TAG_LOCAL_CLASS: {
+			String fqcn = r_reader.get_string();
+			GDScript *script = r_reader.failed ? nullptr : r_reader.root->find_class(fqcn);
+			if (script == nullptr) {
+				r_reader.failed = true;
+				return Variant();
+			}
+			return Ref<GDScript>(script);
+		}
+		case OBJECT_TAG_EXTERNAL_CLASS: {
+			String path = r_reader.get_string();
+			String fqcn = r_reader.get_string();
+			if (r_reader.failed) {
+				return Variant();
+			}
+			Error err = OK;
+			Ref<GDScript> script_root = GDScriptCache::get_shallow_script(path, err, r_reader.root->path);
+			GDScript *script = err == OK && script_root.is_valid() ? script_root->find_class(fqcn) : nullptr;
+			if (script == nullptr) {
+				r_reader.failed = true;
+				return Variant();
+			}
+			return Ref<GDScript>(script);
+		}
+		case OBJECT_TAG_RESOURCE: {
+			String path = r_reader.get_string();
+			Ref<Resource> resource = r_reader.failed ? Ref<Resource>() : ResourceLoader::load(path);
+			if (resource.is_null()) {
+				r_reader.failed = true;
+				return Variant();
+			}
+			return resource;
+		}
+		default: {
+			r_reader.failed = true;
+			return Variant();
+		}
+	}
+}
+
+PropertyInfo GDScriptBytecodeCache::_get_property_info(Reader &r_reader) {
+	PropertyInfo info;
+	info.type = r_reader.get_type();
+	info.name = r_reader.get_string();
+	info.class_name = r_reader.get_string();
+	info.hint = PropertyHint(r_reader.get_32());
+	info.hint_string = r_reader.get_string();
+	info.usage = r_reader.get_32();
+	return info;
+}
+
+MethodInfo GDScriptBytecodeCache::_get_method_info(Reader &r_reader) {
+	MethodInfo info;
+	info.name = r_reader.get_string();
+	info.return_val = _get_property_info(r_reader);
+	info.flags = r_reader.get_32();
+	info.id = r_reader.get_32();
+	uint32_t argument_count = r_reader.get_count();
+	for (uint32_t i = 0; i < argument_count && !r_reader.failed; i++) {
+		info.arguments.push_back(_get_property_info(r_reader));
+	}
+	uint32_t default_argument_count = r_reader.get_count();
+	for (uint32_t i = 0; i < default_argument_count && !r_reader.failed; i++) {
+		info.default_arguments.push_back(_get_variant(r_reader));
+	}
+	info.return_val_metadata = r_reader.get_32();
+	uint32_t metadata_count = r_reader.get_count();
+	for (uint32_t i = 0; i < metadata_count && !r_reader.failed; i++) {
+		info.arguments_metadata.push_back(r_reader.get_32());
+	}
+	return info;
+}
+
+GDScriptDataType GDScriptBytecodeCache::_get_data_type(Reader &r_reader, int p_depth) {
+	GDScriptDataType type;
+	if (p_depth > MAX_NESTING_DEPTH) {
+		r_reader.failed = true;
+		return type;
+	}
+
+	uint8_t kind = r_reader.get_8();
+	if (kind > GDScriptDataType::GDSCRIPT) {
+		r_reader.failed = true;
+		return type;
+	}
+	type.kind = GDScriptDataType::Kind(kind);
+	type.has_type = r_reader.get_8();
+	type.builtin_type = r_reader.get_type();
+	type.native_type = r_reader.get_string();
+
+	switch (r_reader.get_8()) {
+		case DATA_TYPE_SCRIPT_NONE:
+			break;
+		case DATA_TYPE_SCRIPT_WEAK: {
+			// Only local classes are held weakly, and those are kept alive by the root script.
+			Ref<Script> script = _get_object(r_reader, true);
+			type.script_type = script.ptr();
+		} break;
+		case DATA_TYPE_SCRIPT_STRONG: {
+			type.script_type_ref = Ref<Script>(_get_object(r_reader));
+			type.script_type = type.script_type_ref.ptr();
+			if (type.script_type == nullptr) {
+				r_reader.failed = true;
+			}
+		} break;
+		default:
+			r_reader.failed = true;
+			break;
+	}
+
+	uint32_t element_type_count = r_reader.get_count();
+	for (uint32_t i = 0; i < element_type_count && !r_reader.failed; i++) {
+		type.set_container_element_type(i, _get_data_type(r_reader, p_depth + 1));
+	}
+	return type;
+}
+
+GDScript::MemberInfo GDScriptBytecodeCache::_get_member_info(Reader &r_reader) {
+	GDScript::MemberInfo info;
+	info.index = r_reader.get_32();
+	info.setter = r_reader.get_string();
+	info.getter = r_reader.get_string();
+	info.data_type = _get_data_type(r_reader);
+	info.property_info = _get_property_info(r_reader);
+	return info;
+}
+
+void GDScriptBytecodeCache::_make_class_tree(Reader &r_reader, GDScript *p_script, const String &p_fqcn, const StringName &p_local_name, int p_depth) {
+	if (p_depth > MAX_NESTING_DEPTH) {
+		r_reader.failed = true;
+		return;
+	}
+
+	p_script->fully_qualified_name = p_fqcn;
+	p_script->local_name = p_local_name;
+	p_script->global_name = r_reader.get_string();
+	p_script->simplified_icon_path = r_reader.get_string();
+
+	// Same as `GDScriptCompiler::make_scripts()` when keeping state.
+	HashMap<StringName, Ref<GDScript>> old_subclasses = p_script->subclasses;
+	p_script->subclasses.clear();
+
+	uint32_t subclass_count = r_reader.get_count();
+	for (uint32_t i = 0; i < subclass_count && !r_reader.failed; i++) {
+		String fqcn = r_reader.get_string();
+		StringName name = r_reader.get_string();
+		if (r_reader.failed || name == StringName()) {
+			r_reader.failed = true;
+			return;
+		}
+
+		Ref<GDScript> subclass;
+		if (old_subclasses.has(name)) {
+			subclass = old_subclasses[name];
+		} else {
+			subclass = GDScriptLanguage::get_singleton()->get_orphan_subclass(fqcn);
+		}
+		if (subclass.is_null()) {
+			subclass.instantiate();
+		}
+
+		subclass->_owner = p_script;
+		subclass->path = p_script->path;
+		p_script->subclasses.insert(name, subclass);
+
+		_make_class_tree(r_reader, subclass.ptr(), fqcn, name, p_depth + 1);
+	}
+}
+
+void GDScriptBytecodeCache::_get_class(Reader &r_reader, ClassData &r_class) {
+	r_class.tool = r_reader.get_8();
+
+	StringName native_name = r_reader.get_string();
+	const int *native_index = GDScriptLanguage::get_singleton()->get_global_map().getptr(native_name);
+	if (native_index == nullptr) {
+		r_reader.failed = true;
+		return;
+	}
+	r_class.native = GDScriptLanguage::get_singleton()->get_global_array()[*native_index];
+	if (r_class.native.is_null()) {
+		r_reader.failed = true;
+		return;
+	}
+	r_class.base = _get_object(r_reader);
+
+	uint32_t member_count = r_reader.get_count();
+	for (uint32_t i = 0; i < member_count && !r_reader.failed; i++) {
+		StringName name = r_reader.get_string();
+		r_class.members.push_back(Pair<StringName, GDScript::MemberInfo>(name, _get_member_info(r_reader)));
+	}
+
+	uint32_t static_variable_count = r_reader.get_count();
+	for (uint32_t i = 0; i < static_variable_count && !r_reader.failed; i++) {
+		StringName name = r_reader.get_string();
+		GDScript::MemberInfo info = _get_member_info(r_reader);
+		if (info.index < 0 || uint32_t(info.index) >= static_variable_count) {
+			r_reader.failed = true;
+			return;
+		}
+		r_class.static_variables.push_back(Pair<StringName, GDScript::MemberInfo>(name, info));
+	}
+
+	uint32_t constant_count = r_reader.get_count();
+	for (uint32_t i = 0; i < constant_count && !r_reader.failed; i++) {
+		StringName name = r_reader.get_string();
+		r_class.constants.insert(name, _get_variant(r_reader));
+	}
+
+	uint32_t signal_count = r_reader.get_count();
+	for (uint32_t i = 0; i < signal_count && !r_reader.failed; i++) {
+		StringName name = r_reader.get_string();
+		r_class.signals.insert(name, _get_method_info(r_reader));
+	}
+
+	r_class.rpc_config = _get_variant(r_reader);
+
+	uint32_t function_count = r_reader.get_count();
+	for (uint32_t i = 0; i < function_count && !r_reader.failed; i++) {
+		uint8_t role = r_reader.get_8();
+		if (role > FUNCTION_ROLE_STATIC_INITIALIZER) {
+			r_reader.failed = true;
+			return;
+		}
+		GDScriptFunction *function = _get_function(r_reader, r_class.script, r_class);
+		if (function) {
+			r_class.functions.push_back(Pair<FunctionRole, GDScriptFunction *>(FunctionRole(role), function));
+		}
+	}
+}
+
+GDScriptFunction *GDScriptBytecodeCache::_get_function(Reader &r_reader, GDScript *p_script, ClassData &r_class, int p_depth) {
+	if (p_depth > MAX_NESTING_DEPTH) {
+		r_reader.failed = true;
+		return nullptr;
+	}
+
+	GDScriptFunction *function = memnew(GDScriptFunction);
+	function->_script = p_script;
+	function->source = p_script->get_script_path();
+
+	function->name = r_reader.get_string();
+	function->_static = r_reader.get_8();
+	uint32_t argument_type_count = r_reader.get_count();
+	for (uint32_t i = 0; i < argument_type_count && !r_reader.failed; i++) {
+		function->argument_types.push_back(_get_data_type(r_reader));
+	}
+	function->return_type = _get_data_type(r_reader);
+	function->method_info = _get_method_info(r_reader);
+	function->rpc_config = _get_variant(r_reader);
+
+	function->_initial_line = r_reader.get_32();
+	function->_argument_count = r_reader.get_32();
+	function->_stack_size = r_reader.get_32();
+	function->_instruction_args_size = r_reader.get_32();
+
+	uint32_t temporary_slot_count = r_reader.get_count();
+	for (uint32_t i = 0; i < temporary_slot_count && !r_reader.failed; i++) {
+		int slot = r_reader.get_32();
+		function->temporary_slots[slot] = r_reader.get_type();
+	}
+
+	uint32_t stack_debug_count = r_reader.get_count();
+	for (uint32_t i = 0; i < stack_debug_count && !r_reader.failed; i++) {
+		GDScriptFunction::StackDebug stack_debug;
+		stack_debug.line = r_reader.get_32();
+		stack_debug.pos = r_reader.get_32();
+		stack_debug.added = r_reader.get_8();
+		stack_debug.identifier = r_reader.get_string();
+		function->stack_debug.push_back(stack_debug);
+	}
+
+	uint32_t code_size = r_reader.get_count();
+	function->code.resize(code_size);
+	for (uint32_t i = 0; i < code_size && !r_reader.failed; i++) {
+		function->code.write[i] = r_reader.get_32();
+	}
+
+	uint32_t global_index_count = r_reader.get_count();
+	for (uint32_t i = 0; i < global_index_count && !r_reader.failed; i++) {
+		uint32_t position = r_reader.get_32();
+		StringName global_name = r_reader.get_string();
+		const int *global_index = GDScriptLanguage::get_singleton()->get_global_map().getptr(global_name);
+		if (position >= code_size || global_index == nullptr) {
+			r_reader.failed = true;
+			break;
+		}
+		function->code.write[position] = *global_index;
+		function->global_index_positions.push_back(position);
+	}
+
+	uint32_t default_argument_count = r_reader.get_count();
+	for (uint32_t i = 0; i < default_argument_count && !r_reader.failed; i++) {
+		function->default_arguments.push_back(r_reader.get_32());
+	}
+
+	uint32_t constant_count = r_reader.get_count();
+	for (uint32_t i = 0; i < constant_count && !r_reader.failed; i++) {
+		function->constants.push_back(_get_variant(r_reader));
+	}
+
+	uint32_t global_name_count = r_reader.get_count();
+	for (uint32_t i = 0; i < global_name_count && !r_reader.failed; i++) {
+		function->global_names.push_back(r_reader.get_string());
+	}
+
+	uint32_t operator_count = r_reader.get_count();
+	for (uint32_t i = 0; i < operator_count && !r_reader.failed; i++) {
+		uint32_t key = r_reader.get_32();
+		uint32_t op = key >> 16;
+		uint32_t type_a = (key >> 8) & 0xFF;
+		uint32_t type_b = key & 0xFF;
+		Variant::ValidatedOperatorEvaluator evaluator = nullptr;
+		if (op < Variant::OP_MAX && type_a < Variant::VARIANT_MAX && type_b < Variant::VARIANT_MAX) {
+			evaluator = Variant::get_validated_operator_evaluator(Variant::Operator(op), Variant::Type(type_a), Variant::Type(type_b));
+		}
+		if (evaluator == nullptr) {
+			r_reader.failed = true;
+			break;
+		}
+		function->operator_funcs.push_back(evaluator);
+	}
+
+	uint32_t setter_count = r_reader.get_count();
+	for (uint32_t i = 0; i < setter_count && !r_reader.failed; i++) {
+		Variant::Type type = r_reader.get_type();
+		StringName member = r_reader.get_string();
+		Variant::ValidatedSetter setter = r_reader.failed ? nullptr : Variant::get_member_validated_setter(type, member);
+		if (setter == nullptr) {
+			r_reader.failed = true;
+			break;
+		}
+		function->setters.push_back(setter);
+	}
+
+	uint32_t getter_count = r_reader.get_count();
+	for (uint32_t i = 0; i < getter_count && !r_reader.failed; i++) {
+		Variant::Type type = r_reader.get_type();
+		StringName member = r_reader.get_string();
+		Variant::ValidatedGetter getter = r_reader.failed ? nullptr : Variant::get_member_validated_getter(type, member);
+		if (getter == nullptr) {
+			r_reader.failed = true;
+			break;
+		}
+		function->getters.push_back(getter);
+	}
+
+	uint32_t keyed_setter_count = r_reader.get_count();
+	for (uint32_t i = 0; i < keyed_setter_count && !r_reader.failed; i++) {
+		Variant::ValidatedKeyedSetter keyed_setter = Variant::get_member_validated_keyed_setter(r_reader.get_type());
+		if (keyed_setter == nullptr) {
+			r_reader.failed = true;
+			break;
+		}
+		function->keyed_setters.push_back(keyed_setter);
+	}
+
+	uint32_t keyed_getter_count = r_reader.get_count();
+	for (uint32_t i = 0; i < keyed_getter_count && !r_reader.failed; i++) {
+		Variant::ValidatedKeyedGetter keyed_getter = Variant::get_member_validated_keyed_getter(r_reader.get_type());
+		if (keyed_getter == nullptr) {
+			r_reader.failed = true;
+			break;
+		}
+		function->keyed_getters.push_back(keyed_getter);
+	}
+
+	uint32_t indexed_setter_count = r_reader.get_count();
+	for (uint32_t i = 0; i < indexed_setter_count && !r_reader.failed; i++) {
+		Variant::ValidatedIndexedSetter indexed_setter = Variant::get_member_validated_indexed_setter(r_reader.get_type());
+		if (indexed_setter == nullptr) {
+			r_reader.failed = true;
+			break;
+		}
+		function->indexed_setters.push_back(indexed_setter);
+	}
+
+	uint32_t indexed_getter_count = r_reader.get_count();
+	for (uint32_t i = 0; i < indexed_getter_count && !r_reader.failed; i++) {
+		Variant::ValidatedIndexedGetter indexed_getter = Variant::get_member_validated_indexed_getter(r_reader.get_type());
+		if (indexed_getter == nullptr) {
+			r_reader.failed = true;
+			break;
+		}
+		function->indexed_getters.push_back(indexed_getter);
+	}
+
+	CalleeArguments callees;
+
+	uint32_t builtin_method_count = r_reader.get_count();
+	for (uint32_t i = 0; i < builtin_method_count && !r_reader.failed; i++) {
+		Variant::Type type = r_reader.get_type();
+		StringName method = r_reader.get_string();
+		Variant::ValidatedBuiltInMethod builtin_method = r_reader.failed ? nullptr : Variant::get_validated_builtin_method(type, method);
+		if (builtin_method == nullptr) {
+			r_reader.failed = true;
+			break;
+		}
+		function->builtin_methods.push_back(builtin_method);
+		int argument_count = Variant::get_builtin_method_argument_count(type, method);
+		callees.builtin_methods.push_back({ argument_count, argument_count, Variant::is_builtin_method_vararg(type, method) });
+	}
+
+	uint32_t constructor_count = r_reader.get_count();
+	for (uint32_t i = 0; i < constructor_count && !r_reader.failed; i++) {
+		Variant::Type type = r_reader.get_type();
+		int index = r_reader.get_32();
+		Variant::ValidatedConstructor constructor = nullptr;
+		if (!r_reader.failed && index >= 0 && index < Variant::get_constructor_count(type)) {
+			constructor = Variant::get_validated_constructor(type, index);
+		}
+		if (constructor == nullptr) {
+			r_reader.failed = true;
+			break;
+		}
+		function->constructors.push_back(constructor);
+		int argument_count = Variant::get_constructor_argument_count(type, index);
+		callees.constructors.push_back({ argument_count, argument_count, false });
+	}
+
+	uint32_t utility_count = r_reader.get_count();
+	for (uint32_t i = 0; i < utility_count && !r_reader.failed; i++) {
+		StringName utility_name = r_reader.get_string();
+		Variant::ValidatedUtilityFunction utility = Variant::get_validated_utility_function(utility_name);
+		if (utility == nullptr) {
+			r_reader.failed = true;
+			break;
+		}
+		function->utilities.push_back(utility);
+		int argument_count = Variant::get_utility_function_argument_count(utility_name);
+		callees.utilities.push_back({ argument_count, argument_count, Variant::is_utility_function_vararg(utility_name) });
+	}
+
+	uint32_t gds_utility_count = r_reader.get_count();
+	for (uint32_t i = 0; i < gds_utility_count && !r_reader.failed; i++) {
+		StringName gds_utility_name = r_reader.get_string();
+		GDScriptUtilityFunctions::FunctionPtr gds_utility = GDScriptUtilityFunctions::get_function(gds_utility_name);
+		if (gds_utility == nullptr) {
+			r_reader.failed = true;
+			break;
+		}
+		function->gds_utilities.push_back(gds_utility);
+		MethodInfo info = GDScriptUtilityFunctions::get_function_info(gds_utility_name);
+		int argument_count = info.arguments.size();
+		callees.gds_utilities.push_back({ argument_count - int(info.default_arguments.size()), argument_count, GDScriptUtilityFunctions::is_function_vararg(gds_utility_name) });
+	}
+
+	uint32_t method_count = r_reader.get_count();
+	for (uint32_t i = 0; i < method_count && !r_reader.failed; i++) {
+		StringName class_name = r_reader.get_string();
+		StringName method_name = r_reader.get_string();
+		uint32_t hash = r_reader.get_32();
+		// The method may have been removed or changed its signature, e.g. in a GDExtension.
+		MethodBind *method = r_reader.failed ? nullptr : ClassDB::get_method(class_name, method_name);
+		if (method == nullptr || method->get_hash() != hash) {
+			r_reader.failed = true;
+			break;
+		}
+		function->methods.push_back(method);
+		int argument_count = method->get_argument_count();
+		callees.methods.push_back({ argument_count - method->get_default_argument_count(), argument_count, method->is_vararg() });
+	}
+
+	uint32_t lambda_count = r_reader.get_count();
+	for (uint32_t i = 0; i < lambda_count && !r_reader.failed; i++) {
+		GDScript::LambdaInfo lambda_info;
+		lambda_info.capture_count = r_reader.get_32();
+		lambda_info.use_self = r_reader.get_8();
+		GDScriptFunction *lambda = _get_function(r_reader, p_script, r_class, p_depth + 1);
+		if (lambda) {
+			function->lambdas.push_back(lambda);
+			r_class.lambda_info.insert(lambda, lambda_info);
+		}
+	}
+
+#ifdef DEBUG_ENABLED
+	Vector<String> *debug_names[] = {
+		&function->operator_names,
+		&function->setter_names,
+		&function->getter_names,
+		&function->builtin_methods_names,
+		&function->constructors_names,
+		&function->utilities_names,
+		&function->gds_utilities_names,
+	};
+	for (Vector<String> *debug_name_list : debug_names) {
+		uint32_t count = r_reader.get_count();
+		for (uint32_t i = 0; i < count && !r_reader.failed; i++) {
+			debug_name_list->push_back(r_reader.get_string());
+		}
+	}
+	function->profile.signature = r_reader.get_string();
+#endif
+
+	if (!r_reader.failed && !_validate_code(function, callees, r_class.used_member_count)) {
+		r_reader.failed = true;
+	}
+
+	if (r_reader.failed) {
+		memdelete(function); // Also frees the lambdas read so far.
+		return nullptr;
+	}
+
+	// Same as `GDScriptByteCodeGenerator::write_end()`.
+	function->_code_ptr = function->code.is_empty() ? nullptr : function->code.ptrw();
+	function->_code_size = function->code.size();
+	function->_default_arg_count = function->default_arguments.is_empty() ? 0 : function->default_arguments.size() - 1;
+	function->_default_arg_ptr = function->default_arguments.is_empty() ? nullptr : function->default_arguments.ptr();
+	function->_constant_count = function->constants.size();
+	function->_constants_ptr = function->constants.is_empty() ? nullptr : function->constants.ptrw();
+	function->_global_names_count = function->global_names.size();
+	function->_global_names_ptr = function->global_names.is_empty() ? nullptr : function->global_names.ptr();
+	if (!function->global_names.is_empty()) {
+		function->lookup_caches.resize(function->global_names.size() * GDScriptFunction::LOOKUP_CACHE_MAX);
+		function->_lookup_caches_ptr = function->lookup_caches.ptr();
+	}
+	function->_operator_funcs_count = function->operator_funcs.size();
+	function->_operator_funcs_ptr = function->operator_funcs.is_empty() ? nullptr : function->operator_funcs.ptr();
+	function->_setters_count = function->setters.size();
+	function->_setters_ptr = function->setters.is_empty() ? nullptr : function->setters.ptr();
+	function->_getters_count = function->getters.size();
+	function->_getters_ptr = function->getters.is_empty() ? nullptr : function->getters.ptr();
+	function->_keyed_setters_count = function->keyed_setters.size();
+	function->_keyed_setters_ptr = function->keyed_setters.is_empty() ? nullptr : function->keyed_setters.ptr();
+	function->_keyed_getters_count = function->keyed_getters.size();
+	function->_keyed_getters_ptr = function->keyed_getters.is_empty() ? nullptr : function->keyed_getters.ptr();
+	function->_indexed_setters_count = function->indexed_setters.size();
+	function->_indexed_setters_ptr = function->indexed_setters.is_empty() ? nullptr : function->indexed_setters.ptr();
+	function->_indexed_getters_count = function->indexed_getters.size();
+	function->_indexed_getters_ptr = function->indexed_getters.is_empty() ? nullptr : function->indexed_getters.ptr();
+	function->_builtin_methods_count = function->builtin_methods.size();
+	function->_builtin_methods_ptr = function->builtin_methods.is_empty() ? nullptr : function->builtin_methods.ptr();
+	function->_constructors_count = function->constructors.size();
+	function->_constructors_ptr = function->constructors.is_empty() ? nullptr : function->constructors.ptr();
+	function->_utilities_count = function->utilities.size();
+	function->_utilities_ptr = function->utilities.is_empty() ? nullptr : function->utilities.ptr();
+	function->_gds_utilities_count = function->gds_utilities.size();
+	function->_gds_utilities_ptr = function->gds_utilities.is_empty() ? nullptr : function->gds_utilities.ptr();
+	function->_methods_count = function->methods.size();
+	function->_methods_ptr = function->methods.is_empty() ? nullptr : function->methods.ptrw();
+	function->_lambdas_count = function->lambdas.size();
+	function->_lambdas_ptr = function->lambdas.is_empty() ? nullptr : function->lambdas.ptrw();
+
+#ifdef DEBUG_ENABLED
+	function->func_cname = (String(function->source) + " - " + String(function->name)).utf8();
+	function->_func_cname = function->func_cname.get_data();
+#endif
+
+	return function;
+}
+
+// The VM only checks operands in debug builds. Code read from a cache file is only accepted if every address is in
+// the range of its kind, every index is in its table, every jump lands on an instruction, and native and validated
+// calls pass as many arguments as their callee expects. Operand types are still trusted like the ones the compiler emits.
+bool GDScriptBytecodeCache::_validate_code(GDScriptFunction *p_function, const CalleeArguments &p_callees, int &r_member_count) {
+	const int code_size = p_function->code.size();
+	int *code = p_function->code.ptrw();
+	const int stack_size = p_function->_stack_size;
+	const int instruction_args_size = p_function->_instruction_args_size;
+
+	if (p_function->_argument_count < 0 || p_function->_argument_count > p_function->argument_types.size()) {
+		return false;
+	}
+	if (stack_size < GDScriptFunction::FIXED_ADDRESSES_MAX + p_function->_argument_count || stack_size > GDScriptFunction::ADDR_MASK + 1) {
+		return false;
+	}
+	if (instruction_args_size < 0 || instruction_args_size > code_size) {
+		return false;
+	}
+	for (const KeyValue<int, Variant::Type> &E : p_function->temporary_slots) {
+		if (E.key < 0 || E.key >= stack_size) {
+			return false;
+		}
+	}
+
+	const int address_limits[GDScriptFunction::ADDR_TYPE_MAX] = { stack_size, int(p_function->constants.size()), GDScriptFunction::ADDR_MASK + 1 };
+	LocalVector<bool> instruction_starts;
+	instruction_starts.resize(code_size + 1);
+	for (int i = 0; i <= code_size; i++) {
+		instruction_starts[i] = false;
+	}
+	LocalVector<int> jump_targets;
+	for (int default_argument : p_function->default_arguments) {
+		jump_targets.push_back(default_argument);
+	}
+
+	int ip = 0;
+	int args_end = 0; // Position of the last instruction argument, the trailing operands are relative to it.
+	int arg_count = 0;
+
+	auto fits = [&](int p_length) {
+		return p_length <= code_size - ip;
+	};
+	auto address = [&](int p_operand) {
+		int value = code[ip + 1 + p_operand];
+		int type = (value & GDScriptFunction::ADDR_TYPE_MASK) >> GDScriptFunction::ADDR_BITS;
+		int index = value & GDScriptFunction::ADDR_MASK;
+		if (type < 0 || type >= GDScriptFunction::ADDR_TYPE_MAX || index >= address_limits[type]) {
+			return false;
+		}
+		if (type == GDScriptFunction::ADDR_TYPE_MEMBER) {
+			r_member_count = MAX(r_member_count, index + 1);
+		}
+		return true;
+	};
+	auto addresses = [&](int p_count) {
+		for (int i = 0; i < p_count; i++) {
+			if (!address(i)) {
+				return false;
+			}
+		}
+		return true;
+	};
+	auto index = [&](int p_position, int p_count) {
+		return code[p_position] >= 0 && code[p_position] < p_count;
+	};
+	auto type = [&](int p_position) {
+		return index(p_position, Variant::VARIANT_MAX);
+	};
+	auto global_name = [&](int p_position) {
+		return index(p_position, p_function->global_names.size());
+	};
+	auto jump = [&](int p_position) {
+		jump_targets.push_back(code[p_position]);
+		return true;
+	};
+	// `LOAD_INSTRUCTION_ARGS`: the argument count and the arguments, followed by `p_trailing` operands.
+	auto instruction_args = [&](int p_trailing) {
+		if (!fits(2)) {
+			return false;
+		}
+		arg_count = code[ip + 1];
+		if (arg_count < 0 || arg_count > instruction_args_size || !fits(2 + arg_count + p_trailing)) {
+			return false;
+		}
+		for (int i = 0; i < arg_count; i++) {
+			if (!address(1 + i)) {
+				return false;
+			}
+		}
+		args_end = ip + 1 + arg_count;
+		return true;
+	};
+	// The instructions read the arguments up to `argc + p_extra`, e.g. the base and return value of a call.
+	auto call_args = [&](int p_argc, int p_extra) {
+		return p_argc >= 0 && p_argc < arg_count && p_argc + p_extra < arg_count;
+	};
+	auto callee_args = [&](int p_argc, const LocalVector<CalleeArguments::Range> &p_callees, int p_position, bool p_validated) {
+		if (!index(p_position, p_callees.size())) {
+			return false;
+		}
+		const CalleeArguments::Range &range = p_callees[code[p_position]];
+		if (p_validated) {
+			return !range.vararg && p_argc == range.max;
+		}
+		return p_argc >= range.min && (range.vararg || p_argc <= range.max);
+	};
+
+	while (ip < code_size) {
+		instruction_starts[ip] = true;
+		int length = 0;
+		bool valid = false;
+
+		switch (code[ip]) {
+			case GDScriptFunction::OPCODE_OPERATOR: {
+				constexpr int _pointer_size = sizeof(Variant::ValidatedOperatorEvaluator) / sizeof(*code);
+				length = 7 + _pointer_size;
+				valid = fits(length) && addresses(3) && index(ip + 4, Variant::OP_MAX);
+				if (valid) {
+					// The signature, return type and evaluator cached by the VM on the first run.
+					for (int i = 5; i < length; i++) {
+						code[ip + i] = 0;
+					}
+				}
+			} break;
+			case GDScriptFunction::OPCODE_OPERATOR_VALIDATED: {
+				length = 5;
+				valid = fits(length) && addresses(3) && index(ip + 4, p_function->operator_funcs.size());
+			} break;
+			case GDScriptFunction::OPCODE_TYPE_TEST_BUILTIN:
+			case GDScriptFunction::OPCODE_ASSIGN_TYPED_BUILTIN:
+			case GDScriptFunction::OPCODE_CAST_TO_BUILTIN: {
+				length = 4;
+				valid = fits(length) && addresses(2) && type(ip + 3);
+			} break;
+			case GDScriptFunction::OPCODE_TYPE_TEST_ARRAY:
+			case GDScriptFunction::OPCODE_ASSIGN_TYPED_ARRAY: {
+				length = 6;
+				valid = fits(length) && addresses(3) && type(ip + 4) && global_name(ip + 5);
+			} break;
+			case GDScriptFunction::OPCODE_TYPE_TEST_DICTIONARY:
+			case GDScriptFunction::OPCODE_ASSIGN_TYPED_DICTIONARY: {
+				length = 9;
+				valid = fits(length) && addresses(4) && type(ip + 5) && global_name(ip + 6) && type(ip + 7) && global_name(ip + 8);
+			} break;
+			case GDScriptFunction::OPCODE_TYPE_TEST_NATIVE:
+			case GDScriptFunction::OPCODE_SET_NAMED:
+			case GDScriptFunction::OPCODE_GET_NAMED: {
+				length = 4;
+				valid = fits(length) && addresses(2) && global_name(ip + 3);
+			} break;
+			case GDScriptFunction::OPCODE_TYPE_TEST_SCRIPT:
+			case GDScriptFunction::OPCODE_SET_KEYED:
+			case GDScriptFunction::OPCODE_GET_KEYED:
+			case GDScriptFunction::OPCODE_ASSIGN_TYPED_NATIVE:
+			case GDScriptFunction::OPCODE_ASSIGN_TYPED_SCRIPT:
+			case GDScriptFunction::OPCODE_CAST_TO_NATIVE:
+			case GDScriptFunction::OPCODE_CAST_TO_SCRIPT: {
+				length = 4;
+				valid = fits(length) && addresses(3);
+			} break;
+			case GDScriptFunction::OPCODE_SET_KEYED_VALIDATED: {
+				length = 5;
+				valid = fits(length) && addresses(3) && index(ip + 4, p_function->keyed_setters.size());
+			} break;
+			case GDScriptFunction::OPCODE_SET_INDEXED_VALIDATED: {
+				length = 5;
+				valid = fits(length) && addresses(3) && index(ip + 4, p_function->indexed_setters.size());
+			} break;
+			case GDScriptFunction::OPCODE_GET_KEYED_VALIDATED: {
+				length = 5;
+				valid = fits(length) && addresses(3) && index(ip + 4, p_function->keyed_getters.size());
+			} break;
+			case GDScriptFunction::OPCODE_GET_INDEXED_VALIDATED: {
+				length = 5;
+				valid = fits(length) && addresses(3) && index(ip + 4, p_function->indexed_getters.size());
+			} break;
+			case GDScriptFunction::OPCODE_SET_NAMED_VALIDATED: {
+				length = 4;
+				valid = fits(length) && addresses(2) && index(ip + 3, p_function->setters.size());
+			} break;
+			case GDScriptFunction::OPCODE_GET_NAMED_VALIDATED: {
+				length = 4;
+				valid = fits(length) && addresses(2) && index(ip + 3, p_function->getters.size());
+			} break;
+			case GDScriptFunction::OPCODE_SET_MEMBER:
+			case GDScriptFunction::OPCODE_GET_MEMBER:
+			case GDScriptFunction::OPCODE_STORE_NAMED_GLOBAL: {
+				length = 3;
+				valid = fits(length) && addresses(1) && global_name(ip + 2);
+			} break;
+			case GDScriptFunction::OPCODE_SET_STATIC_VARIABLE:
+			case GDScriptFunction::OPCODE_GET_STATIC_VARIABLE: {
+				// The index is checked against the class at runtime.
+				length = 4;
+				valid = fits(length) && addresses(2);
+			} break;
+			case GDScriptFunction::OPCODE_ASSIGN: {
+				length = 3;
+				valid = fits(length) && addresses(2);
+			} break;
+			case GDScriptFunction::OPCODE_ASSIGN_NULL:
+			case GDScriptFunction::OPCODE_ASSIGN_TRUE:
+			case GDScriptFunction::OPCODE_ASSIGN_FALSE:
+			case GDScriptFunction::OPCODE_AWAIT_RESUME:
+			case GDScriptFunction::OPCODE_RETURN: {
+				length = 2;
+				valid = fits(length) && addresses(1);
+			} break;
+			case GDScriptFunction::OPCODE_CONSTRUCT: {
+				valid = instruction_args(2) && call_args(code[args_end + 1], 0) && type(args_end + 2);
+				length = args_end + 3 - ip;
+			} break;
+			case GDScriptFunction::OPCODE_CONSTRUCT_VALIDATED: {
+				valid = instruction_args(2) && call_args(code[args_end + 1], 0) && callee_args(code[args_end + 1], p_callees.constructors, args_end + 2, true);
+				length = args_end + 3 - ip;
+			} break;
+			case GDScriptFunction::OPCODE_CONSTRUCT_ARRAY: {
+				valid = instruction_args(1) && call_args(code[args_end + 1], 0);
+				length = args_end + 2 - ip;
+			} break;
+			case GDScriptFunction::OPCODE_CONSTRUCT_TYPED_ARRAY: {
+				valid = instruction_args(3) && call_args(code[args_end + 1], 1) && type(args_end + 2) && global_name(args_end + 3);
+				length = args_end + 4 - ip;
+			} break;
+			case GDScriptFunction::OPCODE_CONSTRUCT_DICTIONARY: {
+				valid = instruction_args(1) && code[args_end + 1] >= 0 && code[args_end + 1] <= instruction_args_size && call_args(code[args_end + 1] * 2, 0);
+				length = args_end + 2 - ip;
+			} break;
+			case GDScriptFunction::OPCODE_CONSTRUCT_TYPED_DICTIONARY: {
+				valid = instruction_args(5) && code[args_end + 1] >= 0 && code[args_end + 1] <= instruction_args_size && call_args(code[args_end + 1] * 2, 2) && type(args_end + 2) && global_name(args_end + 3) && type(args_end + 4) && global_name(args_end + 5);
+				length = args_end + 6 - ip;
+			} break;
+			case GDScriptFunction::OPCODE_CALL:
+			case GDScriptFunction::OPCODE_CALL_RETURN:
+			case GDScriptFunction::OPCODE_CALL_ASYNC: {
+				int extra = code[ip] == GDScriptFunction::OPCODE_CALL ? 0 : 1;
+				valid = instruction_args(2) && call_args(code[args_end + 1], extra) && global_name(args_end + 2);
+				length = args_end + 3 - ip;
+			} break;
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND:
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND_RET:
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_RETURN:
+			case GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_NO_RETURN: {
+				bool validated = code[ip] == GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_RETURN || code[ip] == GDScriptFunction::OPCODE_CALL_METHOD_BIND_VALIDATED_NO_RETURN;
+				int extra = code[ip] == GDScriptFunction::OPCODE_CALL_METHOD_BIND ? 0 : 1;
+				valid = instruction_args(2) && call_args(code[args_end + 1], extra) && callee_args(code[args_end + 1], p_callees.methods, args_end + 2, validated);
+				length = args_end + 3 - ip;
+			} break;
+			case GDScriptFunction::OPCODE_CALL_BUILTIN_STATIC: {
+				valid = instruction_args(3) && type(args_end + 1) && global_name(args_end + 2) && call_args(code[args_end + 3], 0);
+				length = args_end + 4 - ip;
+			} break;
+			case GDScriptFunction::OPCODE_CALL_NATIVE_STATIC: {
+				valid = instruction_args(2) && call_args(code[args_end + 2], 0) && callee_args(code[args_end + 2], p_callees.methods, args_end + 1, false);
+				length = args_end + 3 - ip;
+			} break;
+			case GDScriptFunction::OPCODE_CALL_NATIVE_STATIC_VALIDATED_RETURN:
+			case GDScriptFunction::OPCODE_CALL_NATIVE_STATIC_VALIDATED_NO_RETURN: {
+				valid = instruction_args(2) && call_args(code[args_end + 1], 0) && callee_args(code[args_end + 1], p_callees.methods, args_end + 2, true);
+				length = args_end + 3 - ip;
+			} break;
+			case GDScriptFunction::OPCODE_CALL_BUILTIN_TYPE_VALIDATED: {
+				valid = instruction_args(2) && call_args(code[args_end + 1], 1) && callee_args(code[args_end + 1], p_callees.builtin_methods, args_end + 2, true);
+				length = args_end + 3 - ip;
+			} break;
+			case GDScriptFunction::OPCODE_CALL_UTILITY:
+			case GDScriptFunction::OPCODE_CALL_SELF_BASE: {
+				valid = instruction_args(2) && call_args(code[args_end + 1], 0) && global_name(args_end + 2);
+				length = args_end + 3 - ip;
+			} break;
+			case GDScriptFunction::OPCODE_CALL_UTILITY_VALIDATED: {
+				valid = instruction_args(2) && call_args(code[args_end + 1], 0) && callee_args(code[args_end + 1], p_callees.utilities, args_end + 2, true);
+				length = args_end + 3 - ip;
+			} break;
+			case GDScriptFunction::OPCODE_CALL_GDSCRIPT_UTILITY: {
+				valid = instruction_args(2) && call_args(code[args_end + 1], 0) && callee_args(code[args_end + 1], p_callees.gds_utilities, args_end + 2, false);
+				length = args_end + 3 - ip;
+			} break;
+			case GDScriptFunction::OPCODE_AWAIT: {
+				// Also writes to the operand of the `OPCODE_AWAIT_RESUME` that follows.
+				length = 2;
+				valid = fits(length + 2) && addresses(1) && code[ip + 2] == GDScriptFunction::OPCODE_AWAIT_RESUME;
+			} break;
+			case GDScriptFunction::OPCODE_CREATE_LAMBDA:
+			case GDScriptFunction::OPCODE_CREATE_SELF_LAMBDA: {
+				valid = instruction_args(2) && call_args(code[args_end + 1], 0) && index(args_end + 2, p_function->lambdas.size());
+				length = args_end + 3 - ip;
+			} break;
+			case GDScriptFunction::OPCODE_JUMP: {
+				length = 2;
+				valid = fits(length) && jump(ip + 1);
+			} break;
+			case GDScriptFunction::OPCODE_JUMP_IF:
+			case GDScriptFunction::OPCODE_JUMP_IF_NOT:
+			case GDScriptFunction::OPCODE_JUMP_IF_SHARED: {
+				length = 3;
+				valid = fits(length) && addresses(1) && jump(ip + 2);
+			} break;
+			case GDScriptFunction::OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT: {
+				length = 6;
+				valid = fits(length) && addresses(3) && index(ip + 4, p_function->operator_funcs.size()) && jump(ip + 5);
+			} break;
+			case GDScriptFunction::OPCODE_JUMP_TO_DEF_ARGUMENT:
+			case GDScriptFunction::OPCODE_BREAKPOINT:
+			case GDScriptFunction::OPCODE_END: {
+				length = 1;
+				valid = true;
+			} break;
+			case GDScriptFunction::OPCODE_RETURN_TYPED_BUILTIN: {
+				length = 3;
+				valid = fits(length) && addresses(1) && type(ip + 2);
+			} break;
+			case GDScriptFunction::OPCODE_RETURN_TYPED_ARRAY: {
+				length = 5;
+				valid = fits(length) && addresses(2) && type(ip + 3) && global_name(ip + 4);
+			} break;
+			case GDScriptFunction::OPCODE_RETURN_TYPED_DICTIONARY: {
+				length = 8;
+				valid = fits(length) && addresses(3) && type(ip + 4) && global_name(ip + 5) && type(ip + 6) && global_name(ip + 7);
+			} break;
+			case GDScriptFunction::OPCODE_RETURN_TYPED_NATIVE:
+			case GDScriptFunction::OPCODE_RETURN_TYPED_SCRIPT: {
+				length = 3;
+				valid = fits(length) && addresses(2);
+			} break;
+			case GDScriptFunction::OPCODE_STORE_GLOBAL: {
+				length = 3;
+				valid = fits(length) && addresses(1) && index(ip + 2, GDScriptLanguage::get_singleton()->get_global_array_size());
+			} break;
+			case GDScriptFunction::OPCODE_ASSERT: {
+				length = 3;
+				valid = fits(length) && addresses(code[ip + 2] != 0 ? 2 : 1);
+			} break;
+			case GDScriptFunction::OPCODE_LINE: {
+				length = 2;
+				valid = fits(length);
+			} break;
+			default: {
+				if (code[ip] >= GDScriptFunction::OPCODE_ITERATE_BEGIN && code[ip] <= GDScriptFunction::OPCODE_ITERATE_OBJECT) {
+					length = 5;
+					valid = fits(length) && addresses(3) && jump(ip + 4);
+				} else if (code[ip] >= GDScriptFunction::OPCODE_TYPE_ADJUST_BOOL && code[ip] <= GDScriptFunction::OPCODE_TYPE_ADJUST_PACKED_VECTOR4_ARRAY) {
+					length = 2;
+					valid = fits(length) && addresses(1);
+				}
+			} break;
+		}
+
+		if (!valid) {
+			return false;
+		}
+		ip += length;
+	}
+
+	// Jumping to the end returns.
+	instruction_starts[code_size] = true;
+	for (int target : jump_targets) {
+		if (target < 0 || target > code_size || !instruction_starts[target]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+int GDScriptBytecodeCache::_get_member_base_index(LocalVector<ClassData> &p_classes, int p_class, int p_depth) {
+	ClassData &class_data = p_classes[p_class];
+	if (class_data.member_base_index >= 0) {
+		return class_data.member_base_index;
+	}
+	if (p_depth > MAX_NESTING_DEPTH) {
+		return -1; // Cyclic inheritance.
+	}
+
+	int base_index = 0;
+	if (class_data.base.is_valid()) {
+		base_index = -1;
+		for (uint32_t i = 0; i < p_classes.size(); i++) {
+			if (p_classes[i].script == class_data.base.ptr()) {
+				int base_base_index = _get_member_base_index(p_classes, i, p_depth + 1);
+				if (base_base_index >= 0) {
+					base_index = base_base_index + p_classes[i].members.size();
+				}
+				break;
+			}
+		}
+		if (base_index < 0 && class_data.base->get_root_script() != p_classes[0].script) {
+			base_index = class_data.base->member_indices.size();
+		}
+	}
+
+	class_data.member_base_index = base_index;
+	return base_index;
+}
+
+void GDScriptBytecodeCache::_apply_class(LocalVector<ClassData> &p_classes, int p_class) {
+	ClassData &class_data = p_classes[p_class];
+	if (class_data.applied) {
+		return;
+	}
+	class_data.applied = true;
+
+	GDScript *script = class_data.script;
+	if (class_data.base.is_valid()) {
+		for (uint32_t i = 0; i < p_classes.size(); i++) {
+			if (p_classes[i].script == class_data.base.ptr()) {
+				_apply_class(p_classes, i);
+				break;
+			}
+		}
+		script->base = class_data.base;
+		script->_base = class_data.base.ptr();
+		script->member_indices = class_data.base->member_indices;
+	}
+	script->native = class_data.native;
+	script->tool = class_data.tool;
+
+	for (const Pair<StringName, GDScript::MemberInfo> &member : class_data.members) {
+		script->member_indices[member.first] = member.second;
+		script->members.insert(member.first);
+	}
+	for (const Pair<StringName, GDScript::MemberInfo> &static_variable : class_data.static_variables) {
+		script->static_variables_indices[static_variable.first] = static_variable.second;
+	}
+	script->static_variables.resize(script->static_variables_indices.size());
+
+	script->constants = class_data.constants;
+	script->_signals = class_data.signals;
+	script->rpc_config = class_data.rpc_config;
+
+	for (const Pair<FunctionRole, GDScriptFunction *> &function : class_data.functions) {
+		switch (function.first) {
+			case FUNCTION_ROLE_MEMBER: {
+				script->member_functions[function.second->name] = function.second;
+				if (function.second->name == GDScriptLanguage::get_singleton()->strings._init) {
+					script->initializer = function.second;
+				}
+			} break;
+			case FUNCTION_ROLE_IMPLICIT_INITIALIZER: {
+				script->implicit_initializer = function.second;
+			} break;
+			case FUNCTION_ROLE_IMPLICIT_READY: {
+				script->implicit_ready = function.second;
+			} break;
+			case FUNCTION_ROLE_STATIC_INITIALIZER: {
+				script->static_initializer = function.second;
+			} break;
+		}
+	}
+	for (const KeyValue<GDScriptFunction *, GDScript::LambdaInfo> &E : class_data.lambda_info) {
+		script->lambda_info.insert(E.key, E.value);
+	}
+
+	script->_static_default_init();
+}
+
+Error GDScriptBytecodeCache::_read_class_tree(Reader &r_reader, GDScript *p_script, bool &r_add_static_script) {
+	uint32_t source_hash = 0;
+	HashMap<String, uint32_t> dependencies;
+	Error err = _read_header(r_reader, source_hash, dependencies);
+	if (err != OK) {
+		return err;
+	}
+
+	r_add_static_script = r_reader.get_8();
+	String fqcn = r_reader.get_string();
+	StringName local_name = r_reader.get_string();
+	_make_class_tree(r_reader, p_script, fqcn, local_name);
+
+	return r_reader.failed ? ERR_FILE_CORRUPT : OK;
+}
+
+Error GDScriptBytecodeCache::make_scripts(GDScript *p_script, const Vector<uint8_t> &p_buffer) {
+	Reader reader(p_buffer, p_script);
+	bool add_static_script = false;
+	return _read_class_tree(reader, p_script, add_static_script);
+}
+
+Error GDScriptBytecodeCache::deserialize(GDScript *p_script, const Vector<uint8_t> &p_buffer, bool &r_add_static_script) {
+	ERR_FAIL_COND_V(!p_script->is_root_script(), ERR_INVALID_PARAMETER);
+
+	Reader reader(p_buffer, p_script);
+	Error err = _read_class_tree(reader, p_script, r_add_static_script);
+	if (err != OK) {
+		return err;
+	}
+
+	LocalVector<GDScript *> scripts;
+	scripts.push_back(p_script);
+	for (uint32_t i = 0; i < scripts.size(); i++) {
+		GDScript *script = scripts[i];
+		if (script->valid || !script->member_functions.is_empty() || script->implicit_initializer) {
+			return ERR_ALREADY_IN_USE;
+		}
+		for (const KeyValue<StringName, Ref<GDScript>> &E : script->subclasses) {
+			scripts.push_back(E.value.ptr());
+		}
+	}
+
+	// The root class comes first, `_get_member_base_index()` relies on it.
+	LocalVector<ClassData> classes;
+	classes.resize(scripts.size());
+	for (uint32_t i = 0; i < classes.size() && !reader.failed; i++) {
+		String fqcn = reader.get_string();
+		classes[i].script = reader.failed ? nullptr : p_script->find_class(fqcn);
+		if (classes[i].script == nullptr) {
+			reader.failed = true;
+			break;
+		}
+		_get_class(reader, classes[i]);
+	}
+
+	// Make sure applying can't fail halfway, so there's nothing to undo.
+	for (uint32_t i = 0; i < classes.size() && !reader.failed; i++) {
+		ClassData &class_data = classes[i];
+		if (class_data.base.is_valid() && class_data.base->get_root_script() != p_script && !class_data.base->is_valid()) {
+			Error base_err = OK;
+			GDScriptCache::get_full_script(class_data.base->get_root_script()->path, base_err, p_script->path);
+			if (base_err != OK || !class_data.base->is_valid()) {
+				reader.failed = true;
+				break;
+			}
+		}
+	}
+	for (uint32_t i = 0; i < classes.size() && !reader.failed; i++) {
+		int member_base_index = _get_member_base_index(classes, i);
+		uint32_t member_count = classes[i].members.size();
+		LocalVector<bool> seen;
+		seen.resize(member_count);
+		for (uint32_t j = 0; j < member_count; j++) {
+			seen[j] = false;
+		}
+		for (const Pair<StringName, GDScript::MemberInfo> &member : classes[i].members) {
+			int local_index = member.second.index - member_base_index;
+			if (member_base_index < 0 || local_index < 0 || uint32_t(local_index) >= member_count || seen[local_index]) {
+				reader.failed = true;
+				break;
+			}
+			seen[local_index] = true;
+		}
+		// Instances of the class or of the classes extending it have at least this many members.
+		if (classes[i].used_member_count > member_base_index + int(member_count)) {
+			reader.failed = true;
+		}
+	}
+
+	if (reader.failed) {
+		for (ClassData &class_data : classes) {
+			for (const Pair<FunctionRole, GDScriptFunction *> &function : class_data.functions) {
+				memdelete(function.second);
+			}
+		}
+		return ERR_FILE_CORRUPT;
+	}
+
+	for (uint32_t i = 0; i < classes.size(); i++) {
+		_apply_class(classes, i);
+	}
+	for (ClassData &class_data : classes) {
+		class_data.script->valid = true;
+	}
+	GDScriptFunction::invalidate_lookup_caches();
+
+	return OK;
+}
+
+void GDScriptBytecodeCache::clear() {
+	MutexLock lock(validated_names_mutex);
+	if (validated_names) {
+		memdelete(validated_names);
+		validated_names = nullptr;
+	}
+}
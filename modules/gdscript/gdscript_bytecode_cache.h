@@ -0,0 +1,123 @@
+/**************************************************************************/
+/*  gdscript_bytecode_cache.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef GDSCRIPT_BYTECODE_CACHE_H
+#define GDSCRIPT_BYTECODE_CACHE_H
+
+#include "gdscript.h"
+#include "gdscript_function.h"
+
+#include "core/os/mutex.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/rb_map.h"
+#include "core/templates/vector.h"
+
+// Serializes the result of compiling a script file (every class in it, with their members, constants,
+// signals and functions) so it can be loaded back without going through the parser, analyzer and compiler.
+// The format is tied to the binary that wrote it: the header records the engine version, build
+// configuration and ClassDB API hash, and the source hashes of the script and of every script it depends
+// on. Native methods and builtin type functions are stored by name and resolved again when loading.
+// A checksum of the payload is verified before reading it, and the operands of the code are checked
+// against the tables of their function, since the VM only checks them in debug builds.
+class GDScriptBytecodeCache {
+	struct Writer;
+	struct Reader;
+	struct ClassData;
+	struct CalleeArguments;
+
+	// Reverse lookup of the validated function pointers used by the bytecode, only built when writing.
+	struct ValidatedNames {
+		RBMap<Variant::ValidatedOperatorEvaluator, uint32_t> operators;
+		RBMap<Variant::ValidatedSetter, Pair<Variant::Type, StringName>> setters;
+		RBMap<Variant::ValidatedGetter, Pair<Variant::Type, StringName>> getters;
+		RBMap<Variant::ValidatedKeyedSetter, Variant::Type> keyed_setters;
+		RBMap<Variant::ValidatedKeyedGetter, Variant::Type> keyed_getters;
+		RBMap<Variant::ValidatedIndexedSetter, Variant::Type> indexed_setters;
+		RBMap<Variant::ValidatedIndexedGetter, Variant::Type> indexed_getters;
+		RBMap<Variant::ValidatedBuiltInMethod, Pair<Variant::Type, StringName>> builtin_methods;
+		RBMap<Variant::ValidatedConstructor, Pair<Variant::Type, int>> constructors;
+		RBMap<Variant::ValidatedUtilityFunction, StringName> utilities;
+		RBMap<GDScriptUtilityFunctions::FunctionPtr, StringName> gds_utilities;
+	};
+
+	static Mutex validated_names_mutex;
+	static ValidatedNames *validated_names;
+
+	static const ValidatedNames &_get_validated_names();
+	static String _get_engine_id();
+	static uint32_t _get_api_hash();
+
+	static Error _read_header(Reader &r_reader, uint32_t &r_source_hash, HashMap<String, uint32_t> &r_dependencies);
+	static Error _read_class_tree(Reader &r_reader, GDScript *p_script, bool &r_add_static_script);
+
+	static void _put_variant(Writer &r_writer, const Variant &p_value, int p_depth = 0);
+	static void _put_object(Writer &r_writer, Object *p_object);
+	static void _put_property_info(Writer &r_writer, const PropertyInfo &p_info);
+	static void _put_method_info(Writer &r_writer, const MethodInfo &p_info);
+	static void _put_data_type(Writer &r_writer, const GDScriptDataType &p_type, int p_depth = 0);
+	static void _put_member_info(Writer &r_writer, const GDScript::MemberInfo &p_info);
+	static void _put_class_tree(Writer &r_writer, GDScript *p_script);
+	static void _put_class(Writer &r_writer, GDScript *p_script);
+	static void _put_function(Writer &r_writer, const GDScriptFunction *p_function);
+
+	static Variant _get_variant(Reader &r_reader, int p_depth = 0);
+	static Variant _get_object(Reader &r_reader, bool p_local_only = false);
+	static PropertyInfo _get_property_info(Reader &r_reader);
+	static MethodInfo _get_method_info(Reader &r_reader);
+	static GDScriptDataType _get_data_type(Reader &r_reader, int p_depth = 0);
+	static GDScript::MemberInfo _get_member_info(Reader &r_reader);
+	static void _make_class_tree(Reader &r_reader, GDScript *p_script, const String &p_fqcn, const StringName &p_local_name, int p_depth = 0);
+	static void _get_class(Reader &r_reader, ClassData &r_class);
+	static GDScriptFunction *_get_function(Reader &r_reader, GDScript *p_script, ClassData &r_class, int p_depth = 0);
+	static bool _validate_code(GDScriptFunction *p_function, const CalleeArguments &p_callees, int &r_member_count);
+
+	static int _get_member_base_index(LocalVector<ClassData> &p_classes, int p_class, int p_depth = 0);
+	static void _apply_class(LocalVector<ClassData> &p_classes, int p_class);
+
+public:
+	static constexpr uint32_t FORMAT_VERSION = 2;
+
+	// Returns the dependencies recorded in the header, or an error if the buffer was not written by this binary
+	// for a script with the given source hash.
+	static Error parse_header(const Vector<uint8_t> &p_buffer, uint32_t p_source_hash, HashMap<String, uint32_t> &r_dependencies);
+
+	// Returns an empty buffer if something in the script can't be stored, e.g. a constant holding a non-resource object.
+	static Vector<uint8_t> serialize(GDScript *p_script, uint32_t p_source_hash, const HashMap<String, uint32_t> &p_dependencies, bool p_add_static_script);
+
+	// Creates the inner class scripts, like `GDScriptCompiler::make_scripts()`.
+	static Error make_scripts(GDScript *p_script, const Vector<uint8_t> &p_buffer);
+	// Fills every class of a freshly made script. The script must not have been compiled before.
+	static Error deserialize(GDScript *p_script, const Vector<uint8_t> &p_buffer, bool &r_add_static_script);
+
+	static void clear();
+};
+
+#endif // GDSCRIPT_BYTECODE_CACHE_H
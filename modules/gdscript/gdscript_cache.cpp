@@ -32,10 +32,16 @@
 
 #include "gdscript.h"
 #include "gdscript_analyzer.h"
+#include "gdscript_bytecode_cache.h"
 #include "gdscript_compiler.h"
 #include "gdscript_parser.h"
 
+#include "core/config/engine.h"
+#include "core/config/project_settings.h"
+#include "core/io/dir_access.h"
 #include "core/io/file_access.h"
+#include "core/os/os.h"
+#include "core/os/thread.h"
 #include "core/templates/vector.h"
 
 GDScriptParserRef::Status GDScriptParserRef::get_status() const {
@@ -207,6 +213,8 @@ void GDScriptCache::remove_script(const String &p_path) {
 	singleton->dependencies.erase(p_path);
 	singleton->shallow_gdscript_cache.erase(p_path);
 	singleton->full_gdscript_cache.erase(p_path);
+	singleton->pending_bytecode.erase(p_path);
+	singleton->file_source_hashes.erase(p_path);
 }
 
 Ref<GDScriptParserRef> GDScriptCache::get_parser(const String &p_path, GDScriptParserRef::Status p_status, Error &r_error, const String &p_owner) {
@@ -326,6 +334,16 @@ Ref<GDScript> GDScriptCache::get_shallow_script(const String &p_path, Error &r_e
 		return Ref<GDScript>(); // Returns null and does not cache when the script fails to load.
 	}
 
+	if (is_bytecode_cache_enabled()) {
+		// The inner classes can be made from the cached bytecode, which is kept until the script is compiled.
+		Vector<uint8_t> bytecode = _load_bytecode(p_path, script->_get_source_hash());
+		if (!bytecode.is_empty() && GDScriptBytecodeCache::make_scripts(script.ptr(), bytecode) == OK) {
+			singleton->pending_bytecode[p_path] = bytecode;
+			singleton->shallow_gdscript_cache[p_path] = script;
+			return script;
+		}
+	}
+
 	Ref<GDScriptParserRef> parser_ref = get_parser(p_path, GDScriptParserRef::PARSED, r_error);
 	if (r_error == OK) {
 		GDScriptCompiler::make_scripts(script.ptr(), parser_ref->get_parser()->get_tree(), true);
@@ -440,6 +458,166 @@ void GDScriptCache::remove_static_script(const String &p_fqcn) {
 	singleton->static_gdscript_cache.erase(p_fqcn);
 }
 
+bool GDScriptCache::_get_file_source_hash(const String &p_path, uint32_t &r_hash) {
+	{
+		MutexLock lock(singleton->mutex);
+		if (const uint32_t *hash = singleton->file_source_hashes.getptr(p_path)) {
+			r_hash = *hash;
+			return true;
+		}
+	}
+
+	// Read the file without holding the cache lock. If another thread hashes the same file meanwhile,
+	// both compute the same value.
+
+	// Same as the hash `GDScript::reload()` checks parsers against.
+	String remapped_path = ResourceLoader::path_remap(p_path);
+	if (!FileAccess::exists(remapped_path)) {
+		return false;
+	}
+	if (remapped_path.get_extension().to_lower() == "gdc") {
+		Vector<uint8_t> buffer = get_binary_tokens(remapped_path);
+		if (buffer.is_empty()) {
+			return false;
+		}
+		r_hash = hash_djb2_buffer(buffer.ptr(), buffer.size());
+	} else {
+		r_hash = get_source_code(remapped_path).hash();
+	}
+
+	MutexLock lock(singleton->mutex);
+	singleton->file_source_hashes[p_path] = r_hash;
+	return true;
+}
+
+String GDScriptCache::_get_bytecode_cache_path(const String &p_path) {
+	String cache_dir = GLOBAL_GET("gdscript/bytecode_cache/path");
+	return cache_dir.path_join(p_path.md5_text() + ".gdbc");
+}
+
+Vector<uint8_t> GDScriptCache::_load_bytecode(const String &p_path, uint32_t p_source_hash) {
+	String cache_path = _get_bytecode_cache_path(p_path);
+	if (!FileAccess::exists(cache_path)) {
+		return Vector<uint8_t>();
+	}
+
+	Error err = OK;
+	Vector<uint8_t> buffer = FileAccess::get_file_as_bytes(cache_path, &err);
+	if (err != OK) {
+		return Vector<uint8_t>();
+	}
+
+	HashMap<String, uint32_t> dependencies;
+	if (GDScriptBytecodeCache::parse_header(buffer, p_source_hash, dependencies) != OK) {
+		print_verbose(vformat(R"(GDScript: Cached bytecode of "%s" is outdated.)", p_path));
+		return Vector<uint8_t>();
+	}
+	for (const KeyValue<String, uint32_t> &E : dependencies) {
+		uint32_t source_hash = 0;
+		if (!_get_file_source_hash(E.key, source_hash) || source_hash != E.value) {
+			print_verbose(vformat(R"(GDScript: Cached bytecode of "%s" is outdated, "%s" changed.)", p_path, E.key));
+			return Vector<uint8_t>();
+		}
+	}
+
+	return buffer;
+}
+
+bool GDScriptCache::is_bytecode_cache_enabled() {
+	MutexLock lock(singleton->mutex);
+	if (singleton->bytecode_cache_enabled < 0) {
+		// The editor changes scripts all the time, and compiles them with editor-only instructions.
+		singleton->bytecode_cache_enabled = !Engine::get_singleton()->is_editor_hint() && bool(GLOBAL_GET("gdscript/bytecode_cache/enabled"));
+	}
+	return singleton->bytecode_cache_enabled;
+}
+
+Vector<uint8_t> GDScriptCache::get_bytecode(const String &p_path, uint32_t p_source_hash) {
+	{
+		MutexLock lock(singleton->mutex);
+		if (HashMap<String, Vector<uint8_t>>::Iterator E = singleton->pending_bytecode.find(p_path)) {
+			Vector<uint8_t> bytecode = E->value;
+			singleton->pending_bytecode.remove(E);
+			return bytecode;
+		}
+	}
+
+	// Reading the cache file and hashing the dependencies can take a while, so don't hold the cache lock for it.
+	return _load_bytecode(p_path, p_source_hash);
+}
+
+void GDScriptCache::save_bytecode(GDScript *p_script, const GDScriptParser *p_parser, bool p_add_static_script) {
+	const String &path = p_script->path;
+	if (!path.begins_with("res://") || path.contains("::")) {
+		return; // Built-in script.
+	}
+
+	// Everything the compiled code was derived from: the scripts parsed while analyzing this one, and their
+	// own dependencies, as well as the scripts the compiler loaded.
+	HashSet<String> dependency_paths;
+	LocalVector<const GDScriptParser *> parsers;
+	parsers.push_back(p_parser);
+	for (uint32_t i = 0; i < parsers.size(); i++) {
+		for (const KeyValue<String, Ref<GDScriptParserRef>> &E : parsers[i]->get_depended_parsers()) {
+			if (E.key == path || dependency_paths.has(E.key)) {
+				continue;
+			}
+			dependency_paths.insert(E.key);
+			if (E.value.is_valid() && E.value->get_parser() != nullptr) {
+				parsers.push_back(E.value->get_parser());
+			}
+		}
+	}
+
+	{
+		MutexLock lock(singleton->mutex);
+		if (const HashSet<String> *compiler_dependencies = singleton->dependencies.getptr(path)) {
+			for (const String &dependency : *compiler_dependencies) {
+				if (dependency != path) {
+					dependency_paths.insert(dependency);
+				}
+			}
+		}
+	}
+
+	HashMap<String, uint32_t> dependencies;
+	for (const String &dependency : dependency_paths) {
+		uint32_t source_hash = 0;
+		if (!_get_file_source_hash(dependency, source_hash)) {
+			return;
+		}
+		dependencies[dependency] = source_hash;
+	}
+
+	Vector<uint8_t> bytecode = GDScriptBytecodeCache::serialize(p_script, p_script->_get_source_hash(), dependencies, p_add_static_script);
+	if (bytecode.is_empty()) {
+		print_verbose(vformat(R"(GDScript: Not caching the bytecode of "%s", it holds values that can't be stored.)", path));
+		return;
+	}
+
+	String cache_path = _get_bytecode_cache_path(path);
+	Error err = DirAccess::make_dir_recursive_absolute(cache_path.get_base_dir());
+	if (err != OK) {
+		return;
+	}
+	// Written next to the cache file and moved over it, so other threads and processes never read a partial file.
+	String temp_path = vformat("%s.%d-%d.tmp", cache_path, OS::get_singleton()->get_process_id(), (int64_t)Thread::get_caller_id());
+	{
+		Ref<FileAccess> file = FileAccess::open(temp_path, FileAccess::WRITE, &err);
+		if (file.is_null()) {
+			return;
+		}
+		file->store_buffer(bytecode);
+		err = file->get_error();
+	}
+	if (err == OK) {
+		err = DirAccess::rename_absolute(temp_path, cache_path);
+	}
+	if (err != OK) {
+		DirAccess::remove_absolute(temp_path);
+	}
+}
+
 void GDScriptCache::clear() {
 	if (singleton == nullptr) {
 		return;
@@ -481,6 +659,10 @@ void GDScriptCache::clear() {
 	parser_map_refs.clear();
 	singleton->shallow_gdscript_cache.clear();
 	singleton->full_gdscript_cache.clear();
+	singleton->pending_bytecode.clear();
+	singleton->file_source_hashes.clear();
+
+	GDScriptBytecodeCache::clear();
 }
 
 GDScriptCache::GDScriptCache() {
@@ -86,6 +86,9 @@ class GDScriptCache {
 	HashMap<String, Ref<GDScript>> static_gdscript_cache;
 	HashMap<String, HashSet<String>> dependencies;
 	HashMap<String, HashSet<String>> parser_inverse_dependencies;
+	HashMap<String, Vector<uint8_t>> pending_bytecode; // Read when making the shallow script, used when it's compiled.
+	HashMap<String, uint32_t> file_source_hashes;
+	int bytecode_cache_enabled = -1;
 
 	friend class GDScript;
 	friend class GDScriptParserRef;
@@ -102,6 +105,10 @@ private:
 	static SafeBinaryMutex<BINARY_MUTEX_TAG> mutex;
 	friend SafeBinaryMutex<BINARY_MUTEX_TAG> &_get_gdscript_cache_mutex();
 
+	static bool _get_file_source_hash(const String &p_path, uint32_t &r_hash);
+	static String _get_bytecode_cache_path(const String &p_path);
+	static Vector<uint8_t> _load_bytecode(const String &p_path, uint32_t p_source_hash);
+
 public:
 	static void move_script(const String &p_from, const String &p_to);
 	static void remove_script(const String &p_path);
@@ -117,6 +124,10 @@ public:
 	static void add_static_script(Ref<GDScript> p_script);
 	static void remove_static_script(const String &p_fqcn);
 
+	static bool is_bytecode_cache_enabled();
+	static Vector<uint8_t> get_bytecode(const String &p_path, uint32_t p_source_hash);
+	static void save_bytecode(GDScript *p_script, const GDScriptParser *p_parser, bool p_add_static_script);
+
 	static void clear();
 
 	GDScriptCache();
@@ -2683,6 +2683,7 @@ Error GDScriptCompiler::_prepare_compilation(GDScript *p_script, const GDScriptP
 
 	p_script->member_functions.clear();
 	p_script->member_indices.clear();
+	GDScriptFunction::invalidate_lookup_caches();
 	p_script->static_variables_indices.clear();
 	p_script->static_variables.clear();
 	p_script->_signals.clear();
@@ -3048,6 +3049,7 @@ Error GDScriptCompiler::_compile_class(GDScript *p_script, const GDScriptParser:
 	p_script->_static_default_init();
 
 	p_script->valid = true;
+	GDScriptFunction::invalidate_lookup_caches(); // Entries resolved while the script was invalid are stale now.
 	return OK;
 }
 
@@ -3269,6 +3271,11 @@ Error GDScriptCompiler::compile(const GDScriptParser *p_parser, GDScript *p_scri
 		GDScriptCache::add_static_script(p_script);
 	}
 
+	// Saved before anything runs, since some instructions patch themselves the first time they're executed.
+	if (GDScriptCache::is_bytecode_cache_enabled()) {
+		GDScriptCache::save_bytecode(main_script, parser, has_static_data && !root->annotated_static_unload);
+	}
+
 	return GDScriptCache::finish_compiling(main_script->path);
 }
 
@@ -32,6 +32,70 @@
 
 #include "gdscript.h"
 
+SafeNumeric<uint32_t> GDScriptFunction::lookup_cache_generation;
+
+bool GDScriptFunction::LookupCache::find(const void *p_script, const void *p_native, uint32_t p_generation, Entry &r_entry) const {
+	for (uint32_t i = 0; i < ENTRY_COUNT; i++) {
+		const Slot &slot = slots[i];
+		uint32_t sequence = slot.sequence.load(std::memory_order_acquire);
+		if (sequence & 1) {
+			continue; // Being written.
+		}
+		if (slot.script.load(std::memory_order_relaxed) != p_script || slot.native.load(std::memory_order_relaxed) != p_native || slot.generation.load(std::memory_order_relaxed) != p_generation) {
+			continue;
+		}
+
+		Entry entry;
+		entry.script = p_script;
+		entry.native = p_native;
+		entry.generation = p_generation;
+		entry.type = slot.type.load(std::memory_order_relaxed);
+		entry.member_type = slot.member_type.load(std::memory_order_relaxed);
+		entry.member_index = slot.member_index.load(std::memory_order_relaxed);
+		entry.function = slot.function.load(std::memory_order_relaxed);
+		entry.method = slot.method.load(std::memory_order_relaxed);
+
+		std::atomic_thread_fence(std::memory_order_acquire);
+		if (slot.sequence.load(std::memory_order_relaxed) != sequence || entry.type == TYPE_EMPTY) {
+			continue; // Replaced while reading, the copy may be torn.
+		}
+
+		r_entry = entry;
+		return true;
+	}
+	return false;
+}
+
+void GDScriptFunction::LookupCache::insert(const Entry &p_entry) {
+	lock.lock();
+	// Prefer replacing stale or empty entries, otherwise cycle through them.
+	uint32_t index = next_entry;
+	for (uint32_t i = 0; i < ENTRY_COUNT; i++) {
+		if (slots[i].type.load(std::memory_order_relaxed) == TYPE_EMPTY || slots[i].generation.load(std::memory_order_relaxed) != p_entry.generation) {
+			index = i;
+			break;
+		}
+	}
+
+	Slot &slot = slots[index];
+	uint32_t sequence = slot.sequence.load(std::memory_order_relaxed);
+	slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+
+	slot.script.store(p_entry.script, std::memory_order_relaxed);
+	slot.native.store(p_entry.native, std::memory_order_relaxed);
+	slot.generation.store(p_entry.generation, std::memory_order_relaxed);
+	slot.type.store(p_entry.type, std::memory_order_relaxed);
+	slot.member_type.store(p_entry.member_type, std::memory_order_relaxed);
+	slot.member_index.store(p_entry.member_index, std::memory_order_relaxed);
+	slot.function.store(p_entry.function, std::memory_order_relaxed);
+	slot.method.store(p_entry.method, std::memory_order_relaxed);
+
+	slot.sequence.store(sequence + 2, std::memory_order_release);
+	next_entry = (index + 1) % ENTRY_COUNT;
+	lock.unlock();
+}
+
 Variant GDScriptFunction::get_constant(int p_idx) const {
 	ERR_FAIL_INDEX_V(p_idx, constants.size(), "<errconst>");
 	return constants[p_idx];
@@ -116,6 +180,7 @@ GDScriptFunction::GDScriptFunction() {
 
 GDScriptFunction::~GDScriptFunction() {
 	get_script()->member_functions.erase(name);
+	invalidate_lookup_caches(); // Other functions may have cached this one.
 
 	for (int i = 0; i < lambdas.size(); i++) {
 		memdelete(lambdas[i]);
@@ -35,9 +35,12 @@
 
 #include "core/object/ref_counted.h"
 #include "core/object/script_language.h"
+#include "core/os/spin_lock.h"
 #include "core/os/thread.h"
 #include "core/string/string_name.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/pair.h"
+#include "core/templates/safe_refcount.h"
 #include "core/templates/self_list.h"
 #include "core/variant/variant.h"
 
@@ -317,6 +320,7 @@ public:
 		OPCODE_JUMP,
 		OPCODE_JUMP_IF,
 		OPCODE_JUMP_IF_NOT,
+		OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT, // Validated comparison followed by a jump if it is false.
 		OPCODE_JUMP_TO_DEF_ARGUMENT,
 		OPCODE_JUMP_IF_SHARED,
 		OPCODE_RETURN,
@@ -445,6 +449,69 @@ private:
 	friend class GDScriptCompiler;
 	friend class GDScriptByteCodeGenerator;
 	friend class GDScriptLanguage;
+	friend class GDScriptBytecodeCache;
+
+	// Caches what untyped calls and named accesses resolve to, so repeated accesses on the same kind of
+	// base skip the StringName lookups. There is one cache per global name and access kind, holding a few
+	// entries keyed on the base's script and native class. Entries are only valid for the generation they
+	// were filled in, which is bumped whenever script functions or members may have changed.
+	enum LookupCacheKind {
+		LOOKUP_CACHE_CALL,
+		LOOKUP_CACHE_GET,
+		LOOKUP_CACHE_SET,
+		LOOKUP_CACHE_MAX,
+	};
+
+	struct LookupCache {
+		enum Type : uint8_t {
+			TYPE_EMPTY,
+			TYPE_UNCACHEABLE, // Resolved through the regular lookup every time.
+			TYPE_SCRIPT_FUNCTION,
+			TYPE_METHOD_BIND,
+			TYPE_SCRIPT_MEMBER,
+		};
+
+		struct Entry {
+			const void *script = nullptr;
+			const void *native = nullptr;
+			uint32_t generation = 0;
+			Type type = TYPE_EMPTY;
+			Variant::Type member_type = Variant::NIL; // NIL if the member is untyped.
+			int member_index = 0;
+			GDScriptFunction *function = nullptr;
+			MethodBind *method = nullptr;
+		};
+
+		// Entries are published with a sequence counter, so hits only read the slot and never contend:
+		// the counter is odd while a writer is filling the slot, and a reader that sees it change
+		// during its copy discards what it read. Writers are serialized by the lock.
+		struct Slot {
+			std::atomic<uint32_t> sequence = 0;
+			std::atomic<const void *> script = nullptr;
+			std::atomic<const void *> native = nullptr;
+			std::atomic<uint32_t> generation = 0;
+			std::atomic<Type> type = TYPE_EMPTY;
+			std::atomic<Variant::Type> member_type = Variant::NIL;
+			std::atomic<int> member_index = 0;
+			std::atomic<GDScriptFunction *> function = nullptr;
+			std::atomic<MethodBind *> method = nullptr;
+		};
+
+		static constexpr uint32_t ENTRY_COUNT = 2;
+
+		SpinLock lock;
+		Slot slots[ENTRY_COUNT];
+		uint32_t next_entry = 0;
+
+		// Calls on builtin types, as the base type in the top 8 bits and the method index + 1 in the rest.
+		// Builtin method indices never change, so this is read without locking and ignores the generation.
+		std::atomic<uint32_t> builtin_method = 0;
+
+		bool find(const void *p_script, const void *p_native, uint32_t p_generation, Entry &r_entry) const;
+		void insert(const Entry &p_entry);
+	};
+
+	static SafeNumeric<uint32_t> lookup_cache_generation;
 
 	StringName name;
 	StringName source;
@@ -466,6 +533,7 @@ private:
 	List<StackDebug> stack_debug;
 
 	Vector<int> code;
+	Vector<int> global_index_positions; // Positions in `code` holding indices into the global array, which change between sessions.
 	Vector<int> default_arguments;
 	Vector<Variant> constants;
 	Vector<StringName> global_names;
@@ -519,6 +587,9 @@ private:
 	MethodBind **_methods_ptr = nullptr;
 	GDScriptFunction **_lambdas_ptr = nullptr;
 
+	LocalVector<LookupCache> lookup_caches;
+	LookupCache *_lookup_caches_ptr = nullptr;
+
 #ifdef DEBUG_ENABLED
 	CharString func_cname;
 	const char *_func_cname = nullptr;
@@ -555,6 +626,12 @@ private:
 	_FORCE_INLINE_ String _get_call_error(const String &p_where, const Variant **p_argptrs, const Variant &p_ret, const Callable::CallError &p_err) const;
 	Variant _get_default_variant_for_data_type(const GDScriptDataType &p_data_type);
 
+	_FORCE_INLINE_ LookupCache &_get_lookup_cache(int p_name_index, LookupCacheKind p_kind) const { return _lookup_caches_ptr[p_name_index * LOOKUP_CACHE_MAX + p_kind]; }
+	static Object *_get_lookup_cache_base(const Variant *p_base, GDScriptInstance *&r_instance);
+	void _call_cached(int p_name_index, Variant *p_base, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err);
+	bool _get_named_cached(int p_name_index, const Variant *p_base, Variant &r_ret);
+	bool _set_named_cached(int p_name_index, Variant *p_base, const Variant &p_value);
+
 public:
 	static constexpr int MAX_CALL_DEPTH = 2048; // Limit to try to avoid crash because of a stack overflow.
 
@@ -586,6 +663,9 @@ public:
 	Variant get_constant(int p_idx) const;
 	StringName get_global_name(int p_idx) const;
 
+	// Invalidates the lookup caches of all functions. Must be called whenever script functions or members are freed or changed.
+	static void invalidate_lookup_caches() { lookup_cache_generation.increment(); }
+
 	Variant call(GDScriptInstance *p_instance, const Variant **p_args, int p_argcount, Callable::CallError &r_err, CallState *p_state = nullptr);
 	void debug_get_stack_member_state(int p_line, List<Pair<StringName, int>> *r_stackvars) const;
 
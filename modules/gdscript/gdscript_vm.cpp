@@ -33,6 +33,7 @@
 #include "gdscript_lambda_callable.h"
 
 #include "core/os/os.h"
+#include "scene/scene_string_names.h"
 
 #ifdef DEBUG_ENABLED
 
@@ -292,6 +293,7 @@ void (*type_init_function_table[])(Variant *) = {
 		&&OPCODE_JUMP,                                   \
 		&&OPCODE_JUMP_IF,                                \
 		&&OPCODE_JUMP_IF_NOT,                            \
+		&&OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT,         \
 		&&OPCODE_JUMP_TO_DEF_ARGUMENT,                   \
 		&&OPCODE_JUMP_IF_SHARED,                         \
 		&&OPCODE_RETURN,                                 \
@@ -466,6 +468,198 @@ void (*type_init_function_table[])(Variant *) = {
 #define METHOD_CALL_ON_NULL_VALUE_ERROR(method_pointer) "Cannot call method '" + (method_pointer)->get_name() + "' on a null value."
 #define METHOD_CALL_ON_FREED_INSTANCE_ERROR(method_pointer) "Cannot call method '" + (method_pointer)->get_name() + "' on a previously freed instance."
 
+Object *GDScriptFunction::_get_lookup_cache_base(const Variant *p_base, GDScriptInstance *&r_instance) {
+	r_instance = nullptr;
+	if (p_base->get_type() != Variant::OBJECT) {
+		return nullptr;
+	}
+
+	Object *obj = p_base->get_validated_object();
+	if (!obj) {
+		return nullptr; // Let the regular lookup report the error.
+	}
+
+	ScriptInstance *si = obj->get_script_instance();
+	if (si) {
+		// Other script instances may resolve names differently.
+		if (si->is_placeholder() || si->get_language() != GDScriptLanguage::get_singleton()) {
+			return nullptr;
+		}
+		r_instance = static_cast<GDScriptInstance *>(si);
+	}
+	return obj;
+}
+
+void GDScriptFunction::_call_cached(int p_name_index, Variant *p_base, const Variant **p_args, int p_argcount, Variant &r_ret, Callable::CallError &r_err) {
+	Variant::Type base_type = p_base->get_type();
+	if (base_type != Variant::OBJECT) {
+		std::atomic<uint32_t> &builtin_method = _get_lookup_cache(p_name_index, LOOKUP_CACHE_CALL).builtin_method;
+		uint32_t cached = builtin_method.load(std::memory_order_relaxed);
+		if (unlikely(cached == 0 || (cached >> 24) != uint32_t(base_type))) {
+			int method_index = Variant::get_builtin_method_index(base_type, _global_names_ptr[p_name_index]);
+			if (method_index < 0) {
+				// Let the regular lookup report the error.
+				p_base->callp(_global_names_ptr[p_name_index], p_args, p_argcount, r_ret, r_err);
+				return;
+			}
+			cached = (uint32_t(base_type) << 24) | uint32_t(method_index + 1);
+			builtin_method.store(cached, std::memory_order_relaxed);
+		}
+		p_base->call_builtin_method(int(cached & 0xFFFFFF) - 1, p_args, p_argcount, r_ret, r_err);
+		return;
+	}
+
+	// Only bases with a GDScript instance are cached, as objects without one may override Object::callp()
+	// (like scripts, native class references or Java objects), which the cache would bypass.
+	GDScriptInstance *instance = nullptr;
+	Object *obj = _get_lookup_cache_base(p_base, instance);
+	if (instance) {
+		LookupCache &cache = _get_lookup_cache(p_name_index, LOOKUP_CACHE_CALL);
+		const void *script = instance->script.ptr();
+		const StringName &class_name = obj->get_class_name();
+		uint32_t generation = lookup_cache_generation.get();
+
+		LookupCache::Entry entry;
+		if (!cache.find(script, class_name.data_unique_pointer(), generation, entry)) {
+			// Resolve in the same order as Object::callp().
+			const StringName &method_name = _global_names_ptr[p_name_index];
+			entry.script = script;
+			entry.native = class_name.data_unique_pointer();
+			entry.generation = generation;
+			entry.type = LookupCache::TYPE_UNCACHEABLE;
+
+			if (method_name != CoreStringName(free_) && method_name != SceneStringName(_ready)) {
+				for (GDScript *sptr = instance->script.ptr(); sptr; sptr = sptr->_base) {
+					if (!sptr->valid) {
+						continue;
+					}
+					HashMap<StringName, GDScriptFunction *>::Iterator E = sptr->member_functions.find(method_name);
+					if (E) {
+						entry.type = LookupCache::TYPE_SCRIPT_FUNCTION;
+						entry.function = E->value;
+						break;
+					}
+				}
+
+				// Extension classes can be unloaded, so their methods are never cached.
+				ClassDB::APIType api = ClassDB::get_api_type(class_name);
+				if (entry.type == LookupCache::TYPE_UNCACHEABLE && api != ClassDB::API_EXTENSION && api != ClassDB::API_EDITOR_EXTENSION) {
+					MethodBind *method = ClassDB::get_method(class_name, method_name);
+					if (method) {
+						entry.type = LookupCache::TYPE_METHOD_BIND;
+						entry.method = method;
+					}
+				}
+			}
+
+			cache.insert(entry);
+		}
+
+		if (entry.type == LookupCache::TYPE_SCRIPT_FUNCTION || entry.type == LookupCache::TYPE_METHOD_BIND) {
+#ifdef DEBUG_ENABLED
+			_ObjectDebugLock debug_lock(obj);
+#endif
+			r_err.error = Callable::CallError::CALL_OK;
+			if (entry.type == LookupCache::TYPE_SCRIPT_FUNCTION) {
+				r_ret = entry.function->call(instance, p_args, p_argcount, r_err);
+			} else {
+				r_ret = entry.method->call(obj, p_args, p_argcount, r_err);
+			}
+			return;
+		}
+	}
+
+	p_base->callp(_global_names_ptr[p_name_index], p_args, p_argcount, r_ret, r_err);
+}
+
+bool GDScriptFunction::_get_named_cached(int p_name_index, const Variant *p_base, Variant &r_ret) {
+	GDScriptInstance *instance = nullptr;
+	_get_lookup_cache_base(p_base, instance);
+	if (!instance) {
+		return false;
+	}
+
+	LookupCache &cache = _get_lookup_cache(p_name_index, LOOKUP_CACHE_GET);
+	const GDScript *script = instance->script.ptr();
+	uint32_t generation = lookup_cache_generation.get();
+
+	LookupCache::Entry entry;
+	if (!cache.find(script, nullptr, generation, entry)) {
+		// Only plain members are cached, anything else goes through GDScriptInstance::get().
+		entry.script = script;
+		entry.generation = generation;
+		entry.type = LookupCache::TYPE_UNCACHEABLE;
+
+		HashMap<StringName, GDScript::MemberInfo>::ConstIterator E = script->member_indices.find(_global_names_ptr[p_name_index]);
+		if (E && E->value.getter == StringName()) {
+			entry.type = LookupCache::TYPE_SCRIPT_MEMBER;
+			entry.member_index = E->value.index;
+		}
+
+		cache.insert(entry);
+	}
+
+	if (entry.type != LookupCache::TYPE_SCRIPT_MEMBER || entry.member_index >= instance->members.size()) {
+		return false;
+	}
+
+	// Copy first, as the base may be stored in the same stack slot as the result.
+	Variant value = instance->members[entry.member_index];
+	r_ret = value;
+	return true;
+}
+
+bool GDScriptFunction::_set_named_cached(int p_name_index, Variant *p_base, const Variant &p_value) {
+#ifdef TOOLS_ENABLED
+	// Object::set() also flags the object as edited in the editor, which a cached store would skip.
+	return false;
+#else
+	GDScriptInstance *instance = nullptr;
+	_get_lookup_cache_base(p_base, instance);
+	if (!instance) {
+		return false;
+	}
+
+	LookupCache &cache = _get_lookup_cache(p_name_index, LOOKUP_CACHE_SET);
+	const GDScript *script = instance->script.ptr();
+	uint32_t generation = lookup_cache_generation.get();
+
+	LookupCache::Entry entry;
+	if (!cache.find(script, nullptr, generation, entry)) {
+		// Only members without setters that are untyped or of a plain builtin type are cached,
+		// anything needing conversion or validation goes through GDScriptInstance::set().
+		entry.script = script;
+		entry.generation = generation;
+		entry.type = LookupCache::TYPE_UNCACHEABLE;
+
+		HashMap<StringName, GDScript::MemberInfo>::ConstIterator E = script->member_indices.find(_global_names_ptr[p_name_index]);
+		if (E && E->value.setter == StringName()) {
+			const GDScriptDataType &data_type = E->value.data_type;
+			if (!data_type.has_type) {
+				entry.type = LookupCache::TYPE_SCRIPT_MEMBER;
+				entry.member_type = Variant::NIL;
+			} else if (data_type.kind == GDScriptDataType::BUILTIN && data_type.builtin_type != Variant::ARRAY && data_type.builtin_type != Variant::DICTIONARY) {
+				entry.type = LookupCache::TYPE_SCRIPT_MEMBER;
+				entry.member_type = data_type.builtin_type;
+			}
+			entry.member_index = E->value.index;
+		}
+
+		cache.insert(entry);
+	}
+
+	if (entry.type != LookupCache::TYPE_SCRIPT_MEMBER || entry.member_index >= instance->members.size()) {
+		return false;
+	}
+	if (entry.member_type != Variant::NIL && p_value.get_type() != entry.member_type) {
+		return false;
+	}
+
+	instance->members.write[entry.member_index] = p_value;
+	return true;
+#endif
+}
+
 Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_args, int p_argcount, Callable::CallError &r_err, CallState *p_state) {
 	OPCODES_TABLE;
 
@@ -1172,8 +1366,10 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				GD_ERR_BREAK(indexname < 0 || indexname >= _global_names_count);
 				const StringName *index = &_global_names_ptr[indexname];
 
-				bool valid;
-				dst->set_named(*index, *value, valid);
+				bool valid = _set_named_cached(indexname, dst, *value);
+				if (!valid) {
+					dst->set_named(*index, *value, valid);
+				}
 
 #ifdef DEBUG_ENABLED
 				if (!valid) {
@@ -1227,10 +1423,16 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				bool valid;
 #ifdef DEBUG_ENABLED
 				//allow better error message in cases where src and dst are the same stack position
-				Variant ret = src->get_named(*index, valid);
+				Variant ret;
+				valid = _get_named_cached(indexname, src, ret);
+				if (!valid) {
+					ret = src->get_named(*index, valid);
+				}
 
 #else
-				*dst = src->get_named(*index, valid);
+				if (!_get_named_cached(indexname, src, *dst)) {
+					*dst = src->get_named(*index, valid);
+				}
 #endif
 #ifdef DEBUG_ENABLED
 				if (!valid) {
@@ -1887,7 +2089,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 				Callable::CallError err;
 				if (call_ret) {
 					GET_INSTRUCTION_ARG(ret, argc + 1);
-					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
+					_call_cached(methodname_idx, base, (const Variant **)argptrs, argc, temp_ret, err);
 					*ret = temp_ret;
 #ifdef DEBUG_ENABLED
 					if (ret->get_type() == Variant::NIL) {
@@ -1917,7 +2119,7 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 					}
 #endif
 				} else {
-					base->callp(*methodname, (const Variant **)argptrs, argc, temp_ret, err);
+					_call_cached(methodname_idx, base, (const Variant **)argptrs, argc, temp_ret, err);
 				}
 #ifdef DEBUG_ENABLED
 
@@ -2700,6 +2902,29 @@ Variant GDScriptFunction::call(GDScriptInstance *p_instance, const Variant **p_a
 			}
 			DISPATCH_OPCODE;
 
+			OPCODE(OPCODE_OPERATOR_VALIDATED_JUMP_IF_NOT) {
+				CHECK_SPACE(6);
+
+				int operator_idx = _code_ptr[ip + 4];
+				GD_ERR_BREAK(operator_idx < 0 || operator_idx >= _operator_funcs_count);
+				Variant::ValidatedOperatorEvaluator operator_func = _operator_funcs_ptr[operator_idx];
+
+				GET_VARIANT_PTR(a, 0);
+				GET_VARIANT_PTR(b, 1);
+				GET_VARIANT_PTR(dst, 2);
+
+				operator_func(a, b, dst);
+
+				if (!*VariantInternal::get_bool(dst)) {
+					int to = _code_ptr[ip + 5];
+					GD_ERR_BREAK(to < 0 || to > _code_size);
+					ip = to;
+				} else {
+					ip += 6;
+				}
+			}
+			DISPATCH_OPCODE;
+
 			OPCODE(OPCODE_JUMP_TO_DEF_ARGUMENT) {
 				CHECK_SPACE(2);
 				ip = _default_arg_ptr[defarg];
@@ -31,8 +31,10 @@
 #ifndef GDSCRIPT_TEST_RUNNER_SUITE_H
 #define GDSCRIPT_TEST_RUNNER_SUITE_H
 
+#include "../gdscript_byte_codegen.h"
 #include "gdscript_test_runner.h"
 
+#include "core/object/worker_thread_pool.h"
 #include "tests/test_macros.h"
 
 namespace GDScriptTests {
@@ -70,6 +72,111 @@ func _init():
 	ref_counted->set_script(gdscript);
 	CHECK_MESSAGE(int(ref_counted->get_meta("result")) == 42, "The script should assign object metadata successfully.");
 }
+
+struct _UntypedLookupBenchmarkData {
+	LocalVector<Ref<RefCounted>> objects;
+	SafeNumeric<int> mismatches;
+};
+
+static void _run_untyped_lookups(void *p_userdata, uint32_t p_index) {
+	_UntypedLookupBenchmarkData *data = (_UntypedLookupBenchmarkData *)p_userdata;
+	Ref<RefCounted> object = data->objects[p_index];
+	if (int(object->call("run", object, 100000)) != 100000) {
+		data->mismatches.increment();
+	}
+}
+
+TEST_CASE("[Modules][GDScript][Benchmark] Untyped calls and member accesses from multiple threads" * doctest::skip()) {
+	// Every call and member access below goes through the untyped lookup caches, which all threads share
+	// as they run the same function. Hits should scale with the thread count instead of contending.
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(R"(
+extends RefCounted
+
+var counter = 0
+
+func bump():
+	counter += 1
+
+func run(other, iterations):
+	for i in iterations:
+		other.bump()
+	return other.counter
+)");
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	REQUIRE(error == OK);
+
+	for (int threads : { 1, 4, 16 }) {
+		_UntypedLookupBenchmarkData data;
+		for (int i = 0; i < threads; i++) {
+			Ref<RefCounted> object = memnew(RefCounted);
+			object->set_script(gdscript);
+			data.objects.push_back(object);
+		}
+
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(&_run_untyped_lookups, &data, threads, threads, true);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+		MESSAGE(vformat("%d threads: %d calls in %d usec.", threads, threads * 100000, OS::get_singleton()->get_ticks_usec() - begin));
+		CHECK(data.mismatches.get() == 0);
+	}
+}
+
+static Ref<GDScript> _compile_benchmark_script(const String &p_source, bool p_peephole) {
+	GDScriptByteCodeGenerator::peephole_disabled = !p_peephole;
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(p_source);
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	GDScriptByteCodeGenerator::peephole_disabled = false;
+	return error == OK ? gdscript : Ref<GDScript>();
+}
+
+TEST_CASE("[Modules][GDScript][Benchmark] Fused compare-and-jump and in-place updates in typical loops" * doctest::skip()) {
+	// Typed comparisons in loop and branch conditions become a single compare-and-jump instruction, and typed
+	// `x = x op y` updates write into the local directly, which also leaves their temporaries without a stack slot.
+	const String source = R"(
+extends RefCounted
+
+func count(n: int) -> int:
+	var total := 0
+	var i := 0
+	while i < n:
+		if i % 3 == 0:
+			total += i
+		else:
+			total -= 1
+		i += 1
+	return total
+
+func integrate(n: int) -> float:
+	var x := 0.0
+	var v := 1.0
+	var dt := 0.016
+	for k in n:
+		v = v - x * dt
+		x = x + v * dt
+		if x > 10.0 and v > 0.0:
+			v = -v
+	return x
+)";
+
+	for (bool peephole : { false, true }) {
+		Ref<GDScript> gdscript = _compile_benchmark_script(source, peephole);
+		REQUIRE(gdscript.is_valid());
+		Ref<RefCounted> object = memnew(RefCounted);
+		object->set_script(gdscript);
+
+		for (const StringName &function : { StringName("count"), StringName("integrate") }) {
+			const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+			object->call(function, 1000000);
+			MESSAGE(vformat("%s, %s: %d usec, %d stack slots.", peephole ? "fused" : "unfused", function, OS::get_singleton()->get_ticks_usec() - begin, gdscript->get_member_functions()[function]->get_max_stack_size()));
+		}
+	}
+}
 #endif // TOOLS_ENABLED
 
 TEST_CASE("[Modules][GDScript] Validate built-in API") {
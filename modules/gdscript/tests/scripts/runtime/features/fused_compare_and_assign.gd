@@ -0,0 +1,49 @@
+# Typed comparisons used as conditions are fused with their jump,
+# and typed numeric `x = x op y` updates are performed in place.
+
+func count_down(n: int) -> int:
+	var steps := 0
+	while n > 0:
+		n -= 2
+		steps += 1
+	return steps
+
+func test():
+	var i := 0
+	var total := 0
+	while i < 5:
+		if i % 2 == 0:
+			total += i
+		else:
+			total -= 1
+		i += 1
+	print(total)
+
+	var f := 1.0
+	while f < 100.0 and f != 16.0:
+		f *= 2.0
+	print(f == 16.0)
+
+	print(count_down(7))
+
+	var a := 3
+	var b := 10
+	b = a - b
+	a = a * a
+	var c := a + 1
+	print(a, " ", b, " ", c)
+	print("lt" if a < c else "ge")
+	print("lt" if c < a else "ge")
+
+	var found := -1
+	for k in 10:
+		if k * k > 20:
+			found = k
+			break
+	print(found)
+
+	var x := 1.5
+	var y := 3.0
+	x = y / x
+	y = 2.0 * y
+	print(x, " ", y)
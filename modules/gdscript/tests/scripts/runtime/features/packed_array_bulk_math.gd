@@ -0,0 +1,42 @@
+func test():
+	var floats := PackedFloat32Array([1.0, 2.0, 3.0, 4.0, 5.0])
+	floats.add_array(PackedFloat32Array([1.0, 1.0, 1.0, 1.0, 1.0]))
+	print(floats == PackedFloat32Array([2.0, 3.0, 4.0, 5.0, 6.0]))
+	floats.multiply_array(PackedFloat32Array([2.0, 2.0, 2.0, 2.0, 0.5]))
+	print(floats == PackedFloat32Array([4.0, 6.0, 8.0, 10.0, 3.0]))
+	floats.scale(0.5)
+	print(floats == PackedFloat32Array([2.0, 3.0, 4.0, 5.0, 1.5]))
+	floats.clamp(2.5, 4.5)
+	print(floats == PackedFloat32Array([2.5, 3.0, 4.0, 4.5, 2.5]))
+	print(floats.sum(), " ", floats.min(), " ", floats.max())
+	print(floats.dot(PackedFloat32Array([2.0, 0.0, 1.0, 0.0, 0.0])))
+
+	var doubles := PackedFloat64Array([0.0, 10.0])
+	doubles.lerp_array(PackedFloat64Array([10.0, 20.0]), 0.25)
+	print(doubles == PackedFloat64Array([2.5, 12.5]))
+
+	var points := PackedVector2Array([Vector2(1, 2), Vector2(3, 4)])
+	points.add_array(PackedVector2Array([Vector2(1, 1), Vector2(1, 1)]))
+	points.scale(2.0)
+	print(points == PackedVector2Array([Vector2(4, 6), Vector2(8, 10)]))
+	print(points.sum())
+	points.transform(Transform2D(0.0, Vector2(1, 0)))
+	print(points == PackedVector2Array([Vector2(5, 6), Vector2(9, 10)]))
+
+	var positions := PackedVector3Array([Vector3(1, 2, 3), Vector3(-4, 5, -6)])
+	var transform := Transform3D(Basis.from_scale(Vector3(2, 2, 2)), Vector3(0, 1, 0))
+	var expected := transform * positions
+	positions.transform(transform)
+	print(positions == expected)
+	positions.clamp(Vector3(-1, -1, -1), Vector3(4, 4, 4))
+	print(positions == PackedVector3Array([Vector3(2, 4, 4), Vector3(-1, 4, -1)]))
+
+	var colors := PackedColorArray([Color(1, 1, 1, 1), Color(0, 0, 0, 0)])
+	colors.lerp_array(PackedColorArray([Color(0, 0, 0, 0), Color(1, 1, 1, 1)]), 0.5)
+	print(colors == PackedColorArray([Color(0.5, 0.5, 0.5, 0.5), Color(0.5, 0.5, 0.5, 0.5)]))
+	colors.multiply_array(PackedColorArray([Color(2, 0, 1, 1), Color(0, 2, 1, 1)]))
+	print(colors == PackedColorArray([Color(1, 0, 0.5, 0.5), Color(0, 1, 0.5, 0.5)]))
+
+	var duplicate := floats.duplicate()
+	floats.scale(2.0)
+	print(duplicate == floats)
@@ -0,0 +1,20 @@
+# Untyped calls on builtin types cache the method index per call site.
+# The same call site must keep resolving correctly when the base type changes.
+
+func get_length(value):
+	return value.length()
+
+func test():
+	var values = ["hello", Vector2(3, 4), "abc", Vector3i(2, 3, 6), Vector2i(0, 1), Vector2(0, 1)]
+	for value in values:
+		print(get_length(value))
+
+	var items = [[3, 1, 2], PackedInt32Array([6, 5, 4])]
+	for i in 2:
+		for item in items:
+			var untyped = item
+			untyped.sort()
+			print(untyped)
+
+	var callable = Vector2(1, 2).dot
+	print(callable.call(Vector2(3, 4)))
@@ -0,0 +1,34 @@
+# Untyped calls and member accesses cache their lookups per base script.
+# The same call sites must keep resolving correctly when the base changes.
+
+class A:
+	var value = "A"
+	var count: int = 0
+	func describe():
+		return "A " + str(value)
+
+class B:
+	var count: int = 0
+	var value = "B"
+	func describe():
+		return "B " + str(value)
+
+class C extends A:
+	var tracked = 0:
+		set(v):
+			tracked = v * 2
+	func describe():
+		return "C " + super()
+
+func test():
+	var objects = [A.new(), B.new(), C.new(), A.new(), C.new()]
+	for i in 2:
+		for object in objects:
+			var untyped = object
+			untyped.value = i
+			untyped.count = 1.5
+			print(untyped.describe(), " ", untyped.count, " ", untyped.get_class())
+
+	var c = objects[2]
+	c.tracked = 3
+	print(c.tracked)
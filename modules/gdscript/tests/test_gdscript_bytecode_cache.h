@@ -0,0 +1,252 @@
+/**************************************************************************/
+/*  test_gdscript_bytecode_cache.h                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_GDSCRIPT_BYTECODE_CACHE_H
+#define TEST_GDSCRIPT_BYTECODE_CACHE_H
+
+#include "../gdscript.h"
+#include "../gdscript_bytecode_cache.h"
+#include "../gdscript_cache.h"
+
+#include "core/config/project_settings.h"
+#include "core/io/dir_access.h"
+#include "core/io/file_access.h"
+#include "core/io/marshalls.h"
+#include "tests/test_macros.h"
+#include "tests/test_utils.h"
+
+namespace TestGDScriptBytecodeCache {
+
+static Ref<GDScript> _compile_script(const String &p_source) {
+	Ref<GDScript> gdscript = memnew(GDScript);
+	gdscript->set_source_code(p_source);
+	ERR_PRINT_OFF;
+	const Error error = gdscript->reload();
+	ERR_PRINT_ON;
+	return error == OK ? gdscript : Ref<GDScript>();
+}
+
+static Ref<GDScript> _load_script(const Vector<uint8_t> &p_bytecode) {
+	Ref<GDScript> gdscript = memnew(GDScript);
+	if (GDScriptBytecodeCache::make_scripts(gdscript.ptr(), p_bytecode) != OK) {
+		return Ref<GDScript>();
+	}
+	bool add_static_script = false;
+	if (GDScriptBytecodeCache::deserialize(gdscript.ptr(), p_bytecode, add_static_script) != OK) {
+		return Ref<GDScript>();
+	}
+	return gdscript;
+}
+
+// Updates the checksum after the magic and format version, like a file that was modified on purpose.
+static void _update_checksum(Vector<uint8_t> &r_bytecode) {
+	encode_uint32(hash_murmur3_buffer(r_bytecode.ptr() + 12, r_bytecode.size() - 12), r_bytecode.ptrw() + 8);
+}
+
+// Where GDScriptCache looks for the cached bytecode of a script.
+static String _get_cache_file_path(const String &p_cache_dir, const String &p_script_path) {
+	return p_cache_dir.path_join(p_script_path.md5_text() + ".gdbc");
+}
+
+// TODO: Handle some cases failing on release builds. See: https://github.com/godotengine/godot/pull/88452
+#ifdef TOOLS_ENABLED
+TEST_CASE("[Modules][GDScript][BytecodeCache] Serialized scripts run like the compiled ones") {
+	Ref<GDScript> compiled = _compile_script(R"(
+extends RefCounted
+
+const SCALE = 3
+const NAMES = ["a", "b"]
+
+class Inner:
+	const OFFSET = 10
+	var value := 1
+
+	func get_value(extra := 5) -> int:
+		return value + extra + OFFSET
+
+func add(a: int, b: int = 2) -> int:
+	return a * SCALE + b
+
+func apply_lambda(x: int) -> int:
+	var offset := func(y): return y + x
+	return offset.call(SCALE)
+
+func make_inner() -> int:
+	var inner := Inner.new()
+	return inner.get_value() + inner.get_value(0)
+
+func join_names() -> String:
+	return "".join(NAMES)
+)");
+	REQUIRE(compiled.is_valid());
+
+	HashMap<String, uint32_t> dependencies;
+	dependencies["res://dependency.gd"] = 1234;
+	Vector<uint8_t> bytecode = GDScriptBytecodeCache::serialize(compiled.ptr(), 42, dependencies, false);
+	REQUIRE_FALSE(bytecode.is_empty());
+
+	HashMap<String, uint32_t> read_dependencies;
+	CHECK(GDScriptBytecodeCache::parse_header(bytecode, 42, read_dependencies) == OK);
+	CHECK(read_dependencies.size() == 1);
+	CHECK(read_dependencies["res://dependency.gd"] == 1234);
+	CHECK_MESSAGE(GDScriptBytecodeCache::parse_header(bytecode, 43, read_dependencies) != OK, "A different source hash should be rejected.");
+
+	Ref<GDScript> loaded = _load_script(bytecode);
+	REQUIRE(loaded.is_valid());
+	CHECK(loaded->is_valid());
+	CHECK(loaded->get_member_functions().size() == compiled->get_member_functions().size());
+
+	Ref<RefCounted> object = memnew(RefCounted);
+	object->set_script(loaded);
+
+	CHECK(int(object->call("add", 1)) == 5);
+	CHECK(int(object->call("add", 1, 4)) == 7);
+	CHECK(int(object->call("apply_lambda", 4)) == 7);
+	CHECK(int(object->call("make_inner")) == 27);
+	CHECK(String(object->call("join_names")) == "ab");
+
+	const HashMap<StringName, Variant> &constants = loaded->get_constants();
+	CHECK(constants.has("SCALE"));
+	CHECK(constants.has("NAMES"));
+	CHECK(constants.has("Inner"));
+
+	SUBCASE("Truncated bytecode is rejected") {
+		Vector<uint8_t> truncated = bytecode;
+		truncated.resize(bytecode.size() / 2);
+		ERR_PRINT_OFF;
+		CHECK(_load_script(truncated).is_null());
+		ERR_PRINT_ON;
+	}
+
+	SUBCASE("Corrupted bytecode is rejected") {
+		Vector<uint8_t> corrupted = bytecode;
+		corrupted.write[corrupted.size() - 1] ^= 0xFF;
+		CHECK(GDScriptBytecodeCache::parse_header(corrupted, 42, read_dependencies) == ERR_FILE_CORRUPT);
+		ERR_PRINT_OFF;
+		CHECK(_load_script(corrupted).is_null());
+		ERR_PRINT_ON;
+	}
+}
+
+TEST_CASE("[Modules][GDScript][BytecodeCache] Out of range operands are rejected") {
+	Ref<GDScript> compiled = _compile_script(R"(
+extends RefCounted
+
+func identity(value):
+	return value
+)");
+	REQUIRE(compiled.is_valid());
+
+	Vector<uint8_t> bytecode = GDScriptBytecodeCache::serialize(compiled.ptr(), 42, HashMap<String, uint32_t>(), false);
+	REQUIRE_FALSE(bytecode.is_empty());
+
+	// `return value` reads the first argument, right after the self, class and nil stack slots.
+	int operand_pos = -1;
+	for (int i = 0; i + 8 <= bytecode.size(); i++) {
+		if (decode_uint32(&bytecode[i]) == GDScriptFunction::OPCODE_RETURN && decode_uint32(&bytecode[i + 4]) == GDScriptFunction::FIXED_ADDRESSES_MAX) {
+			operand_pos = i + 4;
+			break;
+		}
+	}
+	REQUIRE(operand_pos >= 0);
+
+	Vector<uint8_t> resigned = bytecode;
+	_update_checksum(resigned);
+	Ref<GDScript> loaded = _load_script(resigned);
+	REQUIRE(loaded.is_valid());
+	Ref<RefCounted> object = memnew(RefCounted);
+	object->set_script(loaded);
+	CHECK(int(object->call("identity", 5)) == 5);
+
+	Vector<uint8_t> out_of_range = bytecode;
+	encode_uint32(1000, out_of_range.ptrw() + operand_pos);
+	_update_checksum(out_of_range);
+	ERR_PRINT_OFF;
+	CHECK_MESSAGE(_load_script(out_of_range).is_null(), "A stack address past the stack size should be rejected.");
+	ERR_PRINT_ON;
+
+	Vector<uint8_t> bad_address_type = bytecode;
+	encode_uint32(GDScriptFunction::ADDR_TYPE_MAX << GDScriptFunction::ADDR_BITS, bad_address_type.ptrw() + operand_pos);
+	_update_checksum(bad_address_type);
+	ERR_PRINT_OFF;
+	CHECK_MESSAGE(_load_script(bad_address_type).is_null(), "An unknown address type should be rejected.");
+	ERR_PRINT_ON;
+}
+
+TEST_CASE("[Modules][GDScript][BytecodeCache] Cached bytecode with a stale dependency is rejected") {
+	const String cache_dir = TestUtils::get_temp_path("gdscript_bytecode_cache");
+	const String script_path = "res://bytecode_cache_test.gd";
+	const String dependency_path = TestUtils::get_temp_path("bytecode_cache_dependency.gd");
+	REQUIRE(DirAccess::make_dir_recursive_absolute(cache_dir) == OK);
+
+	const Variant old_cache_dir = ProjectSettings::get_singleton()->get_setting("gdscript/bytecode_cache/path");
+	ProjectSettings::get_singleton()->set_setting("gdscript/bytecode_cache/path", cache_dir);
+
+	{
+		Ref<FileAccess> dependency = FileAccess::open(dependency_path, FileAccess::WRITE);
+		REQUIRE(dependency.is_valid());
+		dependency->store_string("extends RefCounted\n");
+	}
+	const uint32_t dependency_hash = GDScriptCache::get_source_code(dependency_path).hash();
+
+	Ref<GDScript> compiled = memnew(GDScript);
+	compiled->set_source_code("extends RefCounted\n\nfunc value():\n\treturn 1\n");
+	ERR_PRINT_OFF;
+	REQUIRE(compiled->reload() == OK);
+	ERR_PRINT_ON;
+
+	const auto store_bytecode = [&](uint32_t p_dependency_hash) {
+		HashMap<String, uint32_t> dependencies;
+		dependencies[dependency_path] = p_dependency_hash;
+		Vector<uint8_t> bytecode = GDScriptBytecodeCache::serialize(compiled.ptr(), 42, dependencies, false);
+		Ref<FileAccess> file = FileAccess::open(_get_cache_file_path(cache_dir, script_path), FileAccess::WRITE);
+		if (bytecode.is_empty() || file.is_null()) {
+			return false;
+		}
+		file->store_buffer(bytecode);
+		return true;
+	};
+
+	REQUIRE(store_bytecode(dependency_hash));
+	CHECK_FALSE(GDScriptCache::get_bytecode(script_path, 42).is_empty());
+	CHECK_MESSAGE(GDScriptCache::get_bytecode(script_path, 43).is_empty(), "A changed script should not use its cached bytecode.");
+
+	REQUIRE(store_bytecode(dependency_hash + 1));
+	CHECK_MESSAGE(GDScriptCache::get_bytecode(script_path, 42).is_empty(), "A changed dependency should invalidate the cached bytecode.");
+
+	ProjectSettings::get_singleton()->set_setting("gdscript/bytecode_cache/path", old_cache_dir);
+	DirAccess::remove_absolute(_get_cache_file_path(cache_dir, script_path));
+	DirAccess::remove_absolute(dependency_path);
+}
+#endif // TOOLS_ENABLED
+
+} // namespace TestGDScriptBytecodeCache
+
+#endif // TEST_GDSCRIPT_BYTECODE_CACHE_H
@@ -31,7 +31,11 @@
 #include "multiplayer_synchronizer.h"
 
 #include "core/config/engine.h"
+#include "scene/2d/node_2d.h"
 #include "scene/main/multiplayer_api.h"
+#ifndef _3D_DISABLED
+#include "scene/3d/node_3d.h"
+#endif // _3D_DISABLED
 
 Object *MultiplayerSynchronizer::_get_prop_target(Object *p_obj, const NodePath &p_path) {
 	if (p_path.get_name_count() == 0) {
@@ -110,6 +114,22 @@ void MultiplayerSynchronizer::reset() {
 	last_watch_usec = 0;
 	sync_started = false;
 	watchers.clear();
+	sync_bindings = SceneReplicationSchema::Bindings();
+	watch_bindings = SceneReplicationSchema::Bindings();
+	for (Snapshot &snapshot : snapshots) {
+		snapshot.valid = false;
+		snapshot.state.clear();
+	}
+}
+
+const MultiplayerSynchronizer::Snapshot *MultiplayerSynchronizer::find_snapshot(uint32_t p_id) const {
+	const Snapshot &snapshot = snapshots[p_id % SNAPSHOT_HISTORY];
+	return snapshot.valid && snapshot.id == p_id ? &snapshot : nullptr;
+}
+
+const MultiplayerSynchronizer::Snapshot *MultiplayerSynchronizer::find_applied_snapshot() const {
+	// Received snapshots are identified by the network time of their packet.
+	return sync_started ? find_snapshot(last_inbound_sync) : nullptr;
 }
 
 uint32_t MultiplayerSynchronizer::get_net_id() const {
@@ -242,6 +262,52 @@ MultiplayerSynchronizer::VisibilityUpdateMode MultiplayerSynchronizer::get_visib
 	return visibility_update_mode;
 }
 
+void MultiplayerSynchronizer::set_spatial_relevancy(bool p_enabled) {
+	if (spatial_relevancy == p_enabled) {
+		return;
+	}
+	spatial_relevancy = p_enabled;
+	if (is_inside_tree()) {
+		// Let the replication interface start or stop tracking the position.
+		emit_signal(SceneStringName(visibility_changed), 0);
+	}
+}
+
+bool MultiplayerSynchronizer::is_spatial_relevancy() const {
+	return spatial_relevancy;
+}
+
+void MultiplayerSynchronizer::set_relevancy_priority(real_t p_priority) {
+	ERR_FAIL_COND_MSG(p_priority <= 0, "Relevancy priority must be greater than 0.");
+	relevancy_priority = p_priority;
+}
+
+real_t MultiplayerSynchronizer::get_relevancy_priority() const {
+	return relevancy_priority;
+}
+
+bool MultiplayerSynchronizer::get_relevancy_position(Vector3 &r_position) {
+	if (!spatial_relevancy) {
+		return false;
+	}
+	Node *node = get_root_node();
+	if (!node || !node->is_inside_tree()) {
+		return false;
+	}
+#ifndef _3D_DISABLED
+	if (Node3D *node_3d = Object::cast_to<Node3D>(node)) {
+		r_position = node_3d->get_global_position();
+		return true;
+	}
+#endif // _3D_DISABLED
+	if (Node2D *node_2d = Object::cast_to<Node2D>(node)) {
+		const Vector2 position = node_2d->get_global_position();
+		r_position = Vector3(position.x, position.y, 0);
+		return true;
+	}
+	return false;
+}
+
 void MultiplayerSynchronizer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_root_path", "path"), &MultiplayerSynchronizer::set_root_path);
 	ClassDB::bind_method(D_METHOD("get_root_path"), &MultiplayerSynchronizer::get_root_path);
@@ -267,12 +333,19 @@ void MultiplayerSynchronizer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_visibility_for", "peer", "visible"), &MultiplayerSynchronizer::set_visibility_for);
 	ClassDB::bind_method(D_METHOD("get_visibility_for", "peer"), &MultiplayerSynchronizer::get_visibility_for);
 
+	ClassDB::bind_method(D_METHOD("set_spatial_relevancy", "enabled"), &MultiplayerSynchronizer::set_spatial_relevancy);
+	ClassDB::bind_method(D_METHOD("is_spatial_relevancy"), &MultiplayerSynchronizer::is_spatial_relevancy);
+	ClassDB::bind_method(D_METHOD("set_relevancy_priority", "priority"), &MultiplayerSynchronizer::set_relevancy_priority);
+	ClassDB::bind_method(D_METHOD("get_relevancy_priority"), &MultiplayerSynchronizer::get_relevancy_priority);
+
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_path"), "set_root_path", "get_root_path");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "replication_interval", PROPERTY_HINT_RANGE, "0,5,0.001,suffix:s"), "set_replication_interval", "get_replication_interval");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "delta_interval", PROPERTY_HINT_RANGE, "0,5,0.001,suffix:s"), "set_delta_interval", "get_delta_interval");
 	ADD_PROPERTY(PropertyInfo(Variant::OBJECT, "replication_config", PROPERTY_HINT_RESOURCE_TYPE, "SceneReplicationConfig", PROPERTY_USAGE_NO_EDITOR | PROPERTY_USAGE_EDITOR_INSTANTIATE_OBJECT), "set_replication_config", "get_replication_config");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "visibility_update_mode", PROPERTY_HINT_ENUM, "Idle,Physics,None"), "set_visibility_update_mode", "get_visibility_update_mode");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "public_visibility"), "set_visibility_public", "is_visibility_public");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "spatial_relevancy"), "set_spatial_relevancy", "is_spatial_relevancy");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "relevancy_priority", PROPERTY_HINT_RANGE, "0.01,100,0.01,or_greater"), "set_relevancy_priority", "get_relevancy_priority");
 
 	BIND_ENUM_CONSTANT(VISIBILITY_PROCESS_IDLE);
 	BIND_ENUM_CONSTANT(VISIBILITY_PROCESS_PHYSICS);
@@ -372,24 +445,23 @@ void MultiplayerSynchronizer::set_multiplayer_authority(int p_peer_id, bool p_re
 
 Error MultiplayerSynchronizer::_watch_changes(uint64_t p_usec) {
 	ERR_FAIL_COND_V(replication_config.is_null(), FAILED);
-	const List<NodePath> props = replication_config->get_watch_properties();
-	if (props.size() != watchers.size()) {
-		watchers.resize(props.size());
+	const SceneReplicationSchema &schema = replication_config->get_watch_schema();
+	const uint32_t count = schema.get_field_count();
+	if (count != (uint32_t)watchers.size()) {
+		watchers.resize(count);
 	}
-	if (props.size() == 0) {
+	if (count == 0) {
 		return OK;
 	}
 	Node *node = get_root_node();
 	ERR_FAIL_NULL_V(node, FAILED);
-	int idx = -1;
 	Watcher *ptr = watchers.ptrw();
-	for (const NodePath &prop : props) {
-		idx++;
-		bool valid = false;
-		const Object *obj = _get_prop_target(node, prop);
-		ERR_CONTINUE_MSG(!obj, vformat("Node not found for property '%s'.", prop));
-		Variant v = obj->get_indexed(prop.get_subnames(), &valid);
-		ERR_CONTINUE_MSG(!valid, vformat("Property '%s' not found.", prop));
+	Variant v;
+	for (uint32_t idx = 0; idx < count; idx++) {
+		if (schema.get_value(node, idx, watch_bindings, v) != OK) {
+			continue;
+		}
+		const NodePath &prop = schema.get_field(idx).path;
 		Watcher &w = ptr[idx];
 		if (w.prop != prop) {
 			w.prop = prop;
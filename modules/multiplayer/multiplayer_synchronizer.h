@@ -45,6 +45,16 @@ public:
 		VISIBILITY_PROCESS_NONE,
 	};
 
+	static const int SNAPSHOT_HISTORY = 32;
+
+	// An encoded state, kept as a baseline for snapshot deltas.
+	// Identified by network frame when sent, and by packet sequence when received.
+	struct Snapshot {
+		uint32_t id = 0;
+		bool valid = false;
+		LocalVector<uint8_t> state;
+	};
+
 private:
 	struct Watcher {
 		NodePath prop;
@@ -59,8 +69,13 @@ private:
 	VisibilityUpdateMode visibility_update_mode = VISIBILITY_PROCESS_IDLE;
 	HashSet<Callable> visibility_filters;
 	HashSet<int> peer_visibility;
+	bool spatial_relevancy = false;
+	real_t relevancy_priority = 1.0;
 	Vector<Watcher> watchers;
 	uint64_t last_watch_usec = 0;
+	SceneReplicationSchema::Bindings sync_bindings;
+	SceneReplicationSchema::Bindings watch_bindings;
+	Snapshot snapshots[SNAPSHOT_HISTORY];
 
 	ObjectID root_node_cache;
 	uint64_t last_sync_usec = 0;
@@ -117,9 +132,20 @@ public:
 	void remove_visibility_filter(Callable p_callback);
 	VisibilityUpdateMode get_visibility_update_mode() const;
 
+	void set_spatial_relevancy(bool p_enabled);
+	bool is_spatial_relevancy() const;
+	void set_relevancy_priority(real_t p_priority);
+	real_t get_relevancy_priority() const;
+	bool get_relevancy_position(Vector3 &r_position);
+
 	List<Variant> get_delta_state(uint64_t p_cur_usec, uint64_t p_last_usec, uint64_t &r_indexes);
 	List<NodePath> get_delta_properties(uint64_t p_indexes);
 	SceneReplicationConfig *get_replication_config_ptr() const;
+	SceneReplicationSchema::Bindings &get_sync_bindings() { return sync_bindings; }
+	SceneReplicationSchema::Bindings &get_watch_bindings() { return watch_bindings; }
+	Snapshot &get_snapshot_slot(uint32_t p_id) { return snapshots[p_id % SNAPSHOT_HISTORY]; }
+	const Snapshot *find_snapshot(uint32_t p_id) const;
+	const Snapshot *find_applied_snapshot() const;
 
 	MultiplayerSynchronizer();
 };
@@ -72,6 +72,9 @@ Error SceneMultiplayer::poll() {
 		return OK;
 	}
 
+	// Send the RPCs batched since the last poll.
+	rpc->flush_batches();
+
 	multiplayer_peer->poll();
 
 	_update_status();
@@ -173,6 +176,7 @@ void SceneMultiplayer::clear() {
 	pending_peers.clear();
 	connected_peers.clear();
 	packet_cache.clear();
+	rpc->clear_batches();
 	replicator->on_reset();
 	cache->clear();
 	relay_buffer->clear();
@@ -259,8 +263,16 @@ _FORCE_INLINE_ Error SceneMultiplayer::_send(const uint8_t *p_packet, int p_pack
 }
 #endif
 
+bool SceneMultiplayer::is_relayed(int p_to) {
+	return server_relay && get_unique_id() != 1 && p_to != 1 && multiplayer_peer->is_server_relay_supported();
+}
+
 Error SceneMultiplayer::send_command(int p_to, const uint8_t *p_packet, int p_packet_len) {
-	if (server_relay && get_unique_id() != 1 && p_to != 1 && multiplayer_peer->is_server_relay_supported()) {
+	if (rpc->has_batches()) {
+		// Keep the batched RPCs ordered with the other commands.
+		rpc->flush_batches();
+	}
+	if (is_relayed(p_to)) {
 		// Send relay packet.
 		relay_buffer->seek(0);
 		relay_buffer->put_u8(NETWORK_COMMAND_SYS);
@@ -350,6 +362,12 @@ void SceneMultiplayer::_process_sys(int p_from, const uint8_t *p_packet, int p_p
 				remote_sender_id = 0;
 			}
 		} break;
+		case SYS_COMMAND_BATCH: {
+			ERR_FAIL_COND_MSG(root_path.is_empty(), "Multiplayer root was not initialized. If you are using custom multiplayer, remember to set the root path via SceneMultiplayer.set_root_path before using it.");
+			remote_sender_id = p_from;
+			rpc->process_batch(p_from, p_packet, p_packet_len);
+			remote_sender_id = 0;
+		} break;
 		default: {
 			ERR_FAIL();
 		}
@@ -424,6 +442,7 @@ void SceneMultiplayer::_del_peer(int p_id) {
 
 	replicator->on_peer_change(p_id, false);
 	cache->on_peer_change(p_id, false);
+	rpc->on_peer_change(p_id, false);
 	connected_peers.erase(p_id);
 	emit_signal(SNAME("peer_disconnected"), p_id);
 }
@@ -637,6 +656,42 @@ int SceneMultiplayer::get_max_delta_packet_size() const {
 	return replicator->get_max_delta_packet_size();
 }
 
+void SceneMultiplayer::set_snapshot_replication_enabled(bool p_enabled) {
+	replicator->set_snapshot_replication_enabled(p_enabled);
+}
+
+bool SceneMultiplayer::is_snapshot_replication_enabled() const {
+	return replicator->is_snapshot_replication_enabled();
+}
+
+void SceneMultiplayer::set_rpc_batching_enabled(bool p_enabled) {
+	rpc->set_batching_enabled(p_enabled);
+}
+
+bool SceneMultiplayer::is_rpc_batching_enabled() const {
+	return rpc->is_batching_enabled();
+}
+
+void SceneMultiplayer::set_peer_relevancy(int p_peer, const Vector3 &p_origin, real_t p_radius) {
+	replicator->set_peer_relevancy(p_peer, p_origin, p_radius);
+}
+
+void SceneMultiplayer::clear_peer_relevancy(int p_peer) {
+	replicator->clear_peer_relevancy(p_peer);
+}
+
+bool SceneMultiplayer::has_peer_relevancy(int p_peer) const {
+	return replicator->has_peer_relevancy(p_peer);
+}
+
+void SceneMultiplayer::set_relevancy_cell_size(real_t p_size) {
+	replicator->set_relevancy_cell_size(p_size);
+}
+
+real_t SceneMultiplayer::get_relevancy_cell_size() const {
+	return replicator->get_relevancy_cell_size();
+}
+
 void SceneMultiplayer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_root_path", "path"), &SceneMultiplayer::set_root_path);
 	ClassDB::bind_method(D_METHOD("get_root_path"), &SceneMultiplayer::get_root_path);
@@ -665,6 +720,16 @@ void SceneMultiplayer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_max_sync_packet_size", "size"), &SceneMultiplayer::set_max_sync_packet_size);
 	ClassDB::bind_method(D_METHOD("get_max_delta_packet_size"), &SceneMultiplayer::get_max_delta_packet_size);
 	ClassDB::bind_method(D_METHOD("set_max_delta_packet_size", "size"), &SceneMultiplayer::set_max_delta_packet_size);
+	ClassDB::bind_method(D_METHOD("set_snapshot_replication_enabled", "enabled"), &SceneMultiplayer::set_snapshot_replication_enabled);
+	ClassDB::bind_method(D_METHOD("is_snapshot_replication_enabled"), &SceneMultiplayer::is_snapshot_replication_enabled);
+	ClassDB::bind_method(D_METHOD("set_rpc_batching_enabled", "enabled"), &SceneMultiplayer::set_rpc_batching_enabled);
+	ClassDB::bind_method(D_METHOD("is_rpc_batching_enabled"), &SceneMultiplayer::is_rpc_batching_enabled);
+
+	ClassDB::bind_method(D_METHOD("set_peer_relevancy", "id", "origin", "radius"), &SceneMultiplayer::set_peer_relevancy);
+	ClassDB::bind_method(D_METHOD("clear_peer_relevancy", "id"), &SceneMultiplayer::clear_peer_relevancy);
+	ClassDB::bind_method(D_METHOD("has_peer_relevancy", "id"), &SceneMultiplayer::has_peer_relevancy);
+	ClassDB::bind_method(D_METHOD("set_relevancy_cell_size", "size"), &SceneMultiplayer::set_relevancy_cell_size);
+	ClassDB::bind_method(D_METHOD("get_relevancy_cell_size"), &SceneMultiplayer::get_relevancy_cell_size);
 
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_path"), "set_root_path", "get_root_path");
 	ADD_PROPERTY(PropertyInfo(Variant::CALLABLE, "auth_callback"), "set_auth_callback", "get_auth_callback");
@@ -674,6 +739,9 @@ void SceneMultiplayer::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "server_relay"), "set_server_relay_enabled", "is_server_relay_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_sync_packet_size"), "set_max_sync_packet_size", "get_max_sync_packet_size");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_delta_packet_size"), "set_max_delta_packet_size", "get_max_delta_packet_size");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "snapshot_replication"), "set_snapshot_replication_enabled", "is_snapshot_replication_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "rpc_batching"), "set_rpc_batching_enabled", "is_rpc_batching_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "relevancy_cell_size", PROPERTY_HINT_RANGE, "0.01,1024,0.01,or_greater"), "set_relevancy_cell_size", "get_relevancy_cell_size");
 
 	ADD_PROPERTY_DEFAULT("refuse_new_connections", false);
 
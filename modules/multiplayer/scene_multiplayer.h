@@ -82,6 +82,7 @@ public:
 		SYS_COMMAND_ADD_PEER,
 		SYS_COMMAND_DEL_PEER,
 		SYS_COMMAND_RELAY,
+		SYS_COMMAND_BATCH,
 	};
 
 	enum {
@@ -180,6 +181,7 @@ public:
 	Vector<int> get_authenticating_peer_ids();
 
 	Error send_command(int p_to, const uint8_t *p_packet, int p_packet_len); // Used internally to relay packets when needed.
+	bool is_relayed(int p_to); // Whether commands to this peer are relayed by the server.
 	Error send_bytes(Vector<uint8_t> p_data, int p_to = MultiplayerPeer::TARGET_PEER_BROADCAST, MultiplayerPeer::TransferMode p_mode = MultiplayerPeer::TRANSFER_MODE_RELIABLE, int p_channel = 0);
 	String get_rpc_md5(const Object *p_obj);
 
@@ -201,6 +203,19 @@ public:
 	void set_max_delta_packet_size(int p_size);
 	int get_max_delta_packet_size() const;
 
+	void set_snapshot_replication_enabled(bool p_enabled);
+	bool is_snapshot_replication_enabled() const;
+
+	void set_rpc_batching_enabled(bool p_enabled);
+	bool is_rpc_batching_enabled() const;
+
+	void set_peer_relevancy(int p_peer, const Vector3 &p_origin, real_t p_radius);
+	void clear_peer_relevancy(int p_peer);
+	bool has_peer_relevancy(int p_peer) const;
+
+	void set_relevancy_cell_size(real_t p_size);
+	real_t get_relevancy_cell_size() const;
+
 	SceneMultiplayer();
 	~SceneMultiplayer();
 };
@@ -31,6 +31,8 @@
 #ifndef SCENE_REPLICATION_CONFIG_H
 #define SCENE_REPLICATION_CONFIG_H
 
+#include "scene_replication_schema.h"
+
 #include "core/io/resource.h"
 #include "core/variant/typed_array.h"
 
@@ -51,6 +53,7 @@ private:
 		NodePath name;
 		bool spawn = true;
 		ReplicationMode mode = REPLICATION_MODE_ALWAYS;
+		bool quantize = false;
 
 		bool operator==(const ReplicationProperty &p_to) {
 			return name == p_to.name;
@@ -67,6 +70,8 @@ private:
 	List<NodePath> spawn_props;
 	List<NodePath> sync_props;
 	List<NodePath> watch_props;
+	SceneReplicationSchema sync_schema;
+	SceneReplicationSchema watch_schema;
 	bool dirty = false;
 
 	void _update();
@@ -100,9 +105,14 @@ public:
 	ReplicationMode property_get_replication_mode(const NodePath &p_path);
 	void property_set_replication_mode(const NodePath &p_path, ReplicationMode p_mode);
 
+	bool property_get_quantize(const NodePath &p_path);
+	void property_set_quantize(const NodePath &p_path, bool p_enabled);
+
 	const List<NodePath> &get_spawn_properties();
 	const List<NodePath> &get_sync_properties();
 	const List<NodePath> &get_watch_properties();
+	const SceneReplicationSchema &get_sync_schema();
+	const SceneReplicationSchema &get_watch_schema();
 
 	SceneReplicationConfig() {}
 };
@@ -0,0 +1,155 @@
+/**************************************************************************/
+/*  scene_replication_interest.cpp                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "scene_replication_interest.h"
+
+Vector3i SceneReplicationInterest::_get_cell(const Vector3 &p_position) const {
+	return Vector3i(Math::floor(p_position.x / cell_size), Math::floor(p_position.y / cell_size), Math::floor(p_position.z / cell_size));
+}
+
+bool SceneReplicationInterest::_is_cell_in_range(const Vector3i &p_cell, const Vector3 &p_origin, real_t p_radius) const {
+	// Distance to the closest point of the cell.
+	const Vector3 from = Vector3(p_cell) * cell_size;
+	const Vector3 closest = p_origin.clamp(from, from + Vector3(cell_size, cell_size, cell_size));
+	return closest.distance_squared_to(p_origin) <= p_radius * p_radius;
+}
+
+void SceneReplicationInterest::_insert(const ObjectID &p_id, const Vector3i &p_cell) {
+	cells[p_cell].push_back(p_id);
+}
+
+void SceneReplicationInterest::_erase(const ObjectID &p_id, const Vector3i &p_cell) {
+	LocalVector<ObjectID> *cell = cells.getptr(p_cell);
+	ERR_FAIL_NULL(cell); // Bug.
+	int64_t idx = cell->find(p_id);
+	ERR_FAIL_COND(idx < 0); // Bug.
+	cell->remove_at_unordered(idx);
+	if (cell->is_empty()) {
+		cells.erase(p_cell);
+	}
+}
+
+void SceneReplicationInterest::set_cell_size(real_t p_size) {
+	ERR_FAIL_COND_MSG(p_size <= 0, "Cell size must be greater than 0.");
+	if (cell_size == p_size) {
+		return;
+	}
+	cell_size = p_size;
+	cells.clear();
+	for (KeyValue<ObjectID, Entry> &E : entries) {
+		E.value.cell = _get_cell(E.value.position);
+		_insert(E.key, E.value.cell);
+	}
+}
+
+bool SceneReplicationInterest::update(const ObjectID &p_id, const Vector3 &p_position) {
+	const Vector3i cell = _get_cell(p_position);
+	Entry *entry = entries.getptr(p_id);
+	if (!entry) {
+		Entry new_entry;
+		new_entry.position = p_position;
+		new_entry.cell = cell;
+		entries.insert(p_id, new_entry);
+		_insert(p_id, cell);
+		return true;
+	}
+	entry->position = p_position;
+	if (entry->cell == cell) {
+		return false;
+	}
+	_erase(p_id, entry->cell);
+	_insert(p_id, cell);
+	entry->cell = cell;
+	return true;
+}
+
+void SceneReplicationInterest::remove(const ObjectID &p_id) {
+	const Entry *entry = entries.getptr(p_id);
+	if (!entry) {
+		return;
+	}
+	_erase(p_id, entry->cell);
+	entries.erase(p_id);
+}
+
+void SceneReplicationInterest::clear() {
+	cells.clear();
+	entries.clear();
+}
+
+bool SceneReplicationInterest::get_position(const ObjectID &p_id, Vector3 &r_position) const {
+	const Entry *entry = entries.getptr(p_id);
+	if (!entry) {
+		return false;
+	}
+	r_position = entry->position;
+	return true;
+}
+
+bool SceneReplicationInterest::is_in_range(const ObjectID &p_id, const Vector3 &p_origin, real_t p_radius) const {
+	const Entry *entry = entries.getptr(p_id);
+	return entry && p_radius >= 0 && _is_cell_in_range(entry->cell, p_origin, p_radius);
+}
+
+void SceneReplicationInterest::query(const Vector3 &p_origin, real_t p_radius, HashSet<ObjectID> &r_result) const {
+	if (p_radius < 0 || entries.is_empty()) {
+		return;
+	}
+	const double span = Math::ceil(2.0 * p_radius / cell_size) + 1;
+	if (span * span * span > cells.size()) {
+		// The radius covers more cells than there are occupied ones, visit those instead.
+		for (const KeyValue<Vector3i, LocalVector<ObjectID>> &E : cells) {
+			if (!_is_cell_in_range(E.key, p_origin, p_radius)) {
+				continue;
+			}
+			for (const ObjectID &id : E.value) {
+				r_result.insert(id);
+			}
+		}
+		return;
+	}
+
+	const Vector3i from = _get_cell(p_origin - Vector3(p_radius, p_radius, p_radius));
+	const Vector3i to = _get_cell(p_origin + Vector3(p_radius, p_radius, p_radius));
+	for (int x = from.x; x <= to.x; x++) {
+		for (int y = from.y; y <= to.y; y++) {
+			for (int z = from.z; z <= to.z; z++) {
+				const Vector3i cell_pos = Vector3i(x, y, z);
+				const LocalVector<ObjectID> *cell = cells.getptr(cell_pos);
+				if (!cell || !_is_cell_in_range(cell_pos, p_origin, p_radius)) {
+					continue;
+				}
+				for (const ObjectID &id : *cell) {
+					r_result.insert(id);
+				}
+			}
+		}
+	}
+}
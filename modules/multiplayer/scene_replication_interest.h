@@ -0,0 +1,79 @@
+/**************************************************************************/
+/*  scene_replication_interest.h                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef SCENE_REPLICATION_INTEREST_H
+#define SCENE_REPLICATION_INTEREST_H
+
+#include "core/math/vector3.h"
+#include "core/math/vector3i.h"
+#include "core/object/object_id.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/hash_set.h"
+#include "core/templates/local_vector.h"
+
+// A uniform grid of the positions of synchronized nodes, used to find the ones relevant to each peer
+// without checking every peer against every synchronizer.
+//
+// Relevancy is evaluated per cell: an entry is within a radius when the cell containing it is, so
+// it can only change when the entry moves to another cell or the radius moves.
+class SceneReplicationInterest {
+	struct Entry {
+		Vector3 position;
+		Vector3i cell;
+	};
+
+	HashMap<Vector3i, LocalVector<ObjectID>> cells;
+	HashMap<ObjectID, Entry> entries;
+	real_t cell_size = 64;
+
+	Vector3i _get_cell(const Vector3 &p_position) const;
+	bool _is_cell_in_range(const Vector3i &p_cell, const Vector3 &p_origin, real_t p_radius) const;
+	void _insert(const ObjectID &p_id, const Vector3i &p_cell);
+	void _erase(const ObjectID &p_id, const Vector3i &p_cell);
+
+public:
+	void set_cell_size(real_t p_size);
+	real_t get_cell_size() const { return cell_size; }
+
+	// Returns true if the entry was added or moved to another cell.
+	bool update(const ObjectID &p_id, const Vector3 &p_position);
+	void remove(const ObjectID &p_id);
+	void clear();
+
+	bool has(const ObjectID &p_id) const { return entries.has(p_id); }
+	int size() const { return entries.size(); }
+	bool get_position(const ObjectID &p_id, Vector3 &r_position) const;
+
+	bool is_in_range(const ObjectID &p_id, const Vector3 &p_origin, real_t p_radius) const;
+	// Adds every entry whose cell is within p_radius of p_origin to r_result.
+	void query(const Vector3 &p_origin, real_t p_radius, HashSet<ObjectID> &r_result) const;
+};
+
+#endif // SCENE_REPLICATION_INTEREST_H
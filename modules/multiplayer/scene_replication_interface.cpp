@@ -124,6 +124,7 @@ void SceneReplicationInterface::on_reset() {
 		ERR_CONTINUE(!sync);
 		sync->reset();
 	}
+	interest.clear();
 	last_net_id = 0;
 }
 
@@ -141,13 +142,25 @@ void SceneReplicationInterface::on_network_process() {
 		spawn_queue.clear();
 	}
 
+	// Update spatial relevancy.
+	_update_relevancy();
+
 	// Process syncs.
 	uint64_t usec = OS::get_singleton()->get_ticks_usec();
+	LocalVector<ObjectID> to_sync;
+	snapshot_frame++;
 	for (KeyValue<int, PeerInfo> &E : peers_info) {
-		const HashSet<ObjectID> to_sync = E.value.sync_nodes;
-		if (to_sync.is_empty()) {
+		if (E.value.snapshot_ack_pending) {
+			_send_snapshot_ack(E.key, E.value);
+		}
+		if (E.value.sync_nodes.is_empty()) {
 			continue; // Nothing to sync
 		}
+		_prioritize(E.value, to_sync);
+		if (snapshot_replication) {
+			_send_snapshot(E.key, to_sync, usec);
+			continue;
+		}
 		uint16_t sync_net_time = ++E.value.last_sent_sync;
 		_send_sync(E.key, to_sync, sync_net_time, usec);
 		_send_delta(E.key, to_sync, usec, E.value.last_watch_usecs);
@@ -236,6 +249,19 @@ Error SceneReplicationInterface::on_replication_start(Object *p_obj, Variant p_c
 
 	// Update visibility.
 	sync->connect(SceneStringName(visibility_changed), callable_mp(this, &SceneReplicationInterface::_visibility_changed).bind(sync->get_instance_id()));
+	if (sync->is_spatial_relevancy()) {
+		relevancy_syncs.insert(sid);
+	}
+	Vector3 position;
+	if (_has_authority(sync) && sync->get_relevancy_position(position)) {
+		// Find the relevant peers now, so the node is not spawned to everyone first.
+		interest.update(sid, position);
+		for (KeyValue<int, PeerInfo> &E : peers_info) {
+			if (E.value.relevancy && interest.is_in_range(sid, E.value.relevancy_origin, E.value.relevancy_radius)) {
+				E.value.relevant_syncs.insert(sid);
+			}
+		}
+	}
 	_update_sync_visibility(0, sync);
 
 	if (pending_spawn == p_obj->get_instance_id() && sync->get_multiplayer_authority() == pending_spawn_remote) {
@@ -280,9 +306,14 @@ Error SceneReplicationInterface::on_replication_stop(Object *p_obj, Variant p_co
 	TrackedNode &tobj = _track(oid);
 	tobj.synchronizers.erase(sid);
 	sync_nodes.erase(sid);
+	relevancy_syncs.erase(sid);
+	interest.remove(sid);
 	for (KeyValue<int, PeerInfo> &E : peers_info) {
 		E.value.sync_nodes.erase(sid);
 		E.value.last_watch_usecs.erase(sid);
+		E.value.relevant_syncs.erase(sid);
+		E.value.starved_syncs.erase(sid);
+		E.value.snapshot_acks.erase(sid);
 		if (sync->get_net_id()) {
 			E.value.recv_sync_ids.erase(sync->get_net_id());
 		}
@@ -293,6 +324,13 @@ Error SceneReplicationInterface::on_replication_stop(Object *p_obj, Variant p_co
 void SceneReplicationInterface::_visibility_changed(int p_peer, ObjectID p_sid) {
 	MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(p_sid);
 	ERR_FAIL_NULL(sync); // Bug.
+	if (sync->is_spatial_relevancy()) {
+		relevancy_syncs.insert(p_sid);
+	} else if (relevancy_syncs.has(p_sid)) {
+		// Spatial relevancy was disabled.
+		relevancy_syncs.erase(p_sid);
+		_remove_relevancy(p_sid);
+	}
 	Node *node = sync->get_root_node();
 	ERR_FAIL_NULL(node); // Bug.
 	const ObjectID oid = node->get_instance_id();
@@ -333,7 +371,7 @@ bool SceneReplicationInterface::is_rpc_visible(const ObjectID &p_oid, int p_peer
 			// RPC visibility is composed using OR when multiple synchronizers are present.
 			// Note that we don't really care about authority here which may lead to unexpected
 			// results when using multiple synchronizers to control the same node.
-			if (sync->is_visible_to(p_peer)) {
+			if (sync->is_visible_to(p_peer) && _is_relevant(p_peer, sid)) {
 				return true;
 			}
 		}
@@ -352,7 +390,7 @@ Error SceneReplicationInterface::_update_sync_visibility(int p_peer, Multiplayer
 	if (p_peer == 0) {
 		for (KeyValue<int, PeerInfo> &E : peers_info) {
 			// Might be visible to this specific peer.
-			bool is_visible_to_peer = is_visible || p_sync->is_visible_to(E.key);
+			bool is_visible_to_peer = (is_visible || p_sync->is_visible_to(E.key)) && _is_relevant(E.key, sid);
 			if (is_visible_to_peer == E.value.sync_nodes.has(sid)) {
 				continue;
 			}
@@ -366,6 +404,7 @@ Error SceneReplicationInterface::_update_sync_visibility(int p_peer, Multiplayer
 		return OK;
 	} else {
 		ERR_FAIL_COND_V(!peers_info.has(p_peer), ERR_INVALID_PARAMETER);
+		is_visible = is_visible && _is_relevant(p_peer, sid);
 		if (is_visible == peers_info[p_peer].sync_nodes.has(sid)) {
 			return OK;
 		}
@@ -397,7 +436,7 @@ Error SceneReplicationInterface::_update_spawn_visibility(int p_peer, const Obje
 			continue;
 		}
 		// Spawn visibility is composed using OR when multiple synchronizers are present.
-		if (sync->is_visible_to(p_peer)) {
+		if (sync->is_visible_to(p_peer) && _is_relevant(p_peer, sid)) {
 			is_visible = true;
 			break;
 		}
@@ -419,7 +458,7 @@ Error SceneReplicationInterface::_update_spawn_visibility(int p_peer, const Obje
 	} else {
 		// Check visibility for each peers.
 		for (const KeyValue<int, PeerInfo> &E : peers_info) {
-			if (is_visible) {
+			if (is_visible && !E.value.relevancy) {
 				// This is fast, since the object is visible to everyone, we don't need to check each peer.
 				if (E.value.spawn_nodes.has(p_oid)) {
 					// Already spawned.
@@ -708,7 +747,9 @@ MultiplayerSynchronizer *SceneReplicationInterface::_find_synchronizer(int p_pee
 	return sync;
 }
 
-void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint64_t p_usec, const HashMap<ObjectID, uint64_t> &p_last_watch_usecs) {
+void SceneReplicationInterface::_send_delta(int p_peer, const LocalVector<ObjectID> &p_synchronizers, uint64_t p_usec, const HashMap<ObjectID, uint64_t> &p_last_watch_usecs) {
+	PeerInfo *peer_info = peers_info.getptr(p_peer);
+	ERR_FAIL_NULL(peer_info);
 	MAKE_ROOM(/* header */ 1 + /* element */ 4 + 8 + 4 + delta_mtu);
 	uint8_t *ptr = packet_cache.ptrw();
 	ptr[0] = SceneMultiplayer::NETWORK_COMMAND_SYNC | (1 << SceneMultiplayer::CMD_FLAG_0_SHIFT);
@@ -728,21 +769,18 @@ void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID>
 			continue; // Nothing to update.
 		}
 
-		Vector<const Variant *> varp;
-		varp.resize(delta.size());
-		const Variant **vptr = varp.ptrw();
-		int i = 0;
-		for (const Variant &v : delta) {
-			vptr[i] = &v;
-			i++;
-		}
-		int size;
-		Error err = MultiplayerAPI::encode_and_compress_variants(vptr, varp.size(), nullptr, size);
+		Error err = sync->get_replication_config_ptr()->get_watch_schema().encode_values(delta, indexes, state_cache);
 		ERR_CONTINUE_MSG(err != OK, "Unable to encode delta state.");
+		int size = state_cache.size();
 
 		ERR_CONTINUE_MSG(size > delta_mtu, vformat("Synchronizer delta bigger than MTU will not be sent (%d > %d): %s", size, delta_mtu, sync->get_path()));
 
 		if (ofs + 4 + 8 + 4 + size > delta_mtu) {
+			if (peer_info->relevancy) {
+				// Only send the most relevant changes, the others are kept for the next frames.
+				peer_info->starved_syncs[oid]++;
+				continue;
+			}
 			// Send what we got, and reset write.
 			_send_raw(packet_cache.ptr(), ofs, p_peer, true);
 			ofs = 1;
@@ -751,13 +789,14 @@ void SceneReplicationInterface::_send_delta(int p_peer, const HashSet<ObjectID>
 			ofs += encode_uint32(sync->get_net_id(), &ptr[ofs]);
 			ofs += encode_uint64(indexes, &ptr[ofs]);
 			ofs += encode_uint32(size, &ptr[ofs]);
-			MultiplayerAPI::encode_and_compress_variants(vptr, varp.size(), &ptr[ofs], size);
+			memcpy(&ptr[ofs], state_cache.ptr(), size);
 			ofs += size;
 		}
 #ifdef DEBUG_ENABLED
 		_profile_node_data("delta_out", oid, size);
 #endif
-		peers_info[p_peer].last_watch_usecs[oid] = p_usec;
+		peer_info->last_watch_usecs[oid] = p_usec;
+		peer_info->starved_syncs.erase(oid);
 	}
 	if (ofs > 1) {
 		// Got some left over to send.
@@ -781,15 +820,8 @@ Error SceneReplicationInterface::on_delta_receive(int p_from, const uint8_t *p_b
 			ofs += size;
 			ERR_CONTINUE_MSG(true, "Ignoring delta for non-authority or invalid synchronizer.");
 		}
-		List<NodePath> props = sync->get_delta_properties(indexes);
-		ERR_FAIL_COND_V(props.is_empty(), ERR_INVALID_DATA);
-		Vector<Variant> vars;
-		vars.resize(props.size());
-		int consumed = 0;
-		Error err = MultiplayerAPI::decode_and_decompress_variants(vars, p_buffer + ofs, size, consumed);
-		ERR_FAIL_COND_V(err != OK, err);
-		ERR_FAIL_COND_V(uint32_t(consumed) != size, ERR_INVALID_DATA);
-		err = MultiplayerSynchronizer::set_state(props, node, vars);
+		const SceneReplicationSchema &schema = sync->get_replication_config_ptr()->get_watch_schema();
+		Error err = schema.decode_values(node, sync->get_watch_bindings(), indexes, p_buffer + ofs, size);
 		ERR_FAIL_COND_V(err != OK, err);
 		ofs += size;
 		sync->emit_signal(SNAME("delta_synchronized"));
@@ -800,7 +832,9 @@ Error SceneReplicationInterface::on_delta_receive(int p_from, const uint8_t *p_b
 	return OK;
 }
 
-void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint16_t p_sync_net_time, uint64_t p_usec) {
+void SceneReplicationInterface::_send_sync(int p_peer, const LocalVector<ObjectID> &p_synchronizers, uint16_t p_sync_net_time, uint64_t p_usec) {
+	PeerInfo *peer_info = peers_info.getptr(p_peer);
+	ERR_FAIL_NULL(peer_info);
 	MAKE_ROOM(/* header */ 3 + /* element */ 4 + 4 + sync_mtu);
 	uint8_t *ptr = packet_cache.ptrw();
 	ptr[0] = SceneMultiplayer::NETWORK_COMMAND_SYNC;
@@ -822,17 +856,18 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &
 			// The path based sync is not yet confirmed, skipping.
 			continue;
 		}
-		int size;
-		Vector<Variant> vars;
-		Vector<const Variant *> varp;
-		const List<NodePath> props = sync->get_replication_config_ptr()->get_sync_properties();
-		Error err = MultiplayerSynchronizer::get_state(props, node, vars, varp);
-		ERR_CONTINUE_MSG(err != OK, "Unable to retrieve sync state.");
-		err = MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), nullptr, size);
+		const SceneReplicationSchema &schema = sync->get_replication_config_ptr()->get_sync_schema();
+		Error err = schema.encode_state(node, sync->get_sync_bindings(), state_cache);
 		ERR_CONTINUE_MSG(err != OK, "Unable to encode sync state.");
+		int size = state_cache.size();
 		// TODO Handle single state above MTU.
 		ERR_CONTINUE_MSG(size > sync_mtu, vformat("Node states bigger than MTU will not be sent (%d > %d): %s", size, sync_mtu, node->get_path()));
 		if (ofs + 4 + 4 + size > sync_mtu) {
+			if (peer_info->relevancy) {
+				// Only send the most relevant states, the others get a higher priority in the next frames.
+				peer_info->starved_syncs[oid]++;
+				continue;
+			}
 			// Send what we got, and reset write.
 			_send_raw(packet_cache.ptr(), ofs, p_peer, false);
 			ofs = 3;
@@ -840,12 +875,13 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &
 		if (size) {
 			ofs += encode_uint32(sync->get_net_id(), &ptr[ofs]);
 			ofs += encode_uint32(size, &ptr[ofs]);
-			MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), &ptr[ofs], size);
+			memcpy(&ptr[ofs], state_cache.ptr(), size);
 			ofs += size;
 		}
 #ifdef DEBUG_ENABLED
 		_profile_node_data("sync_out", oid, size);
 #endif
+		peer_info->starved_syncs.erase(oid);
 	}
 	if (ofs > 3) {
 		// Got some left over to send.
@@ -854,8 +890,13 @@ void SceneReplicationInterface::_send_sync(int p_peer, const HashSet<ObjectID> &
 }
 
 Error SceneReplicationInterface::on_sync_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len) {
-	ERR_FAIL_COND_V_MSG(p_buffer_len < 11, ERR_INVALID_DATA, "Invalid sync packet received");
+	ERR_FAIL_COND_V_MSG(p_buffer_len < 1, ERR_INVALID_DATA, "Invalid sync packet received");
 	bool is_delta = (p_buffer[0] & (1 << SceneMultiplayer::CMD_FLAG_0_SHIFT)) != 0;
+	bool is_snapshot = (p_buffer[0] & (1 << SceneMultiplayer::CMD_FLAG_1_SHIFT)) != 0;
+	if (is_snapshot) {
+		return is_delta ? on_snapshot_ack_receive(p_from, p_buffer, p_buffer_len) : on_snapshot_receive(p_from, p_buffer, p_buffer_len);
+	}
+	ERR_FAIL_COND_V_MSG(p_buffer_len < 11, ERR_INVALID_DATA, "Invalid sync packet received");
 	if (is_delta) {
 		return on_delta_receive(p_from, p_buffer, p_buffer_len);
 	}
@@ -884,13 +925,8 @@ Error SceneReplicationInterface::on_sync_receive(int p_from, const uint8_t *p_bu
 			ofs += size;
 			continue;
 		}
-		const List<NodePath> props = sync->get_replication_config_ptr()->get_sync_properties();
-		Vector<Variant> vars;
-		vars.resize(props.size());
-		int consumed;
-		Error err = MultiplayerAPI::decode_and_decompress_variants(vars, &p_buffer[ofs], size, consumed);
-		ERR_FAIL_COND_V(err, err);
-		err = MultiplayerSynchronizer::set_state(props, node, vars);
+		const SceneReplicationSchema &schema = sync->get_replication_config_ptr()->get_sync_schema();
+		Error err = schema.decode_state(node, sync->get_sync_bindings(), &p_buffer[ofs], size);
 		ERR_FAIL_COND_V(err, err);
 		ofs += size;
 		sync->emit_signal(SNAME("synchronized"));
@@ -901,6 +937,469 @@ Error SceneReplicationInterface::on_sync_receive(int p_from, const uint8_t *p_bu
 	return OK;
 }
 
+SceneReplicationInterface::SnapshotRecord &SceneReplicationInterface::_begin_snapshot_packet(PeerInfo &p_info) {
+	const uint16_t sequence = ++p_info.last_sent_sync;
+	SnapshotRecord &record = p_info.snapshot_records[sequence % MultiplayerSynchronizer::SNAPSHOT_HISTORY];
+	record.sequence = sequence;
+	record.valid = true;
+	record.states.clear();
+	return record;
+}
+
+const MultiplayerSynchronizer::Snapshot *SceneReplicationInterface::_encode_snapshot(MultiplayerSynchronizer *p_sync, Node *p_node) {
+	MultiplayerSynchronizer::Snapshot &snapshot = p_sync->get_snapshot_slot(snapshot_frame);
+	if (snapshot.valid && snapshot.id == snapshot_frame) {
+		return &snapshot; // Already encoded for another peer in this frame.
+	}
+	// Synchronized properties, prefixed by their size, then the watched ones.
+	snapshot.valid = false;
+	snapshot.id = snapshot_frame;
+	SceneReplicationConfig *config = p_sync->get_replication_config_ptr();
+	Error err = config->get_sync_schema().encode_state(p_node, p_sync->get_sync_bindings(), state_cache);
+	ERR_FAIL_COND_V_MSG(err != OK, nullptr, "Unable to encode sync state.");
+	snapshot.state.resize(4 + state_cache.size());
+	encode_uint32(state_cache.size(), snapshot.state.ptr());
+	if (state_cache.size()) {
+		memcpy(snapshot.state.ptr() + 4, state_cache.ptr(), state_cache.size());
+	}
+	err = config->get_watch_schema().encode_state(p_node, p_sync->get_watch_bindings(), state_cache);
+	ERR_FAIL_COND_V_MSG(err != OK, nullptr, "Unable to encode sync state.");
+	const uint32_t ofs = snapshot.state.size();
+	snapshot.state.resize(ofs + state_cache.size());
+	if (state_cache.size()) {
+		memcpy(snapshot.state.ptr() + ofs, state_cache.ptr(), state_cache.size());
+	}
+	snapshot.valid = true;
+	return &snapshot;
+}
+
+void SceneReplicationInterface::_send_snapshot(int p_peer, const LocalVector<ObjectID> &p_synchronizers, uint64_t p_usec) {
+	PeerInfo *peer_info = peers_info.getptr(p_peer);
+	ERR_FAIL_NULL(peer_info);
+	MAKE_ROOM(/* header */ 3 + /* element */ 4 + 1 + 2 + sync_mtu);
+	uint8_t *ptr = packet_cache.ptrw();
+	ptr[0] = SceneMultiplayer::NETWORK_COMMAND_SYNC | (1 << SceneMultiplayer::CMD_FLAG_1_SHIFT);
+	int ofs = 3;
+	SnapshotRecord *record = &_begin_snapshot_packet(*peer_info);
+	for (const ObjectID &oid : p_synchronizers) {
+		MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(oid);
+		ERR_CONTINUE(!sync || !sync->get_replication_config_ptr() || !_has_authority(sync));
+		if (!sync->update_outbound_sync_time(p_usec)) {
+			continue; // nothing to sync.
+		}
+
+		Node *node = sync->get_root_node();
+		ERR_CONTINUE(!node);
+		uint32_t net_id = sync->get_net_id();
+		if (!_verify_synchronizer(p_peer, sync, net_id)) {
+			// The path based sync is not yet confirmed, skipping.
+			continue;
+		}
+		const MultiplayerSynchronizer::Snapshot *snapshot = _encode_snapshot(sync, node);
+		ERR_CONTINUE(!snapshot);
+		ERR_CONTINUE_MSG(int(snapshot->state.size()) > sync_mtu || snapshot->state.size() > UINT16_MAX, vformat("Node states bigger than MTU will not be sent (%d > %d): %s", snapshot->state.size(), sync_mtu, node->get_path()));
+
+		// Encode against the last state acknowledged by the peer, if both sides still have it.
+		const SnapshotAck *ack = peer_info->snapshot_acks.getptr(oid);
+		const MultiplayerSynchronizer::Snapshot *baseline = ack ? sync->find_snapshot(ack->frame) : nullptr;
+		bool use_delta = false;
+		// Leave room for the sequence to be incremented if the packet is full.
+		if (baseline && baseline->state.size() == snapshot->state.size() && uint16_t(record->sequence - ack->sequence) < MultiplayerSynchronizer::SNAPSHOT_HISTORY - 1) {
+			SceneReplicationSchema::encode_snapshot_delta(snapshot->state.ptr(), baseline->state.ptr(), snapshot->state.size(), state_cache);
+			use_delta = state_cache.size() < snapshot->state.size();
+		}
+		int size = use_delta ? state_cache.size() : snapshot->state.size();
+		if (ofs + 4 + 1 + 2 + size > sync_mtu) {
+			if (peer_info->relevancy) {
+				// Only send the most relevant states, the others get a higher priority in the next frames.
+				peer_info->starved_syncs[oid]++;
+				continue;
+			}
+			// Send what we got, and start a new packet.
+			encode_uint16(record->sequence, &ptr[1]);
+			_send_raw(packet_cache.ptr(), ofs, p_peer, false);
+			record = &_begin_snapshot_packet(*peer_info);
+			ofs = 3;
+		}
+		const uint8_t age = use_delta ? uint8_t(record->sequence - ack->sequence) : 0;
+		ofs += encode_uint32(net_id, &ptr[ofs]);
+		ptr[ofs++] = age;
+		ofs += encode_uint16(size, &ptr[ofs]);
+		if (size) {
+			memcpy(&ptr[ofs], age ? state_cache.ptr() : snapshot->state.ptr(), size);
+			ofs += size;
+		}
+		record->states.push_back(Pair<ObjectID, uint32_t>(oid, snapshot->id));
+		peer_info->starved_syncs.erase(oid);
+#ifdef DEBUG_ENABLED
+		_profile_node_data("sync_out", oid, size);
+#endif
+	}
+	if (ofs > 3) {
+		// Got some left over to send.
+		encode_uint16(record->sequence, &ptr[1]);
+		_send_raw(packet_cache.ptr(), ofs, p_peer, false);
+	}
+}
+
+void SceneReplicationInterface::_send_snapshot_ack(int p_peer, PeerInfo &p_info) {
+	MAKE_ROOM(7);
+	uint8_t *ptr = packet_cache.ptrw();
+	ptr[0] = SceneMultiplayer::NETWORK_COMMAND_SYNC | (1 << SceneMultiplayer::CMD_FLAG_0_SHIFT) | (1 << SceneMultiplayer::CMD_FLAG_1_SHIFT);
+	encode_uint16(p_info.last_recv_snapshot, &ptr[1]);
+	encode_uint32(p_info.recv_snapshot_mask, &ptr[3]);
+	_send_raw(packet_cache.ptr(), 7, p_peer, false);
+	p_info.snapshot_ack_pending = false;
+}
+
+Error SceneReplicationInterface::_apply_snapshot(MultiplayerSynchronizer *p_sync, Node *p_node, const MultiplayerSynchronizer::Snapshot &p_snapshot, const MultiplayerSynchronizer::Snapshot *p_previous) {
+	ERR_FAIL_COND_V(p_snapshot.state.size() < 4, ERR_INVALID_DATA);
+	const uint8_t *state = p_snapshot.state.ptr();
+	const uint32_t sync_size = decode_uint32(state);
+	ERR_FAIL_COND_V(sync_size > p_snapshot.state.size() - 4, ERR_INVALID_DATA);
+	SceneReplicationConfig *config = p_sync->get_replication_config_ptr();
+	ERR_FAIL_NULL_V(config, ERR_UNCONFIGURED);
+	Error err = config->get_sync_schema().decode_state(p_node, p_sync->get_sync_bindings(), state + 4, sync_size);
+	ERR_FAIL_COND_V(err, err);
+	p_sync->emit_signal(SNAME("synchronized"));
+
+	// Watched properties are only applied when they changed since the previous state.
+	const uint32_t watch_ofs = 4 + sync_size;
+	const uint32_t watch_size = p_snapshot.state.size() - watch_ofs;
+	if (p_previous && p_previous->state.size() == p_snapshot.state.size() && memcmp(p_previous->state.ptr() + watch_ofs, state + watch_ofs, watch_size) == 0) {
+		return OK;
+	}
+	if (config->get_watch_schema().get_field_count() == 0) {
+		return OK;
+	}
+	err = config->get_watch_schema().decode_state(p_node, p_sync->get_watch_bindings(), state + watch_ofs, watch_size);
+	ERR_FAIL_COND_V(err, err);
+	p_sync->emit_signal(SNAME("delta_synchronized"));
+	return OK;
+}
+
+Error SceneReplicationInterface::on_snapshot_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len) {
+	ERR_FAIL_COND_V_MSG(p_buffer_len < 3, ERR_INVALID_DATA, "Invalid snapshot packet received");
+	PeerInfo *peer_info = peers_info.getptr(p_from);
+	ERR_FAIL_NULL_V(peer_info, ERR_UNAVAILABLE);
+	const uint16_t sequence = decode_uint16(&p_buffer[1]);
+	int ofs = 3;
+	// Packets with states that could not be kept as baselines are not acknowledged.
+	bool complete = true;
+	while (ofs + 7 <= p_buffer_len) {
+		uint32_t net_id = decode_uint32(&p_buffer[ofs]);
+		ofs += 4;
+		uint8_t age = p_buffer[ofs];
+		ofs += 1;
+		uint16_t size = decode_uint16(&p_buffer[ofs]);
+		ofs += 2;
+		ERR_FAIL_COND_V(size > uint32_t(p_buffer_len - ofs), ERR_INVALID_DATA);
+		const uint8_t *data = &p_buffer[ofs];
+		ofs += size;
+
+		MultiplayerSynchronizer *sync = _find_synchronizer(p_from, net_id);
+		if (!sync) {
+			// Not received yet.
+			complete = false;
+			continue;
+		}
+		Node *node = sync->get_root_node();
+		if (sync->get_multiplayer_authority() != p_from || !node) {
+			// Not valid for me.
+			complete = false;
+			ERR_CONTINUE_MSG(true, "Ignoring sync data from non-authority or for missing node.");
+		}
+		const MultiplayerSynchronizer::Snapshot *baseline = nullptr;
+		if (age) {
+			ERR_FAIL_COND_V(age >= MultiplayerSynchronizer::SNAPSHOT_HISTORY, ERR_INVALID_DATA);
+			baseline = sync->find_snapshot(uint16_t(sequence - age));
+			if (!baseline) {
+				complete = false;
+				continue;
+			}
+		}
+		MultiplayerSynchronizer::Snapshot &snapshot = sync->get_snapshot_slot(sequence);
+		snapshot.valid = false;
+		if (baseline) {
+			Error err = SceneReplicationSchema::decode_snapshot_delta(data, size, baseline->state.ptr(), baseline->state.size(), snapshot.state);
+			ERR_FAIL_COND_V(err != OK, err);
+		} else {
+			snapshot.state.resize(size);
+			if (size) {
+				memcpy(snapshot.state.ptr(), data, size);
+			}
+		}
+		snapshot.id = sequence;
+		snapshot.valid = true;
+#ifdef DEBUG_ENABLED
+		_profile_node_data("sync_in", sync->get_instance_id(), size);
+#endif
+		const MultiplayerSynchronizer::Snapshot *previous = sync->find_applied_snapshot();
+		if (!sync->update_inbound_sync_time(sequence)) {
+			continue; // State is too old, but can still be a baseline.
+		}
+		Error err = _apply_snapshot(sync, node, snapshot, previous);
+		ERR_FAIL_COND_V(err, err);
+	}
+	if (!complete) {
+		return OK;
+	}
+
+	if (!peer_info->snapshot_received) {
+		peer_info->snapshot_received = true;
+		peer_info->last_recv_snapshot = sequence;
+		peer_info->recv_snapshot_mask = 0;
+	} else {
+		const int16_t diff = int16_t(sequence - peer_info->last_recv_snapshot);
+		if (diff > 0) {
+			// Newer than the last one, which becomes bit diff - 1.
+			uint32_t mask = diff < 32 ? peer_info->recv_snapshot_mask << diff : 0;
+			if (diff <= 32) {
+				mask |= 1u << (diff - 1);
+			}
+			peer_info->recv_snapshot_mask = mask;
+			peer_info->last_recv_snapshot = sequence;
+		} else if (diff < 0 && diff >= -32) {
+			peer_info->recv_snapshot_mask |= 1u << (-diff - 1);
+		}
+	}
+	peer_info->snapshot_ack_pending = true;
+	return OK;
+}
+
+Error SceneReplicationInterface::on_snapshot_ack_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len) {
+	ERR_FAIL_COND_V_MSG(p_buffer_len < 7, ERR_INVALID_DATA, "Invalid snapshot acknowledgement received");
+	PeerInfo *peer_info = peers_info.getptr(p_from);
+	ERR_FAIL_NULL_V(peer_info, ERR_UNAVAILABLE);
+	const uint16_t last = decode_uint16(&p_buffer[1]);
+	const uint32_t mask = decode_uint32(&p_buffer[3]);
+	for (int i = 0; i <= 32; i++) {
+		if (i > 0 && !(mask & (1u << (i - 1)))) {
+			continue;
+		}
+		const uint16_t sequence = last - i;
+		SnapshotRecord &record = peer_info->snapshot_records[sequence % MultiplayerSynchronizer::SNAPSHOT_HISTORY];
+		if (!record.valid || record.sequence != sequence) {
+			continue; // Unknown, or already acknowledged.
+		}
+		for (const Pair<ObjectID, uint32_t> &state : record.states) {
+			SnapshotAck *ack = peer_info->snapshot_acks.getptr(state.first);
+			if (ack && int16_t(sequence - ack->sequence) <= 0) {
+				continue; // Already have a newer one.
+			}
+			SnapshotAck new_ack;
+			new_ack.sequence = sequence;
+			new_ack.frame = state.second;
+			peer_info->snapshot_acks[state.first] = new_ack;
+		}
+		record.valid = false;
+	}
+	return OK;
+}
+
+bool SceneReplicationInterface::_is_relevant(int p_peer, const ObjectID &p_sid) const {
+	if (p_peer <= 0 || !interest.has(p_sid)) {
+		return true; // Not subject to spatial relevancy.
+	}
+	const PeerInfo *info = peers_info.getptr(p_peer);
+	return !info || !info->relevancy || info->relevant_syncs.has(p_sid);
+}
+
+void SceneReplicationInterface::_update_relevancy() {
+	// Track the position of the synchronizers we control. Peer origins only move with set_peer_relevancy(),
+	// so relevancy can only change for the synchronizers that moved to another cell.
+	relevancy_moved.clear();
+	relevancy_added.clear();
+	LocalVector<ObjectID> removed;
+	for (const ObjectID &sid : relevancy_syncs) {
+		MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(sid);
+		Vector3 position;
+		if (sync && _has_authority(sync) && sync->get_relevancy_position(position)) {
+			const bool added = !interest.has(sid);
+			if (interest.update(sid, position)) {
+				(added ? relevancy_added : relevancy_moved).push_back(sid);
+			}
+		} else if (interest.has(sid)) {
+			removed.push_back(sid);
+		}
+	}
+	// Updating visibility can despawn nodes and stop their synchronizers, so it's done outside of the loop above.
+	for (const ObjectID &sid : removed) {
+		_remove_relevancy(sid);
+	}
+	if (relevancy_moved.is_empty() && relevancy_added.is_empty()) {
+		return;
+	}
+	for (KeyValue<int, PeerInfo> &E : peers_info) {
+		PeerInfo &info = E.value;
+		if (!info.relevancy) {
+			continue;
+		}
+		for (const ObjectID &sid : relevancy_moved) {
+			const bool relevant = interest.is_in_range(sid, info.relevancy_origin, info.relevancy_radius);
+			if (relevant == info.relevant_syncs.has(sid)) {
+				continue;
+			}
+			if (relevant) {
+				info.relevant_syncs.insert(sid);
+			} else {
+				info.relevant_syncs.erase(sid);
+				info.starved_syncs.erase(sid);
+			}
+			_visibility_changed(E.key, sid);
+		}
+		// These were relevant to everyone until now.
+		for (const ObjectID &sid : relevancy_added) {
+			if (interest.is_in_range(sid, info.relevancy_origin, info.relevancy_radius)) {
+				info.relevant_syncs.insert(sid);
+			} else {
+				_visibility_changed(E.key, sid);
+			}
+		}
+	}
+}
+
+void SceneReplicationInterface::_update_peer_relevancy(int p_peer, PeerInfo &p_info) {
+	HashSet<ObjectID> relevant;
+	interest.query(p_info.relevancy_origin, p_info.relevancy_radius, relevant);
+	LocalVector<ObjectID> changed;
+	for (const ObjectID &sid : relevant) {
+		if (!p_info.relevant_syncs.has(sid)) {
+			changed.push_back(sid);
+		}
+	}
+	for (const ObjectID &sid : p_info.relevant_syncs) {
+		if (!relevant.has(sid)) {
+			changed.push_back(sid);
+			p_info.starved_syncs.erase(sid);
+		}
+	}
+	if (changed.is_empty()) {
+		return;
+	}
+	p_info.relevant_syncs = relevant;
+	for (const ObjectID &sid : changed) {
+		_visibility_changed(p_peer, sid);
+	}
+}
+
+void SceneReplicationInterface::_remove_relevancy(const ObjectID &p_sid) {
+	if (!interest.has(p_sid)) {
+		return;
+	}
+	interest.remove(p_sid);
+	bool was_hidden = false;
+	for (KeyValue<int, PeerInfo> &E : peers_info) {
+		was_hidden = was_hidden || (E.value.relevancy && !E.value.relevant_syncs.has(p_sid));
+		E.value.relevant_syncs.erase(p_sid);
+		E.value.starved_syncs.erase(p_sid);
+	}
+	MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(p_sid);
+	if (was_hidden && sync && _has_authority(sync) && sync->get_root_node()) {
+		_visibility_changed(0, p_sid);
+	}
+}
+
+void SceneReplicationInterface::_prioritize(const PeerInfo &p_info, LocalVector<ObjectID> &r_synchronizers) {
+	r_synchronizers.clear();
+	if (!p_info.relevancy) {
+		for (const ObjectID &sid : p_info.sync_nodes) {
+			r_synchronizers.push_back(sid);
+		}
+		return;
+	}
+	// Closer and higher priority synchronizers first. Each frame a synchronizer is skipped increases its priority.
+	const real_t radius_sq = MAX(p_info.relevancy_radius * p_info.relevancy_radius, (real_t)CMP_EPSILON);
+	priority_cache.clear();
+	for (const ObjectID &sid : p_info.sync_nodes) {
+		MultiplayerSynchronizer *sync = get_id_as<MultiplayerSynchronizer>(sid);
+		SyncPriority priority;
+		priority.id = sid;
+		if (sync) {
+			priority.score = sync->get_relevancy_priority();
+			Vector3 position;
+			if (interest.get_position(sid, position)) {
+				priority.score /= 1 + position.distance_squared_to(p_info.relevancy_origin) / radius_sq;
+			}
+			const uint32_t *starved = p_info.starved_syncs.getptr(sid);
+			if (starved) {
+				priority.score *= 1 + *starved;
+			}
+		}
+		priority_cache.push_back(priority);
+	}
+	priority_cache.sort();
+	for (const SyncPriority &priority : priority_cache) {
+		r_synchronizers.push_back(priority.id);
+	}
+}
+
+void SceneReplicationInterface::set_snapshot_replication_enabled(bool p_enabled) {
+	snapshot_replication = p_enabled;
+}
+
+bool SceneReplicationInterface::is_snapshot_replication_enabled() const {
+	return snapshot_replication;
+}
+
+void SceneReplicationInterface::set_peer_relevancy(int p_peer, const Vector3 &p_origin, real_t p_radius) {
+	ERR_FAIL_COND_MSG(p_radius < 0, "Relevancy radius must be greater or equal to 0.");
+	PeerInfo *info = peers_info.getptr(p_peer);
+	ERR_FAIL_NULL_MSG(info, vformat("Unknown peer: %d.", p_peer));
+	if (!info->relevancy) {
+		// Everything was relevant so far.
+		info->relevancy = true;
+		info->relevant_syncs.clear();
+		for (const ObjectID &sid : sync_nodes) {
+			if (interest.has(sid)) {
+				info->relevant_syncs.insert(sid);
+			}
+		}
+	}
+	info->relevancy_origin = p_origin;
+	info->relevancy_radius = p_radius;
+	_update_peer_relevancy(p_peer, *info);
+}
+
+void SceneReplicationInterface::clear_peer_relevancy(int p_peer) {
+	PeerInfo *info = peers_info.getptr(p_peer);
+	ERR_FAIL_NULL_MSG(info, vformat("Unknown peer: %d.", p_peer));
+	if (!info->relevancy) {
+		return;
+	}
+	const HashSet<ObjectID> relevant = info->relevant_syncs;
+	info->relevancy = false;
+	info->relevant_syncs.clear();
+	info->starved_syncs.clear();
+	for (const ObjectID &sid : sync_nodes) {
+		if (interest.has(sid) && !relevant.has(sid)) {
+			_visibility_changed(p_peer, sid);
+		}
+	}
+}
+
+bool SceneReplicationInterface::has_peer_relevancy(int p_peer) const {
+	const PeerInfo *info = peers_info.getptr(p_peer);
+	return info && info->relevancy;
+}
+
+void SceneReplicationInterface::set_relevancy_cell_size(real_t p_size) {
+	if (interest.get_cell_size() == p_size) {
+		return;
+	}
+	interest.set_cell_size(p_size);
+	// Relevancy is decided per cell, so it may change for synchronizers that didn't move.
+	for (KeyValue<int, PeerInfo> &E : peers_info) {
+		if (E.value.relevancy) {
+			_update_peer_relevancy(E.key, E.value);
+		}
+	}
+}
+
+real_t SceneReplicationInterface::get_relevancy_cell_size() const {
+	return interest.get_cell_size();
+}
+
 void SceneReplicationInterface::set_max_sync_packet_size(int p_size) {
 	ERR_FAIL_COND_MSG(p_size < 128, "Sync maximum packet size must be at least 128 bytes.");
 	sync_mtu = p_size;
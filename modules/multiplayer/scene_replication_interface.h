@@ -33,6 +33,7 @@
 
 #include "multiplayer_spawner.h"
 #include "multiplayer_synchronizer.h"
+#include "scene_replication_interest.h"
 
 #include "core/object/ref_counted.h"
 
@@ -60,6 +61,18 @@ private:
 		}
 	};
 
+	struct SnapshotAck {
+		uint16_t sequence = 0;
+		uint32_t frame = 0;
+	};
+
+	// The synchronizer states sent in a snapshot packet.
+	struct SnapshotRecord {
+		uint16_t sequence = 0;
+		bool valid = false;
+		LocalVector<Pair<ObjectID, uint32_t>> states;
+	};
+
 	struct PeerInfo {
 		HashSet<ObjectID> sync_nodes;
 		HashSet<ObjectID> spawn_nodes;
@@ -67,6 +80,29 @@ private:
 		HashMap<uint32_t, ObjectID> recv_sync_ids;
 		HashMap<uint32_t, ObjectID> recv_nodes;
 		uint16_t last_sent_sync = 0;
+
+		// Spatial relevancy.
+		bool relevancy = false;
+		Vector3 relevancy_origin;
+		real_t relevancy_radius = 0;
+		HashSet<ObjectID> relevant_syncs;
+		HashMap<ObjectID, uint32_t> starved_syncs; // Frames each synchronizer was skipped for lack of room.
+
+		// Snapshots sent, and the last one acknowledged for each synchronizer.
+		SnapshotRecord snapshot_records[MultiplayerSynchronizer::SNAPSHOT_HISTORY];
+		HashMap<ObjectID, SnapshotAck> snapshot_acks;
+		// Snapshots received, to be acknowledged.
+		bool snapshot_received = false;
+		bool snapshot_ack_pending = false;
+		uint16_t last_recv_snapshot = 0;
+		uint32_t recv_snapshot_mask = 0; // Bit N set when last_recv_snapshot - N - 1 was received.
+	};
+
+	struct SyncPriority {
+		ObjectID id;
+		real_t score = 0;
+
+		bool operator<(const SyncPriority &p_other) const { return score > p_other.score; }
 	};
 
 	// Replication state.
@@ -75,6 +111,8 @@ private:
 	HashMap<ObjectID, TrackedNode> tracked_nodes;
 	HashSet<ObjectID> spawned_nodes;
 	HashSet<ObjectID> sync_nodes;
+	HashSet<ObjectID> relevancy_syncs; // Synchronizers with spatial relevancy enabled.
+	SceneReplicationInterest interest;
 
 	// Pending local spawn information (handles spawning nested nodes during ready).
 	HashSet<ObjectID> spawn_queue;
@@ -90,8 +128,14 @@ private:
 	SceneMultiplayer *multiplayer = nullptr;
 	SceneCacheInterface *multiplayer_cache = nullptr;
 	PackedByteArray packet_cache;
+	LocalVector<uint8_t> state_cache; // Encoded state of a single synchronizer.
+	LocalVector<SyncPriority> priority_cache;
+	LocalVector<ObjectID> relevancy_moved; // Synchronizers that moved to another cell this frame.
+	LocalVector<ObjectID> relevancy_added; // Synchronizers whose position became known this frame.
 	int sync_mtu = 1350; // Highly dependent on underlying protocol.
 	int delta_mtu = 65535;
+	bool snapshot_replication = false;
+	uint32_t snapshot_frame = 0;
 
 	TrackedNode &_track(const ObjectID &p_id);
 	void _untrack(const ObjectID &p_id);
@@ -101,8 +145,13 @@ private:
 	bool _verify_synchronizer(int p_peer, MultiplayerSynchronizer *p_sync, uint32_t &r_net_id);
 	MultiplayerSynchronizer *_find_synchronizer(int p_peer, uint32_t p_net_ida);
 
-	void _send_sync(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint16_t p_sync_net_time, uint64_t p_usec);
-	void _send_delta(int p_peer, const HashSet<ObjectID> &p_synchronizers, uint64_t p_usec, const HashMap<ObjectID, uint64_t> &p_last_watch_usecs);
+	void _send_sync(int p_peer, const LocalVector<ObjectID> &p_synchronizers, uint16_t p_sync_net_time, uint64_t p_usec);
+	void _send_delta(int p_peer, const LocalVector<ObjectID> &p_synchronizers, uint64_t p_usec, const HashMap<ObjectID, uint64_t> &p_last_watch_usecs);
+	void _send_snapshot(int p_peer, const LocalVector<ObjectID> &p_synchronizers, uint64_t p_usec);
+	void _send_snapshot_ack(int p_peer, PeerInfo &p_info);
+	SnapshotRecord &_begin_snapshot_packet(PeerInfo &p_info);
+	const MultiplayerSynchronizer::Snapshot *_encode_snapshot(MultiplayerSynchronizer *p_sync, Node *p_node);
+	Error _apply_snapshot(MultiplayerSynchronizer *p_sync, Node *p_node, const MultiplayerSynchronizer::Snapshot &p_snapshot, const MultiplayerSynchronizer::Snapshot *p_previous);
 	Error _make_spawn_packet(Node *p_node, MultiplayerSpawner *p_spawner, int &r_len);
 	Error _make_despawn_packet(Node *p_node, int &r_len);
 	Error _send_raw(const uint8_t *p_buffer, int p_size, int p_peer, bool p_reliable);
@@ -112,6 +161,12 @@ private:
 	Error _update_spawn_visibility(int p_peer, const ObjectID &p_oid);
 	void _free_remotes(const PeerInfo &p_info);
 
+	bool _is_relevant(int p_peer, const ObjectID &p_sid) const;
+	void _update_relevancy();
+	void _update_peer_relevancy(int p_peer, PeerInfo &p_info);
+	void _remove_relevancy(const ObjectID &p_sid);
+	void _prioritize(const PeerInfo &p_info, LocalVector<ObjectID> &r_synchronizers);
+
 	template <typename T>
 	static T *get_id_as(const ObjectID &p_id) {
 		return p_id.is_valid() ? Object::cast_to<T>(ObjectDB::get_instance(p_id)) : nullptr;
@@ -137,6 +192,8 @@ public:
 	Error on_despawn_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len);
 	Error on_sync_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len);
 	Error on_delta_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len);
+	Error on_snapshot_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len);
+	Error on_snapshot_ack_receive(int p_from, const uint8_t *p_buffer, int p_buffer_len);
 
 	bool is_rpc_visible(const ObjectID &p_oid, int p_peer) const;
 
@@ -146,6 +203,16 @@ public:
 	void set_max_delta_packet_size(int p_size);
 	int get_max_delta_packet_size() const;
 
+	void set_snapshot_replication_enabled(bool p_enabled);
+	bool is_snapshot_replication_enabled() const;
+
+	void set_peer_relevancy(int p_peer, const Vector3 &p_origin, real_t p_radius);
+	void clear_peer_relevancy(int p_peer);
+	bool has_peer_relevancy(int p_peer) const;
+
+	void set_relevancy_cell_size(real_t p_size);
+	real_t get_relevancy_cell_size() const;
+
 	SceneReplicationInterface(SceneMultiplayer *p_multiplayer, SceneCacheInterface *p_cache) {
 		multiplayer = p_multiplayer;
 		multiplayer_cache = p_cache;
@@ -0,0 +1,666 @@
+/**************************************************************************/
+/*  scene_replication_schema.cpp                                          */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "scene_replication_schema.h"
+
+#include "core/io/marshalls.h"
+#include "core/math/math_funcs.h"
+#include "core/object/class_db.h"
+#include "core/object/script_language.h"
+#include "scene/main/node.h"
+
+namespace {
+
+enum RealPrecision {
+	PRECISION_HALF,
+	PRECISION_FLOAT,
+	PRECISION_DOUBLE,
+};
+
+static_assert(Variant::VARIANT_MAX <= 64, "Variant types must fit in the 6-bit type of replicated values.");
+
+struct BitWriter {
+	LocalVector<uint8_t> &buffer;
+	uint64_t bit = 0;
+
+	void write(uint64_t p_value, uint32_t p_bits) {
+		while (p_bits > 0) {
+			uint32_t offset = bit & 7;
+			if (offset == 0) {
+				buffer.push_back(0);
+			}
+			uint32_t count = MIN(8 - offset, p_bits);
+			buffer[buffer.size() - 1] |= uint8_t((p_value & ((1u << count) - 1)) << offset);
+			p_value >>= count;
+			p_bits -= count;
+			bit += count;
+		}
+	}
+
+	// Byte-aligned storage, for values encoded with encode_variant().
+	uint8_t *write_bytes(uint32_t p_count) {
+		uint32_t ofs = buffer.size();
+		buffer.resize(ofs + p_count);
+		bit = uint64_t(ofs + p_count) * 8;
+		return buffer.ptr() + ofs;
+	}
+
+	BitWriter(LocalVector<uint8_t> &p_buffer) :
+			buffer(p_buffer) {}
+};
+
+struct BitReader {
+	const uint8_t *buffer = nullptr;
+	uint32_t size = 0;
+	uint64_t bit = 0;
+
+	bool read(uint32_t p_bits, uint64_t &r_value) {
+		if (bit + p_bits > uint64_t(size) * 8) {
+			return false;
+		}
+		r_value = 0;
+		uint32_t shift = 0;
+		while (p_bits > 0) {
+			uint32_t offset = bit & 7;
+			uint32_t count = MIN(8 - offset, p_bits);
+			r_value |= uint64_t((buffer[bit >> 3] >> offset) & ((1u << count) - 1)) << shift;
+			shift += count;
+			p_bits -= count;
+			bit += count;
+		}
+		return true;
+	}
+
+	const uint8_t *read_bytes(uint32_t p_count) {
+		uint64_t ofs = (bit + 7) / 8;
+		if (ofs + p_count > size) {
+			return nullptr;
+		}
+		bit = (ofs + p_count) * 8;
+		return buffer + ofs;
+	}
+
+	uint32_t get_bytes_read() const {
+		return uint32_t((bit + 7) / 8);
+	}
+
+	BitReader(const uint8_t *p_buffer, uint32_t p_size) :
+			buffer(p_buffer), size(p_size) {}
+};
+
+void write_real(BitWriter &p_writer, double p_value, RealPrecision p_precision) {
+	switch (p_precision) {
+		case PRECISION_HALF: {
+			p_writer.write(Math::make_half_float(p_value), 16);
+		} break;
+		case PRECISION_FLOAT: {
+			float value = p_value;
+			uint32_t bits;
+			memcpy(&bits, &value, sizeof(bits));
+			p_writer.write(bits, 32);
+		} break;
+		case PRECISION_DOUBLE: {
+			uint64_t bits;
+			memcpy(&bits, &p_value, sizeof(bits));
+			p_writer.write(bits, 64);
+		} break;
+	}
+}
+
+bool read_real(BitReader &p_reader, RealPrecision p_precision, double &r_value) {
+	uint64_t bits = 0;
+	switch (p_precision) {
+		case PRECISION_HALF: {
+			if (!p_reader.read(16, bits)) {
+				return false;
+			}
+			r_value = Math::half_to_float(bits);
+		} break;
+		case PRECISION_FLOAT: {
+			if (!p_reader.read(32, bits)) {
+				return false;
+			}
+			uint32_t bits32 = bits;
+			float value;
+			memcpy(&value, &bits32, sizeof(value));
+			r_value = value;
+		} break;
+		case PRECISION_DOUBLE: {
+			if (!p_reader.read(64, bits)) {
+				return false;
+			}
+			memcpy(&r_value, &bits, sizeof(r_value));
+		} break;
+	}
+	return true;
+}
+
+template <typename T, typename C>
+void write_components(BitWriter &p_writer, const T &p_value, RealPrecision p_precision) {
+	static_assert(sizeof(T) % sizeof(C) == 0);
+	const C *components = reinterpret_cast<const C *>(&p_value);
+	p_writer.write(p_precision, 2);
+	for (uint32_t i = 0; i < sizeof(T) / sizeof(C); i++) {
+		write_real(p_writer, components[i], p_precision);
+	}
+}
+
+template <typename T, typename C>
+bool read_components(BitReader &p_reader, Variant &r_value) {
+	static_assert(sizeof(T) % sizeof(C) == 0);
+	uint64_t precision = 0;
+	if (!p_reader.read(2, precision) || precision > PRECISION_DOUBLE) {
+		return false;
+	}
+	T value;
+	C *components = reinterpret_cast<C *>(&value);
+	for (uint32_t i = 0; i < sizeof(T) / sizeof(C); i++) {
+		double component = 0;
+		if (!read_real(p_reader, RealPrecision(precision), component)) {
+			return false;
+		}
+		components[i] = component;
+	}
+	r_value = value;
+	return true;
+}
+
+template <typename T>
+void write_int_components(BitWriter &p_writer, const T &p_value) {
+	static_assert(sizeof(T) % sizeof(int32_t) == 0);
+	const int32_t *components = reinterpret_cast<const int32_t *>(&p_value);
+	for (uint32_t i = 0; i < sizeof(T) / sizeof(int32_t); i++) {
+		p_writer.write(uint32_t(components[i]), 32);
+	}
+}
+
+template <typename T>
+bool read_int_components(BitReader &p_reader, Variant &r_value) {
+	static_assert(sizeof(T) % sizeof(int32_t) == 0);
+	T value;
+	int32_t *components = reinterpret_cast<int32_t *>(&value);
+	for (uint32_t i = 0; i < sizeof(T) / sizeof(int32_t); i++) {
+		uint64_t bits = 0;
+		if (!p_reader.read(32, bits)) {
+			return false;
+		}
+		components[i] = int32_t(uint32_t(bits));
+	}
+	r_value = value;
+	return true;
+}
+
+// Writes a value without its type, which the reader must already know.
+Error write_payload(BitWriter &p_writer, const Variant &p_value, bool p_quantize) {
+	const RealPrecision real_precision = p_quantize ? PRECISION_HALF : (sizeof(real_t) == sizeof(double) ? PRECISION_DOUBLE : PRECISION_FLOAT);
+	const RealPrecision color_precision = p_quantize ? PRECISION_HALF : PRECISION_FLOAT;
+
+	switch (p_value.get_type()) {
+		case Variant::NIL: {
+		} break;
+		case Variant::BOOL: {
+			p_writer.write(p_value.operator bool(), 1);
+		} break;
+		case Variant::INT: {
+			int64_t value = p_value;
+			bool wide = value != int64_t(int32_t(value));
+			p_writer.write(wide, 1);
+			p_writer.write(uint64_t(value), wide ? 64 : 32);
+		} break;
+		case Variant::FLOAT: {
+			double value = p_value;
+			RealPrecision precision = p_quantize ? PRECISION_HALF : (double(float(value)) == value ? PRECISION_FLOAT : PRECISION_DOUBLE);
+			p_writer.write(precision, 2);
+			write_real(p_writer, value, precision);
+		} break;
+		case Variant::VECTOR2: {
+			write_components<Vector2, real_t>(p_writer, p_value.operator Vector2(), real_precision);
+		} break;
+		case Variant::VECTOR2I: {
+			write_int_components(p_writer, p_value.operator Vector2i());
+		} break;
+		case Variant::RECT2: {
+			write_components<Rect2, real_t>(p_writer, p_value.operator Rect2(), real_precision);
+		} break;
+		case Variant::RECT2I: {
+			write_int_components(p_writer, p_value.operator Rect2i());
+		} break;
+		case Variant::VECTOR3: {
+			write_components<Vector3, real_t>(p_writer, p_value.operator Vector3(), real_precision);
+		} break;
+		case Variant::VECTOR3I: {
+			write_int_components(p_writer, p_value.operator Vector3i());
+		} break;
+		case Variant::TRANSFORM2D: {
+			write_components<Transform2D, real_t>(p_writer, p_value.operator Transform2D(), real_precision);
+		} break;
+		case Variant::VECTOR4: {
+			write_components<Vector4, real_t>(p_writer, p_value.operator Vector4(), real_precision);
+		} break;
+		case Variant::VECTOR4I: {
+			write_int_components(p_writer, p_value.operator Vector4i());
+		} break;
+		case Variant::PLANE: {
+			write_components<Plane, real_t>(p_writer, p_value.operator Plane(), real_precision);
+		} break;
+		case Variant::QUATERNION: {
+			write_components<Quaternion, real_t>(p_writer, p_value.operator Quaternion(), real_precision);
+		} break;
+		case Variant::AABB: {
+			write_components<::AABB, real_t>(p_writer, p_value.operator ::AABB(), real_precision);
+		} break;
+		case Variant::BASIS: {
+			write_components<Basis, real_t>(p_writer, p_value.operator Basis(), real_precision);
+		} break;
+		case Variant::TRANSFORM3D: {
+			write_components<Transform3D, real_t>(p_writer, p_value.operator Transform3D(), real_precision);
+		} break;
+		case Variant::PROJECTION: {
+			write_components<Projection, real_t>(p_writer, p_value.operator Projection(), real_precision);
+		} break;
+		case Variant::COLOR: {
+			write_components<Color, float>(p_writer, p_value.operator Color(), color_precision);
+		} break;
+		default: {
+			int len = 0;
+			Error err = encode_variant(p_value, nullptr, len, false);
+			ERR_FAIL_COND_V(err != OK, err);
+			p_writer.write(len, 32);
+			encode_variant(p_value, p_writer.write_bytes(len), len, false);
+		} break;
+	}
+	return OK;
+}
+
+Error write_value(BitWriter &p_writer, const Variant &p_value, bool p_quantize) {
+	p_writer.write(p_value.get_type(), 6);
+	return write_payload(p_writer, p_value, p_quantize);
+}
+
+bool read_payload(BitReader &p_reader, Variant::Type p_type, Variant &r_value) {
+	switch (p_type) {
+		case Variant::NIL: {
+			r_value = Variant();
+		} break;
+		case Variant::BOOL: {
+			uint64_t value = 0;
+			if (!p_reader.read(1, value)) {
+				return false;
+			}
+			r_value = value != 0;
+		} break;
+		case Variant::INT: {
+			uint64_t wide = 0;
+			uint64_t value = 0;
+			if (!p_reader.read(1, wide) || !p_reader.read(wide ? 64 : 32, value)) {
+				return false;
+			}
+			r_value = wide ? int64_t(value) : int64_t(int32_t(uint32_t(value)));
+		} break;
+		case Variant::FLOAT: {
+			uint64_t precision = 0;
+			double value = 0;
+			if (!p_reader.read(2, precision) || precision > PRECISION_DOUBLE || !read_real(p_reader, RealPrecision(precision), value)) {
+				return false;
+			}
+			r_value = value;
+		} break;
+		case Variant::VECTOR2:
+			return read_components<Vector2, real_t>(p_reader, r_value);
+		case Variant::VECTOR2I:
+			return read_int_components<Vector2i>(p_reader, r_value);
+		case Variant::RECT2:
+			return read_components<Rect2, real_t>(p_reader, r_value);
+		case Variant::RECT2I:
+			return read_int_components<Rect2i>(p_reader, r_value);
+		case Variant::VECTOR3:
+			return read_components<Vector3, real_t>(p_reader, r_value);
+		case Variant::VECTOR3I:
+			return read_int_components<Vector3i>(p_reader, r_value);
+		case Variant::TRANSFORM2D:
+			return read_components<Transform2D, real_t>(p_reader, r_value);
+		case Variant::VECTOR4:
+			return read_components<Vector4, real_t>(p_reader, r_value);
+		case Variant::VECTOR4I:
+			return read_int_components<Vector4i>(p_reader, r_value);
+		case Variant::PLANE:
+			return read_components<Plane, real_t>(p_reader, r_value);
+		case Variant::QUATERNION:
+			return read_components<Quaternion, real_t>(p_reader, r_value);
+		case Variant::AABB:
+			return read_components<::AABB, real_t>(p_reader, r_value);
+		case Variant::BASIS:
+			return read_components<Basis, real_t>(p_reader, r_value);
+		case Variant::TRANSFORM3D:
+			return read_components<Transform3D, real_t>(p_reader, r_value);
+		case Variant::PROJECTION:
+			return read_components<Projection, real_t>(p_reader, r_value);
+		case Variant::COLOR:
+			return read_components<Color, float>(p_reader, r_value);
+		default: {
+			uint64_t len = 0;
+			if (!p_reader.read(32, len)) {
+				return false;
+			}
+			const uint8_t *data = p_reader.read_bytes(len);
+			if (!data) {
+				return false;
+			}
+			int consumed = 0;
+			if (decode_variant(r_value, data, len, &consumed, false) != OK || uint64_t(consumed) != len || r_value.get_type() != p_type) {
+				return false;
+			}
+		} break;
+	}
+	return true;
+}
+
+bool read_value(BitReader &p_reader, Variant &r_value) {
+	uint64_t type = 0;
+	if (!p_reader.read(6, type) || type >= Variant::VARIANT_MAX) {
+		return false;
+	}
+	return read_payload(p_reader, Variant::Type(type), r_value);
+}
+
+} // namespace
+
+SafeNumeric<uint64_t> SceneReplicationSchema::last_version;
+
+void SceneReplicationSchema::clear() {
+	fields.clear();
+	version = last_version.increment();
+}
+
+void SceneReplicationSchema::add_field(const NodePath &p_path, bool p_quantize) {
+	Field field;
+	field.path = p_path;
+	if (p_path.get_name_count() > 0) {
+		field.node_path = NodePath(p_path.get_names(), p_path.is_absolute());
+	}
+	field.subnames = p_path.get_subnames();
+	field.quantize = p_quantize;
+	fields.push_back(field);
+	version = last_version.increment();
+}
+
+void SceneReplicationSchema::_prepare_bindings(Bindings &r_bindings) const {
+	if (r_bindings.version == version) {
+		return;
+	}
+	r_bindings.version = version;
+	r_bindings.fields.clear();
+	r_bindings.fields.resize(fields.size());
+}
+
+Object *SceneReplicationSchema::_get_target(Node *p_root, uint32_t p_field, Bindings &r_bindings) const {
+	const Field &field = fields[p_field];
+	Object *target = p_root;
+	if (!field.node_path.is_empty()) {
+		target = p_root->get_node_or_null(field.node_path);
+		if (!target) {
+			return nullptr;
+		}
+	}
+
+	Bindings::Binding &binding = r_bindings.fields[p_field];
+	const ScriptInstance *script_instance = target->get_script_instance();
+	if (binding.target == target->get_instance_id() && binding.script_instance == script_instance) {
+		return target;
+	}
+
+	binding.target = target->get_instance_id();
+	binding.script_instance = script_instance;
+	binding.getter = nullptr;
+	binding.setter = nullptr;
+
+	// Plain native properties are accessed through their method binds. Anything else, including properties
+	// a script may intercept with _get() or _set(), goes through Object::get_indexed() and Object::set_indexed().
+	// Extension classes can be unloaded, so their methods are never cached.
+	const StringName &class_name = target->get_class_name();
+	ClassDB::APIType api = ClassDB::get_api_type(class_name);
+	if (field.subnames.size() != 1 || api == ClassDB::API_EXTENSION || api == ClassDB::API_EDITOR_EXTENSION) {
+		return target;
+	}
+	bool is_valid = false;
+	const StringName &property = field.subnames[0];
+	if (ClassDB::get_property_index(class_name, property, &is_valid) != -1 || !is_valid) {
+		return target;
+	}
+	if (!script_instance || !script_instance->has_method(SNAME("_get"))) {
+		binding.getter = ClassDB::get_method(class_name, ClassDB::get_property_getter(class_name, property));
+	}
+	if (!script_instance || !script_instance->has_method(SNAME("_set"))) {
+		binding.setter = ClassDB::get_method(class_name, ClassDB::get_property_setter(class_name, property));
+	}
+	return target;
+}
+
+Error SceneReplicationSchema::get_value(Node *p_root, uint32_t p_field, Bindings &r_bindings, Variant &r_value) const {
+	ERR_FAIL_NULL_V(p_root, ERR_INVALID_PARAMETER);
+	ERR_FAIL_UNSIGNED_INDEX_V(p_field, fields.size(), ERR_INVALID_PARAMETER);
+	_prepare_bindings(r_bindings);
+
+	Object *target = _get_target(p_root, p_field, r_bindings);
+	ERR_FAIL_NULL_V_MSG(target, FAILED, vformat("Node not found for property '%s'.", fields[p_field].path));
+
+	MethodBind *getter = r_bindings.fields[p_field].getter;
+	if (getter) {
+		Callable::CallError ce;
+		r_value = getter->call(target, nullptr, 0, ce);
+		ERR_FAIL_COND_V_MSG(ce.error != Callable::CallError::CALL_OK, ERR_INVALID_DATA, vformat("Property '%s' not found.", fields[p_field].path));
+		return OK;
+	}
+
+	bool valid = false;
+	r_value = target->get_indexed(fields[p_field].subnames, &valid);
+	ERR_FAIL_COND_V_MSG(!valid, ERR_INVALID_DATA, vformat("Property '%s' not found.", fields[p_field].path));
+	return OK;
+}
+
+Error SceneReplicationSchema::set_value(Node *p_root, uint32_t p_field, Bindings &r_bindings, const Variant &p_value) const {
+	ERR_FAIL_NULL_V(p_root, ERR_INVALID_PARAMETER);
+	ERR_FAIL_UNSIGNED_INDEX_V(p_field, fields.size(), ERR_INVALID_PARAMETER);
+	_prepare_bindings(r_bindings);
+
+	Object *target = _get_target(p_root, p_field, r_bindings);
+	ERR_FAIL_NULL_V_MSG(target, FAILED, vformat("Node not found for property '%s'.", fields[p_field].path));
+
+	MethodBind *setter = r_bindings.fields[p_field].setter;
+	if (setter) {
+		// Like Object::set_indexed(), values that can't be assigned are ignored.
+		const Variant *args[1] = { &p_value };
+		Callable::CallError ce;
+		setter->call(target, args, 1, ce);
+		return OK;
+	}
+
+	target->set_indexed(fields[p_field].subnames, p_value);
+	return OK;
+}
+
+Error SceneReplicationSchema::encode_state(Node *p_root, Bindings &r_bindings, LocalVector<uint8_t> &r_buffer) const {
+	r_buffer.clear();
+	BitWriter writer(r_buffer);
+	Variant value;
+	for (uint32_t i = 0; i < fields.size(); i++) {
+		Error err = get_value(p_root, i, r_bindings, value);
+		ERR_FAIL_COND_V(err != OK, err);
+		err = write_value(writer, value, fields[i].quantize);
+		ERR_FAIL_COND_V(err != OK, err);
+	}
+	return OK;
+}
+
+Error SceneReplicationSchema::encode_values(const List<Variant> &p_values, uint64_t p_indexes, LocalVector<uint8_t> &r_buffer) const {
+	r_buffer.clear();
+	BitWriter writer(r_buffer);
+	const List<Variant>::Element *E = p_values.front();
+	for (uint32_t i = 0; i < fields.size() && i < 64; i++) {
+		if (!(p_indexes & (1ULL << i))) {
+			continue;
+		}
+		ERR_FAIL_NULL_V(E, ERR_INVALID_PARAMETER);
+		Error err = write_value(writer, E->get(), fields[i].quantize);
+		ERR_FAIL_COND_V(err != OK, err);
+		E = E->next();
+	}
+	ERR_FAIL_COND_V(E, ERR_INVALID_PARAMETER);
+	return OK;
+}
+
+Error SceneReplicationSchema::_decode(Node *p_root, Bindings &r_bindings, bool p_all, uint64_t p_indexes, const uint8_t *p_buffer, int p_size) const {
+	ERR_FAIL_NULL_V(p_root, ERR_INVALID_PARAMETER);
+	ERR_FAIL_COND_V(p_size < 0, ERR_INVALID_PARAMETER);
+	_prepare_bindings(r_bindings);
+
+	BitReader reader(p_buffer, p_size);
+	r_bindings.values.resize(fields.size());
+	for (uint32_t i = 0; i < fields.size(); i++) {
+		if (!p_all && (i >= 64 || !(p_indexes & (1ULL << i)))) {
+			continue;
+		}
+		ERR_FAIL_COND_V_MSG(!read_value(reader, r_bindings.values[i]), ERR_INVALID_DATA, "Invalid replication state received.");
+	}
+	ERR_FAIL_COND_V_MSG(reader.get_bytes_read() != uint32_t(p_size), ERR_INVALID_DATA, "Invalid replication state received.");
+
+	for (uint32_t i = 0; i < fields.size(); i++) {
+		if (!p_all && (i >= 64 || !(p_indexes & (1ULL << i)))) {
+			continue;
+		}
+		Error err = set_value(p_root, i, r_bindings, r_bindings.values[i]);
+		r_bindings.values[i] = Variant();
+		ERR_FAIL_COND_V(err != OK, err);
+	}
+	return OK;
+}
+
+Error SceneReplicationSchema::decode_state(Node *p_root, Bindings &r_bindings, const uint8_t *p_buffer, int p_size) const {
+	return _decode(p_root, r_bindings, true, 0, p_buffer, p_size);
+}
+
+Error SceneReplicationSchema::decode_values(Node *p_root, Bindings &r_bindings, uint64_t p_indexes, const uint8_t *p_buffer, int p_size) const {
+	ERR_FAIL_COND_V(p_indexes == 0, ERR_INVALID_DATA);
+	ERR_FAIL_COND_V(fields.size() < 64 && (p_indexes >> fields.size()) != 0, ERR_INVALID_DATA);
+	return _decode(p_root, r_bindings, false, p_indexes, p_buffer, p_size);
+}
+
+Error SceneReplicationSchema::encode_arguments(const Variant **p_args, int p_argcount, const Variant::Type *p_types, int p_type_count, LocalVector<uint8_t> &r_buffer) {
+	r_buffer.clear();
+	BitWriter writer(r_buffer);
+	for (int i = 0; i < p_argcount; i++) {
+		const Variant &arg = *p_args[i];
+		const Variant::Type expected = i < p_type_count ? p_types[i] : Variant::NIL;
+		Error err = OK;
+		if (expected == Variant::NIL) {
+			err = write_value(writer, arg, false);
+		} else if (arg.get_type() == expected) {
+			writer.write(1, 1);
+			err = write_payload(writer, arg, false);
+		} else {
+			writer.write(0, 1);
+			err = write_value(writer, arg, false);
+		}
+		ERR_FAIL_COND_V(err != OK, err);
+	}
+	return OK;
+}
+
+Error SceneReplicationSchema::decode_arguments(const uint8_t *p_buffer, int p_size, const Variant::Type *p_types, int p_type_count, Vector<Variant> &r_args) {
+	ERR_FAIL_COND_V(p_size < 0, ERR_INVALID_PARAMETER);
+	BitReader reader(p_buffer, p_size);
+	Variant *args = r_args.ptrw();
+	for (int i = 0; i < r_args.size(); i++) {
+		const Variant::Type expected = i < p_type_count ? p_types[i] : Variant::NIL;
+		bool valid = false;
+		if (expected == Variant::NIL) {
+			valid = read_value(reader, args[i]);
+		} else {
+			uint64_t matches = 0;
+			valid = reader.read(1, matches) && (matches ? read_payload(reader, expected, args[i]) : read_value(reader, args[i]));
+		}
+		ERR_FAIL_COND_V_MSG(!valid, ERR_INVALID_DATA, "Invalid RPC arguments received.");
+	}
+	ERR_FAIL_COND_V_MSG(reader.get_bytes_read() != uint32_t(p_size), ERR_INVALID_DATA, "Invalid RPC arguments received.");
+	return OK;
+}
+
+void SceneReplicationSchema::encode_snapshot_delta(const uint8_t *p_state, const uint8_t *p_baseline, uint32_t p_size, LocalVector<uint8_t> &r_delta) {
+	// Each run starts with a byte: 0x80 | (count - 1) for runs of unchanged bytes, count - 1 for runs of changed ones.
+	r_delta.clear();
+	uint32_t end = p_size;
+	while (end > 0 && p_state[end - 1] == p_baseline[end - 1]) {
+		end--;
+	}
+	uint32_t i = 0;
+	while (i < end) {
+		const uint32_t start = i;
+		if (p_state[i] == p_baseline[i]) {
+			while (i < end && i - start < 128 && p_state[i] == p_baseline[i]) {
+				i++;
+			}
+			r_delta.push_back(0x80 | (i - start - 1));
+		} else {
+			while (i < end && i - start < 128 && p_state[i] != p_baseline[i]) {
+				i++;
+			}
+			r_delta.push_back(i - start - 1);
+			for (uint32_t j = start; j < i; j++) {
+				r_delta.push_back(p_state[j] ^ p_baseline[j]);
+			}
+		}
+	}
+}
+
+Error SceneReplicationSchema::decode_snapshot_delta(const uint8_t *p_delta, uint32_t p_delta_size, const uint8_t *p_baseline, uint32_t p_size, LocalVector<uint8_t> &r_state) {
+	r_state.resize(p_size);
+	uint8_t *state = r_state.ptr();
+	uint32_t ofs = 0;
+	uint32_t i = 0;
+	while (i < p_delta_size) {
+		const uint8_t run = p_delta[i++];
+		const uint32_t count = (run & 0x7F) + 1;
+		ERR_FAIL_COND_V(ofs + count > p_size, ERR_INVALID_DATA);
+		if (run & 0x80) {
+			memcpy(state + ofs, p_baseline + ofs, count);
+		} else {
+			ERR_FAIL_COND_V(i + count > p_delta_size, ERR_INVALID_DATA);
+			for (uint32_t j = 0; j < count; j++) {
+				state[ofs + j] = p_baseline[ofs + j] ^ p_delta[i + j];
+			}
+			i += count;
+		}
+		ofs += count;
+	}
+	if (ofs < p_size) {
+		memcpy(state + ofs, p_baseline + ofs, p_size - ofs);
+	}
+	return OK;
+}
@@ -0,0 +1,113 @@
+/**************************************************************************/
+/*  scene_replication_schema.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef SCENE_REPLICATION_SCHEMA_H
+#define SCENE_REPLICATION_SCHEMA_H
+
+#include "core/object/object_id.h"
+#include "core/string/node_path.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
+#include "core/variant/variant.h"
+
+class MethodBind;
+class Node;
+class ScriptInstance;
+
+// A list of replicated properties, compiled by SceneReplicationConfig, used to encode and decode
+// synchronizer states without going through an array of Variants.
+//
+// States are written as a bit stream. Each value is prefixed by its 6-bit type instead of a full
+// Variant header: booleans take a single bit, numbers and math types are written as fixed-width
+// components, and other types fall back to encode_variant(). Floating-point components of quantized
+// properties are sent as half floats.
+class SceneReplicationSchema {
+public:
+	struct Field {
+		NodePath path;
+		NodePath node_path; // Path to the node owning the property, empty for the root node.
+		Vector<StringName> subnames;
+		bool quantize = false;
+	};
+
+	// Targets and accessors resolved for each field, cached by each synchronizer for its root node.
+	struct Bindings {
+		struct Binding {
+			ObjectID target;
+			const ScriptInstance *script_instance = nullptr;
+			MethodBind *getter = nullptr;
+			MethodBind *setter = nullptr;
+		};
+
+		uint64_t version = 0;
+		LocalVector<Binding> fields;
+		LocalVector<Variant> values; // Decoded values, reused between states.
+	};
+
+private:
+	static SafeNumeric<uint64_t> last_version;
+
+	LocalVector<Field> fields;
+	uint64_t version = 0;
+
+	void _prepare_bindings(Bindings &r_bindings) const;
+	Object *_get_target(Node *p_root, uint32_t p_field, Bindings &r_bindings) const;
+	Error _decode(Node *p_root, Bindings &r_bindings, bool p_all, uint64_t p_indexes, const uint8_t *p_buffer, int p_size) const;
+
+public:
+	void clear();
+	void add_field(const NodePath &p_path, bool p_quantize);
+
+	uint32_t get_field_count() const { return fields.size(); }
+	const Field &get_field(uint32_t p_field) const { return fields[p_field]; }
+
+	Error get_value(Node *p_root, uint32_t p_field, Bindings &r_bindings, Variant &r_value) const;
+	Error set_value(Node *p_root, uint32_t p_field, Bindings &r_bindings, const Variant &p_value) const;
+
+	// Encodes the current value of every field.
+	Error encode_state(Node *p_root, Bindings &r_bindings, LocalVector<uint8_t> &r_buffer) const;
+	// Encodes the given values, one for each field set in p_indexes.
+	Error encode_values(const List<Variant> &p_values, uint64_t p_indexes, LocalVector<uint8_t> &r_buffer) const;
+	// Decodes the values written by the methods above, and apply them once they are all valid.
+	Error decode_state(Node *p_root, Bindings &r_bindings, const uint8_t *p_buffer, int p_size) const;
+	Error decode_values(Node *p_root, Bindings &r_bindings, uint64_t p_indexes, const uint8_t *p_buffer, int p_size) const;
+
+	// RPC arguments, using the same encoding. Arguments matching the declared type of their parameter
+	// (when not NIL) are written after a single bit instead of their type.
+	static Error encode_arguments(const Variant **p_args, int p_argcount, const Variant::Type *p_types, int p_type_count, LocalVector<uint8_t> &r_buffer);
+	static Error decode_arguments(const uint8_t *p_buffer, int p_size, const Variant::Type *p_types, int p_type_count, Vector<Variant> &r_args);
+
+	// Snapshot deltas: the bytes of a state XORed with a previous state of the same size, with runs of zeros packed.
+	// Trailing zeros are omitted, so an unchanged state has an empty delta.
+	static void encode_snapshot_delta(const uint8_t *p_state, const uint8_t *p_baseline, uint32_t p_size, LocalVector<uint8_t> &r_delta);
+	static Error decode_snapshot_delta(const uint8_t *p_delta, uint32_t p_delta_size, const uint8_t *p_baseline, uint32_t p_size, LocalVector<uint8_t> &r_state);
+};
+
+#endif // SCENE_REPLICATION_SCHEMA_H
@@ -31,9 +31,11 @@
 #include "scene_rpc_interface.h"
 
 #include "scene_multiplayer.h"
+#include "scene_replication_schema.h"
 
 #include "core/debugger/engine_debugger.h"
 #include "core/io/marshalls.h"
+#include "core/object/script_language.h"
 #include "scene/main/multiplayer_api.h"
 #include "scene/main/node.h"
 #include "scene/main/window.h"
@@ -51,6 +53,12 @@
 #define NAME_ID_COMPRESSION_FLAG (1 << NAME_ID_COMPRESSION_SHIFT)
 #define BYTE_ONLY_OR_NO_ARGS_FLAG (1 << BYTE_ONLY_OR_NO_ARGS_SHIFT)
 
+// Each RPC in a batch is prefixed by a 16-bit header: its size in the lower 15 bits (or BATCH_SIZE_ESCAPE,
+// followed by a 32-bit size, for larger RPCs), and whether its arguments use the compact encoding in the MSB.
+#define BATCH_SIZE_MASK 0x7FFF
+#define BATCH_SIZE_ESCAPE 0x7FFF
+#define BATCH_COMPACT_ARGS_FLAG 0x8000
+
 #ifdef DEBUG_ENABLED
 _FORCE_INLINE_ void SceneRPCInterface::_profile_node_data(const String &p_what, ObjectID p_id, int p_size) {
 	if (EngineDebugger::is_profiling("multiplayer:rpc")) {
@@ -112,6 +120,21 @@ const SceneRPCInterface::RPCConfigCache &SceneRPCInterface::_get_node_config(con
 	if (p_node->get_script_instance()) {
 		_parse_rpc_config(p_node->get_script_instance()->get_rpc_config(), false, cache);
 	}
+	// Cache the declared argument types, used by the compact argument encoding.
+	for (KeyValue<uint16_t, RPCConfig> &E : cache.configs) {
+		MethodInfo info;
+		if (E.key & (1 << 15)) {
+			ClassDB::get_method_info(p_node->get_class_name(), E.value.name, &info);
+		} else {
+			Ref<Script> script = p_node->get_script_instance()->get_script();
+			if (script.is_valid()) {
+				info = script->get_method_info(E.value.name);
+			}
+		}
+		for (const PropertyInfo &arg : info.arguments) {
+			E.value.arg_types.push_back(arg.type);
+		}
+	}
 	rpc_cache[oid] = cache;
 	return rpc_cache[oid];
 }
@@ -155,7 +178,7 @@ Node *SceneRPCInterface::_process_get_node(int p_from, const uint8_t *p_packet,
 	}
 }
 
-void SceneRPCInterface::process_rpc(int p_from, const uint8_t *p_packet, int p_packet_len) {
+void SceneRPCInterface::process_rpc(int p_from, const uint8_t *p_packet, int p_packet_len, bool p_compact_args) {
 	// Extract packet meta
 	int packet_min_size = 1;
 	int name_id_offset = 1;
@@ -225,10 +248,38 @@ void SceneRPCInterface::process_rpc(int p_from, const uint8_t *p_packet, int p_p
 	}
 
 	const int packet_len = get_packet_len(node_target, p_packet_len);
-	_process_rpc(node, name_id, p_from, p_packet, packet_len, packet_min_size);
+	_process_rpc(node, name_id, p_from, p_packet, packet_len, packet_min_size, p_compact_args);
+}
+
+void SceneRPCInterface::process_batch(int p_from, const uint8_t *p_packet, int p_packet_len) {
+	ERR_FAIL_COND_MSG(p_packet_len < SceneMultiplayer::SYS_CMD_SIZE, "Invalid packet received. Size too small.");
+	const uint32_t count = decode_uint32(&p_packet[2]);
+	int ofs = SceneMultiplayer::SYS_CMD_SIZE;
+	for (uint32_t i = 0; i < count; i++) {
+		ERR_FAIL_COND_MSG(ofs + 2 > p_packet_len, "Invalid RPC batch received. Size too small.");
+		const uint16_t header = decode_uint16(&p_packet[ofs]);
+		ofs += 2;
+		uint32_t size = header & BATCH_SIZE_MASK;
+		if (size == BATCH_SIZE_ESCAPE) {
+			ERR_FAIL_COND_MSG(ofs + 4 > p_packet_len, "Invalid RPC batch received. Size too small.");
+			size = decode_uint32(&p_packet[ofs]);
+			ofs += 4;
+		}
+		ERR_FAIL_COND_MSG(size == 0 || size > uint32_t(p_packet_len - ofs), "Invalid RPC batch received. Size too small.");
+		ERR_FAIL_COND_MSG((p_packet[ofs] & SceneMultiplayer::CMD_MASK) != SceneMultiplayer::NETWORK_COMMAND_REMOTE_CALL, "Invalid RPC batch received. Unexpected command.");
+		process_rpc(p_from, &p_packet[ofs], size, header & BATCH_COMPACT_ARGS_FLAG);
+		ofs += size;
+
+		// Calls might have closed the connection.
+		Ref<MultiplayerPeer> peer = multiplayer->get_multiplayer_peer();
+		if (peer.is_null() || peer->get_connection_status() != MultiplayerPeer::CONNECTION_CONNECTED) {
+			return;
+		}
+	}
+	ERR_FAIL_COND_MSG(ofs != p_packet_len, "Invalid RPC batch received. Size mismatch.");
 }
 
-void SceneRPCInterface::_process_rpc(Node *p_node, const uint16_t p_rpc_method_id, int p_from, const uint8_t *p_packet, int p_packet_len, int p_offset) {
+void SceneRPCInterface::_process_rpc(Node *p_node, const uint16_t p_rpc_method_id, int p_from, const uint8_t *p_packet, int p_packet_len, int p_offset, bool p_compact_args) {
 	ERR_FAIL_COND_MSG(p_offset > p_packet_len, "Invalid packet received. Size too small.");
 
 	// Check that remote can call the RPC on this node.
@@ -275,8 +326,13 @@ void SceneRPCInterface::_process_rpc(Node *p_node, const uint16_t p_rpc_method_i
 	_profile_node_data("rpc_in", p_node->get_instance_id(), p_packet_len);
 #endif
 
-	int out;
-	MultiplayerAPI::decode_and_decompress_variants(args, &p_packet[p_offset], p_packet_len - p_offset, out, byte_only_or_no_args, multiplayer->is_object_decoding_allowed());
+	if (p_compact_args) {
+		Error err = SceneReplicationSchema::decode_arguments(&p_packet[p_offset], p_packet_len - p_offset, config.arg_types.ptr(), config.arg_types.size(), args);
+		ERR_FAIL_COND_MSG(err != OK, "Invalid packet received. Unable to decode RPC arguments.");
+	} else {
+		int out;
+		MultiplayerAPI::decode_and_decompress_variants(args, &p_packet[p_offset], p_packet_len - p_offset, out, byte_only_or_no_args, multiplayer->is_object_decoding_allowed());
+	}
 	for (int i = 0; i < argc; i++) {
 		argp.write[i] = &args[i];
 	}
@@ -334,6 +390,18 @@ void SceneRPCInterface::_send_rpc(Node *p_node, int p_to, uint16_t p_rpc_id, con
 		return; // No one in sight.
 	}
 
+	// Arguments can use the compact encoding when the RPC is batched for every target, since the flag
+	// is part of the batch entry. Objects are never encoded this way, and byte-only calls are already tight.
+	bool compact_args = batching && !multiplayer->is_object_decoding_allowed() && p_argcount > 0 && !(p_argcount == 1 && p_arg[0]->get_type() == Variant::PACKED_BYTE_ARRAY);
+	if (compact_args) {
+		for (const int P : targets) {
+			if (multiplayer->is_relayed(P)) {
+				compact_args = false;
+				break;
+			}
+		}
+	}
+
 	// Create base packet, lots of hardcode because it must be tight.
 	int ofs = 0;
 
@@ -397,19 +465,29 @@ void SceneRPCInterface::_send_rpc(Node *p_node, int p_to, uint16_t p_rpc_id, con
 		ofs += 2;
 	}
 
-	int len;
-	Error err = MultiplayerAPI::encode_and_compress_variants(p_arg, p_argcount, nullptr, len, &byte_only_or_no_args, multiplayer->is_object_decoding_allowed());
-	ERR_FAIL_COND_MSG(err != OK, "Unable to encode RPC arguments. THIS IS LIKELY A BUG IN THE ENGINE!");
-	if (byte_only_or_no_args) {
-		MAKE_ROOM(ofs + len);
-	} else {
-		MAKE_ROOM(ofs + 1 + len);
+	if (compact_args) {
+		Error err = SceneReplicationSchema::encode_arguments(p_arg, p_argcount, p_config.arg_types.ptr(), p_config.arg_types.size(), args_cache);
+		ERR_FAIL_COND_MSG(err != OK, "Unable to encode RPC arguments. THIS IS LIKELY A BUG IN THE ENGINE!");
+		MAKE_ROOM(ofs + 1 + (int)args_cache.size());
 		packet_cache.write[ofs] = p_argcount;
 		ofs += 1;
-	}
-	if (len) {
-		MultiplayerAPI::encode_and_compress_variants(p_arg, p_argcount, &packet_cache.write[ofs], len, &byte_only_or_no_args, multiplayer->is_object_decoding_allowed());
-		ofs += len;
+		memcpy(&packet_cache.write[ofs], args_cache.ptr(), args_cache.size());
+		ofs += args_cache.size();
+	} else {
+		int len;
+		Error err = MultiplayerAPI::encode_and_compress_variants(p_arg, p_argcount, nullptr, len, &byte_only_or_no_args, multiplayer->is_object_decoding_allowed());
+		ERR_FAIL_COND_MSG(err != OK, "Unable to encode RPC arguments. THIS IS LIKELY A BUG IN THE ENGINE!");
+		if (byte_only_or_no_args) {
+			MAKE_ROOM(ofs + len);
+		} else {
+			MAKE_ROOM(ofs + 1 + len);
+			packet_cache.write[ofs] = p_argcount;
+			ofs += 1;
+		}
+		if (len) {
+			MultiplayerAPI::encode_and_compress_variants(p_arg, p_argcount, &packet_cache.write[ofs], len, &byte_only_or_no_args, multiplayer->is_object_decoding_allowed());
+			ofs += len;
+		}
 	}
 
 	ERR_FAIL_COND(command_type > 7);
@@ -429,7 +507,7 @@ void SceneRPCInterface::_send_rpc(Node *p_node, int p_to, uint16_t p_rpc_id, con
 
 	if (has_all_peers) {
 		for (const int P : targets) {
-			multiplayer->send_command(P, packet_cache.ptr(), ofs);
+			_send_packet(P, p_config, packet_cache.ptr(), ofs, compact_args);
 		}
 	} else {
 		// Unreachable because the node ID is never compressed if the peers doesn't know it.
@@ -449,16 +527,126 @@ void SceneRPCInterface::_send_rpc(Node *p_node, int p_to, uint16_t p_rpc_id, con
 			if (confirmed) {
 				// This one confirmed path, so use id.
 				encode_uint32(psc_id, &(packet_cache.write[1]));
-				multiplayer->send_command(P, packet_cache.ptr(), ofs);
+				_send_packet(P, p_config, packet_cache.ptr(), ofs, compact_args);
 			} else {
 				// This one did not confirm path yet, so use entire path (sorry!).
 				encode_uint32(0x80000000 | ofs, &(packet_cache.write[1])); // Offset to path and flag.
-				multiplayer->send_command(P, packet_cache.ptr(), ofs + path_len);
+				_send_packet(P, p_config, packet_cache.ptr(), ofs + path_len, compact_args);
 			}
 		}
 	}
 }
 
+void SceneRPCInterface::_send_packet(int p_to, const RPCConfig &p_config, const uint8_t *p_packet, int p_packet_len, bool p_compact_args) {
+	if (!batching || multiplayer->is_relayed(p_to)) {
+		// Relayed RPCs are sent right away, the server would have to split the batch.
+		multiplayer->send_command(p_to, p_packet, p_packet_len);
+		return;
+	}
+
+	const uint64_t key = (uint64_t(uint32_t(p_to)) << 32) | (uint64_t(uint32_t(p_config.channel) & 0xFFFFFF) << 8) | uint64_t(p_config.transfer_mode);
+	RPCBatch *batch = batches.getptr(key);
+	if (!batch) {
+		batch = &batches.insert(key, RPCBatch())->value;
+		batch->peer = p_to;
+		batch->channel = p_config.channel;
+		batch->transfer_mode = p_config.transfer_mode;
+		batch->data.resize(SceneMultiplayer::SYS_CMD_SIZE);
+		batch->data[0] = SceneMultiplayer::NETWORK_COMMAND_SYS;
+		batch->data[1] = SceneMultiplayer::SYS_COMMAND_BATCH;
+	}
+
+	// Unreliable batches must fit in a single datagram, like sync packets.
+	const int header_size = p_packet_len < BATCH_SIZE_ESCAPE ? 2 : 6;
+	const int limit = batch->transfer_mode == MultiplayerPeer::TRANSFER_MODE_RELIABLE ? multiplayer->get_max_delta_packet_size() : multiplayer->get_max_sync_packet_size();
+	if (batch->count && int(batch->data.size()) + header_size + p_packet_len > limit) {
+		_send_batch(*batch);
+	}
+
+	const uint32_t ofs = batch->data.size();
+	batch->data.resize(ofs + header_size + p_packet_len);
+	encode_uint16((p_compact_args ? BATCH_COMPACT_ARGS_FLAG : 0) | MIN(p_packet_len, BATCH_SIZE_ESCAPE), &batch->data[ofs]);
+	if (header_size > 2) {
+		encode_uint32(p_packet_len, &batch->data[ofs + 2]);
+	}
+	memcpy(&batch->data[ofs + header_size], p_packet, p_packet_len);
+	batch->count++;
+	batch->compact = batch->compact || p_compact_args;
+	batched_rpcs++;
+}
+
+void SceneRPCInterface::_send_batch(RPCBatch &p_batch) {
+	if (p_batch.count == 0) {
+		return;
+	}
+	Ref<MultiplayerPeer> peer = multiplayer->get_multiplayer_peer();
+	peer->set_transfer_channel(p_batch.channel);
+	peer->set_transfer_mode(p_batch.transfer_mode);
+
+	// Don't flush batches again while sending this one.
+	const bool was_flushing = flushing;
+	flushing = true;
+	if (p_batch.count == 1 && !p_batch.compact) {
+		// A single RPC is sent as is.
+		uint32_t ofs = SceneMultiplayer::SYS_CMD_SIZE;
+		ofs += (decode_uint16(&p_batch.data[ofs]) & BATCH_SIZE_MASK) == BATCH_SIZE_ESCAPE ? 6 : 2;
+		multiplayer->send_command(p_batch.peer, &p_batch.data[ofs], p_batch.data.size() - ofs);
+	} else {
+		encode_uint32(p_batch.count, &p_batch.data[2]);
+		multiplayer->send_command(p_batch.peer, p_batch.data.ptr(), p_batch.data.size());
+	}
+	flushing = was_flushing;
+
+	batched_rpcs -= p_batch.count;
+	p_batch.count = 0;
+	p_batch.compact = false;
+	p_batch.data.resize(SceneMultiplayer::SYS_CMD_SIZE);
+}
+
+void SceneRPCInterface::set_batching_enabled(bool p_enabled) {
+	if (batching && !p_enabled) {
+		flush_batches();
+	}
+	batching = p_enabled;
+}
+
+void SceneRPCInterface::flush_batches() {
+	if (!has_batches()) {
+		return;
+	}
+	// Might be called before sending another command, restore its transfer mode.
+	Ref<MultiplayerPeer> peer = multiplayer->get_multiplayer_peer();
+	ERR_FAIL_COND(peer.is_null());
+	const int channel = peer->get_transfer_channel();
+	const MultiplayerPeer::TransferMode mode = peer->get_transfer_mode();
+	for (KeyValue<uint64_t, RPCBatch> &E : batches) {
+		_send_batch(E.value);
+	}
+	peer->set_transfer_channel(channel);
+	peer->set_transfer_mode(mode);
+}
+
+void SceneRPCInterface::clear_batches() {
+	batches.clear();
+	batched_rpcs = 0;
+}
+
+void SceneRPCInterface::on_peer_change(int p_id, bool p_connected) {
+	if (p_connected) {
+		return;
+	}
+	LocalVector<uint64_t> to_erase;
+	for (const KeyValue<uint64_t, RPCBatch> &E : batches) {
+		if (E.value.peer == p_id) {
+			batched_rpcs -= E.value.count;
+			to_erase.push_back(E.key);
+		}
+	}
+	for (const uint64_t &key : to_erase) {
+		batches.erase(key);
+	}
+}
+
 Error SceneRPCInterface::rpcp(Object *p_obj, int p_peer_id, const StringName &p_method, const Variant **p_arg, int p_argcount) {
 	Ref<MultiplayerPeer> peer = multiplayer->get_multiplayer_peer();
 	ERR_FAIL_COND_V_MSG(!peer.is_valid(), ERR_UNCONFIGURED, "Trying to call an RPC while no multiplayer peer is active.");
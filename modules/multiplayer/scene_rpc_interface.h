@@ -49,6 +49,7 @@ private:
 		bool call_local = false;
 		MultiplayerPeer::TransferMode transfer_mode = MultiplayerPeer::TRANSFER_MODE_RELIABLE;
 		int channel = 0;
+		LocalVector<Variant::Type> arg_types; // Declared parameter types, NIL when untyped.
 
 		bool operator==(RPCConfig const &p_other) const {
 			return name == p_other.name;
@@ -78,6 +79,17 @@ private:
 		NETWORK_NAME_ID_COMPRESSION_16,
 	};
 
+	// RPCs waiting to be sent to a peer on a given channel and transfer mode, coalesced into a single
+	// SYS_COMMAND_BATCH packet. Each entry is prefixed by its size, whose MSB flags compact arguments.
+	struct RPCBatch {
+		int peer = 0;
+		int channel = 0;
+		MultiplayerPeer::TransferMode transfer_mode = MultiplayerPeer::TRANSFER_MODE_RELIABLE;
+		uint32_t count = 0;
+		bool compact = false;
+		LocalVector<uint8_t> data;
+	};
+
 	SceneMultiplayer *multiplayer = nullptr;
 	SceneCacheInterface *multiplayer_cache = nullptr;
 	SceneReplicationInterface *multiplayer_replicator = nullptr;
@@ -86,14 +98,22 @@ private:
 
 	HashMap<ObjectID, RPCConfigCache> rpc_cache;
 
+	bool batching = false;
+	bool flushing = false;
+	uint32_t batched_rpcs = 0;
+	HashMap<uint64_t, RPCBatch> batches;
+	LocalVector<uint8_t> args_cache;
+
 #ifdef DEBUG_ENABLED
 	_FORCE_INLINE_ void _profile_node_data(const String &p_what, ObjectID p_id, int p_size);
 #endif
 
 protected:
-	void _process_rpc(Node *p_node, const uint16_t p_rpc_method_id, int p_from, const uint8_t *p_packet, int p_packet_len, int p_offset);
+	void _process_rpc(Node *p_node, const uint16_t p_rpc_method_id, int p_from, const uint8_t *p_packet, int p_packet_len, int p_offset, bool p_compact_args);
 
 	void _send_rpc(Node *p_from, int p_to, uint16_t p_rpc_id, const RPCConfig &p_config, const StringName &p_name, const Variant **p_arg, int p_argcount);
+	void _send_packet(int p_to, const RPCConfig &p_config, const uint8_t *p_packet, int p_packet_len, bool p_compact_args);
+	void _send_batch(RPCBatch &p_batch);
 	Node *_process_get_node(int p_from, const uint8_t *p_packet, uint32_t p_node_target, int p_packet_len);
 
 	void _parse_rpc_config(const Variant &p_config, bool p_for_node, RPCConfigCache &r_cache);
@@ -101,9 +121,17 @@ protected:
 
 public:
 	Error rpcp(Object *p_obj, int p_peer_id, const StringName &p_method, const Variant **p_arg, int p_argcount);
-	void process_rpc(int p_from, const uint8_t *p_packet, int p_packet_len);
+	void process_rpc(int p_from, const uint8_t *p_packet, int p_packet_len, bool p_compact_args = false);
+	void process_batch(int p_from, const uint8_t *p_packet, int p_packet_len);
 	String get_rpc_md5(const Object *p_obj);
 
+	void set_batching_enabled(bool p_enabled);
+	bool is_batching_enabled() const { return batching; }
+	bool has_batches() const { return batched_rpcs > 0 && !flushing; }
+	void flush_batches();
+	void clear_batches();
+	void on_peer_change(int p_id, bool p_connected);
+
 	SceneRPCInterface(SceneMultiplayer *p_multiplayer, SceneCacheInterface *p_cache, SceneReplicationInterface *p_replicator) {
 		multiplayer = p_multiplayer;
 		multiplayer_cache = p_cache;
@@ -0,0 +1,140 @@
+/**************************************************************************/
+/*  test_scene_replication_interest.h                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SCENE_REPLICATION_INTEREST_H
+#define TEST_SCENE_REPLICATION_INTEREST_H
+
+#include "tests/test_macros.h"
+
+#include "../scene_replication_interest.h"
+
+#include "core/math/random_number_generator.h"
+
+namespace TestSceneReplicationInterest {
+
+TEST_CASE("[Multiplayer][SceneReplicationInterest] Query within radius") {
+	SceneReplicationInterest interest;
+	interest.set_cell_size(10);
+	interest.update(ObjectID(uint64_t(1)), Vector3(0, 0, 0));
+	interest.update(ObjectID(uint64_t(2)), Vector3(9, 0, 0));
+	interest.update(ObjectID(uint64_t(3)), Vector3(-25, 0, 0));
+	interest.update(ObjectID(uint64_t(4)), Vector3(0, 0, 100));
+	CHECK(interest.size() == 4);
+
+	HashSet<ObjectID> result;
+	interest.query(Vector3(), 10, result);
+	CHECK(result.size() == 2);
+	CHECK(result.has(ObjectID(uint64_t(1))));
+	CHECK(result.has(ObjectID(uint64_t(2))));
+
+	// Relevancy is decided per cell, entries in a cell within the radius are included even if they aren't.
+	interest.update(ObjectID(uint64_t(5)), Vector3(-5, 9, 9));
+	result.clear();
+	interest.query(Vector3(-15, 0, 0), 6, result);
+	CHECK(result.size() == 2);
+	CHECK(result.has(ObjectID(uint64_t(3))));
+	CHECK(result.has(ObjectID(uint64_t(5))));
+	CHECK(interest.is_in_range(ObjectID(uint64_t(5)), Vector3(-15, 0, 0), 6));
+	CHECK_FALSE(interest.is_in_range(ObjectID(uint64_t(1)), Vector3(-15, 0, 0), 6));
+
+	// Large radii visit the occupied cells only.
+	result.clear();
+	interest.query(Vector3(), 1e9, result);
+	CHECK(result.size() == 5);
+}
+
+TEST_CASE("[Multiplayer][SceneReplicationInterest] Moving and removing entries") {
+	SceneReplicationInterest interest;
+	interest.set_cell_size(10);
+	const ObjectID id = ObjectID(uint64_t(1));
+	CHECK(interest.update(id, Vector3(0, 0, 0)));
+	// Only moving to another cell is reported.
+	CHECK_FALSE(interest.update(id, Vector3(9, 9, 9)));
+
+	HashSet<ObjectID> result;
+	CHECK(interest.update(id, Vector3(55, -32, 7)));
+	interest.query(Vector3(), 10, result);
+	CHECK(result.is_empty());
+	interest.query(Vector3(50, -30, 5), 10, result);
+	CHECK(result.has(id));
+
+	Vector3 position;
+	CHECK(interest.get_position(id, position));
+	CHECK(position == Vector3(55, -32, 7));
+
+	// Changing the cell size keeps the entries.
+	interest.set_cell_size(3);
+	result.clear();
+	interest.query(Vector3(50, -30, 5), 10, result);
+	CHECK(result.has(id));
+
+	interest.remove(id);
+	CHECK_FALSE(interest.has(id));
+	result.clear();
+	interest.query(Vector3(50, -30, 5), 10, result);
+	CHECK(result.is_empty());
+}
+
+TEST_CASE("[Multiplayer][SceneReplicationInterest] Same results as a linear search") {
+	const real_t cell_size = 16;
+	SceneReplicationInterest interest;
+	interest.set_cell_size(cell_size);
+	Ref<RandomNumberGenerator> rng;
+	rng.instantiate();
+	rng->set_seed(42);
+
+	LocalVector<Vector3> positions;
+	for (uint64_t i = 0; i < 500; i++) {
+		positions.push_back(Vector3(rng->randf_range(-200, 200), rng->randf_range(-200, 200), rng->randf_range(-20, 20)));
+		interest.update(ObjectID(i + 1), positions[i]);
+	}
+
+	for (int i = 0; i < 20; i++) {
+		const Vector3 origin = Vector3(rng->randf_range(-200, 200), rng->randf_range(-200, 200), 0);
+		const real_t radius = rng->randf_range(1, 100);
+		HashSet<ObjectID> result;
+		interest.query(origin, radius, result);
+
+		uint32_t expected = 0;
+		for (uint64_t j = 0; j < positions.size(); j++) {
+			const Vector3 cell_from = (positions[j] / cell_size).floor() * cell_size;
+			const Vector3 closest = origin.clamp(cell_from, cell_from + Vector3(cell_size, cell_size, cell_size));
+			if (closest.distance_to(origin) <= radius) {
+				CHECK(result.has(ObjectID(j + 1)));
+				expected++;
+			}
+		}
+		CHECK(result.size() == expected);
+	}
+}
+
+} // namespace TestSceneReplicationInterest
+
+#endif // TEST_SCENE_REPLICATION_INTEREST_H
@@ -0,0 +1,351 @@
+/**************************************************************************/
+/*  test_scene_replication_interface.h                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SCENE_REPLICATION_INTERFACE_H
+#define TEST_SCENE_REPLICATION_INTERFACE_H
+
+#include "tests/test_macros.h"
+
+#include "../multiplayer_synchronizer.h"
+#include "../scene_multiplayer.h"
+#include "../scene_replication_config.h"
+#include "test_scene_rpc_interface.h"
+
+#include "core/io/marshalls.h"
+#include "scene/3d/node_3d.h"
+#include "scene/main/window.h"
+
+namespace TestSceneReplicationInterface {
+
+using TestSceneRPCInterface::LoopbackMultiplayerPeer;
+
+// Inspects the snapshots sent by the server and the acknowledgements sent by the client, and can drop or alter them.
+struct SnapshotLink {
+	bool drop_snapshots = false;
+	bool drop_acks = false;
+	// Added to the snapshot sequences seen by the client, and removed from the ones it acknowledges.
+	uint16_t sequence_offset = 0;
+	LocalVector<int> snapshot_sizes;
+	LocalVector<uint16_t> received_sequences;
+
+	static bool _is_sync(const Vector<uint8_t> &p_packet, bool p_ack) {
+		if (p_packet.size() < 3 || (p_packet[0] & SceneMultiplayer::CMD_MASK) != SceneMultiplayer::NETWORK_COMMAND_SYNC) {
+			return false;
+		}
+		const uint8_t flags = (1 << SceneMultiplayer::CMD_FLAG_0_SHIFT) | (1 << SceneMultiplayer::CMD_FLAG_1_SHIFT);
+		return (p_packet[0] & flags) == (p_ack ? flags : (1 << SceneMultiplayer::CMD_FLAG_1_SHIFT));
+	}
+
+	static bool _filter_snapshot(Vector<uint8_t> &r_packet, void *p_userdata) {
+		SnapshotLink *link = static_cast<SnapshotLink *>(p_userdata);
+		if (!_is_sync(r_packet, false)) {
+			return true;
+		}
+		link->snapshot_sizes.push_back(r_packet.size());
+		if (link->drop_snapshots) {
+			return false;
+		}
+		const uint16_t sequence = decode_uint16(r_packet.ptr() + 1) + link->sequence_offset;
+		encode_uint16(sequence, r_packet.ptrw() + 1);
+		link->received_sequences.push_back(sequence);
+		return true;
+	}
+
+	static bool _filter_ack(Vector<uint8_t> &r_packet, void *p_userdata) {
+		SnapshotLink *link = static_cast<SnapshotLink *>(p_userdata);
+		if (!_is_sync(r_packet, true)) {
+			return true;
+		}
+		if (link->drop_acks) {
+			return false;
+		}
+		encode_uint16(decode_uint16(r_packet.ptr() + 1) - link->sequence_offset, r_packet.ptrw() + 1);
+		return true;
+	}
+
+	int get_last_size() const {
+		return snapshot_sizes.is_empty() ? 0 : snapshot_sizes[snapshot_sizes.size() - 1];
+	}
+
+	void attach(LoopbackMultiplayerPeer *p_server, LoopbackMultiplayerPeer *p_client) {
+		p_server->packet_filter = &SnapshotLink::_filter_snapshot;
+		p_server->packet_filter_userdata = this;
+		p_client->packet_filter = &SnapshotLink::_filter_ack;
+		p_client->packet_filter_userdata = this;
+	}
+};
+
+// A server and a client with the same Node3Ds, whose positions are synchronized by the server.
+struct ReplicationHarness {
+	Ref<LoopbackMultiplayerPeer> peers[2];
+	Ref<SceneMultiplayer> multiplayers[2];
+	Node *roots[2] = {};
+	LocalVector<Node3D *> nodes[2];
+	LocalVector<MultiplayerSynchronizer *> synchronizers;
+
+	explicit ReplicationHarness(int p_node_count, SnapshotLink *p_snapshots = nullptr) {
+		const NodePath position_path = NodePath(".:position");
+		Ref<SceneReplicationConfig> config;
+		config.instantiate();
+		config->add_property(position_path);
+		config->property_set_spawn(position_path, false);
+		config->property_set_replication_mode(position_path, SceneReplicationConfig::REPLICATION_MODE_ALWAYS);
+
+		for (int i = 0; i < 2; i++) {
+			peers[i].instantiate();
+		}
+		peers[0]->setup(1, peers[1].ptr());
+		peers[1]->setup(2, peers[0].ptr());
+		if (p_snapshots) {
+			p_snapshots->attach(peers[0].ptr(), peers[1].ptr());
+		}
+
+		for (int i = 0; i < 2; i++) {
+			roots[i] = memnew(Node);
+			roots[i]->set_name(i == 0 ? "Server" : "Client");
+			SceneTree::get_singleton()->get_root()->add_child(roots[i]);
+			multiplayers[i].instantiate();
+			multiplayers[i]->set_snapshot_replication_enabled(p_snapshots != nullptr);
+			SceneTree::get_singleton()->set_multiplayer(multiplayers[i], roots[i]->get_path());
+			for (int j = 0; j < p_node_count; j++) {
+				Node3D *node = memnew(Node3D);
+				node->set_name(itos(j));
+				MultiplayerSynchronizer *sync = memnew(MultiplayerSynchronizer);
+				sync->set_name("Sync");
+				sync->set_replication_config(config);
+				sync->set_spatial_relevancy(true);
+				node->add_child(sync);
+				roots[i]->add_child(node);
+				nodes[i].push_back(node);
+				if (i == 0) {
+					synchronizers.push_back(sync);
+				}
+			}
+		}
+		multiplayers[0]->set_multiplayer_peer(peers[0]);
+		multiplayers[1]->set_multiplayer_peer(peers[1]);
+		// Connect, and confirm the paths of the synchronizers.
+		poll(4);
+	}
+
+	void poll(int p_frames = 1) {
+		for (int i = 0; i < p_frames; i++) {
+			multiplayers[0]->poll();
+			multiplayers[1]->poll();
+		}
+	}
+
+	Vector3 get_client_position(int p_node) const {
+		return nodes[1][p_node]->get_position();
+	}
+
+	~ReplicationHarness() {
+		for (int i = 0; i < 2; i++) {
+			SceneTree::get_singleton()->set_multiplayer(Ref<MultiplayerAPI>(), roots[i]->get_path());
+			multiplayers[i]->set_multiplayer_peer(Ref<MultiplayerPeer>());
+			memdelete(roots[i]);
+		}
+	}
+};
+
+TEST_CASE("[SceneTree][Multiplayer][SceneReplicationInterface] Spatial relevancy") {
+	ReplicationHarness harness(2);
+	Ref<SceneMultiplayer> server = harness.multiplayers[0];
+	server->set_relevancy_cell_size(10);
+
+	harness.nodes[0][0]->set_position(Vector3(1, 0, 0));
+	harness.nodes[0][1]->set_position(Vector3(1000, 0, 0));
+	harness.poll(2);
+	// Without a relevancy radius, everything is synchronized.
+	CHECK(harness.get_client_position(0) == Vector3(1, 0, 0));
+	CHECK(harness.get_client_position(1) == Vector3(1000, 0, 0));
+
+	server->set_peer_relevancy(2, Vector3(), 5);
+	CHECK(server->has_peer_relevancy(2));
+	harness.nodes[0][0]->set_position(Vector3(1, 2, 3));
+	harness.nodes[0][1]->set_position(Vector3(1001, 0, 0));
+	harness.poll(2);
+	CHECK(harness.get_client_position(0) == Vector3(1, 2, 3));
+	CHECK_MESSAGE(harness.get_client_position(1) == Vector3(1000, 0, 0), "Out of range nodes must not be synchronized.");
+
+	SUBCASE("Nodes entering and leaving the radius") {
+		// Entering the cell of the other node.
+		harness.nodes[0][1]->set_position(Vector3(3, 0, 0));
+		harness.poll(2);
+		CHECK(harness.get_client_position(1) == Vector3(3, 0, 0));
+
+		// Leaving it, the new position is not sent anymore.
+		harness.nodes[0][1]->set_position(Vector3(500, 0, 0));
+		harness.poll(2);
+		CHECK(harness.get_client_position(1) == Vector3(3, 0, 0));
+
+		// Moving within a cell that is out of range doesn't change anything.
+		harness.nodes[0][1]->set_position(Vector3(501, 0, 0));
+		harness.poll(2);
+		CHECK(harness.get_client_position(1) == Vector3(3, 0, 0));
+	}
+
+	SUBCASE("Moving the peer origin") {
+		server->set_peer_relevancy(2, Vector3(1000, 0, 0), 5);
+		harness.poll(2);
+		CHECK(harness.get_client_position(1) == Vector3(1001, 0, 0));
+
+		harness.nodes[0][0]->set_position(Vector3(4, 4, 4));
+		harness.poll(2);
+		CHECK(harness.get_client_position(0) == Vector3(1, 2, 3));
+	}
+
+	SUBCASE("Changing the cell size") {
+		// Relevancy is decided per cell, a large enough cell holds both the peer origin and the far node.
+		server->set_relevancy_cell_size(4000);
+		harness.poll(2);
+		CHECK_MESSAGE(harness.get_client_position(1) == Vector3(1001, 0, 0), "Nodes that didn't move must become relevant.");
+
+		server->set_relevancy_cell_size(10);
+		harness.nodes[0][1]->set_position(Vector3(1002, 0, 0));
+		harness.poll(2);
+		CHECK_MESSAGE(harness.get_client_position(1) == Vector3(1001, 0, 0), "Nodes moving within their cell must stop being relevant.");
+	}
+
+	SUBCASE("Disabling relevancy") {
+		harness.synchronizers[1]->set_spatial_relevancy(false);
+		harness.poll(2);
+		CHECK(harness.get_client_position(1) == Vector3(1001, 0, 0));
+		harness.synchronizers[1]->set_spatial_relevancy(true);
+
+		server->clear_peer_relevancy(2);
+		CHECK_FALSE(server->has_peer_relevancy(2));
+		harness.nodes[0][1]->set_position(Vector3(2000, 0, 0));
+		harness.poll(2);
+		CHECK(harness.get_client_position(1) == Vector3(2000, 0, 0));
+	}
+}
+
+TEST_CASE("[SceneTree][Multiplayer][SceneReplicationInterface] Relevancy priority") {
+	const int node_count = 12;
+	ReplicationHarness harness(node_count);
+	Ref<SceneMultiplayer> server = harness.multiplayers[0];
+	// Too small for the states of every node.
+	server->set_max_sync_packet_size(128);
+	server->set_peer_relevancy(2, Vector3(), 1000);
+	harness.poll(2);
+
+	// The farthest node, but with the highest priority.
+	harness.synchronizers[node_count - 1]->set_relevancy_priority(100);
+	for (int i = 0; i < node_count; i++) {
+		harness.nodes[0][i]->set_position(Vector3(i * 10, 1, 0));
+	}
+	harness.poll();
+
+	int updated = 0;
+	for (int i = 0; i < node_count; i++) {
+		if (harness.get_client_position(i) == Vector3(i * 10, 1, 0)) {
+			updated++;
+		}
+	}
+	CHECK(harness.get_client_position(node_count - 1) == Vector3((node_count - 1) * 10, 1, 0));
+	CHECK_MESSAGE(updated < node_count, "Only a single packet is sent per frame.");
+
+	// Skipped nodes gain priority, until all of them are sent.
+	harness.poll(node_count);
+	for (int i = 0; i < node_count; i++) {
+		CHECK(harness.get_client_position(i) == Vector3(i * 10, 1, 0));
+	}
+}
+
+TEST_CASE("[SceneTree][Multiplayer][SceneReplicationInterface] Snapshot acknowledgements") {
+	SnapshotLink link;
+	ReplicationHarness harness(1, &link);
+	REQUIRE(link.snapshot_sizes.size() > 1);
+	// Nothing is acknowledged for the first snapshot, so it holds the full state.
+	const int full_size = link.snapshot_sizes[0];
+	CHECK_MESSAGE(link.get_last_size() < full_size, "Unchanged states are sent as empty deltas.");
+
+	Node3D *node = harness.nodes[0][0];
+	node->set_position(Vector3(1, 2, 3));
+	harness.poll();
+	CHECK(harness.get_client_position(0) == Vector3(1, 2, 3));
+	CHECK(link.get_last_size() < full_size);
+
+	SUBCASE("Lost snapshots") {
+		link.drop_snapshots = true;
+		node->set_position(Vector3(1, 2, 4));
+		harness.poll(3);
+		CHECK(harness.get_client_position(0) == Vector3(1, 2, 3));
+
+		// Still encoded against the last state that was acknowledged.
+		link.drop_snapshots = false;
+		node->set_position(Vector3(1, 2, 5));
+		harness.poll();
+		CHECK(harness.get_client_position(0) == Vector3(1, 2, 5));
+		CHECK(link.get_last_size() < full_size);
+	}
+
+	SUBCASE("Lost acknowledgements") {
+		link.drop_acks = true;
+		for (int i = 0; i < MultiplayerSynchronizer::SNAPSHOT_HISTORY; i++) {
+			node->set_position(Vector3(1, 2, 4 + i));
+			harness.poll();
+			CHECK(harness.get_client_position(0) == Vector3(1, 2, 4 + i));
+		}
+		CHECK_MESSAGE(link.get_last_size() == full_size, "The acknowledged state is too old to be used as a baseline.");
+
+		link.drop_acks = false;
+		harness.poll(2);
+		CHECK(link.get_last_size() < full_size);
+	}
+}
+
+TEST_CASE("[SceneTree][Multiplayer][SceneReplicationInterface] Snapshot sequence wraparound") {
+	SnapshotLink link;
+	link.sequence_offset = UINT16_MAX - 8;
+	ReplicationHarness harness(1, &link);
+	REQUIRE(link.snapshot_sizes.size() > 1);
+	const int full_size = link.snapshot_sizes[0];
+
+	Node3D *node = harness.nodes[0][0];
+	for (int i = 0; i < 2 * MultiplayerSynchronizer::SNAPSHOT_HISTORY; i++) {
+		node->set_position(Vector3(1, 2, i));
+		harness.poll();
+		CHECK(harness.get_client_position(0) == Vector3(1, 2, i));
+		CHECK(link.get_last_size() < full_size);
+	}
+
+	// The sequences seen by the client went past UINT16_MAX.
+	bool wrapped = false;
+	for (uint32_t i = 1; i < link.received_sequences.size(); i++) {
+		wrapped = wrapped || link.received_sequences[i] < link.received_sequences[i - 1];
+	}
+	CHECK(wrapped);
+}
+
+} // namespace TestSceneReplicationInterface
+
+#endif // TEST_SCENE_REPLICATION_INTERFACE_H
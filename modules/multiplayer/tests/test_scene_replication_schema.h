@@ -0,0 +1,259 @@
+/**************************************************************************/
+/*  test_scene_replication_schema.h                                       */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SCENE_REPLICATION_SCHEMA_H
+#define TEST_SCENE_REPLICATION_SCHEMA_H
+
+#include "tests/test_macros.h"
+
+#include "../multiplayer_synchronizer.h"
+#include "../scene_replication_schema.h"
+
+#include "core/os/os.h"
+#include "scene/2d/node_2d.h"
+#include "scene/main/multiplayer_api.h"
+
+namespace TestSceneReplicationSchema {
+
+Node2D *make_scene() {
+	Node2D *root = memnew(Node2D);
+	Node2D *child = memnew(Node2D);
+	child->set_name("Child");
+	root->add_child(child);
+	return root;
+}
+
+void fill_schema(SceneReplicationSchema &r_schema) {
+	r_schema.add_field(NodePath(":position"), false);
+	r_schema.add_field(NodePath(":rotation"), false);
+	r_schema.add_field(NodePath(":scale"), true);
+	r_schema.add_field(NodePath(":editor_description"), false);
+	r_schema.add_field(NodePath("Child:visible"), false);
+	r_schema.add_field(NodePath("Child:position:x"), false);
+}
+
+TEST_CASE("[Multiplayer][SceneReplicationSchema] Encode and decode states") {
+	SceneReplicationSchema schema;
+	fill_schema(schema);
+	SceneReplicationSchema::Bindings src_bindings;
+	SceneReplicationSchema::Bindings dst_bindings;
+
+	Node2D *src = make_scene();
+	Node2D *dst = make_scene();
+	src->set_position(Vector2(12.5, -3.25));
+	src->set_rotation(1.5);
+	src->set_scale(Vector2(2.0, 0.5));
+	src->set_editor_description("Replicated");
+	Node2D *src_child = Object::cast_to<Node2D>(src->get_node(NodePath("Child")));
+	src_child->set_visible(false);
+	src_child->set_position(Vector2(7, 8));
+
+	LocalVector<uint8_t> buffer;
+	CHECK(schema.encode_state(src, src_bindings, buffer) == OK);
+	CHECK(schema.decode_state(dst, dst_bindings, buffer.ptr(), buffer.size()) == OK);
+
+	Node2D *dst_child = Object::cast_to<Node2D>(dst->get_node(NodePath("Child")));
+	CHECK(dst->get_position() == Vector2(12.5, -3.25));
+	CHECK(dst->get_rotation() == doctest::Approx(1.5));
+	CHECK(dst->get_scale() == Vector2(2.0, 0.5)); // Exact as half floats.
+	CHECK(dst->get_editor_description() == "Replicated");
+	CHECK_FALSE(dst_child->is_visible());
+	CHECK(dst_child->get_position() == Vector2(7, 0));
+
+	// Bindings are reused on the next state.
+	src->set_position(Vector2(-1, 1));
+	CHECK(schema.encode_state(src, src_bindings, buffer) == OK);
+	CHECK(schema.decode_state(dst, dst_bindings, buffer.ptr(), buffer.size()) == OK);
+	CHECK(dst->get_position() == Vector2(-1, 1));
+
+	memdelete(src);
+	memdelete(dst);
+}
+
+TEST_CASE("[Multiplayer][SceneReplicationSchema] Quantized values") {
+	SceneReplicationSchema full;
+	full.add_field(NodePath(":rotation"), false);
+	SceneReplicationSchema quantized;
+	quantized.add_field(NodePath(":rotation"), true);
+	SceneReplicationSchema::Bindings bindings;
+
+	Node2D *node = memnew(Node2D);
+	node->set_rotation(0.1);
+
+	LocalVector<uint8_t> full_buffer;
+	LocalVector<uint8_t> quantized_buffer;
+	CHECK(full.encode_state(node, bindings, full_buffer) == OK);
+	CHECK(quantized.encode_state(node, bindings, quantized_buffer) == OK);
+	CHECK(quantized_buffer.size() < full_buffer.size());
+
+	node->set_rotation(0);
+	CHECK(quantized.decode_state(node, bindings, quantized_buffer.ptr(), quantized_buffer.size()) == OK);
+	CHECK(node->get_rotation() != 0.1);
+	CHECK(node->get_rotation() == doctest::Approx(0.1).epsilon(0.001));
+
+	memdelete(node);
+}
+
+TEST_CASE("[Multiplayer][SceneReplicationSchema] Encode and decode deltas") {
+	SceneReplicationSchema schema;
+	fill_schema(schema);
+	SceneReplicationSchema::Bindings bindings;
+
+	Node2D *node = make_scene();
+	node->set_editor_description("Before");
+
+	List<Variant> values;
+	values.push_back(Vector2(4, 5));
+	values.push_back("After");
+	const uint64_t indexes = (1 << 0) | (1 << 3);
+
+	LocalVector<uint8_t> buffer;
+	CHECK(schema.encode_values(values, indexes, buffer) == OK);
+	CHECK(schema.decode_values(node, bindings, indexes, buffer.ptr(), buffer.size()) == OK);
+	CHECK(node->get_position() == Vector2(4, 5));
+	CHECK(node->get_editor_description() == "After");
+	CHECK(node->get_rotation() == 0);
+
+	ERR_PRINT_OFF;
+	// Fields outside of the schema.
+	CHECK(schema.decode_values(node, bindings, 1 << 6, buffer.ptr(), buffer.size()) != OK);
+	// Indexes not matching the values.
+	CHECK(schema.decode_values(node, bindings, 1 << 0, buffer.ptr(), buffer.size()) != OK);
+	ERR_PRINT_ON;
+
+	memdelete(node);
+}
+
+TEST_CASE("[Multiplayer][SceneReplicationSchema] Invalid states are not applied") {
+	SceneReplicationSchema schema;
+	fill_schema(schema);
+	SceneReplicationSchema::Bindings bindings;
+
+	Node2D *src = make_scene();
+	Node2D *dst = make_scene();
+	src->set_position(Vector2(1, 2));
+	src->set_editor_description("Replicated");
+
+	LocalVector<uint8_t> buffer;
+	CHECK(schema.encode_state(src, bindings, buffer) == OK);
+
+	ERR_PRINT_OFF;
+	CHECK(schema.decode_state(dst, bindings, buffer.ptr(), buffer.size() - 1) != OK);
+	buffer.push_back(0);
+	CHECK(schema.decode_state(dst, bindings, buffer.ptr(), buffer.size()) != OK);
+	ERR_PRINT_ON;
+	CHECK(dst->get_position() == Vector2());
+	CHECK(dst->get_editor_description().is_empty());
+
+	memdelete(src);
+	memdelete(dst);
+}
+
+TEST_CASE("[Multiplayer][SceneReplicationSchema] Snapshot deltas") {
+	LocalVector<uint8_t> baseline;
+	LocalVector<uint8_t> state;
+	for (int i = 0; i < 600; i++) {
+		baseline.push_back(uint8_t(i * 7));
+		state.push_back(uint8_t(i * 7));
+	}
+	LocalVector<uint8_t> delta;
+	LocalVector<uint8_t> decoded;
+
+	SUBCASE("Unchanged states produce an empty delta") {
+		SceneReplicationSchema::encode_snapshot_delta(state.ptr(), baseline.ptr(), state.size(), delta);
+		CHECK(delta.size() == 0);
+		CHECK(SceneReplicationSchema::decode_snapshot_delta(delta.ptr(), delta.size(), baseline.ptr(), baseline.size(), decoded) == OK);
+		CHECK((decoded.size() == state.size() && memcmp(decoded.ptr(), state.ptr(), state.size()) == 0));
+	}
+
+	SUBCASE("Changed bytes round-trip") {
+		state[0] ^= 0x01;
+		state[129] = 0;
+		for (int i = 300; i < 450; i++) {
+			state[i] = uint8_t(~state[i]);
+		}
+		state[599] ^= 0xF0;
+		SceneReplicationSchema::encode_snapshot_delta(state.ptr(), baseline.ptr(), state.size(), delta);
+		CHECK(delta.size() > 0);
+		CHECK(delta.size() < state.size() / 2);
+		CHECK(SceneReplicationSchema::decode_snapshot_delta(delta.ptr(), delta.size(), baseline.ptr(), baseline.size(), decoded) == OK);
+		CHECK((decoded.size() == state.size() && memcmp(decoded.ptr(), state.ptr(), state.size()) == 0));
+	}
+
+	SUBCASE("Malformed deltas are rejected") {
+		state[10] ^= 0xFF;
+		state[11] ^= 0xFF;
+		SceneReplicationSchema::encode_snapshot_delta(state.ptr(), baseline.ptr(), state.size(), delta);
+		REQUIRE(delta.size() > 1);
+		ERR_PRINT_OFF;
+		CHECK(SceneReplicationSchema::decode_snapshot_delta(delta.ptr(), delta.size() - 1, baseline.ptr(), baseline.size(), decoded) != OK);
+		CHECK(SceneReplicationSchema::decode_snapshot_delta(delta.ptr(), delta.size(), baseline.ptr(), 5, decoded) != OK);
+		ERR_PRINT_ON;
+	}
+}
+
+TEST_CASE("[Multiplayer][SceneReplicationSchema][Benchmark] Schema and Variant array states" * doctest::skip()) {
+	const int iterations = 100000;
+	SceneReplicationSchema schema;
+	fill_schema(schema);
+	SceneReplicationSchema::Bindings bindings;
+	List<NodePath> properties;
+	for (uint32_t i = 0; i < schema.get_field_count(); i++) {
+		properties.push_back(schema.get_field(i).path);
+	}
+	Node2D *node = make_scene();
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	Vector<Variant> vars;
+	Vector<const Variant *> varp;
+	Vector<uint8_t> variant_buffer;
+	int variant_size = 0;
+	for (int i = 0; i < iterations; i++) {
+		MultiplayerSynchronizer::get_state(properties, node, vars, varp);
+		MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), nullptr, variant_size);
+		variant_buffer.resize(variant_size);
+		MultiplayerAPI::encode_and_compress_variants(varp.ptrw(), varp.size(), variant_buffer.ptrw(), variant_size);
+	}
+	uint64_t variant_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	LocalVector<uint8_t> schema_buffer;
+	for (int i = 0; i < iterations; i++) {
+		schema.encode_state(node, bindings, schema_buffer);
+	}
+	uint64_t schema_usec = OS::get_singleton()->get_ticks_usec() - begin;
+
+	MESSAGE(vformat("Variant array: %d usec, %d bytes. Schema: %d usec, %d bytes.", variant_usec, variant_size, schema_usec, schema_buffer.size()));
+	memdelete(node);
+}
+
+} // namespace TestSceneReplicationSchema
+
+#endif // TEST_SCENE_REPLICATION_SCHEMA_H
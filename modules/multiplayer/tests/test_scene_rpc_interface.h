@@ -0,0 +1,227 @@
+/**************************************************************************/
+/*  test_scene_rpc_interface.h                                            */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SCENE_RPC_INTERFACE_H
+#define TEST_SCENE_RPC_INTERFACE_H
+
+#include "tests/test_macros.h"
+
+#include "../scene_multiplayer.h"
+#include "../scene_replication_schema.h"
+
+#include "core/os/os.h"
+#include "scene/2d/node_2d.h"
+#include "scene/main/window.h"
+
+namespace TestSceneRPCInterface {
+
+// Delivers packets to another instance, without any transport.
+class LoopbackMultiplayerPeer : public MultiplayerPeer {
+	GDCLASS(LoopbackMultiplayerPeer, MultiplayerPeer);
+
+	struct Packet {
+		Vector<uint8_t> data;
+		int from = 0;
+		int channel = 0;
+		TransferMode mode = TRANSFER_MODE_RELIABLE;
+	};
+
+	LoopbackMultiplayerPeer *remote = nullptr;
+	int unique_id = 0;
+	bool connected = false;
+	List<Packet> incoming;
+	Packet current;
+
+public:
+	int sent_packets = 0;
+	int sent_bytes = 0;
+	// Called with every sent packet, which is dropped when it returns false.
+	bool (*packet_filter)(Vector<uint8_t> &r_packet, void *p_userdata) = nullptr;
+	void *packet_filter_userdata = nullptr;
+
+	void setup(int p_id, LoopbackMultiplayerPeer *p_remote) {
+		unique_id = p_id;
+		remote = p_remote;
+	}
+
+	virtual int get_available_packet_count() const override { return incoming.size(); }
+	virtual Error get_packet(const uint8_t **r_buffer, int &r_buffer_size) override {
+		ERR_FAIL_COND_V(incoming.is_empty(), ERR_UNAVAILABLE);
+		current = incoming.front()->get();
+		incoming.pop_front();
+		*r_buffer = current.data.ptr();
+		r_buffer_size = current.data.size();
+		return OK;
+	}
+	virtual Error put_packet(const uint8_t *p_buffer, int p_buffer_size) override {
+		Packet packet;
+		packet.data.resize(p_buffer_size);
+		memcpy(packet.data.ptrw(), p_buffer, p_buffer_size);
+		packet.from = unique_id;
+		packet.channel = get_transfer_channel();
+		packet.mode = get_transfer_mode();
+		sent_packets++;
+		sent_bytes += p_buffer_size;
+		if (packet_filter && !packet_filter(packet.data, packet_filter_userdata)) {
+			return OK;
+		}
+		remote->incoming.push_back(packet);
+		return OK;
+	}
+	virtual int get_max_packet_size() const override { return 1 << 24; }
+
+	virtual void set_target_peer(int p_peer_id) override {}
+	virtual int get_packet_peer() const override { return incoming.is_empty() ? 0 : incoming.front()->get().from; }
+	virtual TransferMode get_packet_mode() const override { return incoming.is_empty() ? TRANSFER_MODE_RELIABLE : incoming.front()->get().mode; }
+	virtual int get_packet_channel() const override { return incoming.is_empty() ? 0 : incoming.front()->get().channel; }
+	virtual void disconnect_peer(int p_peer, bool p_force = false) override {}
+	virtual bool is_server() const override { return unique_id == 1; }
+	virtual void poll() override {
+		if (!connected) {
+			connected = true;
+			emit_signal(SNAME("peer_connected"), remote->unique_id);
+		}
+	}
+	virtual void close() override {}
+	virtual int get_unique_id() const override { return unique_id; }
+	virtual ConnectionStatus get_connection_status() const override { return CONNECTION_CONNECTED; }
+};
+
+TEST_CASE("[Multiplayer][SceneRPCInterface] Compact arguments") {
+	const Variant::Type types[] = { Variant::VECTOR3, Variant::INT, Variant::STRING, Variant::NIL };
+	Variant a = Vector3(1, 2, 3);
+	Variant b = 42;
+	Variant c = "hello";
+	Variant d = 1.5;
+	const Variant *args[] = { &a, &b, &c, &d };
+	LocalVector<uint8_t> buffer;
+	Vector<Variant> decoded;
+	decoded.resize(4);
+
+	SUBCASE("Arguments round-trip") {
+		REQUIRE(SceneReplicationSchema::encode_arguments(args, 4, types, 4, buffer) == OK);
+		CHECK(SceneReplicationSchema::decode_arguments(buffer.ptr(), buffer.size(), types, 4, decoded) == OK);
+		CHECK(decoded[0] == a);
+		CHECK(decoded[1] == b);
+		CHECK(decoded[2] == c);
+		CHECK(decoded[3] == d);
+
+		int len = 0;
+		MultiplayerAPI::encode_and_compress_variants(args, 4, nullptr, len);
+		CHECK(int(buffer.size()) < len);
+	}
+
+	SUBCASE("Arguments not matching their type") {
+		b = "not an int";
+		REQUIRE(SceneReplicationSchema::encode_arguments(args, 4, types, 2, buffer) == OK);
+		CHECK(SceneReplicationSchema::decode_arguments(buffer.ptr(), buffer.size(), types, 2, decoded) == OK);
+		CHECK(decoded[1] == b);
+		CHECK(decoded[2] == c);
+	}
+
+	SUBCASE("Malformed arguments are rejected") {
+		REQUIRE(SceneReplicationSchema::encode_arguments(args, 4, types, 4, buffer) == OK);
+		ERR_PRINT_OFF;
+		CHECK(SceneReplicationSchema::decode_arguments(buffer.ptr(), buffer.size() - 1, types, 4, decoded) != OK);
+		decoded.resize(5);
+		CHECK(SceneReplicationSchema::decode_arguments(buffer.ptr(), buffer.size(), types, 4, decoded) != OK);
+		ERR_PRINT_ON;
+	}
+}
+
+TEST_CASE("[SceneTree][Multiplayer][SceneRPCInterface][Benchmark] Batched and unbatched RPCs over loopback" * doctest::skip()) {
+	const int node_count = 64;
+	const int ticks = 1000;
+	Dictionary config;
+	config["rpc_mode"] = MultiplayerAPI::RPC_MODE_ANY_PEER;
+	config["transfer_mode"] = MultiplayerPeer::TRANSFER_MODE_UNRELIABLE;
+
+	for (int batching = 0; batching < 2; batching++) {
+		Ref<LoopbackMultiplayerPeer> server_peer;
+		Ref<LoopbackMultiplayerPeer> client_peer;
+		server_peer.instantiate();
+		client_peer.instantiate();
+		server_peer->setup(1, client_peer.ptr());
+		client_peer->setup(2, server_peer.ptr());
+
+		Node *roots[2];
+		Ref<SceneMultiplayer> multiplayers[2];
+		for (int i = 0; i < 2; i++) {
+			roots[i] = memnew(Node);
+			roots[i]->set_name(i == 0 ? "Server" : "Client");
+			SceneTree::get_singleton()->get_root()->add_child(roots[i]);
+			for (int j = 0; j < node_count; j++) {
+				Node2D *node = memnew(Node2D);
+				node->set_name(itos(j));
+				node->rpc_config("set_position", config);
+				roots[i]->add_child(node);
+			}
+			multiplayers[i].instantiate();
+			SceneTree::get_singleton()->set_multiplayer(multiplayers[i], roots[i]->get_path());
+		}
+		multiplayers[0]->set_rpc_batching_enabled(batching);
+		multiplayers[0]->set_multiplayer_peer(server_peer);
+		multiplayers[1]->set_multiplayer_peer(client_peer);
+		multiplayers[0]->poll();
+		multiplayers[1]->poll();
+
+		uint64_t usec = 0;
+		for (int t = 0; t < ticks; t++) {
+			if (t == 2) {
+				// Don't count path caching.
+				server_peer->sent_packets = 0;
+				server_peer->sent_bytes = 0;
+				usec = 0;
+			}
+			uint64_t begin = OS::get_singleton()->get_ticks_usec();
+			for (int j = 0; j < node_count; j++) {
+				Variant position = Vector2(j, t);
+				const Variant *argp[] = { &position };
+				roots[0]->get_child(j)->rpcp(0, "set_position", argp, 1);
+			}
+			multiplayers[0]->poll();
+			multiplayers[1]->poll();
+			usec += OS::get_singleton()->get_ticks_usec() - begin;
+		}
+		CHECK(Object::cast_to<Node2D>(roots[1]->get_child(node_count - 1))->get_position() == Vector2(node_count - 1, ticks - 1));
+
+		MESSAGE(vformat("%s: %d packets, %d bytes, %d usec.", batching ? "Batched" : "Unbatched", server_peer->sent_packets, server_peer->sent_bytes, usec));
+
+		for (int i = 0; i < 2; i++) {
+			SceneTree::get_singleton()->set_multiplayer(Ref<MultiplayerAPI>(), roots[i]->get_path());
+			multiplayers[i]->set_multiplayer_peer(Ref<MultiplayerPeer>());
+			memdelete(roots[i]);
+		}
+	}
+}
+
+} // namespace TestSceneRPCInterface
+
+#endif // TEST_SCENE_RPC_INTERFACE_H
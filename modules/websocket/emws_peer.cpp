@@ -137,10 +137,9 @@ Error EMWSPeer::get_packet(const uint8_t **r_buffer, int &r_buffer_size) {
 	}
 
 	int read = 0;
-	Error err = in_buffer.read_packet(packet_buffer.ptrw(), packet_buffer.size(), &was_string, read);
+	Error err = in_buffer.read_packet_view(r_buffer, packet_buffer.ptrw(), packet_buffer.size(), &was_string, read);
 	ERR_FAIL_COND_V(err != OK, err);
 
-	*r_buffer = packet_buffer.ptr();
 	r_buffer_size = read;
 
 	return OK;
@@ -192,8 +191,8 @@ void EMWSPeer::close(int p_code, String p_reason) {
 			ready_state = STATE_CLOSED;
 		}
 	}
-	in_buffer.clear();
-	packet_buffer.clear();
+	// The last packet read might still be in use (e.g. by WebSocketMultiplayerPeer), it's released on the next connection.
+	in_buffer.discard();
 }
 
 void EMWSPeer::poll() {
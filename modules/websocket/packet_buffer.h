@@ -46,6 +46,28 @@ private:
 	int _write_pos = 0;
 	int _read_pos = 0;
 	RingBuffer<uint8_t> _payload;
+	int _pending_release = 0; // Payload of the last packet read in place, released on the next read.
+
+	void _release_payload() {
+		if (_pending_release) {
+			_payload.advance_read(_pending_release);
+			_pending_release = 0;
+		}
+	}
+
+	bool _pop_packet(_Packet &r_packet) {
+		_release_payload();
+		if (_queued < 1) {
+			return false;
+		}
+		r_packet = _packets[_read_pos];
+		_read_pos += 1;
+		if (_read_pos >= _packets.size()) {
+			_read_pos = 0;
+		}
+		_queued -= 1;
+		return true;
+	}
 
 public:
 	Error write_packet(const uint8_t *p_payload, uint32_t p_size, const T *p_info) {
@@ -75,13 +97,8 @@ public:
 	}
 
 	Error read_packet(uint8_t *r_payload, int p_bytes, T *r_info, int &r_read) {
-		ERR_FAIL_COND_V(_queued < 1, ERR_UNAVAILABLE);
-		_Packet p = _packets[_read_pos];
-		_read_pos += 1;
-		if (_read_pos >= _packets.size()) {
-			_read_pos = 0;
-		}
-		_queued -= 1;
+		_Packet p;
+		ERR_FAIL_COND_V(!_pop_packet(p), ERR_UNAVAILABLE);
 
 		ERR_FAIL_COND_V(_payload.data_left() < (int)p.size, ERR_BUG);
 		ERR_FAIL_COND_V(p_bytes < (int)p.size, ERR_OUT_OF_MEMORY);
@@ -92,9 +109,32 @@ public:
 		return OK;
 	}
 
+	// Like read_packet(), but points r_payload to the payload in the ring buffer, which stays valid until the next read.
+	// The payload is only copied to r_scratch when it wraps around the end of the ring buffer.
+	Error read_packet_view(const uint8_t **r_payload, uint8_t *r_scratch, int p_scratch_size, T *r_info, int &r_read) {
+		_Packet p;
+		ERR_FAIL_COND_V(!_pop_packet(p), ERR_UNAVAILABLE);
+
+		ERR_FAIL_COND_V(_payload.data_left() < (int)p.size, ERR_BUG);
+
+		const uint8_t *view = _payload.get_read_ptr(p.size);
+		if (view) {
+			*r_payload = view;
+			_pending_release = p.size;
+		} else {
+			ERR_FAIL_COND_V(p_scratch_size < (int)p.size, ERR_OUT_OF_MEMORY);
+			_payload.read(r_scratch, p.size);
+			*r_payload = r_scratch;
+		}
+		r_read = p.size;
+		memcpy(r_info, &p.info, sizeof(T));
+		return OK;
+	}
+
 	void resize(int p_buf_shift, int p_max_packets) {
 		_payload.resize(p_buf_shift);
 		_packets.resize(p_max_packets);
+		_pending_release = 0;
 		_read_pos = 0;
 		_write_pos = 0;
 		_queued = 0;
@@ -104,9 +144,19 @@ public:
 		return _queued;
 	}
 
+	// Drops the queued packets, but keeps the memory, so the last packet read stays valid until the next resize.
+	void discard() {
+		_payload.clear();
+		_pending_release = 0;
+		_read_pos = 0;
+		_write_pos = 0;
+		_queued = 0;
+	}
+
 	void clear() {
 		_payload.resize(0);
 		_packets.resize(0);
+		_pending_release = 0;
 		_read_pos = 0;
 		_write_pos = 0;
 		_queued = 0;
@@ -0,0 +1,84 @@
+/**************************************************************************/
+/*  test_packet_buffer.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_PACKET_BUFFER_H
+#define TEST_PACKET_BUFFER_H
+
+#include "../packet_buffer.h"
+
+#include "tests/test_macros.h"
+
+namespace TestPacketBuffer {
+
+TEST_CASE("[WebSocket][PacketBuffer] Read packets in place") {
+	PacketBuffer<uint8_t> buffer;
+	buffer.resize(4, 8); // 16 bytes of payload, 15 usable.
+	uint8_t scratch[16];
+	const uint8_t *payload = nullptr;
+	int read = 0;
+	uint8_t info = 0;
+
+	const uint8_t a[6] = { 1, 2, 3, 4, 5, 6 };
+	const uint8_t b[8] = { 11, 12, 13, 14, 15, 16, 17, 18 };
+	const uint8_t c[6] = { 21, 22, 23, 24, 25, 26 };
+	uint8_t a_info = 1;
+	uint8_t b_info = 2;
+	uint8_t c_info = 3;
+
+	REQUIRE(buffer.write_packet(a, sizeof(a), &a_info) == OK);
+	REQUIRE(buffer.read_packet_view(&payload, scratch, sizeof(scratch), &info, read) == OK);
+	CHECK(info == 1);
+	CHECK(read == 6);
+	CHECK(payload != scratch);
+	CHECK(memcmp(payload, a, sizeof(a)) == 0);
+
+	// The last packet read is kept until the next read.
+	REQUIRE(buffer.write_packet(b, sizeof(b), &b_info) == OK);
+	CHECK(memcmp(payload, a, sizeof(a)) == 0);
+	REQUIRE(buffer.read_packet_view(&payload, scratch, sizeof(scratch), &info, read) == OK);
+	CHECK(info == 2);
+	CHECK(read == 8);
+	CHECK(payload != scratch);
+	CHECK(memcmp(payload, b, sizeof(b)) == 0);
+
+	// Packets wrapping around the end of the buffer are copied.
+	REQUIRE(buffer.write_packet(c, sizeof(c), &c_info) == OK);
+	CHECK(memcmp(payload, b, sizeof(b)) == 0);
+	REQUIRE(buffer.read_packet_view(&payload, scratch, sizeof(scratch), &info, read) == OK);
+	CHECK(info == 3);
+	CHECK(read == 6);
+	CHECK(payload == scratch);
+	CHECK(memcmp(payload, c, sizeof(c)) == 0);
+	CHECK(buffer.packets_left() == 0);
+}
+
+} // namespace TestPacketBuffer
+
+#endif // TEST_PACKET_BUFFER_H
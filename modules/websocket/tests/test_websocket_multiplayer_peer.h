@@ -0,0 +1,124 @@
+/**************************************************************************/
+/*  test_websocket_multiplayer_peer.h                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_WEBSOCKET_MULTIPLAYER_PEER_H
+#define TEST_WEBSOCKET_MULTIPLAYER_PEER_H
+
+#include "../websocket_multiplayer_peer.h"
+
+#include "core/os/os.h"
+
+#include "tests/test_macros.h"
+
+namespace TestWebSocketMultiplayerPeer {
+
+// Polls the peers until the condition is met, for up to 5 seconds.
+template <typename F>
+static bool poll_until(const LocalVector<Ref<WebSocketMultiplayerPeer>> &p_peers, F p_condition) {
+	for (int i = 0; i < 5000; i++) {
+		for (const Ref<WebSocketMultiplayerPeer> &peer : p_peers) {
+			if (peer->get_connection_status() != MultiplayerPeer::CONNECTION_DISCONNECTED) {
+				peer->poll();
+			}
+		}
+		if (p_condition()) {
+			return true;
+		}
+		OS::get_singleton()->delay_usec(1000);
+	}
+	return false;
+}
+
+TEST_CASE("[WebSocket][WebSocketMultiplayerPeer] Queued packets") {
+	const int port = 20517;
+	Ref<WebSocketMultiplayerPeer> server;
+	server.instantiate();
+	REQUIRE(server->create_server(port, IPAddress("127.0.0.1"), Ref<TLSOptions>()) == OK);
+
+	LocalVector<Ref<WebSocketMultiplayerPeer>> all_peers;
+	all_peers.push_back(server);
+	Ref<WebSocketMultiplayerPeer> clients[2];
+	for (Ref<WebSocketMultiplayerPeer> &client : clients) {
+		client.instantiate();
+		REQUIRE(client->create_client("ws://127.0.0.1:" + itos(port), Ref<TLSOptions>()) == OK);
+		all_peers.push_back(client);
+	}
+	REQUIRE(poll_until(all_peers, [&]() {
+		return clients[0]->get_connection_status() == MultiplayerPeer::CONNECTION_CONNECTED && clients[1]->get_connection_status() == MultiplayerPeer::CONNECTION_CONNECTED;
+	}));
+
+	// Two packets from the first client, one from the second.
+	const uint8_t packets[3][2] = { { 0, 1 }, { 0, 2 }, { 1, 1 } };
+	REQUIRE(clients[0]->put_packet(packets[0], 2) == OK);
+	REQUIRE(clients[0]->put_packet(packets[1], 2) == OK);
+	REQUIRE(clients[1]->put_packet(packets[2], 2) == OK);
+	REQUIRE(poll_until(all_peers, [&]() {
+		return server->get_available_packet_count() == 3;
+	}));
+
+	const uint8_t *buffer = nullptr;
+	int size = 0;
+	const int first_source = server->get_packet_peer();
+	REQUIRE(server->get_packet(&buffer, size) == OK);
+	REQUIRE(size == 2);
+	const int first_client = first_source == clients[0]->get_unique_id() ? 0 : 1;
+	CHECK(clients[first_client]->get_unique_id() == first_source);
+	CHECK(buffer[0] == first_client);
+	const int other_client = 1 - first_client;
+	const int other_count = other_client == 0 ? 2 : 1;
+
+	SUBCASE("Packets of peers closed through get_peer() are skipped") {
+		server->get_peer(first_source)->close();
+		CHECK(server->get_available_packet_count() == other_count);
+		for (int i = 0; i < other_count; i++) {
+			CHECK(server->get_packet_peer() == clients[other_client]->get_unique_id());
+			REQUIRE(server->get_packet(&buffer, size) == OK);
+			REQUIRE(size == 2);
+			CHECK(buffer[0] == other_client);
+			CHECK(buffer[1] == i + 1);
+		}
+		CHECK(server->get_available_packet_count() == 0);
+	}
+
+	SUBCASE("The last packet stays valid when its peer is removed") {
+		server->disconnect_peer(first_source, true);
+		CHECK(buffer[0] == first_client);
+		CHECK(buffer[1] == 1);
+		CHECK(server->get_available_packet_count() == other_count);
+	}
+
+	for (Ref<WebSocketMultiplayerPeer> &peer : all_peers) {
+		peer->close();
+	}
+}
+
+} // namespace TestWebSocketMultiplayerPeer
+
+#endif // TEST_WEBSOCKET_MULTIPLAYER_PEER_H
@@ -53,21 +53,80 @@ Ref<WebSocketPeer> WebSocketMultiplayerPeer::_create_peer() {
 void WebSocketMultiplayerPeer::_clear() {
 	connection_status = CONNECTION_DISCONNECTED;
 	unique_id = 0;
+	_unwatch_all();
 	peers_map.clear();
 	tcp_server.unref();
 	pending_peers.clear();
 	tls_server_options.unref();
-	if (current_packet.data != nullptr) {
-		memfree(current_packet.data);
-		current_packet.data = nullptr;
+	active_peers.clear();
+	incoming_packets.clear();
+	queued_packets.clear();
+}
+
+void WebSocketMultiplayerPeer::_queue_packets(int p_peer_id, const Ref<WebSocketPeer> &p_ws) {
+	int &queued = queued_packets[p_peer_id];
+	for (int available = p_ws->get_available_packet_count(); queued < available; queued++) {
+		incoming_packets.push_back(p_peer_id);
 	}
+}
 
-	for (Packet &E : incoming_packets) {
-		memfree(E.data);
-		E.data = nullptr;
+void WebSocketMultiplayerPeer::_drop_packets(int p_peer_id) const {
+	if (!queued_packets.erase(p_peer_id)) {
+		return;
+	}
+	List<int>::Element *E = incoming_packets.front();
+	while (E) {
+		List<int>::Element *next = E->next();
+		if (E->get() == p_peer_id) {
+			incoming_packets.erase(E);
+		}
+		E = next;
 	}
+}
 
-	incoming_packets.clear();
+void WebSocketMultiplayerPeer::_skip_closed_packets() const {
+	while (!incoming_packets.is_empty()) {
+		const int source = incoming_packets.front()->get();
+		HashMap<int, Ref<WebSocketPeer>>::ConstIterator E = peers_map.find(source);
+		if (E && E->value->get_ready_state() == WebSocketPeer::STATE_OPEN) {
+			return;
+		}
+		_drop_packets(source);
+	}
+}
+
+void WebSocketMultiplayerPeer::_watch_peer(int p_peer_id, const Ref<StreamPeerTCP> &p_tcp) {
+	active_peers.insert(p_peer_id);
+	if (poller.is_null()) {
+		return;
+	}
+	if (p_tcp->watch(poller, NetSocket::POLL_TYPE_IN, p_peer_id) != OK) {
+		// Poll every peer instead.
+		_unwatch_all();
+		return;
+	}
+	peer_streams[p_peer_id] = p_tcp;
+}
+
+void WebSocketMultiplayerPeer::_unwatch_peer(int p_peer_id) {
+	active_peers.erase(p_peer_id);
+	HashMap<int, Ref<StreamPeerTCP>>::Iterator E = peer_streams.find(p_peer_id);
+	if (!E) {
+		return;
+	}
+	E->value->unwatch();
+	peer_streams.remove(E);
+}
+
+void WebSocketMultiplayerPeer::_unwatch_all() {
+	for (KeyValue<int, Ref<StreamPeerTCP>> &E : peer_streams) {
+		E.value->unwatch();
+	}
+	peer_streams.clear();
+	if (tcp_server.is_valid()) {
+		tcp_server->unwatch();
+	}
+	poller.unref();
 }
 
 void WebSocketMultiplayerPeer::_bind_methods() {
@@ -111,6 +170,7 @@ void WebSocketMultiplayerPeer::_bind_methods() {
 // PacketPeer
 //
 int WebSocketMultiplayerPeer::get_available_packet_count() const {
+	_skip_closed_packets();
 	return incoming_packets.size();
 }
 
@@ -119,20 +179,16 @@ Error WebSocketMultiplayerPeer::get_packet(const uint8_t **r_buffer, int &r_buff
 
 	r_buffer_size = 0;
 
-	if (current_packet.data != nullptr) {
-		memfree(current_packet.data);
-		current_packet.data = nullptr;
-	}
-
+	_skip_closed_packets();
 	ERR_FAIL_COND_V(incoming_packets.is_empty(), ERR_UNAVAILABLE);
 
-	current_packet = incoming_packets.front()->get();
+	const int source = incoming_packets.front()->get();
 	incoming_packets.pop_front();
+	queued_packets[source]--;
 
-	*r_buffer = current_packet.data;
-	r_buffer_size = current_packet.size;
-
-	return OK;
+	// Read from the peer's buffer directly, the packet stays valid until its next read.
+	current_packet_peer = peers_map[source];
+	return current_packet_peer->get_packet(r_buffer, r_buffer_size);
 }
 
 Error WebSocketMultiplayerPeer::put_packet(const uint8_t *p_buffer, int p_buffer_size) {
@@ -141,13 +197,20 @@ Error WebSocketMultiplayerPeer::put_packet(const uint8_t *p_buffer, int p_buffer
 	if (is_server()) {
 		if (target_peer > 0) {
 			ERR_FAIL_COND_V_MSG(!peers_map.has(target_peer), ERR_INVALID_PARAMETER, "Peer not found: " + itos(target_peer));
-			get_peer(target_peer)->put_packet(p_buffer, p_buffer_size);
+			Ref<WebSocketPeer> &peer = peers_map[target_peer];
+			peer->put_packet(p_buffer, p_buffer_size);
+			if (peer->get_current_outbound_buffered_amount() > 0) {
+				active_peers.insert(target_peer); // Will be flushed when polling.
+			}
 		} else {
 			for (KeyValue<int, Ref<WebSocketPeer>> &E : peers_map) {
 				if (target_peer && -target_peer == E.key) {
 					continue; // Excluded.
 				}
 				E.value->put_packet(p_buffer, p_buffer_size);
+				if (E.value->get_current_outbound_buffered_amount() > 0) {
+					active_peers.insert(E.key);
+				}
 			}
 		}
 		return OK;
@@ -164,9 +227,10 @@ void WebSocketMultiplayerPeer::set_target_peer(int p_target_peer) {
 }
 
 int WebSocketMultiplayerPeer::get_packet_peer() const {
+	_skip_closed_packets();
 	ERR_FAIL_COND_V(incoming_packets.is_empty(), 1);
 
-	return incoming_packets.front()->get().source;
+	return incoming_packets.front()->get();
 }
 
 int WebSocketMultiplayerPeer::get_unique_id() const {
@@ -190,6 +254,13 @@ Error WebSocketMultiplayerPeer::create_server(int p_port, IPAddress p_bind_ip, R
 	unique_id = 1;
 	connection_status = CONNECTION_CONNECTED;
 	tls_server_options = p_options;
+	if (tls_server_options.is_null()) {
+		// TLS streams buffer decrypted data, so socket readiness only applies to plain connections.
+		poller = Ref<NetSocketPoller>(NetSocketPoller::create());
+		if (poller.is_valid() && tcp_server->watch(poller, 0) != OK) {
+			poller.unref();
+		}
+	}
 	return OK;
 }
 
@@ -230,7 +301,9 @@ void WebSocketMultiplayerPeer::_poll_client() {
 					peer->close(); // Will cause connection error on next poll.
 					ERR_FAIL_MSG("Invalid ID received from server");
 				}
-				unique_id = *((int32_t *)in_buffer);
+				int32_t id = 0;
+				memcpy(&id, in_buffer, sizeof(id)); // Packets are not aligned.
+				unique_id = id;
 				if (unique_id < 2) {
 					peer->close(); // Will cause connection error on next poll.
 					ERR_FAIL_MSG("Invalid ID received from server");
@@ -241,21 +314,7 @@ void WebSocketMultiplayerPeer::_poll_client() {
 				return; // Still waiting for an ID.
 			}
 		}
-		int pkts = peer->get_available_packet_count();
-		while (pkts > 0 && peer->get_ready_state() == WebSocketPeer::STATE_OPEN) {
-			const uint8_t *in_buffer;
-			int size = 0;
-			Error err = peer->get_packet(&in_buffer, size);
-			ERR_FAIL_COND(err != OK);
-			ERR_FAIL_COND(size <= 0);
-			Packet packet;
-			packet.data = (uint8_t *)memalloc(size);
-			memcpy(packet.data, in_buffer, size);
-			packet.size = size;
-			packet.source = 1;
-			incoming_packets.push_back(packet);
-			pkts--;
-		}
+		_queue_packets(1, peer);
 	} else if (peer->get_ready_state() == WebSocketPeer::STATE_CLOSED) {
 		if (connection_status == CONNECTION_CONNECTED) {
 			emit_signal(SNAME("peer_disconnected"), 1);
@@ -278,8 +337,22 @@ void WebSocketMultiplayerPeer::_poll_server() {
 	ERR_FAIL_COND(connection_status != CONNECTION_CONNECTED); // Bug.
 	ERR_FAIL_COND(tcp_server.is_null() || !tcp_server->is_listening()); // Bug.
 
+	bool server_ready = true;
+	if (poller.is_valid()) {
+		// Connected peers with incoming data (or errors) will be polled along with the active ones.
+		server_ready = false;
+		poller->wait(0, ready_ids);
+		for (const uint64_t &id : ready_ids) {
+			if (id == 0) {
+				server_ready = true; // The server socket.
+			} else if (peers_map.has(int(id))) {
+				active_peers.insert(int(id));
+			}
+		}
+	}
+
 	// Accept new connections.
-	if (!is_refusing_new_connections() && tcp_server->is_connection_available()) {
+	if (!is_refusing_new_connections() && server_ready && tcp_server->is_connection_available()) {
 		PendingPeer peer;
 		peer.time = OS::get_singleton()->get_ticks_msec();
 		peer.tcp = tcp_server->take_connection();
@@ -313,6 +386,7 @@ void WebSocketMultiplayerPeer::_poll_server() {
 				Error err = peer.ws->put_packet((const uint8_t *)&peer_id, sizeof(peer_id));
 				if (err == OK) {
 					peers_map[id] = peer.ws;
+					_watch_peer(id, peer.tcp);
 					emit_signal("peer_connected", id);
 				} else {
 					ERR_PRINT("Failed to send ID to newly connected peer.");
@@ -365,37 +439,41 @@ void WebSocketMultiplayerPeer::_poll_server() {
 	to_remove.clear();
 
 	// Process connected peers.
-	for (KeyValue<int, Ref<WebSocketPeer>> &E : peers_map) {
-		Ref<WebSocketPeer> ws = E.value;
-		int id = E.key;
+	poll_ids.clear();
+	if (poller.is_valid()) {
+		for (const int &id : active_peers) {
+			poll_ids.push_back(id);
+		}
+	} else {
+		for (const KeyValue<int, Ref<WebSocketPeer>> &E : peers_map) {
+			poll_ids.push_back(E.key);
+		}
+	}
+	for (const int &id : poll_ids) {
+		HashMap<int, Ref<WebSocketPeer>>::Iterator E = peers_map.find(id);
+		if (!E) {
+			active_peers.erase(id);
+			continue;
+		}
+		Ref<WebSocketPeer> ws = E->value;
 		ws->poll();
 		if (ws->get_ready_state() != WebSocketPeer::STATE_OPEN) {
 			to_remove.insert(id); // Disconnected.
 			continue;
 		}
-		// Fetch packets
-		int pkts = ws->get_available_packet_count();
-		while (pkts > 0 && ws->get_ready_state() == WebSocketPeer::STATE_OPEN) {
-			const uint8_t *in_buffer;
-			int size = 0;
-			Error err = ws->get_packet(&in_buffer, size);
-			if (err != OK || size <= 0) {
-				break;
-			}
-			Packet packet;
-			packet.data = (uint8_t *)memalloc(size);
-			memcpy(packet.data, in_buffer, size);
-			packet.size = size;
-			packet.source = E.key;
-			incoming_packets.push_back(packet);
-			pkts--;
+		if (ws->get_current_outbound_buffered_amount() == 0) {
+			active_peers.erase(id); // Idle until its socket is ready again.
 		}
+		// Queue new packets.
+		_queue_packets(id, ws);
 	}
 
 	// Remove disconnected peers.
 	for (const int &pid : to_remove) {
 		emit_signal(SNAME("peer_disconnected"), pid);
 		peers_map.erase(pid);
+		_unwatch_peer(pid);
+		_drop_packets(pid);
 	}
 }
 
@@ -416,6 +494,7 @@ MultiplayerPeer::ConnectionStatus WebSocketMultiplayerPeer::get_connection_statu
 
 Ref<WebSocketPeer> WebSocketMultiplayerPeer::get_peer(int p_id) const {
 	ERR_FAIL_COND_V(!peers_map.has(p_id), Ref<WebSocketPeer>());
+	active_peers.insert(p_id);
 	return peers_map[p_id];
 }
 
@@ -481,8 +560,11 @@ int WebSocketMultiplayerPeer::get_peer_port(int p_peer_id) const {
 void WebSocketMultiplayerPeer::disconnect_peer(int p_peer_id, bool p_force) {
 	ERR_FAIL_COND(!peers_map.has(p_peer_id));
 	peers_map[p_peer_id]->close();
+	active_peers.insert(p_peer_id); // Poll until closed.
+	_drop_packets(p_peer_id); // Can't be read anymore.
 	if (p_force) {
 		peers_map.erase(p_peer_id);
+		_unwatch_peer(p_peer_id);
 		if (!is_server()) {
 			_clear();
 		}
@@ -36,6 +36,7 @@
 #include "core/error/error_list.h"
 #include "core/io/stream_peer_tls.h"
 #include "core/io/tcp_server.h"
+#include "core/templates/hash_set.h"
 #include "core/templates/list.h"
 #include "scene/main/multiplayer_peer.h"
 
@@ -55,12 +56,6 @@ protected:
 		PROTO_SIZE = 9
 	};
 
-	struct Packet {
-		int source = 0;
-		uint8_t *data = nullptr;
-		uint32_t size = 0;
-	};
-
 	struct PendingPeer {
 		uint64_t time = 0;
 		Ref<StreamPeerTCP> tcp;
@@ -76,9 +71,19 @@ protected:
 
 	ConnectionStatus connection_status = CONNECTION_DISCONNECTED;
 
-	List<Packet> incoming_packets;
+	// Received packets stay in the buffer of the peer they came from until read, only their source is queued here.
+	// Packets are read from the buffer of the peer they came from. Packets of peers closed through get_peer() can't be read anymore, and are skipped.
+	mutable List<int> incoming_packets;
+	mutable HashMap<int, int> queued_packets; // Number of packets of each peer in incoming_packets.
+	Ref<WebSocketPeer> current_packet_peer; // Keeps the last packet read valid until the next one, even if its peer is removed.
 	HashMap<int, Ref<WebSocketPeer>> peers_map;
-	Packet current_packet;
+
+	// When serving without TLS, connected peers are only polled when their socket is ready, or while they still have something to do.
+	Ref<NetSocketPoller> poller;
+	HashMap<int, Ref<StreamPeerTCP>> peer_streams;
+	mutable HashSet<int> active_peers; // Peers returned by get_peer() might be written to or closed by the user.
+	LocalVector<uint64_t> ready_ids;
+	LocalVector<int> poll_ids;
 
 	int target_peer = 0;
 	int unique_id = 0;
@@ -89,6 +94,14 @@ protected:
 	void _poll_server();
 	void _clear();
 
+	void _watch_peer(int p_peer_id, const Ref<StreamPeerTCP> &p_tcp);
+	void _unwatch_peer(int p_peer_id);
+	void _unwatch_all();
+
+	void _queue_packets(int p_peer_id, const Ref<WebSocketPeer> &p_ws);
+	void _drop_packets(int p_peer_id) const;
+	void _skip_closed_packets() const;
+
 public:
 	/* MultiplayerPeer */
 	virtual void set_target_peer(int p_target_peer) override;
@@ -735,10 +735,9 @@ Error WSLPeer::get_packet(const uint8_t **r_buffer, int &r_buffer_size) {
 	}
 
 	int read = 0;
-	uint8_t *rw = packet_buffer.ptrw();
-	in_buffer.read_packet(rw, packet_buffer.size(), &was_string, read);
+	Error err = in_buffer.read_packet_view(r_buffer, packet_buffer.ptrw(), packet_buffer.size(), &was_string, read);
+	ERR_FAIL_COND_V(err != OK, err);
 
-	*r_buffer = rw;
 	r_buffer_size = read;
 
 	return OK;
@@ -780,8 +779,8 @@ void WSLPeer::close(int p_code, String p_reason) {
 		}
 	}
 
-	in_buffer.clear();
-	packet_buffer.resize(0);
+	// The last packet read might still be in use (e.g. by WebSocketMultiplayerPeer), it's released on the next connection.
+	in_buffer.discard();
 }
 
 IPAddress WSLPeer::get_connected_host() const {
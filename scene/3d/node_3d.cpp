@@ -108,25 +108,69 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		return;
 	}
 
-	for (Node3D *&E : data.children) {
-		if (E->data.top_level) {
-			continue; //don't propagate to a top_level
+	// Walk the subtree with an explicit stack instead of recursing once per node.
+	// Children are pushed in order, so they are popped last to first; replaying the visited
+	// nodes backwards then yields the same post-order (children in order, then the parent)
+	// in which the recursive version queued transform notifications.
+	// The scratch buffers are kept per thread, as nothing called from here can re-enter this function.
+	thread_local LocalVector<Node3D *> propagate_stack;
+	thread_local LocalVector<Node3D *> propagate_visited;
+	const uint32_t stack_base = propagate_stack.size();
+	const uint32_t visited_base = propagate_visited.size();
+	propagate_stack.push_back(this);
+
+	while (propagate_stack.size() > stack_base) {
+		Node3D *node = propagate_stack[propagate_stack.size() - 1];
+		propagate_stack.resize(propagate_stack.size() - 1);
+		propagate_visited.push_back(node);
+
+		node->_update_children_order();
+		for (Node3D *child : node->data.children) {
+			if (child->data.top_level) {
+				continue; // Don't propagate to a top_level.
+			}
+			propagate_stack.push_back(child);
 		}
-		E->_propagate_transform_changed(p_origin);
 	}
+
+	for (uint32_t i = propagate_visited.size(); i > visited_base; i--) {
+		Node3D *node = propagate_visited[i - 1];
 #ifdef TOOLS_ENABLED
-	if ((!data.gizmos.is_empty() || data.notify_transform) && !data.ignore_notification && !xform_change.in_list()) {
+		if ((!node->data.gizmos.is_empty() || node->data.notify_transform) && !node->data.ignore_notification && !node->xform_change.in_list()) {
 #else
-	if (data.notify_transform && !data.ignore_notification && !xform_change.in_list()) {
+		if (node->data.notify_transform && !node->data.ignore_notification && !node->xform_change.in_list()) {
 #endif
-		if (likely(is_accessible_from_caller_thread())) {
-			get_tree()->xform_change_list.add(&xform_change);
-		} else {
-			// This should very rarely happen, but if it does at least make sure the notification is received eventually.
-			callable_mp(this, &Node3D::_propagate_transform_changed_deferred).call_deferred();
+			if (likely(node->is_accessible_from_caller_thread())) {
+				node->get_tree()->xform_change_list.add(&node->xform_change);
+			} else {
+				// This should very rarely happen, but if it does at least make sure the notification is received eventually.
+				callable_mp(node, &Node3D::_propagate_transform_changed_deferred).call_deferred();
+			}
+		}
+		node->_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM);
+	}
+	propagate_visited.resize(visited_base);
+}
+
+void Node3D::_update_children_order_impl() {
+	struct TreeOrder {
+		_FORCE_INLINE_ bool operator()(const Node3D *p_a, const Node3D *p_b) const {
+			return p_a->get_index() < p_b->get_index();
 		}
+	};
+
+	data.children.sort_custom<TreeOrder>();
+	for (uint32_t i = 0; i < data.children.size(); i++) {
+		data.children[i]->data.index_in_parent = i;
+	}
+	data.children_order_dirty = false;
+}
+
+void Node3D::move_child_notify(Node *p_child) {
+	Node::move_child_notify(p_child);
+	if (Object::cast_to<Node3D>(p_child)) {
+		data.children_order_dirty = true;
 	}
-	_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM);
 }
 
 void Node3D::_notification(int p_what) {
@@ -141,9 +185,15 @@ void Node3D::_notification(int p_what) {
 			}
 
 			if (data.parent) {
-				data.C = data.parent->data.children.push_back(this);
+				LocalVector<Node3D *> &siblings = data.parent->data.children;
+				if (!siblings.is_empty() && siblings[siblings.size() - 1]->get_index() > get_index()) {
+					// Added before the last sibling, e.g. as a front internal child.
+					data.parent->data.children_order_dirty = true;
+				}
+				data.index_in_parent = siblings.size();
+				siblings.push_back(this);
 			} else {
-				data.C = nullptr;
+				data.index_in_parent = UINT32_MAX;
 			}
 
 			if (data.top_level && !Engine::get_singleton()->is_editor_hint()) {
@@ -171,11 +221,19 @@ void Node3D::_notification(int p_what) {
 			if (xform_change.in_list()) {
 				get_tree()->xform_change_list.remove(&xform_change);
 			}
-			if (data.C) {
-				data.parent->data.children.erase(data.C);
+			if (data.index_in_parent != UINT32_MAX) {
+				// Swap with the last child so removal is O(1), the order is restored when next iterated.
+				LocalVector<Node3D *> &siblings = data.parent->data.children;
+				Node3D *last = siblings[siblings.size() - 1];
+				if (last != this) {
+					siblings[data.index_in_parent] = last;
+					last->data.index_in_parent = data.index_in_parent;
+					data.parent->data.children_order_dirty = true;
+				}
+				siblings.resize(siblings.size() - 1);
 			}
 			data.parent = nullptr;
-			data.C = nullptr;
+			data.index_in_parent = UINT32_MAX;
 			_update_visibility_parent(true);
 			_disable_client_physics_interpolation();
 		} break;
@@ -462,33 +520,67 @@ Transform3D Node3D::get_global_transform_interpolated() {
 	return _get_global_transform_interpolated(Engine::get_singleton()->get_physics_interpolation_fraction());
 }
 
-Transform3D Node3D::get_global_transform() const {
-	ERR_FAIL_COND_V(!is_inside_tree(), Transform3D());
+void Node3D::_update_global_transform() const {
+	// Collect this node and every dirty ancestor up to the first clean one (or the root of the hierarchy),
+	// then resolve them top-down in a single linear pass rather than recursing through each parent.
+	uint32_t chain_size = 1;
+	for (const Node3D *node = this; node->data.parent && !node->data.top_level && node->data.parent->_test_dirty_bits(DIRTY_GLOBAL_TRANSFORM); node = node->data.parent) {
+		chain_size++;
+	}
 
-	/* Due to how threads work at scene level, while this global transform won't be able to be changed from outside a thread,
-	 * it is possible that multiple threads can access it while it's dirty from previous work. Due to this, we must ensure that
-	 * the dirty/update process is thread safe by utilizing atomic copies.
-	 */
+	// Hierarchies can be arbitrarily deep, so only use the stack for reasonably short chains.
+	const uint32_t MAX_STACK_CHAIN = 256;
+	LocalVector<const Node3D *> heap_chain;
+	const Node3D **chain;
+	if (chain_size <= MAX_STACK_CHAIN) {
+		chain = (const Node3D **)alloca(sizeof(const Node3D *) * chain_size);
+	} else {
+		heap_chain.resize(chain_size);
+		chain = heap_chain.ptr();
+	}
+	const Node3D *node = this;
+	for (uint32_t i = 0; i < chain_size; i++) {
+		chain[i] = node;
+		node = node->data.parent;
+	}
+
+	for (int64_t i = int64_t(chain_size) - 1; i >= 0; i--) {
+		const Node3D *current = chain[i];
+		uint32_t dirty = current->_read_dirty_mask();
+		if (!(dirty & DIRTY_GLOBAL_TRANSFORM)) {
+			continue; // Already resolved, possibly by another thread.
+		}
 
-	uint32_t dirty = _read_dirty_mask();
-	if (dirty & DIRTY_GLOBAL_TRANSFORM) {
 		if (dirty & DIRTY_LOCAL_TRANSFORM) {
-			_update_local_transform(); // Update local transform atomically.
+			current->_update_local_transform(); // Update local transform atomically.
 		}
 
 		Transform3D new_global;
-		if (data.parent && !data.top_level) {
-			new_global = data.parent->get_global_transform() * data.local_transform;
+		if (current->data.parent && !current->data.top_level) {
+			new_global = current->data.parent->data.global_transform * current->data.local_transform;
 		} else {
-			new_global = data.local_transform;
+			new_global = current->data.local_transform;
 		}
 
-		if (data.disable_scale) {
+		if (current->data.disable_scale) {
 			new_global.basis.orthonormalize();
 		}
 
-		data.global_transform = new_global;
-		_clear_dirty_bits(DIRTY_GLOBAL_TRANSFORM);
+		current->data.global_transform = new_global;
+		current->_clear_dirty_bits(DIRTY_GLOBAL_TRANSFORM);
+	}
+}
+
+Transform3D Node3D::get_global_transform() const {
+	ERR_FAIL_COND_V(!is_inside_tree(), Transform3D());
+
+	/* Due to how threads work at scene level, while this global transform won't be able to be changed from outside a thread,
+	 * it is possible that multiple threads can access it while it's dirty from previous work. Due to this, we must ensure that
+	 * the dirty/update process is thread safe by utilizing atomic copies.
+	 */
+
+	if (_test_dirty_bits(DIRTY_GLOBAL_TRANSFORM)) {
+		_update_global_transform();
 	}
 
 	return data.global_transform;
@@ -906,12 +998,30 @@ void Node3D::_propagate_visibility_changed() {
 	}
 #endif
 
+	if (data.children.is_empty()) {
+		return;
+	}
+
+	// Visibility callbacks may add, remove or free children, so iterate over a snapshot
+	// and skip any child that is gone or no longer parented here by the time it is reached.
+	// The snapshots of all levels share one buffer per thread: nested calls append theirs
+	// after this one and truncate back to it before returning.
+	thread_local LocalVector<ObjectID> visibility_children;
+	_update_children_order();
+	const uint32_t base = visibility_children.size();
 	for (Node3D *c : data.children) {
-		if (!c || !c->data.visible) {
+		visibility_children.push_back(c->get_instance_id());
+	}
+	const uint32_t end = visibility_children.size();
+
+	for (uint32_t i = base; i < end; i++) {
+		Node3D *c = Object::cast_to<Node3D>(ObjectDB::get_instance(visibility_children[i]));
+		if (!c || c->data.parent != this || !c->data.visible) {
 			continue;
 		}
 		c->_propagate_visibility_changed();
 	}
+	visibility_children.resize(base);
 }
 
 void Node3D::show() {
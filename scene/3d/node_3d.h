@@ -126,8 +126,11 @@ private:
 		RID visibility_parent;
 
 		Node3D *parent = nullptr;
-		List<Node3D *> children;
-		List<Node3D *>::Element *C = nullptr;
+		// Stored contiguously so transform propagation iterates cache-friendly memory.
+		// Removal swaps the last child in, the tree order is restored lazily by _update_children_order().
+		LocalVector<Node3D *> children;
+		uint32_t index_in_parent = UINT32_MAX;
+		bool children_order_dirty = false;
 
 		ClientPhysicsInterpolationData *client_physics_interpolation_data = nullptr;
 
@@ -150,8 +153,16 @@ private:
 
 	void _update_gizmos();
 	void _notify_dirty();
+	void _update_global_transform() const;
 	void _propagate_transform_changed(Node3D *p_origin);
 
+	_FORCE_INLINE_ void _update_children_order() {
+		if (unlikely(data.children_order_dirty)) {
+			_update_children_order_impl();
+		}
+	}
+	void _update_children_order_impl();
+
 	void _propagate_visibility_changed();
 
 	void _propagate_visibility_parent();
@@ -172,6 +183,8 @@ protected:
 	void _notification(int p_what);
 	static void _bind_methods();
 
+	virtual void move_child_notify(Node *p_child) override;
+
 	void _validate_property(PropertyInfo &p_property) const;
 
 	bool _property_can_revert(const StringName &p_name) const;
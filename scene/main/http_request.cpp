@@ -32,10 +32,143 @@
 #include "core/io/compression.h"
 #include "scene/main/timer.h"
 
+Mutex HTTPRequest::connection_pool_mutex;
+HashMap<String, LocalVector<HTTPRequest::PooledConnection>> HTTPRequest::connection_pool;
+uint64_t HTTPRequest::connection_pool_last_expiry = 0;
+
 Error HTTPRequest::_request() {
+	if (client->get_status() == HTTPClient::STATUS_CONNECTED) {
+		return OK; // Kept-alive connection taken from the pool.
+	}
+	reused_connection = false;
 	return client->connect_to_host(url, port, use_tls ? tls_options : nullptr);
 }
 
+bool HTTPRequest::_retry_request() {
+	// The server may have closed a pooled connection while it was idle, try again once on a new one.
+	if (!reused_connection || got_response) {
+		return false;
+	}
+	client->close();
+	request_sent = false;
+	return _request() == OK;
+}
+
+Ref<HTTPClient> HTTPRequest::_create_client() const {
+	Ref<HTTPClient> new_client = Ref<HTTPClient>(HTTPClient::create());
+	new_client->set_read_chunk_size(download_chunk_size);
+	if (!http_proxy_host.is_empty()) {
+		new_client->set_http_proxy(http_proxy_host, http_proxy_port);
+	}
+	if (!https_proxy_host.is_empty()) {
+		new_client->set_https_proxy(https_proxy_host, https_proxy_port);
+	}
+	return new_client;
+}
+
+String HTTPRequest::_get_connection_key() const {
+	String key = vformat("%s:%d", url, port);
+	if (use_tls) {
+		// Only share connections whose server was verified the same way.
+		Ref<X509Certificate> ca = tls_options->get_trusted_ca_chain();
+		key += vformat(" tls:%d:%s:%d", tls_options->is_unsafe_client(), tls_options->get_common_name_override(), ca.is_valid() ? (uint64_t)ca->get_instance_id() : 0);
+	}
+	const String &proxy_host = use_tls ? https_proxy_host : http_proxy_host;
+	if (!proxy_host.is_empty()) {
+		key += vformat(" proxy:%s:%d", proxy_host, use_tls ? https_proxy_port : http_proxy_port);
+	}
+	return key;
+}
+
+void HTTPRequest::_acquire_connection() {
+	reused_connection = false;
+
+	// Only requests that are safe to send twice may use a pooled connection, see _retry_request().
+	bool idempotent = method == HTTPClient::METHOD_GET || method == HTTPClient::METHOD_HEAD || method == HTTPClient::METHOD_PUT || method == HTTPClient::METHOD_DELETE || method == HTTPClient::METHOD_OPTIONS || method == HTTPClient::METHOD_TRACE;
+	if (!reuse_connections || !idempotent) {
+		return;
+	}
+
+	const String key = _get_connection_key();
+	const uint64_t now = OS::get_singleton()->get_ticks_msec();
+
+	MutexLock lock(connection_pool_mutex);
+	LocalVector<PooledConnection> *idle = connection_pool.getptr(key);
+	if (!idle) {
+		return;
+	}
+	while (!idle->is_empty()) {
+		// Most recently used first, it is the least likely to have timed out on the server.
+		PooledConnection pooled = (*idle)[idle->size() - 1];
+		idle->remove_at(idle->size() - 1);
+		pooled.client->poll();
+		if (now - pooled.idle_since < CONNECTION_POOL_IDLE_MSEC && pooled.client->get_status() == HTTPClient::STATUS_CONNECTED) {
+			client = pooled.client;
+			client->set_read_chunk_size(download_chunk_size);
+			reused_connection = true;
+			break;
+		}
+		pooled.client->close();
+	}
+	if (idle->is_empty()) {
+		connection_pool.erase(key);
+	}
+}
+
+void HTTPRequest::_release_connection() {
+	PooledConnection pooled;
+	pooled.client = client;
+	pooled.idle_since = OS::get_singleton()->get_ticks_msec();
+	client = _create_client();
+
+	const String key = _get_connection_key();
+
+	MutexLock lock(connection_pool_mutex);
+	LocalVector<PooledConnection> &idle = connection_pool[key];
+	if (idle.size() >= CONNECTION_POOL_MAX_IDLE) {
+		idle[0].client->close();
+		idle.remove_at(0);
+	}
+	idle.push_back(pooled);
+}
+
+bool HTTPRequest::_expire_idle_connections() {
+	const uint64_t now = OS::get_singleton()->get_ticks_msec();
+
+	MutexLock lock(connection_pool_mutex);
+	if (now - connection_pool_last_expiry < CONNECTION_POOL_EXPIRY_INTERVAL_MSEC) {
+		return !connection_pool.is_empty();
+	}
+	connection_pool_last_expiry = now;
+
+	LocalVector<String> empty_keys;
+	for (KeyValue<String, LocalVector<PooledConnection>> &E : connection_pool) {
+		// Connections are added to the back, so the oldest ones are first.
+		LocalVector<PooledConnection> &idle = E.value;
+		while (!idle.is_empty() && now - idle[0].idle_since >= CONNECTION_POOL_IDLE_MSEC) {
+			idle[0].client->close();
+			idle.remove_at(0);
+		}
+		if (idle.is_empty()) {
+			empty_keys.push_back(E.key);
+		}
+	}
+	for (const String &key : empty_keys) {
+		connection_pool.erase(key);
+	}
+	return !connection_pool.is_empty();
+}
+
+void HTTPRequest::clear_connection_pool() {
+	MutexLock lock(connection_pool_mutex);
+	for (KeyValue<String, LocalVector<PooledConnection>> &E : connection_pool) {
+		for (PooledConnection &pooled : E.value) {
+			pooled.client->close();
+		}
+	}
+	connection_pool.clear();
+}
+
 Error HTTPRequest::_parse_url(const String &p_url) {
 	use_tls = false;
 	request_string = "";
@@ -140,6 +273,8 @@ Error HTTPRequest::request_raw(const String &p_url, const Vector<String> &p_cust
 
 	request_data = p_request_data_raw;
 
+	_acquire_connection();
+
 	requesting = true;
 
 	if (use_threads.is_set()) {
@@ -182,6 +317,10 @@ void HTTPRequest::_thread_func(void *p_userdata) {
 }
 
 void HTTPRequest::cancel_request() {
+	_stop_request(false);
+}
+
+void HTTPRequest::_stop_request(bool p_keep_connection) {
 	timer->stop();
 
 	if (!requesting) {
@@ -199,7 +338,12 @@ void HTTPRequest::cancel_request() {
 
 	file.unref();
 	decompressor.unref();
-	client->close();
+	if (p_keep_connection && client->get_status() == HTTPClient::STATUS_CONNECTED) {
+		_release_connection();
+		set_process_internal(true); // To close idle connections once they expire.
+	} else {
+		client->close();
+	}
 	body.clear();
 	got_response = false;
 	response_code = -1;
@@ -290,6 +434,9 @@ bool HTTPRequest::_handle_response(bool *ret_value) {
 bool HTTPRequest::_update_connection() {
 	switch (client->get_status()) {
 		case HTTPClient::STATUS_DISCONNECTED: {
+			if (_retry_request()) {
+				return false;
+			}
 			_defer_done(RESULT_CANT_CONNECT, 0, PackedStringArray(), PackedByteArray());
 			return true; // End it, since it's disconnected.
 		} break;
@@ -342,6 +489,9 @@ bool HTTPRequest::_update_connection() {
 				int size = request_data.size();
 				Error err = client->request(method, request_string, headers, size > 0 ? request_data.ptr() : nullptr, size);
 				if (err != OK) {
+					if (_retry_request()) {
+						return false;
+					}
 					_defer_done(RESULT_CONNECTION_ERROR, 0, PackedStringArray(), PackedByteArray());
 					return true;
 				}
@@ -392,57 +542,59 @@ bool HTTPRequest::_update_connection() {
 				return false;
 			}
 
-			PackedByteArray chunk;
-			if (decompressor.is_null()) {
-				// Chunk can be read directly.
-				chunk = client->read_response_body_chunk();
-				downloaded.add(chunk.size());
-			} else {
-				// Chunk is the result of decompression.
-				PackedByteArray compressed = client->read_response_body_chunk();
-				downloaded.add(compressed.size());
+			client->read_response_body_into(chunk_buffer);
+			downloaded.add(chunk_buffer.size());
 
+			const uint8_t *chunk = chunk_buffer.ptr();
+			int chunk_size = chunk_buffer.size();
+			PackedByteArray decompressed;
+			if (decompressor.is_valid()) {
+				// Chunk is the result of decompression.
 				int pos = 0;
-				int left = compressed.size();
+				int left = chunk_buffer.size();
 				while (left) {
 					int w = 0;
-					Error err = decompressor->put_partial_data(compressed.ptr() + pos, left, w);
+					Error err = decompressor->put_partial_data(chunk_buffer.ptr() + pos, left, w);
 					if (err == OK) {
 						PackedByteArray dc;
 						dc.resize(decompressor->get_available_bytes());
 						err = decompressor->get_data(dc.ptrw(), dc.size());
-						chunk.append_array(dc);
+						decompressed.append_array(dc);
 					}
 					if (err != OK) {
 						_defer_done(RESULT_BODY_DECOMPRESS_FAILED, response_code, response_headers, PackedByteArray());
 						return true;
 					}
 					// We need this check here because a "zip bomb" could result in a chunk of few kilos decompressing into gigabytes of data.
-					if (body_size_limit >= 0 && final_body_size.get() + chunk.size() > body_size_limit) {
+					if (body_size_limit >= 0 && final_body_size.get() + decompressed.size() > body_size_limit) {
 						_defer_done(RESULT_BODY_SIZE_LIMIT_EXCEEDED, response_code, response_headers, PackedByteArray());
 						return true;
 					}
 					pos += w;
 					left -= w;
 				}
+				chunk = decompressed.ptr();
+				chunk_size = decompressed.size();
 			}
-			final_body_size.add(chunk.size());
+			final_body_size.add(chunk_size);
 
 			if (body_size_limit >= 0 && final_body_size.get() > body_size_limit) {
 				_defer_done(RESULT_BODY_SIZE_LIMIT_EXCEEDED, response_code, response_headers, PackedByteArray());
 				return true;
 			}
 
-			if (chunk.size()) {
+			if (chunk_size) {
 				if (file.is_valid()) {
-					const uint8_t *r = chunk.ptr();
-					file->store_buffer(r, chunk.size());
+					// Written straight from the read buffer, the body is never kept in memory.
+					file->store_buffer(chunk, chunk_size);
 					if (file->get_error() != OK) {
 						_defer_done(RESULT_DOWNLOAD_FILE_WRITE_ERROR, response_code, response_headers, PackedByteArray());
 						return true;
 					}
 				} else {
-					body.append_array(chunk);
+					int ofs = body.size();
+					body.resize(ofs + chunk_size);
+					memcpy(body.ptrw() + ofs, chunk, chunk_size);
 				}
 			}
 
@@ -461,6 +613,9 @@ bool HTTPRequest::_update_connection() {
 
 		} break; // Request resulted in body: break which must be read.
 		case HTTPClient::STATUS_CONNECTION_ERROR: {
+			if (_retry_request()) {
+				return false;
+			}
 			_defer_done(RESULT_CONNECTION_ERROR, 0, PackedStringArray(), PackedByteArray());
 			return true;
 		} break;
@@ -478,7 +633,9 @@ void HTTPRequest::_defer_done(int p_status, int p_code, const PackedStringArray
 }
 
 void HTTPRequest::_request_done(int p_status, int p_code, const PackedStringArray &p_headers, const PackedByteArray &p_data) {
-	cancel_request();
+	// The connection can serve another request once the whole response was read, unless the server asked to close it.
+	bool keep_connection = reuse_connections && p_status == RESULT_SUCCESS && !get_header_value(p_headers, "Connection").to_lower().contains("close");
+	_stop_request(keep_connection);
 
 	emit_signal(SNAME("request_completed"), p_status, p_code, p_headers, p_data);
 }
@@ -486,6 +643,13 @@ void HTTPRequest::_request_done(int p_status, int p_code, const PackedStringArra
 void HTTPRequest::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_INTERNAL_PROCESS: {
+			if (!requesting) {
+				// Still processing while the connection pool has idle connections.
+				if (!_expire_idle_connections()) {
+					set_process_internal(false);
+				}
+				return;
+			}
 			if (use_threads.is_set()) {
 				return;
 			}
@@ -522,6 +686,14 @@ bool HTTPRequest::is_accepting_gzip() const {
 	return accept_gzip;
 }
 
+void HTTPRequest::set_reuse_connections(bool p_reuse) {
+	reuse_connections = p_reuse;
+}
+
+bool HTTPRequest::is_reusing_connections() const {
+	return reuse_connections;
+}
+
 void HTTPRequest::set_body_size_limit(int p_bytes) {
 	ERR_FAIL_COND(get_http_client_status() != HTTPClient::STATUS_DISCONNECTED);
 
@@ -546,6 +718,7 @@ void HTTPRequest::set_download_chunk_size(int p_chunk_size) {
 	ERR_FAIL_COND(get_http_client_status() != HTTPClient::STATUS_DISCONNECTED);
 
 	client->set_read_chunk_size(p_chunk_size);
+	download_chunk_size = client->get_read_chunk_size();
 }
 
 int HTTPRequest::get_download_chunk_size() const {
@@ -573,10 +746,14 @@ int HTTPRequest::get_body_size() const {
 }
 
 void HTTPRequest::set_http_proxy(const String &p_host, int p_port) {
+	http_proxy_host = p_host;
+	http_proxy_port = p_port;
 	client->set_http_proxy(p_host, p_port);
 }
 
 void HTTPRequest::set_https_proxy(const String &p_host, int p_port) {
+	https_proxy_host = p_host;
+	https_proxy_port = p_port;
 	client->set_https_proxy(p_host, p_port);
 }
 
@@ -613,6 +790,10 @@ void HTTPRequest::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_accept_gzip", "enable"), &HTTPRequest::set_accept_gzip);
 	ClassDB::bind_method(D_METHOD("is_accepting_gzip"), &HTTPRequest::is_accepting_gzip);
 
+	ClassDB::bind_method(D_METHOD("set_reuse_connections", "enable"), &HTTPRequest::set_reuse_connections);
+	ClassDB::bind_method(D_METHOD("is_reusing_connections"), &HTTPRequest::is_reusing_connections);
+	ClassDB::bind_static_method("HTTPRequest", D_METHOD("clear_connection_pool"), &HTTPRequest::clear_connection_pool);
+
 	ClassDB::bind_method(D_METHOD("set_body_size_limit", "bytes"), &HTTPRequest::set_body_size_limit);
 	ClassDB::bind_method(D_METHOD("get_body_size_limit"), &HTTPRequest::get_body_size_limit);
 
@@ -638,6 +819,7 @@ void HTTPRequest::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "download_chunk_size", PROPERTY_HINT_RANGE, "256,16777216,suffix:B"), "set_download_chunk_size", "get_download_chunk_size");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "use_threads"), "set_use_threads", "is_using_threads");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "accept_gzip"), "set_accept_gzip", "is_accepting_gzip");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "reuse_connections"), "set_reuse_connections", "is_reusing_connections");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "body_size_limit", PROPERTY_HINT_RANGE, "-1,2000000000,suffix:B"), "set_body_size_limit", "get_body_size_limit");
 	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_redirects", PROPERTY_HINT_RANGE, "-1,64"), "set_max_redirects", "get_max_redirects");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "timeout", PROPERTY_HINT_RANGE, "0,3600,0.1,or_greater,suffix:s"), "set_timeout", "get_timeout");
@@ -661,7 +843,7 @@ void HTTPRequest::_bind_methods() {
 }
 
 HTTPRequest::HTTPRequest() {
-	client = Ref<HTTPClient>(HTTPClient::create());
+	client = _create_client();
 	tls_options = TLSOptions::client();
 	timer = memnew(Timer);
 	timer->set_one_shot(true);
@@ -33,7 +33,10 @@
 
 #include "core/io/http_client.h"
 #include "core/io/stream_peer_gzip.h"
+#include "core/os/mutex.h"
 #include "core/os/thread.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_refcount.h"
 #include "scene/main/node.h"
 
@@ -62,6 +65,22 @@ public:
 	};
 
 private:
+	// Idle kept-alive connections, shared by all HTTPRequest nodes.
+	struct PooledConnection {
+		Ref<HTTPClient> client;
+		uint64_t idle_since = 0;
+	};
+
+	enum {
+		CONNECTION_POOL_MAX_IDLE = 6, // Per host, like most browsers.
+		CONNECTION_POOL_IDLE_MSEC = 10000,
+		CONNECTION_POOL_EXPIRY_INTERVAL_MSEC = 1000,
+	};
+
+	static Mutex connection_pool_mutex;
+	static HashMap<String, LocalVector<PooledConnection>> connection_pool;
+	static uint64_t connection_pool_last_expiry;
+
 	bool requesting = false;
 
 	String request_string;
@@ -78,6 +97,15 @@ private:
 	PackedByteArray body;
 	SafeFlag use_threads;
 	bool accept_gzip = true;
+	bool reuse_connections = false;
+	bool reused_connection = false;
+
+	String http_proxy_host;
+	int http_proxy_port = -1;
+	String https_proxy_host;
+	int https_proxy_port = -1;
+	int download_chunk_size = 65536;
+	LocalVector<uint8_t> chunk_buffer;
 
 	bool got_response = false;
 	int response_code = 0;
@@ -107,6 +135,14 @@ private:
 
 	Error _parse_url(const String &p_url);
 	Error _request();
+	bool _retry_request();
+
+	Ref<HTTPClient> _create_client() const;
+	String _get_connection_key() const;
+	void _acquire_connection();
+	void _release_connection();
+	static bool _expire_idle_connections();
+	void _stop_request(bool p_keep_connection);
 
 	bool has_header(const PackedStringArray &p_headers, const String &p_header_name);
 	String get_header_value(const PackedStringArray &p_headers, const String &header_name);
@@ -136,6 +172,11 @@ public:
 	void set_accept_gzip(bool p_gzip);
 	bool is_accepting_gzip() const;
 
+	void set_reuse_connections(bool p_reuse);
+	bool is_reusing_connections() const;
+
+	static void clear_connection_pool();
+
 	void set_download_file(const String &p_file);
 	String get_download_file() const;
 
@@ -354,7 +354,7 @@ void Node::_propagate_after_exit_tree() {
 
 	data.blocked++;
 
-	for (HashMap<StringName, Node *>::Iterator I = data.children.last(); I; --I) {
+	for (AHashMap<StringName, Node *>::Iterator I = data.children.last(); I; --I) {
 		I->value->_propagate_after_exit_tree();
 	}
 
@@ -374,7 +374,7 @@ void Node::_propagate_exit_tree() {
 #endif
 	data.blocked++;
 
-	for (HashMap<StringName, Node *>::Iterator I = data.children.last(); I; --I) {
+	for (AHashMap<StringName, Node *>::Iterator I = data.children.last(); I; --I) {
 		I->value->_propagate_exit_tree();
 	}
 
@@ -2414,7 +2414,7 @@ String Node::get_tree_string() {
 void Node::_propagate_reverse_notification(int p_notification) {
 	data.blocked++;
 
-	for (HashMap<StringName, Node *>::Iterator I = data.children.last(); I; --I) {
+	for (AHashMap<StringName, Node *>::Iterator I = data.children.last(); I; --I) {
 		I->value->_propagate_reverse_notification(p_notification);
 	}
 
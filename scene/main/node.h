@@ -32,6 +32,7 @@
 #define NODE_H
 
 #include "core/string/node_path.h"
+#include "core/templates/a_hash_map.h"
 #include "core/templates/rb_map.h"
 #include "core/variant/typed_array.h"
 #include "scene/main/scene_tree.h"
@@ -165,7 +166,7 @@ private:
 
 		Node *parent = nullptr;
 		Node *owner = nullptr;
-		HashMap<StringName, Node *> children;
+		AHashMap<StringName, Node *> children;
 		mutable bool children_cache_dirty = true;
 		mutable LocalVector<Node *> children_cache;
 		HashMap<StringName, Node *> owned_unique_nodes;
@@ -249,6 +249,14 @@ void SceneTree::_update_group_order(Group &g) {
 	g.changed = false;
 }
 
+Node *SceneTree::_get_sub_thread_group_owner(const Node *p_node) {
+	Node *owner = p_node->data.process_thread_group_owner;
+	if (owner && owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD) {
+		return owner;
+	}
+	return nullptr;
+}
+
 void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_group, const StringName &p_function, const Variant **p_args, int p_argcount) {
 	Vector<Node *> nodes_copy;
 
@@ -288,7 +296,7 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 		nodes_copy = g.nodes;
 	}
 
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node **gr_nodes = (Node **)nodes_copy.ptr(); // Force cast, the copy is never written to.
 	int gr_node_count = nodes_copy.size();
 
 	{
@@ -296,11 +304,20 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 		nodes_removed_on_group_call_lock++;
 	}
 
+	// Threaded calls are only possible from the main thread, as the process groups are dispatched to the WorkerThreadPool from here.
+	bool threaded = (p_call_flags & GROUP_CALL_THREADED) && !(p_call_flags & GROUP_CALL_DEFERRED) && !node_threading_disabled && !Node::is_group_processing() && is_current_thread_safe_for_nodes();
+	if (threaded) {
+		_call_group_threaded(gr_nodes, gr_node_count, p_call_flags, p_function, p_args, p_argcount);
+	}
+
 	if (p_call_flags & GROUP_CALL_REVERSE) {
 		for (int i = gr_node_count - 1; i >= 0; i--) {
 			if (nodes_removed_on_group_call_lock && nodes_removed_on_group_call.has(gr_nodes[i])) {
 				continue;
 			}
+			if (threaded && _get_sub_thread_group_owner(gr_nodes[i])) {
+				continue; // Already called from its process group thread.
+			}
 
 			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
 				Callable::CallError ce;
@@ -315,6 +332,9 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 			if (nodes_removed_on_group_call_lock && nodes_removed_on_group_call.has(gr_nodes[i])) {
 				continue;
 			}
+			if (threaded && _get_sub_thread_group_owner(gr_nodes[i])) {
+				continue; // Already called from its process group thread.
+			}
 
 			if (!(p_call_flags & GROUP_CALL_DEFERRED)) {
 				Callable::CallError ce;
@@ -334,6 +354,50 @@ void SceneTree::call_group_flagsp(uint32_t p_call_flags, const StringName &p_gro
 	}
 }
 
+void SceneTree::_call_group_threaded(Node *const *p_nodes, int p_node_count, uint32_t p_call_flags, const StringName &p_function, const Variant **p_args, int p_argcount) {
+	GroupCallThreaded call;
+	call.function = p_function;
+	call.args = p_args;
+	call.argcount = p_argcount;
+
+	// Split the nodes by sub-thread process group, keeping the call order within each batch.
+	// Nodes outside sub-thread process groups are left to the caller.
+	HashMap<Node *, uint32_t> batch_indices;
+	for (int j = 0; j < p_node_count; j++) {
+		Node *n = p_nodes[(p_call_flags & GROUP_CALL_REVERSE) ? p_node_count - 1 - j : j];
+		Node *owner = _get_sub_thread_group_owner(n);
+		if (owner == nullptr || nodes_removed_on_group_call.has(n)) {
+			continue;
+		}
+
+		HashMap<Node *, uint32_t>::Iterator E = batch_indices.find(owner);
+		if (!E) {
+			E = batch_indices.insert(owner, call.batches.size());
+			call.batches.push_back(GroupCallThreaded::Batch());
+			call.batches[E->value].owner = owner;
+		}
+		call.batches[E->value].nodes.push_back(n);
+	}
+
+	if (call.batches.is_empty()) {
+		return;
+	}
+
+	WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_call_group_thread, &call, call.batches.size(), -1, true, SNAME("SceneTreeGroupCall"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
+}
+
+void SceneTree::_call_group_thread(uint32_t p_index, GroupCallThreaded *p_call) {
+	const GroupCallThreaded::Batch &batch = p_call->batches[p_index];
+
+	Node::current_process_thread_group = batch.owner;
+	for (Node *n : batch.nodes) {
+		Callable::CallError ce;
+		n->callp(p_call->function, p_call->args, p_call->argcount, ce);
+	}
+	Node::current_process_thread_group = nullptr;
+}
+
 void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_group, int p_notification) {
 	Vector<Node *> nodes_copy;
 	{
@@ -352,7 +416,7 @@ void SceneTree::notify_group_flags(uint32_t p_call_flags, const StringName &p_gr
 		nodes_copy = g.nodes;
 	}
 
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node **gr_nodes = (Node **)nodes_copy.ptr(); // Force cast, the copy is never written to.
 	int gr_node_count = nodes_copy.size();
 
 	{
@@ -414,7 +478,7 @@ void SceneTree::set_group_flags(uint32_t p_call_flags, const StringName &p_group
 
 		nodes_copy = g.nodes;
 	}
-	Node **gr_nodes = nodes_copy.ptrw();
+	Node **gr_nodes = (Node **)nodes_copy.ptr(); // Force cast, the copy is never written to.
 	int gr_node_count = nodes_copy.size();
 
 	{
@@ -1741,6 +1805,7 @@ void SceneTree::_bind_methods() {
 	BIND_ENUM_CONSTANT(GROUP_CALL_REVERSE);
 	BIND_ENUM_CONSTANT(GROUP_CALL_DEFERRED);
 	BIND_ENUM_CONSTANT(GROUP_CALL_UNIQUE);
+	BIND_ENUM_CONSTANT(GROUP_CALL_THREADED);
 }
 
 SceneTree *SceneTree::singleton = nullptr;
@@ -123,6 +123,18 @@ private:
 		bool changed = false;
 	};
 
+	struct GroupCallThreaded {
+		struct Batch {
+			Node *owner = nullptr;
+			LocalVector<Node *> nodes;
+		};
+
+		LocalVector<Batch> batches;
+		StringName function;
+		const Variant **args = nullptr;
+		int argcount = 0;
+	};
+
 #ifndef _3D_DISABLED
 	struct ClientPhysicsInterpolation {
 		SelfList<Node3D>::List _node_3d_list;
@@ -183,6 +195,9 @@ private:
 	void _flush_ugc();
 
 	_FORCE_INLINE_ void _update_group_order(Group &g);
+	_FORCE_INLINE_ static Node *_get_sub_thread_group_owner(const Node *p_node);
+	void _call_group_threaded(Node *const *p_nodes, int p_node_count, uint32_t p_call_flags, const StringName &p_function, const Variant **p_args, int p_argcount);
+	void _call_group_thread(uint32_t p_index, GroupCallThreaded *p_call);
 
 	TypedArray<Node> _get_nodes_in_group(const StringName &p_group);
 
@@ -284,6 +299,7 @@ public:
 		GROUP_CALL_REVERSE = 1,
 		GROUP_CALL_DEFERRED = 2,
 		GROUP_CALL_UNIQUE = 4,
+		GROUP_CALL_THREADED = 8,
 	};
 
 	_FORCE_INLINE_ Window *get_root() const { return root; }
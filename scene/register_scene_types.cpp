@@ -1281,6 +1281,7 @@ void unregister_scene_types() {
 	CanvasItemMaterial::finish_shaders();
 	ColorPicker::finish_shaders();
 	GraphEdit::finish_shaders();
+	HTTPRequest::clear_connection_pool();
 	SceneStringNames::free();
 
 	OS::get_singleton()->benchmark_end_measure("Scene", "Unregister Types");
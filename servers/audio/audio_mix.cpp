@@ -0,0 +1,229 @@
+/**************************************************************************/
+/*  audio_mix.cpp                                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#include "audio_mix.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define AUDIO_MIX_SSE2
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define AUDIO_MIX_NEON
+#endif
+
+static_assert(sizeof(AudioFrame) == 2 * sizeof(float), "The mixing loops expect AudioFrame to be two packed floats.");
+
+namespace {
+
+// Two interleaved stereo frames in a SIMD register, so the mixing loops don't depend on what the
+// auto-vectorizer makes of them at each optimization level.
+struct FramePair {
+#if defined(AUDIO_MIX_SSE2)
+	__m128 v;
+
+	static _FORCE_INLINE_ FramePair load(const float *p_src) { return { _mm_loadu_ps(p_src) }; }
+	// Frames from two unrelated positions.
+	static _FORCE_INLINE_ FramePair load(const float *p_first, const float *p_second) { return { _mm_castpd_ps(_mm_loadh_pd(_mm_load_sd((const double *)p_first), (const double *)p_second)) }; }
+	static _FORCE_INLINE_ FramePair set(float p_l0, float p_r0, float p_l1, float p_r1) { return { _mm_setr_ps(p_l0, p_r0, p_l1, p_r1) }; }
+	static _FORCE_INLINE_ FramePair splat(float p_value) { return { _mm_set1_ps(p_value) }; }
+	_FORCE_INLINE_ void store(float *r_dst) const { _mm_storeu_ps(r_dst, v); }
+
+	_FORCE_INLINE_ FramePair operator+(const FramePair &p_other) const { return { _mm_add_ps(v, p_other.v) }; }
+	_FORCE_INLINE_ FramePair operator-(const FramePair &p_other) const { return { _mm_sub_ps(v, p_other.v) }; }
+	_FORCE_INLINE_ FramePair operator*(const FramePair &p_other) const { return { _mm_mul_ps(v, p_other.v) }; }
+	_FORCE_INLINE_ FramePair abs() const { return { _mm_andnot_ps(_mm_set1_ps(-0.0f), v) }; }
+	_FORCE_INLINE_ FramePair max(const FramePair &p_other) const { return { _mm_max_ps(v, p_other.v) }; }
+#elif defined(AUDIO_MIX_NEON)
+	float32x4_t v;
+
+	static _FORCE_INLINE_ FramePair load(const float *p_src) { return { vld1q_f32(p_src) }; }
+	static _FORCE_INLINE_ FramePair load(const float *p_first, const float *p_second) { return { vcombine_f32(vld1_f32(p_first), vld1_f32(p_second)) }; }
+	static _FORCE_INLINE_ FramePair set(float p_l0, float p_r0, float p_l1, float p_r1) {
+		const float values[4] = { p_l0, p_r0, p_l1, p_r1 };
+		return { vld1q_f32(values) };
+	}
+	static _FORCE_INLINE_ FramePair splat(float p_value) { return { vdupq_n_f32(p_value) }; }
+	_FORCE_INLINE_ void store(float *r_dst) const { vst1q_f32(r_dst, v); }
+
+	_FORCE_INLINE_ FramePair operator+(const FramePair &p_other) const { return { vaddq_f32(v, p_other.v) }; }
+	_FORCE_INLINE_ FramePair operator-(const FramePair &p_other) const { return { vsubq_f32(v, p_other.v) }; }
+	_FORCE_INLINE_ FramePair operator*(const FramePair &p_other) const { return { vmulq_f32(v, p_other.v) }; }
+	_FORCE_INLINE_ FramePair abs() const { return { vabsq_f32(v) }; }
+	_FORCE_INLINE_ FramePair max(const FramePair &p_other) const { return { vmaxq_f32(v, p_other.v) }; }
+#else
+	float v[4];
+
+	static _FORCE_INLINE_ FramePair load(const float *p_src) { return { { p_src[0], p_src[1], p_src[2], p_src[3] } }; }
+	static _FORCE_INLINE_ FramePair load(const float *p_first, const float *p_second) { return { { p_first[0], p_first[1], p_second[0], p_second[1] } }; }
+	static _FORCE_INLINE_ FramePair set(float p_l0, float p_r0, float p_l1, float p_r1) { return { { p_l0, p_r0, p_l1, p_r1 } }; }
+	static _FORCE_INLINE_ FramePair splat(float p_value) { return { { p_value, p_value, p_value, p_value } }; }
+	_FORCE_INLINE_ void store(float *r_dst) const {
+		for (int i = 0; i < 4; i++) {
+			r_dst[i] = v[i];
+		}
+	}
+
+	_FORCE_INLINE_ FramePair operator+(const FramePair &p_other) const { return { { v[0] + p_other.v[0], v[1] + p_other.v[1], v[2] + p_other.v[2], v[3] + p_other.v[3] } }; }
+	_FORCE_INLINE_ FramePair operator-(const FramePair &p_other) const { return { { v[0] - p_other.v[0], v[1] - p_other.v[1], v[2] - p_other.v[2], v[3] - p_other.v[3] } }; }
+	_FORCE_INLINE_ FramePair operator*(const FramePair &p_other) const { return { { v[0] * p_other.v[0], v[1] * p_other.v[1], v[2] * p_other.v[2], v[3] * p_other.v[3] } }; }
+	_FORCE_INLINE_ FramePair abs() const { return { { Math::abs(v[0]), Math::abs(v[1]), Math::abs(v[2]), Math::abs(v[3]) } }; }
+	_FORCE_INLINE_ FramePair max(const FramePair &p_other) const { return { { MAX(v[0], p_other.v[0]), MAX(v[1], p_other.v[1]), MAX(v[2], p_other.v[2]), MAX(v[3], p_other.v[3]) } }; }
+#endif
+};
+
+} // namespace
+
+void AudioMix::mix_ramp(AudioFrame *__restrict r_dst, const AudioFrame *__restrict p_src, uint32_t p_frames, const AudioFrame &p_vol_start, const AudioFrame &p_vol_final) {
+	float *__restrict dst = r_dst->levels;
+	const float *__restrict src = p_src->levels;
+	const float step_l = (p_vol_final.left - p_vol_start.left) / p_frames;
+	const float step_r = (p_vol_final.right - p_vol_start.right) / p_frames;
+
+	// The volume of each frame is computed from its index instead of accumulated, so it doesn't drift.
+	const FramePair start = FramePair::set(p_vol_start.left, p_vol_start.right, p_vol_start.left, p_vol_start.right);
+	const FramePair step = FramePair::set(step_l, step_r, step_l, step_r);
+	const FramePair two = FramePair::splat(2);
+	FramePair t = FramePair::set(0, 0, 1, 1);
+
+	uint32_t i = 0;
+	for (; i + 2 <= p_frames; i += 2) {
+		const FramePair mixed = FramePair::load(dst + i * 2) + (start + step * t) * FramePair::load(src + i * 2);
+		mixed.store(dst + i * 2);
+		t = t + two; // Exact, frame counts are far below 2^24.
+	}
+	for (; i < p_frames; i++) {
+		const float t1 = float(i);
+		dst[i * 2 + 0] += (p_vol_start.left + step_l * t1) * src[i * 2 + 0];
+		dst[i * 2 + 1] += (p_vol_start.right + step_r * t1) * src[i * 2 + 1];
+	}
+}
+
+void AudioMix::mix(AudioFrame *__restrict r_dst, const AudioFrame *__restrict p_src, uint32_t p_frames) {
+	float *__restrict dst = r_dst->levels;
+	const float *__restrict src = p_src->levels;
+	uint32_t i = 0;
+	for (; i + 2 <= p_frames; i += 2) {
+		(FramePair::load(dst + i * 2) + FramePair::load(src + i * 2)).store(dst + i * 2);
+	}
+	for (; i < p_frames; i++) {
+		dst[i * 2 + 0] += src[i * 2 + 0];
+		dst[i * 2 + 1] += src[i * 2 + 1];
+	}
+}
+
+void AudioMix::clear(AudioFrame *r_buffer, uint32_t p_frames) {
+	// Compiles to a memset.
+	float *buffer = r_buffer->levels;
+	for (uint32_t i = 0; i < p_frames * 2; i++) {
+		buffer[i] = 0.0f;
+	}
+}
+
+AudioFrame AudioMix::scale_and_peak(AudioFrame *r_buffer, uint32_t p_frames, float p_volume) {
+	float *buffer = r_buffer->levels;
+	const FramePair volume = FramePair::splat(p_volume);
+	FramePair peaks = FramePair::splat(0);
+	uint32_t i = 0;
+	for (; i + 2 <= p_frames; i += 2) {
+		const FramePair scaled = FramePair::load(buffer + i * 2) * volume;
+		scaled.store(buffer + i * 2);
+		peaks = peaks.max(scaled.abs());
+	}
+
+	float peak_values[4];
+	peaks.store(peak_values);
+	AudioFrame peak(MAX(peak_values[0], peak_values[2]), MAX(peak_values[1], peak_values[3]));
+	for (; i < p_frames; i++) {
+		r_buffer[i] *= p_volume;
+		peak.left = MAX(peak.left, Math::abs(r_buffer[i].left));
+		peak.right = MAX(peak.right, Math::abs(r_buffer[i].right));
+	}
+	return peak;
+}
+
+void AudioMix::resample_cubic(AudioFrame *__restrict r_dst, const AudioFrame *__restrict p_src, uint32_t p_frames, uint64_t &r_offset, uint64_t p_increment, uint32_t p_fraction_bits) {
+	const uint64_t mask = (uint64_t(1) << p_fraction_bits) - 1;
+	const float fraction_scale = 1.0f / float(uint64_t(1) << p_fraction_bits);
+	uint64_t offset = r_offset;
+
+	//standard cubic interpolation (great quality/performance ratio)
+	//this used to be moved to a LUT for greater performance, but nowadays CPU speed is generally faster than memory.
+	const FramePair two = FramePair::splat(2);
+	const FramePair three = FramePair::splat(3);
+	const FramePair four = FramePair::splat(4);
+	const FramePair five = FramePair::splat(5);
+	const FramePair half = FramePair::splat(0.5f);
+
+	uint32_t i = 0;
+	for (; i + 2 <= p_frames; i += 2) {
+		// Two output frames at once, each one reading its own four source frames.
+		const float *y = p_src[offset >> p_fraction_bits].levels;
+		const float mu_first = (offset & mask) * fraction_scale;
+		offset += p_increment;
+		const float *z = p_src[offset >> p_fraction_bits].levels;
+		const float mu_second = (offset & mask) * fraction_scale;
+		offset += p_increment;
+
+		const FramePair y0 = FramePair::load(y, z);
+		const FramePair y1 = FramePair::load(y + 2, z + 2);
+		const FramePair y2 = FramePair::load(y + 4, z + 4);
+		const FramePair y3 = FramePair::load(y + 6, z + 6);
+		const FramePair mu = FramePair::set(mu_first, mu_first, mu_second, mu_second);
+		const FramePair mu2 = mu * mu;
+
+		const FramePair a0 = three * y1 - three * y2 + y3 - y0;
+		const FramePair a1 = two * y0 - five * y1 + four * y2 - y3;
+		const FramePair a2 = y2 - y0;
+		const FramePair a3 = two * y1;
+		// Halving is exact, like the division by 2 below.
+		((a0 * mu * mu2 + a1 * mu2 + a2 * mu + a3) * half).store(r_dst[i].levels);
+	}
+	for (; i < p_frames; i++) {
+		const AudioFrame *y = &p_src[offset >> p_fraction_bits];
+		const float mu = (offset & mask) * fraction_scale;
+		const float mu2 = mu * mu;
+
+		for (int c = 0; c < 2; c++) {
+			const float y0 = y[0].levels[c];
+			const float y1 = y[1].levels[c];
+			const float y2 = y[2].levels[c];
+			const float y3 = y[3].levels[c];
+			const float a0 = 3 * y1 - 3 * y2 + y3 - y0;
+			const float a1 = 2 * y0 - 5 * y1 + 4 * y2 - y3;
+			const float a2 = y2 - y0;
+			const float a3 = 2 * y1;
+			r_dst[i].levels[c] = (a0 * mu * mu2 + a1 * mu2 + a2 * mu + a3) / 2;
+		}
+
+		offset += p_increment;
+	}
+
+	r_offset = offset;
+}
@@ -0,0 +1,54 @@
+/**************************************************************************/
+/*  audio_mix.h                                                           */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef AUDIO_MIX_H
+#define AUDIO_MIX_H
+
+#include "core/math/audio_frame.h"
+#include "core/math/math_funcs.h"
+#include "core/typedefs.h"
+
+// Loops over whole mix buffers. They process two interleaved frames at a time with SSE2 or NEON,
+// depending on the build target, and fall back to plain loops elsewhere.
+class AudioMix {
+public:
+	// Adds p_src to r_dst, scaled by a volume going linearly from p_vol_start to p_vol_final.
+	static void mix_ramp(AudioFrame *__restrict r_dst, const AudioFrame *__restrict p_src, uint32_t p_frames, const AudioFrame &p_vol_start, const AudioFrame &p_vol_final);
+	static void mix(AudioFrame *__restrict r_dst, const AudioFrame *__restrict p_src, uint32_t p_frames);
+	static void clear(AudioFrame *r_buffer, uint32_t p_frames);
+	// Scales r_buffer by p_volume and returns the peak of the result.
+	static AudioFrame scale_and_peak(AudioFrame *r_buffer, uint32_t p_frames, float p_volume);
+
+	// Cubic interpolation at fixed point positions starting from r_offset, which is advanced past the last output frame.
+	// Each output frame reads the 4 frames of p_src starting at the integer part of its position.
+	static void resample_cubic(AudioFrame *__restrict r_dst, const AudioFrame *__restrict p_src, uint32_t p_frames, uint64_t &r_offset, uint64_t p_increment, uint32_t p_fraction_bits);
+};
+
+#endif // AUDIO_MIX_H
@@ -47,13 +47,17 @@ int AudioRBResampler::get_channel_count() const {
 template <int C>
 uint32_t AudioRBResampler::_resample(AudioFrame *p_dest, int p_todo, int32_t p_increment) {
 	uint32_t read = offset & MIX_FRAC_MASK;
+	// The offset wraps around the ring buffer, so positions are always in range and the loop needs no checks.
+	const uint32_t offset_mask = (1 << (rb_bits + MIX_FRAC_BITS)) - 1;
+	const float frac_scale = 1.0f / float(MIX_FRAC_LEN);
+
+	uint32_t pos_offset = offset;
 
 	for (int i = 0; i < p_todo; i++) {
-		offset = (offset + p_increment) & (((1 << (rb_bits + MIX_FRAC_BITS)) - 1));
+		pos_offset = (pos_offset + p_increment) & offset_mask;
 		read += p_increment;
-		uint32_t pos = offset >> MIX_FRAC_BITS;
-		float frac = float(offset & MIX_FRAC_MASK) / float(MIX_FRAC_LEN);
-		ERR_FAIL_COND_V(pos >= rb_len, 0);
+		uint32_t pos = pos_offset >> MIX_FRAC_BITS;
+		float frac = float(pos_offset & MIX_FRAC_MASK) * frac_scale;
 		uint32_t pos_next = (pos + 1) & rb_mask;
 
 		// since this is a template with a known compile time value (C), conditionals go away when compiling.
@@ -98,6 +102,7 @@ uint32_t AudioRBResampler::_resample(AudioFrame *p_dest, int p_todo, int32_t p_i
 		}
 	}
 
+	offset = pos_offset;
 	return read >> MIX_FRAC_BITS; //rb_read_pos = offset >> MIX_FRAC_BITS;
 }
 
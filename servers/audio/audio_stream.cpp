@@ -32,6 +32,7 @@
 
 #include "core/config/project_settings.h"
 #include "core/os/os.h"
+#include "servers/audio/audio_mix.h"
 
 void AudioStreamPlayback::start(double p_from_pos) {
 	if (GDVIRTUAL_CALL(_start, p_from_pos)) {
@@ -156,31 +157,30 @@ int AudioStreamPlaybackResampled::mix(AudioFrame *p_buffer, float p_rate_scale,
 
 	int mixed_frames_total = -1;
 
-	int i;
-	for (i = 0; i < p_frames; i++) {
-		uint32_t idx = CUBIC_INTERP_HISTORY + uint32_t(mix_offset >> FP_BITS);
-		//standard cubic interpolation (great quality/performance ratio)
-		//this used to be moved to a LUT for greater performance, but nowadays CPU speed is generally faster than memory.
-		float mu = (mix_offset & FP_MASK) / float(FP_LEN);
-		AudioFrame y0 = internal_buffer[idx - 3];
-		AudioFrame y1 = internal_buffer[idx - 2];
-		AudioFrame y2 = internal_buffer[idx - 1];
-		AudioFrame y3 = internal_buffer[idx - 0];
-
-		if (idx >= internal_buffer_end && mixed_frames_total == -1) {
-			// The internal buffer ends somewhere in this range, and we haven't yet recorded the number of good frames we have.
-			mixed_frames_total = i;
+	int i = 0;
+	while (i < p_frames) {
+		// Interpolate all the frames that can be before the internal buffer has to be refilled in one go.
+		int todo = p_frames - i;
+		if (mix_increment > 0) {
+			uint64_t buffer_left = (uint64_t(INTERNAL_BUFFER_LEN) << FP_BITS) - mix_offset;
+			todo = MIN(uint64_t(todo), (buffer_left + mix_increment - 1) / mix_increment);
 		}
 
-		float mu2 = mu * mu;
-		AudioFrame a0 = 3 * y1 - 3 * y2 + y3 - y0;
-		AudioFrame a1 = 2 * y0 - 5 * y1 + 4 * y2 - y3;
-		AudioFrame a2 = y2 - y0;
-		AudioFrame a3 = 2 * y1;
-
-		p_buffer[i] = (a0 * mu * mu2 + a1 * mu2 + a2 * mu + a3) / 2;
+		if (mixed_frames_total == -1 && internal_buffer_end != (unsigned int)-1) {
+			// The internal buffer ends somewhere in this range, record the number of good frames we have.
+			uint64_t offset = mix_offset;
+			for (int k = 0; k < todo; k++) {
+				if (CUBIC_INTERP_HISTORY + uint32_t(offset >> FP_BITS) >= internal_buffer_end) {
+					mixed_frames_total = i + k;
+					break;
+				}
+				offset += mix_increment;
+			}
+		}
 
-		mix_offset += mix_increment;
+		// Each frame reads from 3 frames before to the frame at its position in the internal buffer.
+		AudioMix::resample_cubic(p_buffer + i, internal_buffer + CUBIC_INTERP_HISTORY - 3, todo, mix_offset, mix_increment, FP_BITS);
+		i += todo;
 
 		while ((mix_offset >> FP_BITS) >= INTERNAL_BUFFER_LEN) {
 			internal_buffer[0] = internal_buffer[INTERNAL_BUFFER_LEN + 0];
@@ -198,7 +198,7 @@ int AudioStreamPlaybackResampled::mix(AudioFrame *p_buffer, float p_rate_scale,
 			mix_offset -= (INTERNAL_BUFFER_LEN << FP_BITS);
 		}
 	}
-	if (mixed_frames_total == -1 && i == p_frames) {
+	if (mixed_frames_total == -1) {
 		mixed_frames_total = p_frames;
 	}
 	return mixed_frames_total;
@@ -36,12 +36,14 @@
 #include "core/io/file_access.h"
 #include "core/io/resource_loader.h"
 #include "core/math/audio_frame.h"
+#include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
 #include "core/string/string_name.h"
 #include "core/templates/pair.h"
 #include "scene/resources/audio_stream_wav.h"
 #include "scene/scene_string_names.h"
 #include "servers/audio/audio_driver_dummy.h"
+#include "servers/audio/audio_mix.h"
 #include "servers/audio/effects/audio_effect_compressor.h"
 
 #include <cstring>
@@ -335,7 +337,7 @@ void AudioServer::_driver_process(int p_frames, int32_t *p_buffer) {
 }
 
 void AudioServer::_mix_step() {
-	bool solo_mode = false;
+	solo_mode = false;
 
 	for (int i = 0; i < buses.size(); i++) {
 		Bus *bus = buses[i];
@@ -523,131 +525,191 @@ void AudioServer::_mix_step() {
 		}
 	}
 
-	for (int i = buses.size() - 1; i >= 0; i--) {
-		//go bus by bus
-		Bus *bus = buses[i];
-
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (bus->channels[k].active && !bus->channels[k].used) {
-				//buffer was not used, but it's still active, so it must be cleaned
-				AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
+	// Buses of the same depth in the send tree don't depend on each other, process them level by level starting from the deepest.
+	_update_bus_graph();
+	uint32_t level_start = 0;
+	for (uint32_t level_end : bus_level_ends) {
+		_process_bus_level(&bus_order[level_start], level_end - level_start);
+		level_start = level_end;
+	}
 
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					buf[j] = AudioFrame(0, 0);
-				}
-			}
-		}
+	mix_frames += buffer_size;
+	to_mix = buffer_size;
+}
 
-		//process effects
-		if (!bus->bypass) {
-			for (int j = 0; j < bus->effects.size(); j++) {
-				if (!bus->effects[j].enabled) {
-					continue;
-				}
+void AudioServer::_update_bus_graph() {
+	int bus_count = buses.size();
+	bus_sends.resize(bus_count);
+	bus_depths.resize(bus_count);
 
-#ifdef DEBUG_ENABLED
-				uint64_t ticks = OS::get_singleton()->get_ticks_usec();
-#endif
+	int max_depth = 0;
+	for (int i = 0; i < bus_count; i++) {
+		if (i == 0) {
+			bus_sends[i] = -1;
+			bus_depths[i] = 0;
+			continue;
+		}
 
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
-						continue;
-					}
-					bus->channels.write[k].effect_instances.write[j]->process(bus->channels[k].buffer.ptr(), temp_buffer.write[k].ptrw(), buffer_size);
-				}
+		//everything has a send save for master bus
+		Bus *bus = buses[i];
+		int send = 0;
+		if (bus_map.has(bus->send)) {
+			send = bus_map[bus->send]->index_cache;
+			if (send >= i) { //invalid, send to master
+				send = 0;
+			}
+		}
+		bus_sends[i] = send;
+		// Sends always go to a lower index, so the depth of the target is already known.
+		bus_depths[i] = bus_depths[send] + 1;
+		max_depth = MAX(max_depth, bus_depths[i]);
+	}
 
-				//swap buffers, so internal buffer always has the right data
-				for (int k = 0; k < bus->channels.size(); k++) {
-					if (!(buses[i]->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
-						continue;
-					}
-					SWAP(bus->channels.write[k].buffer, temp_buffer.write[k]);
-				}
+	bus_order.resize(bus_count);
+	bus_level_ends.resize(max_depth + 1);
+	uint32_t ordered = 0;
+	for (int depth = max_depth; depth >= 0; depth--) {
+		for (int i = bus_count - 1; i >= 0; i--) {
+			if (bus_depths[i] == depth) {
+				bus_order[ordered++] = i;
+			}
+		}
+		bus_level_ends[max_depth - depth] = ordered;
+	}
+}
 
-#ifdef DEBUG_ENABLED
-				bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
-#endif
+void AudioServer::_process_bus_level(const int *p_buses, uint32_t p_count) {
+	if (parallel_bus_processing && p_count > 1) {
+		// Only worth dispatching when more than one bus has effects to run.
+		uint32_t buses_with_effects = 0;
+		for (uint32_t i = 0; i < p_count; i++) {
+			const Bus *bus = buses[p_buses[i]];
+			if (!bus->bypass && !bus->effects.is_empty()) {
+				buses_with_effects++;
 			}
 		}
 
-		//process send
+		if (buses_with_effects > 1) {
+			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &AudioServer::_process_bus_task, p_buses + 1, p_count - 1, -1, true);
+			// The mixing thread takes the first bus instead of only waiting.
+			_process_bus(p_buses[0]);
+			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+			return;
+		}
+	}
+
+	for (uint32_t i = 0; i < p_count; i++) {
+		_process_bus(p_buses[i]);
+	}
+}
 
-		Bus *send = nullptr;
+void AudioServer::_process_bus_task(uint32_t p_index, const int *p_buses) {
+	_process_bus(p_buses[p_index]);
+}
 
-		if (i > 0) {
-			//everything has a send save for master bus
-			if (!bus_map.has(bus->send)) {
-				send = buses[0];
-			} else {
-				send = bus_map[bus->send];
-				if (send->index_cache >= bus->index_cache) { //invalid, send to master
-					send = buses[0];
-				}
-			}
+void AudioServer::_process_bus(int p_bus) {
+	Bus *bus = buses[p_bus];
+
+	// Sum the sends into this bus. Sources were processed in the previous level and are always added
+	// in the same order, so the result doesn't depend on how the levels were split between threads.
+	for (int i = buses.size() - 1; i > p_bus; i--) {
+		if (bus_sends[i] != p_bus) {
+			continue;
 		}
 
-		for (int k = 0; k < bus->channels.size(); k++) {
-			if (!bus->channels[k].active) {
-				bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
+		const Bus *source = buses[i];
+		for (int k = 0; k < source->channels.size(); k++) {
+			if (!source->channels[k].active) {
 				continue;
 			}
 
-			AudioFrame *buf = bus->channels.write[k].buffer.ptrw();
-
-			AudioFrame peak = AudioFrame(0, 0);
+			AudioMix::mix(_get_channel_mix_buffer(bus, k), source->channels[k].buffer.ptr(), buffer_size);
+		}
+	}
 
-			float volume = Math::db_to_linear(bus->volume_db);
+	for (int k = 0; k < bus->channels.size(); k++) {
+		if (bus->channels[k].active && !bus->channels[k].used) {
+			//buffer was not used, but it's still active, so it must be cleaned
+			AudioMix::clear(bus->channels.write[k].buffer.ptrw(), buffer_size);
+		}
+	}
 
-			if (solo_mode) {
-				if (!bus->soloed) {
-					volume = 0.0;
-				}
-			} else {
-				if (bus->mute) {
-					volume = 0.0;
-				}
+	//process effects
+	if (!bus->bypass) {
+		for (int j = 0; j < bus->effects.size(); j++) {
+			if (!bus->effects[j].enabled) {
+				continue;
 			}
 
-			//apply volume and compute peak
-			for (uint32_t j = 0; j < buffer_size; j++) {
-				buf[j] *= volume;
+#ifdef DEBUG_ENABLED
+			uint64_t ticks = OS::get_singleton()->get_ticks_usec();
+#endif
 
-				float l = ABS(buf[j].left);
-				if (l > peak.left) {
-					peak.left = l;
-				}
-				float r = ABS(buf[j].right);
-				if (r > peak.right) {
-					peak.right = r;
+			for (int k = 0; k < bus->channels.size(); k++) {
+				if (!(bus->channels[k].active || bus->channels[k].effect_instances[j]->process_silence())) {
+					continue;
 				}
+				Bus::Channel &channel = bus->channels.write[k];
+				channel.effect_instances.write[j]->process(channel.buffer.ptr(), channel.effect_buffer.ptrw(), buffer_size);
+
+				//swap buffers, so internal buffer always has the right data
+				SWAP(channel.buffer, channel.effect_buffer);
 			}
 
-			bus->channels.write[k].peak_volume = AudioFrame(Math::linear_to_db(peak.left + AUDIO_PEAK_OFFSET), Math::linear_to_db(peak.right + AUDIO_PEAK_OFFSET));
+#ifdef DEBUG_ENABLED
+			bus->effects.write[j].prof_time += OS::get_singleton()->get_ticks_usec() - ticks;
+#endif
+		}
+	}
 
-			if (!bus->channels[k].used) {
-				//see if any audio is contained, because channel was not used
+	for (int k = 0; k < bus->channels.size(); k++) {
+		if (!bus->channels[k].active) {
+			bus->channels.write[k].peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
+			continue;
+		}
 
-				if (MAX(peak.right, peak.left) > Math::db_to_linear(channel_disable_threshold_db)) {
-					bus->channels.write[k].last_mix_with_audio = mix_frames;
-				} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
-					bus->channels.write[k].active = false;
-					continue; //went inactive, don't mix.
-				}
+		float volume = Math::db_to_linear(bus->volume_db);
+
+		if (solo_mode) {
+			if (!bus->soloed) {
+				volume = 0.0;
 			}
+		} else {
+			if (bus->mute) {
+				volume = 0.0;
+			}
+		}
 
-			if (send) {
-				//if not master bus, send
-				AudioFrame *target_buf = thread_get_channel_mix_buffer(send->index_cache, k);
+		//apply volume and compute peak
+		AudioFrame peak = AudioMix::scale_and_peak(bus->channels.write[k].buffer.ptrw(), buffer_size, volume);
 
-				for (uint32_t j = 0; j < buffer_size; j++) {
-					target_buf[j] += buf[j];
-				}
+		bus->channels.write[k].peak_volume = AudioFrame(Math::linear_to_db(peak.left + AUDIO_PEAK_OFFSET), Math::linear_to_db(peak.right + AUDIO_PEAK_OFFSET));
+
+		if (!bus->channels[k].used) {
+			//see if any audio is contained, because channel was not used
+
+			if (MAX(peak.right, peak.left) > Math::db_to_linear(channel_disable_threshold_db)) {
+				bus->channels.write[k].last_mix_with_audio = mix_frames;
+			} else if (mix_frames - bus->channels[k].last_mix_with_audio > channel_disable_frames) {
+				bus->channels.write[k].active = false;
+				continue; //went inactive, don't mix.
 			}
 		}
 	}
+}
 
-	mix_frames += buffer_size;
-	to_mix = buffer_size;
+AudioFrame *AudioServer::_get_channel_mix_buffer(Bus *p_bus, int p_channel) {
+	Bus::Channel &channel = p_bus->channels.write[p_channel];
+	AudioFrame *data = channel.buffer.ptrw();
+
+	if (!channel.used) {
+		channel.used = true;
+		channel.active = true;
+		channel.last_mix_with_audio = mix_frames;
+		AudioMix::clear(data, buffer_size);
+	}
+
+	return data;
 }
 
 void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r) {
@@ -669,10 +731,10 @@ void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_sou
 		p_processor_r->set_filter(&filter, /* clear_history= */ is_just_started);
 		p_processor_r->update_coeffs(buffer_size);
 
+		// The filters are recursive so this can't be vectorized, but at least the ramp doesn't divide on every frame.
+		const AudioFrame vol_step = (p_vol_final - p_vol_start) / buffer_size;
 		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
-			// Make this buffer size invariant if buffer_size ever becomes a project setting.
-			float lerp_param = (float)frame_idx / buffer_size;
-			AudioFrame vol = p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start;
+			AudioFrame vol = p_vol_start + vol_step * frame_idx;
 			AudioFrame mixed = vol * p_source_buf[frame_idx];
 			p_processor_l->process_one_interp(mixed.left);
 			p_processor_r->process_one_interp(mixed.right);
@@ -680,11 +742,7 @@ void AudioServer::_mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_sou
 		}
 
 	} else {
-		for (unsigned int frame_idx = 0; frame_idx < buffer_size; frame_idx++) {
-			// Make this buffer size invariant if buffer_size ever becomes a project setting.
-			float lerp_param = (float)frame_idx / buffer_size;
-			p_out_buf[frame_idx] += (p_vol_final * lerp_param + (1 - lerp_param) * p_vol_start) * p_source_buf[frame_idx];
-		}
+		AudioMix::mix_ramp(p_out_buf, p_source_buf, buffer_size, p_vol_start, p_vol_final);
 	}
 }
 
@@ -711,18 +769,7 @@ AudioFrame *AudioServer::thread_get_channel_mix_buffer(int p_bus, int p_buffer)
 	ERR_FAIL_INDEX_V(p_bus, buses.size(), nullptr);
 	ERR_FAIL_INDEX_V(p_buffer, buses[p_bus]->channels.size(), nullptr);
 
-	AudioFrame *data = buses.write[p_bus]->channels.write[p_buffer].buffer.ptrw();
-
-	if (!buses[p_bus]->channels[p_buffer].used) {
-		buses.write[p_bus]->channels.write[p_buffer].used = true;
-		buses.write[p_bus]->channels.write[p_buffer].active = true;
-		buses.write[p_bus]->channels.write[p_buffer].last_mix_with_audio = mix_frames;
-		for (uint32_t i = 0; i < buffer_size; i++) {
-			data[i] = AudioFrame(0, 0);
-		}
-	}
-
-	return data;
+	return _get_channel_mix_buffer(buses[p_bus], p_buffer);
 }
 
 int AudioServer::thread_get_mix_buffer_size() const {
@@ -779,6 +826,7 @@ void AudioServer::set_bus_count(int p_count) {
 		buses.write[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		buses[i]->name = attempt;
 		buses[i]->solo = false;
@@ -852,6 +900,7 @@ void AudioServer::add_bus(int p_at_pos) {
 	bus->channels.resize(channel_count);
 	for (int j = 0; j < channel_count; j++) {
 		bus->channels.write[j].buffer.resize(buffer_size);
+		bus->channels.write[j].effect_buffer.resize(buffer_size);
 	}
 	bus->name = attempt;
 	bus->solo = false;
@@ -1426,17 +1475,13 @@ void AudioServer::notify_listener_changed() {
 
 void AudioServer::init_channels_and_buffers() {
 	channel_count = get_channel_count();
-	temp_buffer.resize(channel_count);
 	mix_buffer.resize(buffer_size + LOOKAHEAD_BUFFER_SIZE);
 
-	for (int i = 0; i < temp_buffer.size(); i++) {
-		temp_buffer.write[i].resize(buffer_size);
-	}
-
 	for (int i = 0; i < buses.size(); i++) {
 		buses[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		_update_bus_effects(i);
 	}
@@ -1445,6 +1490,7 @@ void AudioServer::init_channels_and_buffers() {
 void AudioServer::init() {
 	channel_disable_threshold_db = GLOBAL_DEF_RST("audio/buses/channel_disable_threshold_db", -60.0);
 	channel_disable_frames = float(GLOBAL_DEF_RST(PropertyInfo(Variant::FLOAT, "audio/buses/channel_disable_time", PROPERTY_HINT_RANGE, "0,5,0.01,or_greater"), 2.0)) * get_mix_rate();
+	parallel_bus_processing = GLOBAL_DEF_RST("audio/buses/parallel_bus_processing", false);
 	buffer_size = 512; //hardcoded for now
 
 	init_channels_and_buffers();
@@ -1710,6 +1756,7 @@ void AudioServer::set_bus_layout(const Ref<AudioBusLayout> &p_bus_layout) {
 		buses[i]->channels.resize(channel_count);
 		for (int j = 0; j < channel_count; j++) {
 			buses.write[i]->channels.write[j].buffer.resize(buffer_size);
+			buses.write[i]->channels.write[j].effect_buffer.resize(buffer_size);
 		}
 		_update_bus_effects(i);
 	}
@@ -1773,6 +1820,16 @@ void AudioServer::set_enable_tagging_used_audio_streams(bool p_enable) {
 	tag_used_audio_streams = p_enable;
 }
 
+void AudioServer::set_enable_parallel_bus_processing(bool p_enable) {
+	lock();
+	parallel_bus_processing = p_enable;
+	unlock();
+}
+
+bool AudioServer::is_parallel_bus_processing_enabled() const {
+	return parallel_bus_processing;
+}
+
 #ifdef TOOLS_ENABLED
 void AudioServer::get_argument_options(const StringName &p_function, int p_idx, List<String> *r_options) const {
 	const String pf = p_function;
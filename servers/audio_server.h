@@ -34,6 +34,7 @@
 #include "core/math/audio_frame.h"
 #include "core/object/class_db.h"
 #include "core/os/os.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/safe_list.h"
 #include "core/variant/variant.h"
 #include "servers/audio/audio_effect.h"
@@ -242,6 +243,7 @@ private:
 			bool active = false;
 			AudioFrame peak_volume = AudioFrame(AUDIO_MIN_PEAK_DB, AUDIO_MIN_PEAK_DB);
 			Vector<AudioFrame> buffer;
+			Vector<AudioFrame> effect_buffer; // Effects write here, then it's swapped with buffer.
 			Vector<Ref<AudioEffectInstance>> effect_instances;
 			uint64_t last_mix_with_audio = 0;
 			Channel() {}
@@ -301,11 +303,18 @@ private:
 	// TODO document if this is necessary.
 	SafeList<AudioStreamPlaybackBusDetails *> bus_details_graveyard_frame_old;
 
-	Vector<Vector<AudioFrame>> temp_buffer; //temp_buffer for each level
 	Vector<AudioFrame> mix_buffer;
 	Vector<Bus *> buses;
 	HashMap<StringName, Bus *> bus_map;
 
+	// Send target of each bus and the order buses are processed in, grouped by depth in the send tree.
+	LocalVector<int> bus_sends;
+	LocalVector<int> bus_depths;
+	LocalVector<int> bus_order;
+	LocalVector<uint32_t> bus_level_ends;
+	bool solo_mode = false;
+	bool parallel_bus_processing = false;
+
 	void _update_bus_effects(int p_bus);
 
 	static AudioServer *singleton;
@@ -313,6 +322,11 @@ private:
 	void init_channels_and_buffers();
 
 	void _mix_step();
+	void _update_bus_graph();
+	void _process_bus_level(const int *p_buses, uint32_t p_count);
+	void _process_bus_task(uint32_t p_index, const int *p_buses);
+	void _process_bus(int p_bus);
+	AudioFrame *_get_channel_mix_buffer(Bus *p_bus, int p_channel);
 	void _mix_step_for_channel(AudioFrame *p_out_buf, AudioFrame *p_source_buf, AudioFrame p_vol_start, AudioFrame p_vol_final, float p_attenuation_filter_cutoff_hz, float p_highshelf_gain, AudioFilterSW::Processor *p_processor_l, AudioFilterSW::Processor *p_processor_r);
 
 	// Should only be called on the main thread.
@@ -470,6 +484,9 @@ public:
 
 	void set_enable_tagging_used_audio_streams(bool p_enable);
 
+	void set_enable_parallel_bus_processing(bool p_enable);
+	bool is_parallel_bus_processing_enabled() const;
+
 #ifdef TOOLS_ENABLED
 	virtual void get_argument_options(const StringName &p_function, int p_idx, List<String> *r_options) const override;
 #endif
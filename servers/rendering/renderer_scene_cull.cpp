@@ -33,6 +33,7 @@
 #include "core/config/project_settings.h"
 #include "core/object/worker_thread_pool.h"
 #include "core/os/os.h"
+#include "core/templates/frame_arena.h"
 #include "rendering_light_culler.h"
 #include "rendering_server_constants.h"
 #include "rendering_server_default.h"
@@ -2466,6 +2467,9 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 
 	bool animated_material_found = false;
 
+	// Instances found by the query of the current shadow pass.
+	FrameLocalVector<Instance *> shadow_cull_result;
+
 	switch (RSG::light_storage->light_get_type(p_instance->base)) {
 		case RS::LIGHT_DIRECTIONAL: {
 		} break;
@@ -2492,12 +2496,12 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 					planes.write[4] = light_transform.xform(Plane(Vector3(0, -1, z).normalized(), radius));
 					planes.write[5] = light_transform.xform(Plane(Vector3(0, 0, -z), 0));
 
-					instance_shadow_cull_result.clear();
+					shadow_cull_result.clear();
 
 					Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(&planes[0], planes.size());
 
 					struct CullConvex {
-						PagedArray<Instance *> *result;
+						FrameLocalVector<Instance *> *result;
 						_FORCE_INLINE_ bool operator()(void *p_data) {
 							Instance *p_instance = (Instance *)p_data;
 							result->push_back(p_instance);
@@ -2506,18 +2510,18 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 					};
 
 					CullConvex cull_convex;
-					cull_convex.result = &instance_shadow_cull_result;
+					cull_convex.result = &shadow_cull_result;
 
 					p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), cull_convex);
 
 					RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
 
 					if (!light->is_shadow_update_full()) {
-						light_culler->cull_regular_light(instance_shadow_cull_result);
+						light_culler->cull_regular_light(shadow_cull_result);
 					}
 
-					for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
-						Instance *instance = instance_shadow_cull_result[j];
+					for (int j = 0; j < (int)shadow_cull_result.size(); j++) {
+						Instance *instance = shadow_cull_result[j];
 						if (!instance->visible || !((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows || !(p_visible_layers & instance->layer_mask)) {
 							continue;
 						} else {
@@ -2574,12 +2578,12 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 
 					Vector<Plane> planes = cm.get_projection_planes(xform);
 
-					instance_shadow_cull_result.clear();
+					shadow_cull_result.clear();
 
 					Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(&planes[0], planes.size());
 
 					struct CullConvex {
-						PagedArray<Instance *> *result;
+						FrameLocalVector<Instance *> *result;
 						_FORCE_INLINE_ bool operator()(void *p_data) {
 							Instance *p_instance = (Instance *)p_data;
 							result->push_back(p_instance);
@@ -2588,18 +2592,18 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 					};
 
 					CullConvex cull_convex;
-					cull_convex.result = &instance_shadow_cull_result;
+					cull_convex.result = &shadow_cull_result;
 
 					p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), cull_convex);
 
 					RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
 
 					if (!light->is_shadow_update_full()) {
-						light_culler->cull_regular_light(instance_shadow_cull_result);
+						light_culler->cull_regular_light(shadow_cull_result);
 					}
 
-					for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
-						Instance *instance = instance_shadow_cull_result[j];
+					for (int j = 0; j < (int)shadow_cull_result.size(); j++) {
+						Instance *instance = shadow_cull_result[j];
 						if (!instance->visible || !((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows || !(p_visible_layers & instance->layer_mask)) {
 							continue;
 						} else {
@@ -2641,12 +2645,12 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 
 			Vector<Plane> planes = cm.get_projection_planes(light_transform);
 
-			instance_shadow_cull_result.clear();
+			shadow_cull_result.clear();
 
 			Vector<Vector3> points = Geometry3D::compute_convex_mesh_points(&planes[0], planes.size());
 
 			struct CullConvex {
-				PagedArray<Instance *> *result;
+				FrameLocalVector<Instance *> *result;
 				_FORCE_INLINE_ bool operator()(void *p_data) {
 					Instance *p_instance = (Instance *)p_data;
 					result->push_back(p_instance);
@@ -2655,18 +2659,18 @@ bool RendererSceneCull::_light_instance_update_shadow(Instance *p_instance, cons
 			};
 
 			CullConvex cull_convex;
-			cull_convex.result = &instance_shadow_cull_result;
+			cull_convex.result = &shadow_cull_result;
 
 			p_scenario->indexers[Scenario::INDEXER_GEOMETRY].convex_query(planes.ptr(), planes.size(), points.ptr(), points.size(), cull_convex);
 
 			RendererSceneRender::RenderShadowData &shadow_data = render_shadow_data[max_shadows_used++];
 
 			if (!light->is_shadow_update_full()) {
-				light_culler->cull_regular_light(instance_shadow_cull_result);
+				light_culler->cull_regular_light(shadow_cull_result);
 			}
 
-			for (int j = 0; j < (int)instance_shadow_cull_result.size(); j++) {
-				Instance *instance = instance_shadow_cull_result[j];
+			for (int j = 0; j < (int)shadow_cull_result.size(); j++) {
+				Instance *instance = shadow_cull_result[j];
 				if (!instance->visible || !((1 << instance->base_type) & RS::INSTANCE_GEOMETRY_MASK) || !static_cast<InstanceGeometryData *>(instance->base_data)->can_cast_shadows || !(p_visible_layers & instance->layer_mask)) {
 					continue;
 				} else {
@@ -3235,7 +3239,7 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 	{
 		cull.shadow_count = 0;
 
-		Vector<Instance *> lights_with_shadow;
+		FrameLocalVector<Instance *> lights_with_shadow;
 
 		for (Instance *E : scenario->directional_lights) {
 			if (!E->visible || !(E->layer_mask & p_visible_layers)) {
@@ -3261,7 +3265,7 @@ void RendererSceneCull::_render_scene(const RendererSceneRender::CameraData *p_c
 
 		RSG::light_storage->set_directional_shadow_count(lights_with_shadow.size());
 
-		for (int i = 0; i < lights_with_shadow.size(); i++) {
+		for (uint32_t i = 0; i < lights_with_shadow.size(); i++) {
 			_light_instance_setup_directional_shadow(i, lights_with_shadow[i], p_camera_data->main_transform, p_camera_data->main_projection, p_camera_data->is_orthogonal, p_camera_data->vaspect);
 		}
 	}
@@ -3968,6 +3972,8 @@ void RendererSceneCull::render_probes() {
 }
 
 void RendererSceneCull::render_particle_colliders() {
+	FrameLocalVector<Instance *> instance_cull_result;
+
 	while (heightfield_particle_colliders_update_list.begin()) {
 		Instance *hfpc = *heightfield_particle_colliders_update_list.begin();
 
@@ -3977,7 +3983,7 @@ void RendererSceneCull::render_particle_colliders() {
 			scene_cull_result.geometry_instances.clear();
 
 			struct CullAABB {
-				PagedArray<Instance *> *result;
+				FrameLocalVector<Instance *> *result;
 				_FORCE_INLINE_ bool operator()(void *p_data) {
 					Instance *p_instance = (Instance *)p_data;
 					result->push_back(p_instance);
@@ -4280,14 +4286,10 @@ void RendererSceneCull::update_dirty_instances() {
 void RendererSceneCull::update() {
 	//optimize bvhs
 
-	uint32_t rid_count = scenario_owner.get_rid_count();
-	RID *rids = (RID *)alloca(sizeof(RID) * rid_count);
-	scenario_owner.fill_owned_buffer(rids);
-	for (uint32_t i = 0; i < rid_count; i++) {
-		Scenario *s = scenario_owner.get_or_null(rids[i]);
-		s->indexers[Scenario::INDEXER_GEOMETRY].optimize_incremental(indexer_update_iterations);
-		s->indexers[Scenario::INDEXER_VOLUMES].optimize_incremental(indexer_update_iterations);
-	}
+	scenario_owner.for_each_owned([this](const RID &p_rid, Scenario *p_scenario) {
+		p_scenario->indexers[Scenario::INDEXER_GEOMETRY].optimize_incremental(indexer_update_iterations);
+		p_scenario->indexers[Scenario::INDEXER_VOLUMES].optimize_incremental(indexer_update_iterations);
+	});
 	scene_render->update();
 	update_dirty_instances();
 	render_particle_colliders();
@@ -4497,9 +4499,6 @@ RendererSceneCull::RendererSceneCull() {
 	render_pass = 1;
 	singleton = this;
 
-	instance_cull_result.set_page_pool(&instance_cull_page_pool);
-	instance_shadow_cull_result.set_page_pool(&instance_cull_page_pool);
-
 	for (uint32_t i = 0; i < MAX_UPDATE_SHADOWS; i++) {
 		render_shadow_data[i].instances.set_page_pool(&geometry_instance_cull_page_pool);
 	}
@@ -4528,9 +4527,6 @@ RendererSceneCull::RendererSceneCull() {
 }
 
 RendererSceneCull::~RendererSceneCull() {
-	instance_cull_result.reset();
-	instance_shadow_cull_result.reset();
-
 	for (uint32_t i = 0; i < MAX_UPDATE_SHADOWS; i++) {
 		render_shadow_data[i].instances.reset();
 	}
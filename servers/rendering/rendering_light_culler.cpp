@@ -150,7 +150,7 @@ bool RenderingLightCuller::cull_directional_light(const RendererSceneCull::Insta
 	return true;
 }
 
-void RenderingLightCuller::cull_regular_light(PagedArray<RendererSceneCull::Instance *> &r_instance_shadow_cull_result) {
+void RenderingLightCuller::cull_regular_light(FrameLocalVector<RendererSceneCull::Instance *> &r_instance_shadow_cull_result) {
 	if (!data.is_active() || !is_caster_culling_active()) {
 		return;
 	}
@@ -162,7 +162,7 @@ void RenderingLightCuller::cull_regular_light(PagedArray<RendererSceneCull::Inst
 	}
 
 	// Shorter local alias.
-	PagedArray<RendererSceneCull::Instance *> &list = r_instance_shadow_cull_result;
+	FrameLocalVector<RendererSceneCull::Instance *> &list = r_instance_shadow_cull_result;
 
 #ifdef LIGHT_CULLER_DEBUG_LOGGING
 	uint32_t count_before = r_instance_shadow_cull_result.size();
@@ -232,6 +232,27 @@ TEST_CASE("[JSON] Parsing escape sequences") {
 		ERR_PRINT_ON
 	}
 }
+
+TEST_CASE("[JSON] Parsing strings with and without escape sequences") {
+	JSON json;
+
+	CHECK(json.parse("[\"\", \"plain\", \"tab\\there\", \"\\u00e9t\\u00e9\", \"a\\\"b\\\\c\"]") == OK);
+	Array array = json.get_data();
+	REQUIRE(array.size() == 5);
+	CHECK(array[0] == "");
+	CHECK(array[1] == "plain");
+	CHECK(array[2] == "tab\there");
+	CHECK(array[3] == U"été");
+	CHECK(array[4] == "a\"b\\c");
+
+	CHECK_MESSAGE(
+			json.parse("{\"multi\nline\": \"a\nb\", \"unterminated") == ERR_PARSE_ERROR,
+			"Parsing an unterminated string should fail.");
+	CHECK(json.get_error_message() == "Unterminated String");
+	CHECK_MESSAGE(
+			json.get_error_line() == 2,
+			"Line breaks inside strings should be counted.");
+}
 } // namespace TestJSON
 
 #endif // TEST_JSON_H
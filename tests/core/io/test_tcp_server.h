@@ -0,0 +1,115 @@
+/**************************************************************************/
+/*  test_tcp_server.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_TCP_SERVER_H
+#define TEST_TCP_SERVER_H
+
+#include "core/io/net_socket.h"
+#include "core/io/stream_peer_tcp.h"
+#include "core/io/tcp_server.h"
+#include "core/os/os.h"
+
+#include "tests/test_macros.h"
+
+namespace TestTCPServer {
+
+TEST_CASE("[TCPServer] Readiness with a NetSocketPoller") {
+	Ref<NetSocketPoller> poller = Ref<NetSocketPoller>(NetSocketPoller::create());
+	if (poller.is_null()) {
+		MESSAGE("No readiness API on this platform.");
+		return;
+	}
+	const IPAddress localhost = IPAddress("127.0.0.1");
+	LocalVector<uint64_t> ready;
+
+	Ref<TCPServer> server;
+	server.instantiate();
+	REQUIRE(server->listen(0, localhost) == OK);
+	REQUIRE(server->watch(poller, 1) == OK);
+	CHECK(poller->get_socket_count() == 1);
+	CHECK(poller->wait(0, ready) == OK);
+	CHECK(ready.is_empty());
+
+	Ref<StreamPeerTCP> client;
+	client.instantiate();
+	REQUIRE(client->connect_to_host(localhost, server->get_local_port()) == OK);
+	CHECK(poller->wait(1000, ready) == OK);
+	REQUIRE(ready.size() == 1);
+	CHECK(ready[0] == 1);
+
+	Ref<StreamPeerTCP> connection = server->take_connection();
+	REQUIRE(connection.is_valid());
+	REQUIRE(connection->watch(poller, NetSocket::POLL_TYPE_IN, 2) == OK);
+	CHECK(poller->get_socket_count() == 2);
+	CHECK(poller->wait(0, ready) == OK);
+	CHECK_MESSAGE(ready.is_empty(), "Nothing to accept nor read.");
+
+	for (int i = 0; i < 1000 && client->get_status() == StreamPeerTCP::STATUS_CONNECTING; i++) {
+		client->poll();
+		OS::get_singleton()->delay_usec(1000);
+	}
+	REQUIRE(client->get_status() == StreamPeerTCP::STATUS_CONNECTED);
+
+	const uint8_t data[4] = { 1, 2, 3, 4 };
+	REQUIRE(client->put_data(data, 4) == OK);
+	CHECK(poller->wait(1000, ready) == OK);
+	REQUIRE(ready.size() == 1);
+	CHECK(ready[0] == 2);
+
+	uint8_t received[4] = {};
+	REQUIRE(connection->get_data(received, 4) == OK);
+	CHECK(memcmp(data, received, 4) == 0);
+	CHECK(poller->wait(0, ready) == OK);
+	CHECK_MESSAGE(ready.is_empty(), "Everything was read.");
+
+	SUBCASE("Hung up connections are ready") {
+		client->disconnect_from_host();
+		CHECK(poller->wait(1000, ready) == OK);
+		REQUIRE(ready.size() == 1);
+		CHECK(ready[0] == 2);
+	}
+
+	SUBCASE("Disconnecting and stopping stop watching") {
+		connection->disconnect_from_host();
+		CHECK(poller->get_socket_count() == 1);
+		server->stop();
+		CHECK(poller->get_socket_count() == 0);
+		CHECK(poller->wait(0, ready) == OK);
+		CHECK(ready.is_empty());
+	}
+
+	connection->disconnect_from_host();
+	client->disconnect_from_host();
+	server->stop();
+}
+
+} // namespace TestTCPServer
+
+#endif // TEST_TCP_SERVER_H
@@ -321,6 +321,36 @@ TEST_CASE("[Expression] Expressions with variables") {
 	ERR_PRINT_ON;
 }
 
+TEST_CASE("[Expression] Method calls on values of changing types") {
+	Expression expression;
+
+	PackedStringArray parameter_names;
+	parameter_names.push_back("foo");
+	CHECK_MESSAGE(
+			expression.parse("foo.length()", parameter_names) == OK,
+			"The expression should parse successfully.");
+
+	// The same call node resolves the method again when the type of its base changes.
+	Array values;
+	values.push_back("hello");
+	CHECK(int(expression.execute(values)) == 5);
+	CHECK(int(expression.execute(values)) == 5);
+	values[0] = Vector2(3, 4);
+	CHECK(double(expression.execute(values)) == doctest::Approx(5.0));
+	values[0] = Vector3i(2, 3, 6);
+	CHECK(double(expression.execute(values)) == doctest::Approx(7.0));
+	values[0] = "abc";
+	CHECK(int(expression.execute(values)) == 3);
+
+	values[0] = 10;
+	ERR_PRINT_OFF;
+	expression.execute(values);
+	ERR_PRINT_ON;
+	CHECK_MESSAGE(
+			expression.has_execute_failed(),
+			"Calling a method that doesn't exist on the base type should fail.");
+}
+
 TEST_CASE("[Expression] Invalid expressions") {
 	Expression expression;
 
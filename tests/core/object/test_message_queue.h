@@ -0,0 +1,184 @@
+/**************************************************************************/
+/*  test_message_queue.h                                                  */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_MESSAGE_QUEUE_H
+#define TEST_MESSAGE_QUEUE_H
+
+#include "core/object/message_queue.h"
+#include "core/object/object.h"
+
+#include "tests/test_macros.h"
+
+namespace TestMessageQueue {
+
+class _DeferredTarget : public Object {
+public:
+	LocalVector<int> calls;
+
+	void add_call(int p_value) {
+		calls.push_back(p_value);
+	}
+	void add_sum(int p_a, const String &p_b) {
+		calls.push_back(p_a + p_b.to_int());
+	}
+
+protected:
+	virtual bool _setv(const StringName &p_name, const Variant &p_property) override {
+		if (p_name == "value") {
+			calls.push_back(p_property);
+			return true;
+		}
+		return false;
+	}
+};
+
+TEST_CASE("[MessageQueue] Native method calls") {
+	CallQueue queue;
+	_DeferredTarget target;
+
+	queue.push_method(&target, &_DeferredTarget::add_call, 1);
+	queue.push_callable(callable_mp(&target, &_DeferredTarget::add_call), 2);
+	queue.push_method(&target, &_DeferredTarget::add_sum, 1, String("2"));
+	CHECK(target.calls.is_empty());
+	CHECK(queue.has_messages());
+
+	queue.flush();
+	CHECK_FALSE(queue.has_messages());
+	REQUIRE(target.calls.size() == 3);
+	// Native and regular calls keep their order.
+	CHECK(target.calls[0] == 1);
+	CHECK(target.calls[1] == 2);
+	CHECK(target.calls[2] == 3);
+
+	SUBCASE("Calls to freed objects are skipped") {
+		_DeferredTarget *freed = memnew(_DeferredTarget);
+		queue.push_method(freed, &_DeferredTarget::add_call, 4);
+		memdelete(freed);
+		queue.push_method(&target, &_DeferredTarget::add_call, 5);
+		queue.flush();
+		CHECK(target.calls.size() == 4);
+		CHECK(target.calls[3] == 5);
+	}
+
+	SUBCASE("Cleared calls aren't run") {
+		queue.push_method(&target, &_DeferredTarget::add_sum, 1, String("a long string that needs to be freed"));
+		queue.clear();
+		queue.flush();
+		CHECK(target.calls.size() == 3);
+	}
+}
+
+TEST_CASE("[MessageQueue] Repeated deferred sets") {
+	CallQueue queue;
+	_DeferredTarget target;
+	_DeferredTarget other_target;
+
+	queue.push_set(&target, "value", 1);
+	queue.push_set(&target, "value", 2);
+	queue.push_set(&other_target, "value", 1);
+	queue.push_set(&target, "value", 3);
+	queue.push_set(&target, "value", 4);
+	CHECK(target.calls.is_empty());
+
+	queue.flush();
+	// Only consecutive sets of the same property are merged, keeping the last value.
+	REQUIRE(target.calls.size() == 2);
+	CHECK(target.calls[0] == 2);
+	CHECK(target.calls[1] == 4);
+	CHECK(other_target.calls.size() == 1);
+
+	// Sets after a flush need a new message.
+	queue.push_set(&target, "value", 5);
+	queue.flush();
+	REQUIRE(target.calls.size() == 3);
+	CHECK(target.calls[2] == 5);
+
+	queue.push_set(&target, "value", 6);
+	queue.clear();
+	queue.push_set(&target, "value", 7);
+	queue.flush();
+	REQUIRE(target.calls.size() == 4);
+	CHECK(target.calls[3] == 7);
+}
+
+TEST_CASE("[MessageQueue] Deferred sets keep their order with other messages") {
+	CallQueue queue;
+	_DeferredTarget target;
+
+	queue.push_set(&target, "value", 1);
+	queue.push_method(&target, &_DeferredTarget::add_call, 10);
+	queue.push_set(&target, "value", 2);
+	queue.push_callable(callable_mp(&target, &_DeferredTarget::add_call), 20);
+	queue.push_set(&target, "value", 3);
+	queue.push_notification(&target, 1000);
+	queue.push_set(&target, "value", 4);
+
+	queue.flush();
+	// Each call sees the value set right before it.
+	REQUIRE(target.calls.size() == 6);
+	CHECK(target.calls[0] == 1);
+	CHECK(target.calls[1] == 10);
+	CHECK(target.calls[2] == 2);
+	CHECK(target.calls[3] == 20);
+	CHECK(target.calls[4] == 3);
+	CHECK(target.calls[5] == 4);
+}
+
+TEST_CASE("[MessageQueue][Benchmark] Deferred calls" * doctest::skip()) {
+	CallQueue queue(nullptr, 65536);
+	_DeferredTarget target;
+	const int count = 100000;
+	target.calls.reserve(count * 2);
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < count; i++) {
+		callable_mp(&target, &_DeferredTarget::add_call).call_deferred(i);
+	}
+	MessageQueue::get_singleton()->flush();
+	MESSAGE(vformat("callable_mp().call_deferred(): %d usec.", OS::get_singleton()->get_ticks_usec() - begin));
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < count; i++) {
+		queue.push_method(&target, &_DeferredTarget::add_call, i);
+	}
+	queue.flush();
+	MESSAGE(vformat("push_method(): %d usec.", OS::get_singleton()->get_ticks_usec() - begin));
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < count; i++) {
+		queue.push_set(&target, "value", i);
+	}
+	queue.flush();
+	MESSAGE(vformat("Repeated push_set(): %d usec.", OS::get_singleton()->get_ticks_usec() - begin));
+}
+
+} // namespace TestMessageQueue
+
+#endif // TEST_MESSAGE_QUEUE_H
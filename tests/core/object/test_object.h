@@ -34,6 +34,7 @@
 #include "core/object/class_db.h"
 #include "core/object/object.h"
 #include "core/object/script_language.h"
+#include "core/object/worker_thread_pool.h"
 
 #include "tests/test_macros.h"
 
@@ -59,6 +60,27 @@ public:
 
 namespace TestObject {
 
+class _SignalReceiver : public Object {
+public:
+	int calls = 0;
+	Object *emitter = nullptr;
+	Callable disconnect_on_call;
+	Callable connect_on_call;
+
+	void on_signal() {
+		calls++;
+		if (disconnect_on_call.is_valid()) {
+			emitter->disconnect("my_custom_signal", disconnect_on_call);
+			disconnect_on_call = Callable();
+		}
+		if (connect_on_call.is_valid()) {
+			emitter->connect("my_custom_signal", connect_on_call);
+			connect_on_call = Callable();
+		}
+	}
+};
+
+
 class _MockScriptInstance : public ScriptInstance {
 	StringName property_name = "NO_NAME";
 	Variant property_value;
@@ -454,6 +476,137 @@ TEST_CASE("[Object] Signals") {
 		object.get_all_signal_connections(&signal_connections);
 		CHECK(signal_connections.size() == 0);
 	}
+
+	SUBCASE("Connecting or disconnecting while emitting should only affect the next emissions") {
+		_SignalReceiver receivers[3];
+		for (_SignalReceiver &receiver : receivers) {
+			receiver.emitter = &object;
+			object.connect("my_custom_signal", callable_mp(&receiver, &_SignalReceiver::on_signal));
+		}
+		_SignalReceiver late_receiver;
+		receivers[0].disconnect_on_call = callable_mp(&receivers[1], &_SignalReceiver::on_signal);
+		receivers[0].connect_on_call = callable_mp(&late_receiver, &_SignalReceiver::on_signal);
+
+		object.emit_signal("my_custom_signal");
+		CHECK(receivers[0].calls == 1);
+		CHECK(receivers[1].calls == 1);
+		CHECK(receivers[2].calls == 1);
+		CHECK(late_receiver.calls == 0);
+
+		object.emit_signal("my_custom_signal");
+		CHECK(receivers[0].calls == 2);
+		CHECK(receivers[1].calls == 1);
+		CHECK(receivers[2].calls == 2);
+		CHECK(late_receiver.calls == 1);
+
+		object.disconnect("my_custom_signal", callable_mp(&receivers[0], &_SignalReceiver::on_signal));
+		object.disconnect("my_custom_signal", callable_mp(&receivers[2], &_SignalReceiver::on_signal));
+		object.disconnect("my_custom_signal", callable_mp(&late_receiver, &_SignalReceiver::on_signal));
+	}
+
+	SUBCASE("One-shot connections should only be called once") {
+		_SignalReceiver receiver;
+		object.connect("my_custom_signal", callable_mp(&receiver, &_SignalReceiver::on_signal), Object::CONNECT_ONE_SHOT);
+		object.emit_signal("my_custom_signal");
+		object.emit_signal("my_custom_signal");
+		CHECK(receiver.calls == 1);
+		CHECK_FALSE(object.is_connected("my_custom_signal", callable_mp(&receiver, &_SignalReceiver::on_signal)));
+	}
+}
+
+TEST_CASE("[Object][Benchmark] Signal emission" * doctest::skip()) {
+	for (int count : { 1, 10, 100 }) {
+		Object object;
+		object.add_user_signal(MethodInfo("my_custom_signal"));
+		_SignalReceiver *receivers = memnew_arr(_SignalReceiver, count);
+		for (int i = 0; i < count; i++) {
+			object.connect("my_custom_signal", callable_mp(&receivers[i], &_SignalReceiver::on_signal));
+		}
+
+		const int emissions = 1000000 / count;
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < emissions; i++) {
+			object.emit_signal("my_custom_signal");
+		}
+		MESSAGE(vformat("%d connections: %d emissions in %d usec.", count, emissions, OS::get_singleton()->get_ticks_usec() - begin));
+
+		CHECK(receivers[count - 1].calls == emissions);
+		memdelete_arr(receivers);
+	}
+}
+
+struct _ObjectDBLookupData {
+	LocalVector<Object *> objects;
+	LocalVector<ObjectID> ids;
+	int iterations = 0;
+	SafeNumeric<uint32_t> mismatches;
+};
+
+static void _resolve_object_ids(void *p_userdata, uint32_t p_index) {
+	_ObjectDBLookupData *data = (_ObjectDBLookupData *)p_userdata;
+	for (int i = 0; i < data->iterations; i++) {
+		for (uint32_t j = 0; j < data->ids.size(); j++) {
+			if (ObjectDB::get_instance(data->ids[j]) != data->objects[j]) {
+				data->mismatches.increment();
+			}
+		}
+	}
+}
+
+TEST_CASE("[Object] ObjectDB lookups from multiple threads") {
+	_ObjectDBLookupData data;
+	data.iterations = 100;
+	for (int i = 0; i < 100; i++) {
+		data.objects.push_back(memnew(Object));
+		data.ids.push_back(data.objects[i]->get_instance_id());
+	}
+
+	// Add and remove instances while the other threads resolve the IDs, growing the slot storage.
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(&_resolve_object_ids, &data, 8, -1, true);
+	LocalVector<ObjectID> freed_ids;
+	for (int i = 0; i < 100; i++) {
+		LocalVector<Object *> temporary;
+		for (int j = 0; j < 100; j++) {
+			temporary.push_back(memnew(Object));
+		}
+		for (Object *object : temporary) {
+			freed_ids.push_back(object->get_instance_id());
+			memdelete(object);
+		}
+	}
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	CHECK(data.mismatches.get() == 0);
+	bool all_freed_invalid = true;
+	for (const ObjectID &id : freed_ids) {
+		all_freed_invalid &= ObjectDB::get_instance(id) == nullptr;
+	}
+	CHECK(all_freed_invalid);
+
+	for (Object *object : data.objects) {
+		memdelete(object);
+	}
+}
+
+TEST_CASE("[Object][Benchmark] ObjectDB lookups from multiple threads" * doctest::skip()) {
+	_ObjectDBLookupData data;
+	data.iterations = 10000;
+	for (int i = 0; i < 1000; i++) {
+		data.objects.push_back(memnew(Object));
+		data.ids.push_back(data.objects[i]->get_instance_id());
+	}
+
+	for (int threads : { 1, 4, 16 }) {
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(&_resolve_object_ids, &data, threads, threads, true);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+		MESSAGE(vformat("%d threads: %d lookups in %d usec.", threads, (int64_t)threads * data.iterations * data.ids.size(), OS::get_singleton()->get_ticks_usec() - begin));
+	}
+	CHECK(data.mismatches.get() == 0);
+
+	for (Object *object : data.objects) {
+		memdelete(object);
+	}
 }
 
 class NotificationObject1 : public Object {
@@ -0,0 +1,161 @@
+/**************************************************************************/
+/*  test_small_object_allocator.h                                         */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SMALL_OBJECT_ALLOCATOR_H
+#define TEST_SMALL_OBJECT_ALLOCATOR_H
+
+#include "core/os/small_object_allocator.h"
+#include "core/os/thread.h"
+#include "core/templates/local_vector.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSmallObjectAllocator {
+
+TEST_CASE("[SmallObjectAllocator] Size classes") {
+	CHECK(SmallObjectAllocator::get_size_class(0) == 0);
+	CHECK(SmallObjectAllocator::get_size_class(1) == 0);
+	CHECK(SmallObjectAllocator::get_size_class(16) == 0);
+	CHECK(SmallObjectAllocator::get_size_class(17) == 1);
+	CHECK(SmallObjectAllocator::get_size_class(128) == 7);
+	CHECK(SmallObjectAllocator::get_size_class(129) == 8);
+	CHECK(SmallObjectAllocator::get_size_class(256) == 11);
+	CHECK(SmallObjectAllocator::get_size_class(257) == 12);
+	CHECK(SmallObjectAllocator::get_size_class(SmallObjectAllocator::MAX_BLOCK_SIZE) == SmallObjectAllocator::SIZE_CLASS_COUNT - 1);
+	CHECK(SmallObjectAllocator::get_size_class(SmallObjectAllocator::MAX_BLOCK_SIZE + 1) == SmallObjectAllocator::INVALID_SIZE_CLASS);
+
+	for (size_t size = 1; size <= SmallObjectAllocator::MAX_BLOCK_SIZE; size++) {
+		const uint32_t size_class = SmallObjectAllocator::get_size_class(size);
+		const size_t block_size = SmallObjectAllocator::get_block_size(size_class);
+		if (block_size < size || (size_class > 0 && SmallObjectAllocator::get_block_size(size_class - 1) >= size)) {
+			FAIL("Size ", size, " maps to a block size of ", block_size, ".");
+		}
+	}
+}
+
+TEST_CASE("[SmallObjectAllocator] Allocate and free") {
+	LocalVector<void *> blocks;
+	for (uint32_t i = 0; i < 4096; i++) {
+		const uint32_t size_class = i % SmallObjectAllocator::SIZE_CLASS_COUNT;
+		uint8_t *block = (uint8_t *)SmallObjectAllocator::alloc(size_class);
+		REQUIRE(block != nullptr);
+		CHECK(SmallObjectAllocator::get_pointer_size_class(block) == size_class);
+		// The last byte of the block is usable too.
+		CHECK(SmallObjectAllocator::get_pointer_size_class(block + SmallObjectAllocator::get_block_size(size_class) - 1) == size_class);
+		memset(block, (int)size_class, SmallObjectAllocator::get_block_size(size_class));
+		blocks.push_back(block);
+	}
+
+	bool intact = true;
+	for (uint32_t i = 0; i < blocks.size(); i++) {
+		const uint32_t size_class = i % SmallObjectAllocator::SIZE_CLASS_COUNT;
+		const uint8_t *block = (const uint8_t *)blocks[i];
+		for (size_t j = 0; j < SmallObjectAllocator::get_block_size(size_class); j++) {
+			intact = intact && block[j] == size_class;
+		}
+	}
+	CHECK_MESSAGE(intact, "Blocks must not overlap.");
+
+	for (uint32_t i = 0; i < blocks.size(); i++) {
+		SmallObjectAllocator::free(blocks[i], i % SmallObjectAllocator::SIZE_CLASS_COUNT);
+	}
+
+	// A freed block is handed out again by the same thread.
+	void *block = SmallObjectAllocator::alloc(3);
+	SmallObjectAllocator::free(block, 3);
+	CHECK(SmallObjectAllocator::alloc(3) == block);
+	SmallObjectAllocator::free(block, 3);
+}
+
+TEST_CASE("[SmallObjectAllocator] Foreign pointers") {
+	void *mem = malloc(32);
+	CHECK(SmallObjectAllocator::get_pointer_size_class(mem) == SmallObjectAllocator::INVALID_SIZE_CLASS);
+	free(mem);
+
+	int local = 0;
+	CHECK(SmallObjectAllocator::get_pointer_size_class(&local) == SmallObjectAllocator::INVALID_SIZE_CLASS);
+}
+
+struct CrossThreadData {
+	LocalVector<void *> blocks;
+	bool classes_match = true;
+};
+
+static void free_blocks_func(void *p_user) {
+	CrossThreadData *data = static_cast<CrossThreadData *>(p_user);
+	for (uint32_t i = 0; i < data->blocks.size(); i++) {
+		const uint32_t size_class = i % SmallObjectAllocator::SIZE_CLASS_COUNT;
+		data->classes_match = data->classes_match && SmallObjectAllocator::get_pointer_size_class(data->blocks[i]) == size_class;
+		SmallObjectAllocator::free(data->blocks[i], size_class);
+	}
+}
+
+static void alloc_blocks_func(void *p_user) {
+	CrossThreadData *data = static_cast<CrossThreadData *>(p_user);
+	for (uint32_t i = 0; i < 20000; i++) {
+		data->blocks.push_back(SmallObjectAllocator::alloc(i % SmallObjectAllocator::SIZE_CLASS_COUNT));
+	}
+}
+
+TEST_CASE("[SmallObjectAllocator] Blocks freed by another thread") {
+	SmallObjectAllocator::SizeClassStats stats_before[SmallObjectAllocator::SIZE_CLASS_COUNT];
+	SmallObjectAllocator::get_stats(stats_before);
+
+	CrossThreadData data;
+	// Allocated here, freed by another thread.
+	for (uint32_t i = 0; i < 20000; i++) {
+		data.blocks.push_back(SmallObjectAllocator::alloc(i % SmallObjectAllocator::SIZE_CLASS_COUNT));
+	}
+	Thread freeing_thread;
+	freeing_thread.start(free_blocks_func, &data);
+	freeing_thread.wait_to_finish();
+	CHECK(data.classes_match);
+
+	// Allocated by another thread, which exits before they are freed here.
+	data.blocks.clear();
+	Thread allocating_thread;
+	allocating_thread.start(alloc_blocks_func, &data);
+	allocating_thread.wait_to_finish();
+	free_blocks_func(&data);
+	CHECK(data.classes_match);
+
+	// Exiting threads hand their cached blocks back, so the pools can serve them again.
+	SmallObjectAllocator::SizeClassStats stats_after[SmallObjectAllocator::SIZE_CLASS_COUNT];
+	SmallObjectAllocator::get_stats(stats_after);
+	for (uint32_t i = 0; i < SmallObjectAllocator::SIZE_CLASS_COUNT; i++) {
+		CHECK(stats_after[i].block_size == SmallObjectAllocator::get_block_size(i));
+		CHECK(stats_after[i].reserved_blocks >= stats_before[i].reserved_blocks);
+		CHECK(stats_after[i].reserved_blocks >= stats_after[i].used_blocks);
+	}
+}
+
+} // namespace TestSmallObjectAllocator
+
+#endif // TEST_SMALL_OBJECT_ALLOCATOR_H
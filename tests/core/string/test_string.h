@@ -31,6 +31,7 @@
 #ifndef TEST_STRING_H
 #define TEST_STRING_H
 
+#include "core/io/json.h"
 #include "core/string/ustring.h"
 
 #include "tests/test_macros.h"
@@ -1974,6 +1975,78 @@ TEST_CASE("[String] Variant ptr indexed set") {
 	CHECK_EQ(s, String("azcd"));
 }
 
+TEST_CASE("[String] Single character strings") {
+	String a = String::chr('a');
+	String b = String("xay").substr(1, 1);
+	CHECK(a == "a");
+	CHECK(b == "a");
+	CHECK(a.length() == 1);
+	// Latin-1 characters share the same buffer.
+	CHECK(a.ptr() == b.ptr());
+
+	// Modifying one of them must not affect the others.
+	b[0] = 'z';
+	CHECK(a == "a");
+	CHECK(b == "z");
+	CHECK(String::chr('a') == "a");
+	a += "bc";
+	CHECK(a == "abc");
+	CHECK(String::chr('a') == "a");
+
+	CHECK(String::chr(0xe9) == U"é");
+	CHECK(String::chr(U'😀') == U"😀");
+	CHECK(String::chr(0).is_empty());
+
+	Variant v = String("héllo");
+	bool valid = false;
+	bool oob = true;
+	CHECK(v.get_indexed(1, valid, oob) == Variant(U"é"));
+	CHECK(valid);
+	CHECK_FALSE(oob);
+}
+
+TEST_CASE("[String][Benchmark] Common operations on short strings" * doctest::skip()) {
+	OS *os = OS::get_singleton();
+	const String csv = String("alpha,beta,gamma,delta,a,b,c,").repeat(1000);
+
+	uint64_t begin = os->get_ticks_usec();
+	int count = 0;
+	for (int i = 0; i < 100; i++) {
+		count += csv.split(",").size();
+	}
+	MESSAGE(vformat("split: %d usec (%d parts).", os->get_ticks_usec() - begin, count));
+
+	Dictionary values;
+	values["name"] = "key";
+	values["value"] = 42;
+	begin = os->get_ticks_usec();
+	for (int i = 0; i < 100000; i++) {
+		count += String("{name} = {value}").format(values).length();
+	}
+	MESSAGE(vformat("format: %d usec.", os->get_ticks_usec() - begin));
+
+	begin = os->get_ticks_usec();
+	for (int i = 0; i < 100; i++) {
+		count += csv.replace(",", ";").length();
+	}
+	MESSAGE(vformat("replace: %d usec.", os->get_ticks_usec() - begin));
+
+	begin = os->get_ticks_usec();
+	for (int i = 0; i < 10; i++) {
+		for (int j = 0; j < csv.length(); j++) {
+			count += csv.substr(j, 1).length();
+		}
+	}
+	MESSAGE(vformat("substr (1 character): %d usec.", os->get_ticks_usec() - begin));
+
+	const String json = "[" + String("{\"name\": \"alpha\", \"tags\": [\"a\", \"b\"], \"text\": \"line\\nbreak\"},").repeat(1000) + "{}]";
+	begin = os->get_ticks_usec();
+	for (int i = 0; i < 10; i++) {
+		count += Array(JSON::parse_string(json)).size();
+	}
+	MESSAGE(vformat("JSON parse: %d usec (checksum %d).", os->get_ticks_usec() - begin, count));
+}
+
 TEST_CASE("[Stress][String] Empty via ' == String()'") {
 	for (int i = 0; i < 100000; ++i) {
 		String str = "Hello World!";
@@ -0,0 +1,321 @@
+/**************************************************************************/
+/*  test_a_hash_map.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_A_HASH_MAP_H
+#define TEST_A_HASH_MAP_H
+
+#include "core/os/os.h"
+#include "core/templates/a_hash_map.h"
+#include "core/templates/hash_map.h"
+
+#include "tests/test_macros.h"
+
+namespace TestAHashMap {
+
+TEST_CASE("[AHashMap] Insert element") {
+	AHashMap<int, int> map;
+	AHashMap<int, int>::Iterator e = map.insert(42, 84);
+
+	CHECK(e);
+	CHECK(e->key == 42);
+	CHECK(e->value == 84);
+	CHECK(map[42] == 84);
+	CHECK(map.has(42));
+	CHECK(map.find(42));
+}
+
+TEST_CASE("[AHashMap] Overwrite element") {
+	AHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(42, 1234);
+
+	CHECK(map[42] == 1234);
+}
+
+TEST_CASE("[AHashMap] Erase via element") {
+	AHashMap<int, int> map;
+	AHashMap<int, int>::Iterator e = map.insert(42, 84);
+	map.remove(e);
+	CHECK(!map.has(42));
+	CHECK(!map.find(42));
+}
+
+TEST_CASE("[AHashMap] Erase via key") {
+	AHashMap<int, int> map;
+	map.insert(42, 84);
+	map.erase(42);
+	CHECK(!map.has(42));
+	CHECK(!map.find(42));
+}
+
+TEST_CASE("[AHashMap] Size") {
+	AHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(123, 84);
+	map.insert(123, 84);
+	map.insert(0, 84);
+	map.insert(123485, 84);
+
+	CHECK(map.size() == 4);
+}
+
+TEST_CASE("[AHashMap] Iteration") {
+	AHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(123, 12385);
+	map.insert(0, 12934);
+	map.insert(123485, 1238888);
+	map.insert(123, 111111);
+
+	Vector<Pair<int, int>> expected;
+	expected.push_back(Pair<int, int>(42, 84));
+	expected.push_back(Pair<int, int>(123, 111111));
+	expected.push_back(Pair<int, int>(0, 12934));
+	expected.push_back(Pair<int, int>(123485, 1238888));
+
+	int idx = 0;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(expected[idx] == Pair<int, int>(E.key, E.value));
+		++idx;
+	}
+	CHECK(idx == 4);
+}
+
+TEST_CASE("[AHashMap] Const iteration") {
+	AHashMap<int, int> map;
+	map.insert(42, 84);
+	map.insert(123, 12385);
+	map.insert(0, 12934);
+	map.insert(123485, 1238888);
+	map.insert(123, 111111);
+
+	const AHashMap<int, int> const_map = map;
+
+	Vector<Pair<int, int>> expected;
+	expected.push_back(Pair<int, int>(42, 84));
+	expected.push_back(Pair<int, int>(123, 111111));
+	expected.push_back(Pair<int, int>(0, 12934));
+	expected.push_back(Pair<int, int>(123485, 1238888));
+
+	int idx = 0;
+	for (const KeyValue<int, int> &E : const_map) {
+		CHECK(expected[idx] == Pair<int, int>(E.key, E.value));
+		++idx;
+	}
+	CHECK(idx == 4);
+}
+
+TEST_CASE("[AHashMap] Reverse iteration") {
+	AHashMap<int, int> map;
+	for (int i = 0; i < 10; i++) {
+		map.insert(i, i * 10);
+	}
+	map.erase(9);
+	map.erase(4);
+
+	int expected = 8;
+	for (AHashMap<int, int>::Iterator I = map.last(); I; --I) {
+		CHECK(I->key == expected);
+		expected -= expected == 5 ? 2 : 1;
+	}
+	CHECK(expected == -1);
+}
+
+TEST_CASE("[AHashMap] Insertion order is kept after erasing") {
+	AHashMap<int, int> map;
+	for (int i = 0; i < 100; i++) {
+		map.insert(i, i);
+	}
+	for (int i = 0; i < 100; i += 3) {
+		map.erase(i);
+	}
+	// Enough insertions to make the map reuse the erased slots and grow.
+	for (int i = 100; i < 200; i++) {
+		map.insert(i, i);
+	}
+
+	int previous = -1;
+	int count = 0;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK((E.key % 3 != 0 || E.key >= 100));
+		CHECK(E.key > previous);
+		CHECK(E.value == E.key);
+		previous = E.key;
+		count++;
+	}
+	CHECK(count == map.size());
+	CHECK(map.size() == 166);
+}
+
+TEST_CASE("[AHashMap] Front insertion") {
+	AHashMap<int, int> map;
+	map.insert(1, 1);
+	map.insert(2, 2);
+	map.insert(0, 0, true);
+
+	int expected = 0;
+	for (const KeyValue<int, int> &E : map) {
+		CHECK(E.key == expected);
+		expected++;
+	}
+	CHECK(map[0] == 0);
+	CHECK(map[1] == 1);
+	CHECK(map[2] == 2);
+}
+
+TEST_CASE("[AHashMap] Front insertion of a value stored in the map") {
+	AHashMap<int, String> map;
+	map.reserve(16);
+	map.insert(1, "one");
+	map.insert(2, "two");
+
+	// The referenced value is moved by the front insertion, it must be copied before that.
+	map.insert(0, map[1], true);
+	CHECK(map.size() == 3);
+	CHECK(map[0] == "one");
+	CHECK(map[1] == "one");
+	CHECK(map[2] == "two");
+
+	map[1] = "changed";
+	map.erase(2);
+	CHECK(map[0] == "one");
+	CHECK(map[1] == "changed");
+
+	Vector<int> keys;
+	for (const KeyValue<int, String> &E : map) {
+		keys.push_back(E.key);
+	}
+	CHECK(keys == Vector<int>({ 0, 1 }));
+}
+
+TEST_CASE("[AHashMap] Replace key") {
+	AHashMap<int, int> map;
+	map.insert(1, 10);
+	map.insert(2, 20);
+	map.insert(3, 30);
+
+	CHECK(map.replace_key(2, 5));
+	CHECK(!map.has(2));
+	CHECK(map[5] == 20);
+
+	Vector<int> keys;
+	for (const KeyValue<int, int> &E : map) {
+		keys.push_back(E.key);
+	}
+	CHECK(keys == Vector<int>({ 1, 5, 3 }));
+}
+
+TEST_CASE("[AHashMap] Insertion while iterating") {
+	AHashMap<int, int> map;
+	map.insert(0, 0);
+
+	int count = 0;
+	for (const KeyValue<int, int> &E : map) {
+		if (E.key < 100) {
+			map.insert(E.key + 1, 0);
+		}
+		count++;
+	}
+	CHECK(count == 101);
+	CHECK(map.size() == 101);
+}
+
+TEST_CASE("[AHashMap] Many elements") {
+	AHashMap<String, int> map;
+	for (int i = 0; i < 5000; i++) {
+		map[itos(i)] = i;
+	}
+	for (int i = 0; i < 5000; i += 2) {
+		map.erase(itos(i));
+	}
+
+	CHECK(map.size() == 2500);
+	for (int i = 0; i < 5000; i++) {
+		CHECK(map.has(itos(i)) == (i % 2 == 1));
+	}
+
+	map.clear();
+	CHECK(map.is_empty());
+	CHECK(!map.begin());
+}
+
+// Benchmarks against HashMap, run them with `--no-skip`.
+
+template <typename TMap>
+static void _benchmark_map(const char *p_name, const Vector<StringName> &p_keys) {
+	OS *os = OS::get_singleton();
+	TMap map;
+
+	uint64_t begin = os->get_ticks_usec();
+	for (int i = 0; i < p_keys.size(); i++) {
+		map.insert(p_keys[i], i);
+	}
+	const uint64_t insert_usec = os->get_ticks_usec() - begin;
+
+	int64_t sum = 0;
+	begin = os->get_ticks_usec();
+	for (int pass = 0; pass < 10; pass++) {
+		for (int i = 0; i < p_keys.size(); i++) {
+			sum += map[p_keys[i]];
+		}
+	}
+	const uint64_t lookup_usec = os->get_ticks_usec() - begin;
+
+	begin = os->get_ticks_usec();
+	for (int pass = 0; pass < 10; pass++) {
+		for (const KeyValue<StringName, int> &E : map) {
+			sum += E.value;
+		}
+	}
+	const uint64_t iterate_usec = os->get_ticks_usec() - begin;
+
+	begin = os->get_ticks_usec();
+	for (int i = 0; i < p_keys.size(); i += 2) {
+		map.erase(p_keys[i]);
+	}
+	const uint64_t erase_usec = os->get_ticks_usec() - begin;
+
+	MESSAGE(vformat("%s (%d keys): insert %d usec, lookup x10 %d usec, iterate x10 %d usec, erase half %d usec (checksum %d).", p_name, p_keys.size(), insert_usec, lookup_usec, iterate_usec, erase_usec, sum));
+}
+
+TEST_CASE("[AHashMap][Benchmark] Compare with HashMap" * doctest::skip()) {
+	for (int count : { 16, 1024, 65536 }) {
+		Vector<StringName> keys;
+		for (int i = 0; i < count; i++) {
+			keys.push_back(StringName("key_" + itos(i)));
+		}
+		_benchmark_map<HashMap<StringName, int>>("HashMap", keys);
+		_benchmark_map<AHashMap<StringName, int>>("AHashMap", keys);
+	}
+}
+
+} // namespace TestAHashMap
+
+#endif // TEST_A_HASH_MAP_H
@@ -0,0 +1,140 @@
+/**************************************************************************/
+/*  test_frame_arena.h                                                    */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_FRAME_ARENA_H
+#define TEST_FRAME_ARENA_H
+
+#include "core/templates/frame_arena.h"
+#include "core/templates/hash_map.h"
+#include "core/templates/list.h"
+
+#include "tests/test_macros.h"
+
+namespace TestFrameArena {
+
+TEST_CASE("[FrameArena] Blocks are aligned and writable") {
+	void *a = FrameArena::alloc(3);
+	void *b = FrameArena::alloc(100);
+	CHECK(((uintptr_t)a % alignof(max_align_t)) == 0);
+	CHECK(((uintptr_t)b % alignof(max_align_t)) == 0);
+	CHECK((uint8_t *)b >= (uint8_t *)a + 3);
+	memset(a, 1, 3);
+	memset(b, 2, 100);
+	CHECK(((uint8_t *)a)[2] == 1);
+	FrameArena::free(b);
+	FrameArena::free(a);
+}
+
+TEST_CASE("[FrameArena] Most recent block grows in place and memory is reused") {
+	void *first = FrameArena::alloc(16);
+	void *grown = FrameArena::realloc(first, 1024);
+	CHECK(grown == first);
+	FrameArena::free(grown);
+
+	// Everything was freed, so the arena starts over.
+	void *again = FrameArena::alloc(16);
+	CHECK(again == first);
+	FrameArena::free(again);
+}
+
+TEST_CASE("[FrameArena] Reallocating an older block copies it") {
+	uint8_t *a = (uint8_t *)FrameArena::alloc(16);
+	void *b = FrameArena::alloc(16);
+	for (int i = 0; i < 16; i++) {
+		a[i] = i;
+	}
+	uint8_t *moved = (uint8_t *)FrameArena::realloc(a, 64);
+	CHECK(moved != a);
+	for (int i = 0; i < 16; i++) {
+		CHECK(moved[i] == i);
+	}
+	FrameArena::free(b);
+	FrameArena::free(moved);
+}
+
+TEST_CASE("[FrameArena] Blocks larger than a chunk") {
+	const size_t size = FrameArena::CHUNK_SIZE * 3;
+	uint8_t *small = (uint8_t *)FrameArena::alloc(32);
+	uint8_t *big = (uint8_t *)FrameArena::alloc(size);
+	big[0] = 1;
+	big[size - 1] = 2;
+	CHECK(big[size - 1] == 2);
+	FrameArena::free(big);
+	FrameArena::free(small);
+}
+
+TEST_CASE("[FrameArena] LocalVector") {
+	FrameLocalVector<int> vector;
+	for (int i = 0; i < 10000; i++) {
+		vector.push_back(i);
+	}
+	CHECK(vector.size() == 10000);
+	CHECK(vector[9999] == 9999);
+	vector.remove_at_unordered(0);
+	CHECK(vector[0] == 9999);
+
+	FrameLocalVector<int> copy = vector;
+	CHECK(copy.size() == vector.size());
+}
+
+TEST_CASE("[FrameArena] HashMap and List") {
+	HashMap<int, int, HashMapHasherDefault, HashMapComparatorDefault<int>, FrameArenaTypedAllocator<HashMapElement<int, int>>> map;
+	List<int, FrameArena> list;
+	for (int i = 0; i < 100; i++) {
+		map.insert(i, i * 2);
+		list.push_back(i);
+	}
+	map.erase(50);
+	CHECK(map.size() == 99);
+	CHECK(map[99] == 198);
+	CHECK(list.size() == 100);
+	CHECK(list.back()->get() == 99);
+}
+
+TEST_CASE("[FrameArena] Statistics") {
+	FrameArena::end_frame();
+	const uint64_t frame = FrameArena::get_frame();
+
+	for (int i = 0; i < 100; i++) {
+		FrameLocalVector<int> vector;
+		vector.push_back(i);
+	}
+	FrameArena::end_frame();
+
+	CHECK(FrameArena::get_frame() == frame + 1);
+	const FrameArena::Stats stats = FrameArena::get_last_frame_stats();
+	CHECK(stats.allocations == 100);
+	// The chunk is reused once every block is freed.
+	CHECK(stats.chunk_allocations <= 1);
+}
+
+} // namespace TestFrameArena
+
+#endif // TEST_FRAME_ARENA_H
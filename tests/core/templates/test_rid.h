@@ -31,7 +31,11 @@
 #ifndef TEST_RID_H
 #define TEST_RID_H
 
+#include "core/object/worker_thread_pool.h"
+#include "core/os/os.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rid.h"
+#include "core/templates/rid_owner.h"
 
 #include "tests/test_macros.h"
 
@@ -96,6 +100,174 @@ TEST_CASE("[RID] 'get_local_index'") {
 	CHECK(RID::from_uint64(4'294'967'295).get_local_index() == 4'294'967'295);
 	CHECK(RID::from_uint64(4'294'967'297).get_local_index() == 1);
 }
+
+TEST_CASE("[RID_Owner] Freed slots are reused from the lowest index") {
+	RID_Owner<uint64_t> owner;
+	LocalVector<RID> rids;
+	for (uint64_t i = 0; i < 10; i++) {
+		rids.push_back(owner.make_rid(i));
+	}
+
+	owner.free(rids[5]);
+	owner.free(rids[2]);
+	CHECK_FALSE(owner.owns(rids[2]));
+	CHECK(owner.get_or_null(rids[5]) == nullptr);
+
+	RID reused = owner.make_rid(100);
+	CHECK(reused.get_local_index() == rids[2].get_local_index());
+	CHECK_FALSE(owner.owns(rids[2]));
+	CHECK(*owner.get_or_null(reused) == 100);
+	rids[2] = reused;
+
+	rids[5] = owner.make_rid(200);
+	CHECK(owner.get_rid_count() == 10);
+
+	for (const RID &rid : rids) {
+		owner.free(rid);
+	}
+	CHECK(owner.get_rid_count() == 0);
+}
+
+TEST_CASE("[RID_Owner] Iterating owned elements") {
+	// Small chunks, so the elements span several of them.
+	RID_Owner<uint64_t> owner(64);
+	LocalVector<RID> rids;
+	uint64_t expected_sum = 0;
+	for (uint64_t i = 0; i < 1000; i++) {
+		rids.push_back(owner.make_rid(i));
+		expected_sum += i;
+	}
+	for (uint32_t i = 0; i < rids.size(); i += 3) {
+		expected_sum -= *owner.get_or_null(rids[i]);
+		owner.free(rids[i]);
+	}
+	RID uninitialized = owner.allocate_rid();
+
+	List<RID> owned;
+	owner.get_owned_list(&owned);
+	CHECK(owned.size() == (int)owner.get_rid_count());
+
+	SUBCASE("Sequential") {
+		uint64_t sum = 0;
+		uint32_t count = 0;
+		bool all_owned = true;
+		owner.for_each_owned([&](const RID &p_rid, uint64_t *p_value) {
+			all_owned &= owner.get_or_null(p_rid) == p_value;
+			sum += *p_value;
+			count++;
+		});
+		CHECK(all_owned);
+		CHECK(sum == expected_sum);
+		CHECK(count == owner.get_rid_count() - 1);
+	}
+
+	SUBCASE("Parallel") {
+		SafeNumeric<uint64_t> sum;
+		SafeNumeric<uint32_t> count;
+		owner.for_each_owned([&](const RID &p_rid, uint64_t *p_value) {
+			sum.add(*p_value);
+			count.increment();
+		},
+				true);
+		CHECK(sum.get() == expected_sum);
+		CHECK(count.get() == owner.get_rid_count() - 1);
+	}
+
+	owner.initialize_rid(uninitialized, 0);
+	for (const RID &rid : owned) {
+		owner.free(rid);
+	}
+	CHECK(owner.get_rid_count() == 0);
+}
+
+struct _RIDLookupData {
+	RID_Owner<uint64_t, true> *owner = nullptr;
+	LocalVector<RID> rids;
+	int iterations = 0;
+	SafeNumeric<uint32_t> mismatches;
+};
+
+static void _lookup_rids(void *p_userdata, uint32_t p_index) {
+	_RIDLookupData *data = (_RIDLookupData *)p_userdata;
+	for (int i = 0; i < data->iterations; i++) {
+		for (uint32_t j = 0; j < data->rids.size(); j++) {
+			uint64_t *value = data->owner->get_or_null(data->rids[j]);
+			if (!value || *value != j) {
+				data->mismatches.increment();
+			}
+		}
+	}
+}
+
+TEST_CASE("[RID_Owner] Lookups from multiple threads") {
+	// Small chunks, so the chunk table grows while the other threads look RIDs up.
+	RID_Owner<uint64_t, true> owner(64);
+	_RIDLookupData data;
+	data.owner = &owner;
+	data.iterations = 100;
+	for (uint64_t i = 0; i < 100; i++) {
+		data.rids.push_back(owner.make_rid(i));
+	}
+
+	WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(&_lookup_rids, &data, 8, -1, true);
+	LocalVector<RID> freed_rids;
+	for (int i = 0; i < 100; i++) {
+		LocalVector<RID> temporary;
+		for (int j = 0; j < 100; j++) {
+			temporary.push_back(owner.make_rid(uint64_t(j)));
+		}
+		for (const RID &rid : temporary) {
+			owner.free(rid);
+			freed_rids.push_back(rid);
+		}
+	}
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+
+	CHECK(data.mismatches.get() == 0);
+	bool all_freed_invalid = true;
+	for (const RID &rid : freed_rids) {
+		all_freed_invalid &= !owner.owns(rid);
+	}
+	CHECK(all_freed_invalid);
+
+	for (const RID &rid : data.rids) {
+		owner.free(rid);
+	}
+}
+
+TEST_CASE("[RID_Owner][Benchmark] Lookups from multiple threads" * doctest::skip()) {
+	RID_Owner<uint64_t, true> owner;
+	_RIDLookupData data;
+	data.owner = &owner;
+	data.iterations = 1000;
+	for (uint64_t i = 0; i < 100000; i++) {
+		data.rids.push_back(owner.make_rid(i));
+	}
+
+	for (int threads : { 1, 4, 16 }) {
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		WorkerThreadPool::GroupID group = WorkerThreadPool::get_singleton()->add_native_group_task(&_lookup_rids, &data, threads, threads, true);
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group);
+		MESSAGE(vformat("%d threads: %d lookups in %d usec.", threads, (int64_t)threads * data.iterations * data.rids.size(), OS::get_singleton()->get_ticks_usec() - begin));
+	}
+	CHECK(data.mismatches.get() == 0);
+
+	for (bool parallel : { false, true }) {
+		SafeNumeric<uint64_t> sum;
+		const uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		for (int i = 0; i < 100; i++) {
+			owner.for_each_owned([&](const RID &p_rid, uint64_t *p_value) {
+				sum.add(*p_value);
+			},
+					parallel);
+		}
+		MESSAGE(vformat("for_each_owned (%s): %d elements 100 times in %d usec.", parallel ? "parallel" : "sequential", owner.get_rid_count(), OS::get_singleton()->get_ticks_usec() - begin));
+	}
+
+	for (const RID &rid : data.rids) {
+		owner.free(rid);
+	}
+}
 } // namespace TestRID
 
 #endif // TEST_RID_H
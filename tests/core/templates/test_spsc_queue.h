@@ -0,0 +1,114 @@
+/**************************************************************************/
+/*  test_spsc_queue.h                                                     */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_SPSC_QUEUE_H
+#define TEST_SPSC_QUEUE_H
+
+#include "core/os/thread.h"
+#include "core/templates/spsc_queue.h"
+
+#include "tests/test_macros.h"
+
+namespace TestSPSCQueue {
+
+TEST_CASE("[SPSCQueue] Push and pop in order until full") {
+	SPSCQueue<int> queue(6);
+	CHECK(queue.get_capacity() == 8);
+	CHECK(queue.is_empty());
+
+	int value = 0;
+	CHECK_FALSE(queue.pop(value));
+	for (int i = 0; i < 8; i++) {
+		CHECK(queue.push(i));
+	}
+	CHECK_FALSE(queue.push(8));
+	CHECK(queue.size() == 8);
+
+	// Wraps around.
+	for (int round = 0; round < 3; round++) {
+		CHECK(queue.pop(value));
+		CHECK(value == round);
+		CHECK(queue.push(8 + round));
+	}
+	for (int i = 3; i < 11; i++) {
+		CHECK(queue.pop(value));
+		CHECK(value == i);
+	}
+	CHECK(queue.is_empty());
+}
+
+TEST_CASE("[SPSCQueue] Unset capacity rejects values") {
+	SPSCQueue<int> queue;
+	CHECK_FALSE(queue.push(1));
+	CHECK(queue.is_empty());
+}
+
+struct ProducerData {
+	SPSCQueue<uint32_t> *queue = nullptr;
+	uint32_t count = 0;
+};
+
+static void producer_func(void *p_user) {
+	ProducerData *data = static_cast<ProducerData *>(p_user);
+	for (uint32_t i = 0; i < data->count; i++) {
+		while (!data->queue->push(i)) {
+			// Spin until the consumer makes room.
+		}
+	}
+}
+
+TEST_CASE("[SPSCQueue] Values cross threads in order") {
+	SPSCQueue<uint32_t> queue(1024);
+	ProducerData data;
+	data.queue = &queue;
+	data.count = 20000;
+
+	Thread producer;
+	producer.start(producer_func, &data);
+
+	uint32_t expected = 0;
+	bool in_order = true;
+	while (expected < data.count) {
+		uint32_t value = 0;
+		if (!queue.pop(value)) {
+			continue;
+		}
+		in_order = in_order && value == expected;
+		expected++;
+	}
+	producer.wait_to_finish();
+
+	CHECK(in_order);
+	CHECK(queue.is_empty());
+}
+
+} // namespace TestSPSCQueue
+
+#endif // TEST_SPSC_QUEUE_H
@@ -2208,6 +2208,155 @@ TEST_CASE("[Variant] Operator NOT") {
 	}
 }
 
+TEST_CASE("[Variant] Packed array bulk math") {
+	PackedFloat32Array floats = { 1.0, -2.0, 3.0, 4.0, 5.0 };
+	Variant array = floats;
+	Variant ret;
+	Callable::CallError ce;
+
+	Variant factor = 2.0;
+	const Variant *args[1] = { &factor };
+	array.callp("scale", args, 1, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(array == Variant(PackedFloat32Array({ 2.0, -4.0, 6.0, 8.0, 10.0 })));
+
+	array.callp("sum", nullptr, 0, ret, ce);
+	CHECK(ret == Variant(22.0));
+	array.callp("min", nullptr, 0, ret, ce);
+	CHECK(ret == Variant(-4.0));
+	array.callp("max", nullptr, 0, ret, ce);
+	CHECK(ret == Variant(10.0));
+
+	// Arrays of different sizes are rejected.
+	Variant other = PackedFloat32Array({ 1.0 });
+	args[0] = &other;
+	ERR_PRINT_OFF;
+	array.callp("add_array", args, 1, ret, ce);
+	ERR_PRINT_ON;
+	CHECK(array == Variant(PackedFloat32Array({ 2.0, -4.0, 6.0, 8.0, 10.0 })));
+
+	PackedVector3Array vectors;
+	for (int i = 0; i < 7; i++) {
+		vectors.push_back(Vector3(i, i * 2, i * 3));
+	}
+	const Transform3D transform(Basis(Vector3(0, 1, 0), Math_PI / 3.0), Vector3(1, 2, 3));
+	Variant vectors_variant = vectors;
+	Variant transform_variant = transform;
+	args[0] = &transform_variant;
+	vectors_variant.callp("transform", args, 1, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	const PackedVector3Array transformed = vectors_variant;
+	REQUIRE(transformed.size() == vectors.size());
+	for (int i = 0; i < vectors.size(); i++) {
+		CHECK(transformed[i].is_equal_approx(transform.xform(vectors[i])));
+	}
+}
+
+TEST_CASE("[Variant][Benchmark] Packed array bulk math compared to element-wise access" * doctest::skip()) {
+	PackedVector3Array vectors;
+	vectors.resize(100000);
+	const Transform3D transform(Basis(Vector3(0, 1, 0), 0.5), Vector3(1, 2, 3));
+
+	// Element-wise access through Variant, as scripts do.
+	Variant array = vectors;
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < vectors.size(); i++) {
+		bool valid = false;
+		bool oob = false;
+		Variant element = array.get_indexed(i, valid, oob);
+		array.set_indexed(i, transform.xform(Vector3(element)), valid, oob);
+	}
+	MESSAGE(vformat("Element-wise transform: %d usec.", OS::get_singleton()->get_ticks_usec() - begin));
+
+	Variant transform_variant = transform;
+	const Variant *args[1] = { &transform_variant };
+	Variant ret;
+	Callable::CallError ce;
+	begin = OS::get_singleton()->get_ticks_usec();
+	array.callp("transform", args, 1, ret, ce);
+	MESSAGE(vformat("Bulk transform: %d usec.", OS::get_singleton()->get_ticks_usec() - begin));
+
+	Variant factor = 0.5;
+	args[0] = &factor;
+	begin = OS::get_singleton()->get_ticks_usec();
+	array.callp("scale", args, 1, ret, ce);
+	MESSAGE(vformat("Bulk scale: %d usec.", OS::get_singleton()->get_ticks_usec() - begin));
+}
+
+TEST_CASE("[Variant] Calling builtin methods by index") {
+	for (int type = Variant::NIL + 1; type < Variant::VARIANT_MAX; type++) {
+		if (type == Variant::OBJECT) {
+			continue;
+		}
+		List<StringName> methods;
+		Variant::get_builtin_method_list(Variant::Type(type), &methods);
+		HashSet<int> indices;
+		for (const StringName &method : methods) {
+			indices.insert(Variant::get_builtin_method_index(Variant::Type(type), method));
+		}
+		CHECK(indices.size() == methods.size());
+		CHECK_FALSE(indices.has(-1));
+		CHECK_FALSE(indices.has(Variant::get_builtin_method_count(Variant::Type(type))));
+	}
+	CHECK(Variant::get_builtin_method_index(Variant::VECTOR2, "not_a_method") == -1);
+
+	Variant vector = Vector2(3, 4);
+	const int normalized = Variant::get_builtin_method_index(Variant::VECTOR2, "normalized");
+	const int dot = Variant::get_builtin_method_index(Variant::VECTOR2, "dot");
+	REQUIRE(normalized >= 0);
+	REQUIRE(dot >= 0);
+
+	Variant ret;
+	Callable::CallError ce;
+	vector.call_builtin_method(normalized, nullptr, 0, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(Vector2(ret).is_equal_approx(Vector2(0.6, 0.8)));
+
+	Variant other = Vector2(1, 2);
+	const Variant *args[1] = { &other };
+	vector.call_builtin_method(dot, args, 1, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_OK);
+	CHECK(ret == Variant(11.0));
+
+	vector.call_builtin_method(dot, nullptr, 0, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_ERROR_TOO_FEW_ARGUMENTS);
+
+	vector.call_builtin_method(-1, nullptr, 0, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_ERROR_INVALID_METHOD);
+	vector.call_builtin_method(Variant::get_builtin_method_count(Variant::VECTOR2), nullptr, 0, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_ERROR_INVALID_METHOD);
+
+	Object *object = memnew(Object);
+	Variant object_variant = object;
+	object_variant.call_builtin_method(0, nullptr, 0, ret, ce);
+	CHECK(ce.error == Callable::CallError::CALL_ERROR_INVALID_METHOD);
+	memdelete(object);
+
+	// Builtin method callables resolve their index once.
+	Callable callable = Callable::create(vector, "dot");
+	CHECK(callable.call(other) == Variant(11.0));
+}
+
+TEST_CASE("[Variant][Benchmark] Calling builtin methods by name and by index" * doctest::skip()) {
+	Variant vector = Vector2(3, 4);
+	const StringName method = "normalized";
+	const int method_index = Variant::get_builtin_method_index(Variant::VECTOR2, method);
+	Variant ret;
+	Callable::CallError ce;
+
+	uint64_t begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < 1000000; i++) {
+		vector.callp(method, nullptr, 0, ret, ce);
+	}
+	MESSAGE(vformat("By name: %d usec.", OS::get_singleton()->get_ticks_usec() - begin));
+
+	begin = OS::get_singleton()->get_ticks_usec();
+	for (int i = 0; i < 1000000; i++) {
+		vector.call_builtin_method(method_index, nullptr, 0, ret, ce);
+	}
+	MESSAGE(vformat("By index: %d usec.", OS::get_singleton()->get_ticks_usec() - begin));
+}
+
 } // namespace TestVariant
 
 #endif // TEST_VARIANT_H
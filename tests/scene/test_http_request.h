@@ -0,0 +1,221 @@
+/**************************************************************************/
+/*  test_http_request.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_HTTP_REQUEST_H
+#define TEST_HTTP_REQUEST_H
+
+#include "scene/main/http_request.h"
+
+#include "core/io/stream_peer_tcp.h"
+#include "core/io/tcp_server.h"
+#include "core/object/message_queue.h"
+#include "core/os/os.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestHTTPRequest {
+
+// Minimal HTTP/1.1 server answering every request with the same response.
+struct LocalHTTPServer {
+	struct Connection {
+		Ref<StreamPeerTCP> peer;
+		String received;
+		int requests = 0;
+	};
+
+	Ref<TCPServer> tcp;
+	LocalVector<Connection> connections;
+	String response;
+	bool close_after_response = false;
+	// Closes the connection on its second request without answering, as if it had timed out on the server.
+	bool drop_second_request = false;
+	int requests = 0;
+
+	String get_url() const {
+		return vformat("http://127.0.0.1:%d/", tcp->get_local_port());
+	}
+
+	void poll() {
+		while (tcp->is_connection_available()) {
+			Connection connection;
+			connection.peer = tcp->take_connection();
+			connections.push_back(connection);
+		}
+		for (Connection &connection : connections) {
+			connection.peer->poll();
+			if (connection.peer->get_status() != StreamPeerTCP::STATUS_CONNECTED) {
+				continue;
+			}
+			const int available = connection.peer->get_available_bytes();
+			if (available <= 0) {
+				continue;
+			}
+			Vector<uint8_t> data;
+			data.resize(available);
+			int read = 0;
+			connection.peer->get_partial_data(data.ptrw(), available, read);
+			connection.received += String::utf8((const char *)data.ptr(), read);
+
+			// Only bodyless requests are sent, so a request ends with its headers.
+			const int end = connection.received.find("\r\n\r\n");
+			if (end == -1) {
+				continue;
+			}
+			connection.received = connection.received.substr(end + 4);
+			connection.requests++;
+			requests++;
+			if (drop_second_request && connection.requests == 2) {
+				connection.peer->disconnect_from_host();
+				continue;
+			}
+			const CharString utf8 = response.utf8();
+			connection.peer->put_data((const uint8_t *)utf8.get_data(), utf8.length());
+			if (close_after_response) {
+				connection.peer->disconnect_from_host();
+			}
+		}
+	}
+};
+
+class RequestResult : public Object {
+public:
+	bool done = false;
+	int result = -1;
+	int response_code = 0;
+	String body;
+
+	void completed(int p_result, int p_response_code, const PackedStringArray &p_headers, const PackedByteArray &p_body) {
+		done = true;
+		result = p_result;
+		response_code = p_response_code;
+		body = String::utf8((const char *)p_body.ptr(), p_body.size());
+	}
+};
+
+static bool run_request(HTTPRequest *p_request, LocalHTTPServer &p_server, RequestResult *p_result) {
+	p_result->done = false;
+	if (p_request->request(p_server.get_url()) != OK) {
+		return false;
+	}
+	for (int i = 0; i < 5000 && !p_result->done; i++) {
+		p_request->notification(Node::NOTIFICATION_INTERNAL_PROCESS);
+		p_server.poll();
+		MessageQueue::get_singleton()->flush(); // Completion is deferred.
+		OS::get_singleton()->delay_usec(1000);
+	}
+	return p_result->done;
+}
+
+static const char *KEEP_ALIVE_RESPONSE = "HTTP/1.1 200 OK\r\nContent-Length: 5\r\n\r\nhello";
+static const char *CHUNKED_RESPONSE = "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n3\r\nhel\r\n2\r\nlo\r\n0\r\n\r\n";
+static const char *CLOSE_RESPONSE = "HTTP/1.1 200 OK\r\nConnection: close\r\nContent-Length: 5\r\n\r\nhello";
+
+TEST_CASE("[SceneTree][HTTPRequest] Connection reuse") {
+	HTTPRequest::clear_connection_pool();
+
+	LocalHTTPServer server;
+	server.tcp.instantiate();
+	REQUIRE(server.tcp->listen(0, IPAddress("127.0.0.1")) == OK);
+
+	HTTPRequest *request = memnew(HTTPRequest);
+	SceneTree::get_singleton()->get_root()->add_child(request);
+	RequestResult *result = memnew(RequestResult);
+	request->connect("request_completed", callable_mp(result, &RequestResult::completed));
+
+	SUBCASE("Keep-alive connections are reused") {
+		server.response = KEEP_ALIVE_RESPONSE;
+		request->set_reuse_connections(true);
+		for (int i = 0; i < 3; i++) {
+			REQUIRE(run_request(request, server, result));
+			CHECK(result->result == HTTPRequest::RESULT_SUCCESS);
+			CHECK(result->response_code == 200);
+			CHECK(result->body == "hello");
+		}
+		CHECK(server.requests == 3);
+		CHECK(server.connections.size() == 1);
+		CHECK_MESSAGE(request->is_processing_internal(), "Expires the pooled connection.");
+
+		HTTPRequest::clear_connection_pool();
+		request->notification(Node::NOTIFICATION_INTERNAL_PROCESS);
+		CHECK_FALSE(request->is_processing_internal());
+		REQUIRE(run_request(request, server, result));
+		CHECK(result->result == HTTPRequest::RESULT_SUCCESS);
+		CHECK(server.connections.size() == 2);
+	}
+
+	SUBCASE("Chunked responses keep the connection usable") {
+		server.response = CHUNKED_RESPONSE;
+		request->set_reuse_connections(true);
+		for (int i = 0; i < 2; i++) {
+			REQUIRE(run_request(request, server, result));
+			CHECK(result->result == HTTPRequest::RESULT_SUCCESS);
+			CHECK(result->body == "hello");
+		}
+		CHECK(server.requests == 2);
+		CHECK(server.connections.size() == 1);
+	}
+
+	SUBCASE("Connections are not reused when disabled or closed by the server") {
+		server.response = KEEP_ALIVE_RESPONSE;
+		REQUIRE(run_request(request, server, result));
+		REQUIRE(run_request(request, server, result));
+		CHECK(result->body == "hello");
+		CHECK(server.connections.size() == 2);
+
+		server.response = CLOSE_RESPONSE;
+		request->set_reuse_connections(true);
+		REQUIRE(run_request(request, server, result));
+		REQUIRE(run_request(request, server, result));
+		CHECK(result->result == HTTPRequest::RESULT_SUCCESS);
+		CHECK(result->body == "hello");
+		CHECK(server.connections.size() == 4);
+	}
+
+	SUBCASE("Requests are retried once when a pooled connection was closed") {
+		server.response = KEEP_ALIVE_RESPONSE;
+		server.drop_second_request = true;
+		request->set_reuse_connections(true);
+		REQUIRE(run_request(request, server, result));
+		REQUIRE(run_request(request, server, result));
+		CHECK(result->result == HTTPRequest::RESULT_SUCCESS);
+		CHECK(result->body == "hello");
+		CHECK_MESSAGE(server.requests == 3, "Sent again after the pooled connection was dropped.");
+		CHECK(server.connections.size() == 2);
+	}
+
+	memdelete(request);
+	memdelete(result);
+	HTTPRequest::clear_connection_pool();
+}
+
+} // namespace TestHTTPRequest
+
+#endif // TEST_HTTP_REQUEST_H
@@ -72,6 +72,8 @@ protected:
 		ClassDB::bind_method(D_METHOD("set_exported_nodes", "node"), &TestNode::set_exported_nodes);
 		ClassDB::bind_method(D_METHOD("get_exported_nodes"), &TestNode::get_exported_nodes);
 		ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "exported_nodes", PROPERTY_HINT_TYPE_STRING, "24/34:Node"), "set_exported_nodes", "get_exported_nodes");
+
+		ClassDB::bind_method(D_METHOD("group_call", "value"), &TestNode::group_call);
 	}
 
 private:
@@ -97,6 +99,20 @@ public:
 
 	void set_exported_nodes(const Array &p_nodes) { exported_nodes = p_nodes; }
 	Array get_exported_nodes() const { return exported_nodes; }
+
+	// Group calls may run on worker threads, so the shared list is guarded.
+	static inline Mutex group_call_mutex;
+	int group_call_counter = 0;
+	int group_call_value = 0;
+	bool group_call_from_group_thread = false;
+
+	void group_call(int p_value) {
+		group_call_counter++;
+		group_call_value = p_value;
+		group_call_from_group_thread = Node::is_group_processing();
+		MutexLock lock(group_call_mutex);
+		push_self();
+	}
 };
 
 TEST_CASE("[SceneTree][Node] Testing node operations with a very simple scene tree") {
@@ -892,6 +908,101 @@ TEST_CASE("[SceneTree][Node] Test the process priority") {
 	memdelete(node4);
 }
 
+TEST_CASE("[SceneTree][Node] Test group calls") {
+	GDREGISTER_CLASS(TestNode);
+
+	List<Node *> call_order;
+	TestNode *nodes[4];
+	for (int i = 0; i < 4; i++) {
+		nodes[i] = memnew(TestNode);
+		nodes[i]->callback_list = &call_order;
+		SceneTree::get_singleton()->get_root()->add_child(nodes[i]);
+		nodes[i]->add_to_group("test_group_call");
+	}
+
+	SUBCASE("Group calls happen in tree order") {
+		SceneTree::get_singleton()->call_group_flags(0, "test_group_call", "group_call", 1);
+
+		CHECK_EQ(4, call_order.size());
+		int i = 0;
+		for (Node *node : call_order) {
+			CHECK_EQ(node, nodes[i++]);
+		}
+	}
+
+	SUBCASE("Reverse group calls happen in reverse tree order") {
+		SceneTree::get_singleton()->call_group_flags(SceneTree::GROUP_CALL_REVERSE, "test_group_call", "group_call", 1);
+
+		CHECK_EQ(4, call_order.size());
+		int i = 3;
+		for (Node *node : call_order) {
+			CHECK_EQ(node, nodes[i--]);
+		}
+	}
+
+	SUBCASE("Threaded group calls reach every node") {
+		// Two sub-thread process groups with several group members each, plus nodes outside of them.
+		TestNode *group_owners[2];
+		TestNode *group_children[2][8];
+		for (int i = 0; i < 2; i++) {
+			group_owners[i] = memnew(TestNode);
+			group_owners[i]->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+			group_owners[i]->callback_list = &call_order;
+			SceneTree::get_singleton()->get_root()->add_child(group_owners[i]);
+			group_owners[i]->add_to_group("test_group_call");
+			for (int j = 0; j < 8; j++) {
+				group_children[i][j] = memnew(TestNode);
+				group_children[i][j]->callback_list = &call_order;
+				group_owners[i]->add_child(group_children[i][j]);
+				group_children[i][j]->add_to_group("test_group_call");
+			}
+		}
+
+		SceneTree::get_singleton()->call_group_flags(SceneTree::GROUP_CALL_THREADED, "test_group_call", "group_call", 7);
+
+		CHECK_EQ(4 + 2 * 9, call_order.size());
+		for (int i = 0; i < 4; i++) {
+			CHECK_EQ(nodes[i]->group_call_counter, 1);
+			CHECK_EQ(nodes[i]->group_call_value, 7);
+			CHECK_FALSE(nodes[i]->group_call_from_group_thread);
+		}
+		for (int i = 0; i < 2; i++) {
+			CHECK_EQ(group_owners[i]->group_call_counter, 1);
+			CHECK(group_owners[i]->group_call_from_group_thread);
+			for (int j = 0; j < 8; j++) {
+				CHECK_EQ(group_children[i][j]->group_call_counter, 1);
+				CHECK_EQ(group_children[i][j]->group_call_value, 7);
+				CHECK(group_children[i][j]->group_call_from_group_thread);
+			}
+		}
+
+		// Nodes outside of sub-thread process groups are still called in order, after the threaded ones.
+		List<Node *>::Element *E = call_order.back();
+		for (int i = 3; i >= 0; i--) {
+			CHECK_EQ(E->get(), nodes[i]);
+			E = E->prev();
+		}
+
+		SUBCASE("Deferred threaded group calls fall back to the main thread") {
+			call_order.clear();
+			SceneTree::get_singleton()->call_group_flags(SceneTree::GROUP_CALL_THREADED | SceneTree::GROUP_CALL_DEFERRED, "test_group_call", "group_call", 8);
+			MessageQueue::get_singleton()->flush();
+
+			CHECK_EQ(4 + 2 * 9, call_order.size());
+			CHECK_EQ(group_children[1][7]->group_call_counter, 2);
+			CHECK_FALSE(group_children[1][7]->group_call_from_group_thread);
+		}
+
+		for (int i = 0; i < 2; i++) {
+			memdelete(group_owners[i]);
+		}
+	}
+
+	for (int i = 0; i < 4; i++) {
+		memdelete(nodes[i]);
+	}
+}
+
 } // namespace TestNode
 
 #endif // TEST_NODE_H
@@ -0,0 +1,256 @@
+/**************************************************************************/
+/*  test_node_3d.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_NODE_3D_H
+#define TEST_NODE_3D_H
+
+#include "scene/3d/node_3d.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestNode3D {
+
+class TestNotifyNode3D : public Node3D {
+	GDCLASS(TestNotifyNode3D, Node3D);
+
+protected:
+	void _notification(int p_what) {
+		switch (p_what) {
+			case NOTIFICATION_TRANSFORM_CHANGED: {
+				if (transform_log) {
+					transform_log->push_back(this);
+				}
+			} break;
+			case NOTIFICATION_VISIBILITY_CHANGED: {
+				if (visibility_log) {
+					visibility_log->push_back(this);
+				}
+				if (remove_on_visibility_changed) {
+					Node3D *node = remove_on_visibility_changed;
+					remove_on_visibility_changed = nullptr;
+					node->get_parent()->remove_child(node);
+				}
+			} break;
+		}
+	}
+
+public:
+	LocalVector<Node3D *> *transform_log = nullptr;
+	LocalVector<Node3D *> *visibility_log = nullptr;
+	Node3D *remove_on_visibility_changed = nullptr;
+};
+
+TEST_CASE("[SceneTree][Node3D] Global transform") {
+	Node3D *root = memnew(Node3D);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+
+	SUBCASE("[Node3D][Global Transform] Deep hierarchies should resolve dirty ancestors in order.") {
+		Node3D *parent = root;
+		for (int i = 0; i < 64; i++) {
+			Node3D *child = memnew(Node3D);
+			child->set_position(Vector3(1, 0, 0));
+			parent->add_child(child);
+			parent = child;
+		}
+		CHECK(parent->get_global_position().is_equal_approx(Vector3(64, 0, 0)));
+
+		root->set_position(Vector3(0, 2, 0));
+		CHECK(parent->get_global_position().is_equal_approx(Vector3(64, 2, 0)));
+
+		root->rotate_y(Math_PI);
+		CHECK(parent->get_global_position().is_equal_approx(Vector3(-64, 2, 0)));
+	}
+
+	SUBCASE("[Node3D][Global Transform] Top level nodes should not inherit parent transforms.") {
+		Node3D *child = memnew(Node3D);
+		Node3D *grandchild = memnew(Node3D);
+		root->add_child(child);
+		child->add_child(grandchild);
+		child->set_as_top_level(true);
+		child->set_position(Vector3(1, 1, 1));
+		grandchild->set_position(Vector3(1, 0, 0));
+
+		root->set_position(Vector3(10, 10, 10));
+		CHECK(child->get_global_position().is_equal_approx(Vector3(1, 1, 1)));
+		CHECK(grandchild->get_global_position().is_equal_approx(Vector3(2, 1, 1)));
+	}
+
+	SUBCASE("[Node3D][Global Transform] Removing children should keep siblings updating.") {
+		Node3D *children[4];
+		for (int i = 0; i < 4; i++) {
+			children[i] = memnew(Node3D);
+			children[i]->set_position(Vector3(i, 0, 0));
+			root->add_child(children[i]);
+		}
+
+		root->remove_child(children[1]);
+		root->set_position(Vector3(0, 0, 5));
+		CHECK(children[0]->get_global_position().is_equal_approx(Vector3(0, 0, 5)));
+		CHECK(children[2]->get_global_position().is_equal_approx(Vector3(2, 0, 5)));
+		CHECK(children[3]->get_global_position().is_equal_approx(Vector3(3, 0, 5)));
+		CHECK(children[1]->get_position().is_equal_approx(Vector3(1, 0, 0)));
+
+		memdelete(children[1]);
+	}
+
+	SUBCASE("[Node3D][Global Transform] Chains deeper than the stack buffer should resolve.") {
+		Node3D *parent = root;
+		for (int i = 0; i < 1000; i++) {
+			Node3D *child = memnew(Node3D);
+			child->set_position(Vector3(0, 1, 0));
+			parent->add_child(child);
+			parent = child;
+		}
+		root->set_position(Vector3(3, 0, 0));
+		CHECK(parent->get_global_position().is_equal_approx(Vector3(3, 1000, 0)));
+	}
+
+	memdelete(root);
+}
+
+TEST_CASE("[SceneTree][Node3D] Children order and notifications") {
+	Node3D *root = memnew(Node3D);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+
+	SUBCASE("[Node3D] Removing a child should keep the siblings in order.") {
+		Node3D *children[4];
+		for (int i = 0; i < 4; i++) {
+			children[i] = memnew(Node3D);
+			root->add_child(children[i]);
+		}
+		root->remove_child(children[0]);
+
+		// Transform notifications are delivered in reverse child order, which reflects the internal order.
+		LocalVector<Node3D *> log;
+		TestNotifyNode3D *notifiers[3];
+		for (int i = 0; i < 3; i++) {
+			notifiers[i] = memnew(TestNotifyNode3D);
+			notifiers[i]->set_notify_transform(true);
+			notifiers[i]->transform_log = &log;
+			children[i + 1]->add_child(notifiers[i]);
+		}
+		SceneTree::get_singleton()->flush_transform_notifications();
+		log.clear();
+
+		root->set_position(Vector3(1, 0, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		REQUIRE(log.size() == 3);
+		CHECK(log[0] == notifiers[2]);
+		CHECK(log[1] == notifiers[1]);
+		CHECK(log[2] == notifiers[0]);
+
+		memdelete(children[0]);
+	}
+
+	SUBCASE("[Node3D] Removing and moving children of a wide node should restore the tree order.") {
+		const int count = 2000;
+		LocalVector<Node3D *> log;
+		LocalVector<TestNotifyNode3D *> children;
+		for (int i = 0; i < count; i++) {
+			TestNotifyNode3D *child = memnew(TestNotifyNode3D);
+			child->visibility_log = &log;
+			root->add_child(child);
+			children.push_back(child);
+		}
+		// Each removal swaps the last child in, so this stays linear in the number of children.
+		for (int i = 0; i < count; i += 2) {
+			root->remove_child(children[i]);
+			memdelete(children[i]);
+		}
+		root->move_child(children[count - 1], 0);
+
+		// Visibility notifications are delivered in the internal children order.
+		root->hide();
+		REQUIRE(log.size() == count / 2);
+		CHECK(log[0] == children[count - 1]);
+		bool in_order = true;
+		for (int i = 1; i < count / 2; i++) {
+			in_order = in_order && log[i] == children[i * 2 - 1];
+		}
+		CHECK(in_order);
+	}
+
+	SUBCASE("[Node3D] Transform notifications should keep the order of recursive propagation.") {
+		LocalVector<Node3D *> log;
+		TestNotifyNode3D *parent = memnew(TestNotifyNode3D);
+		TestNotifyNode3D *child_a = memnew(TestNotifyNode3D);
+		TestNotifyNode3D *child_b = memnew(TestNotifyNode3D);
+		TestNotifyNode3D *grandchild = memnew(TestNotifyNode3D);
+		root->add_child(parent);
+		parent->add_child(child_a);
+		parent->add_child(child_b);
+		child_a->add_child(grandchild);
+		for (TestNotifyNode3D *node : { parent, child_a, child_b, grandchild }) {
+			node->set_notify_transform(true);
+			node->transform_log = &log;
+		}
+		SceneTree::get_singleton()->flush_transform_notifications();
+		log.clear();
+
+		parent->set_position(Vector3(0, 1, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		REQUIRE(log.size() == 4);
+		// Queued children first, then the parent; the queue is delivered last in, first out.
+		CHECK(log[0] == parent);
+		CHECK(log[1] == child_b);
+		CHECK(log[2] == child_a);
+		CHECK(log[3] == grandchild);
+	}
+
+	SUBCASE("[Node3D] Removing a sibling from a visibility callback should not skip the others.") {
+		LocalVector<Node3D *> log;
+		TestNotifyNode3D *children[4];
+		for (int i = 0; i < 4; i++) {
+			children[i] = memnew(TestNotifyNode3D);
+			children[i]->visibility_log = &log;
+			root->add_child(children[i]);
+		}
+		root->hide();
+		log.clear();
+		children[1]->remove_on_visibility_changed = children[1];
+		root->show();
+
+		REQUIRE(log.size() == 4);
+		CHECK(log[0] == children[0]);
+		CHECK(log[1] == children[1]);
+		CHECK(log[2] == children[2]);
+		CHECK(log[3] == children[3]);
+		CHECK(children[1]->get_parent() == nullptr);
+
+		memdelete(children[1]);
+	}
+
+	memdelete(root);
+}
+
+} // namespace TestNode3D
+
+#endif // TEST_NODE_3D_H
@@ -0,0 +1,107 @@
+/**************************************************************************/
+/*  test_audio_mix.h                                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_AUDIO_MIX_H
+#define TEST_AUDIO_MIX_H
+
+#include "servers/audio/audio_mix.h"
+
+#include "tests/test_macros.h"
+
+namespace TestAudioMix {
+
+// Odd on purpose, so the loops also go through their remainders.
+constexpr int FRAMES = 37;
+
+void fill(AudioFrame *r_buffer, float p_seed) {
+	for (int i = 0; i < FRAMES; i++) {
+		r_buffer[i] = AudioFrame(Math::sin(p_seed + i), -Math::cos(p_seed * 2 + i));
+	}
+}
+
+TEST_CASE("[AudioMix] Volume ramp") {
+	AudioFrame src[FRAMES];
+	AudioFrame dst[FRAMES];
+	AudioFrame expected[FRAMES];
+	fill(src, 1);
+	fill(dst, 2);
+	fill(expected, 2);
+
+	const AudioFrame vol_start(0.25, 1);
+	const AudioFrame vol_final(1, 0);
+	AudioMix::mix_ramp(dst, src, FRAMES, vol_start, vol_final);
+
+	for (int i = 0; i < FRAMES; i++) {
+		float lerp_param = float(i) / FRAMES;
+		expected[i] += (vol_final * lerp_param + (1 - lerp_param) * vol_start) * src[i];
+		CHECK(dst[i].left == doctest::Approx(expected[i].left));
+		CHECK(dst[i].right == doctest::Approx(expected[i].right));
+	}
+}
+
+TEST_CASE("[AudioMix] Scale and peak") {
+	AudioFrame buffer[FRAMES];
+	fill(buffer, 3);
+	buffer[FRAMES - 1] = AudioFrame(-4, 0.5);
+	buffer[5] = AudioFrame(0.5, 3);
+
+	AudioFrame peak = AudioMix::scale_and_peak(buffer, FRAMES, 0.5);
+
+	CHECK(peak.left == doctest::Approx(2));
+	CHECK(peak.right == doctest::Approx(1.5));
+	CHECK(buffer[FRAMES - 1].left == doctest::Approx(-2));
+	CHECK(buffer[5].right == doctest::Approx(1.5));
+}
+
+TEST_CASE("[AudioMix] Cubic resampling") {
+	AudioFrame src[FRAMES + 3];
+	for (int i = 0; i < FRAMES + 3; i++) {
+		// Cubic interpolation is exact for a line.
+		src[i] = AudioFrame(i * 0.5, -i * 0.25);
+	}
+
+	AudioFrame dst[FRAMES];
+	uint64_t offset = 0;
+	const uint64_t increment = 3 << 15; // 1.5 frames per output frame, with 16 fractional bits.
+	// Odd, so the last frame is interpolated on its own.
+	AudioMix::resample_cubic(dst, src, 21, offset, increment, 16);
+
+	CHECK(offset == 21 * increment);
+	for (int i = 0; i < 21; i++) {
+		// Each frame interpolates between the second and third frame it reads.
+		float position = i * 1.5 + 1;
+		CHECK(dst[i].left == doctest::Approx(position * 0.5));
+		CHECK(dst[i].right == doctest::Approx(-position * 0.25));
+	}
+}
+
+} // namespace TestAudioMix
+
+#endif // TEST_AUDIO_MIX_H
@@ -0,0 +1,229 @@
+/**************************************************************************/
+/*  test_audio_server.h                                                   */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_AUDIO_SERVER_H
+#define TEST_AUDIO_SERVER_H
+
+#include "scene/resources/audio_stream_wav.h"
+#include "servers/audio/audio_driver_dummy.h"
+#include "servers/audio/effects/audio_effect_eq.h"
+#include "servers/audio/effects/audio_effect_reverb.h"
+#include "servers/audio/effects/audio_stream_generator.h"
+#include "servers/audio_server.h"
+
+#include "tests/test_macros.h"
+
+namespace TestAudioServer {
+
+// One second of a looping 16-bit mono sine wave.
+Ref<AudioStreamWAV> create_tone(float p_frequency) {
+	const int rate = 44100;
+	Vector<uint8_t> data;
+	data.resize(rate * 2);
+	uint8_t *w = data.ptrw();
+	for (int i = 0; i < rate; i++) {
+		int16_t sample = Math::sin(Math_TAU * p_frequency * i / rate) * 8000;
+		w[i * 2 + 0] = sample & 0xFF;
+		w[i * 2 + 1] = (sample >> 8) & 0xFF;
+	}
+
+	Ref<AudioStreamWAV> stream;
+	stream.instantiate();
+	stream->set_format(AudioStreamWAV::FORMAT_16_BITS);
+	stream->set_mix_rate(rate);
+	stream->set_loop_mode(AudioStreamWAV::LOOP_FORWARD);
+	stream->set_loop_end(rate);
+	stream->set_data(data);
+	return stream;
+}
+
+// Builds p_groups buses sending to master, each receiving p_buses_per_group buses with a reverb and an equalizer,
+// and starts one voice on every bus of the last level.
+Vector<Ref<AudioStreamPlayback>> create_bus_tree(int p_groups, int p_buses_per_group, int p_voices_per_bus) {
+	AudioServer *audio_server = AudioServer::get_singleton();
+	audio_server->set_bus_count(1);
+
+	for (int i = 0; i < p_groups; i++) {
+		const String group = vformat("Group%d", i);
+		audio_server->add_bus();
+		audio_server->set_bus_name(audio_server->get_bus_count() - 1, group);
+		audio_server->set_bus_send(audio_server->get_bus_count() - 1, "Master");
+		audio_server->add_bus_effect(audio_server->get_bus_count() - 1, memnew(AudioEffectEQ6));
+	}
+
+	Vector<AudioFrame> volume;
+	volume.resize(AudioServer::MAX_CHANNELS_PER_BUS);
+	volume.fill(AudioFrame(0.1, 0.1));
+
+	Vector<Ref<AudioStreamPlayback>> playbacks;
+	for (int i = 0; i < p_groups; i++) {
+		for (int j = 0; j < p_buses_per_group; j++) {
+			const String name = vformat("Bus%d_%d", i, j);
+			audio_server->add_bus();
+			int bus = audio_server->get_bus_count() - 1;
+			audio_server->set_bus_name(bus, name);
+			audio_server->set_bus_send(bus, vformat("Group%d", i));
+			audio_server->add_bus_effect(bus, memnew(AudioEffectReverb));
+			audio_server->add_bus_effect(bus, memnew(AudioEffectEQ10));
+
+			for (int k = 0; k < p_voices_per_bus; k++) {
+				Ref<AudioStreamPlayback> playback = create_tone(220 + 10 * (playbacks.size() % 40))->instantiate_playback();
+				audio_server->start_playback_stream(playback, name, volume);
+				playbacks.push_back(playback);
+			}
+		}
+	}
+	return playbacks;
+}
+
+void stop_playbacks(const Vector<Ref<AudioStreamPlayback>> &p_playbacks) {
+	for (const Ref<AudioStreamPlayback> &playback : p_playbacks) {
+		AudioServer::get_singleton()->stop_playback_stream(playback);
+	}
+	// Let the voices fade out so they don't end up in the next mix.
+	Vector<int32_t> buffer;
+	buffer.resize(AudioServer::get_singleton()->thread_get_mix_buffer_size() * 2);
+	AudioDriverDummy::get_dummy_singleton()->mix_audio(AudioServer::get_singleton()->thread_get_mix_buffer_size(), buffer.ptrw());
+}
+
+Vector<int32_t> mix(int p_frames) {
+	Vector<int32_t> buffer;
+	buffer.resize(p_frames * AudioDriverDummy::get_dummy_singleton()->get_channels());
+	AudioDriverDummy::get_dummy_singleton()->mix_audio(p_frames, buffer.ptrw());
+	return buffer;
+}
+
+TEST_CASE("[Audio][AudioServer] Parallel bus processing gives the same output") {
+	AudioServer *audio_server = AudioServer::get_singleton();
+	// Whole mix steps, so nothing mixed for one run is left over for the next.
+	const int frames = audio_server->thread_get_mix_buffer_size() * 20;
+
+	audio_server->set_enable_parallel_bus_processing(false);
+	Vector<Ref<AudioStreamPlayback>> playbacks = create_bus_tree(3, 4, 1);
+	const Vector<int32_t> serial = mix(frames);
+	stop_playbacks(playbacks);
+
+	audio_server->set_enable_parallel_bus_processing(true);
+	playbacks = create_bus_tree(3, 4, 1);
+	const Vector<int32_t> parallel = mix(frames);
+	stop_playbacks(playbacks);
+
+	bool has_audio = false;
+	for (int32_t sample : serial) {
+		if (sample != 0) {
+			has_audio = true;
+			break;
+		}
+	}
+	CHECK_MESSAGE(has_audio, "The buses should produce sound.");
+	CHECK_MESSAGE(serial == parallel, "Processing buses in parallel must not change the mix.");
+
+	audio_server->set_enable_parallel_bus_processing(false);
+	audio_server->set_bus_count(1);
+}
+
+TEST_CASE("[Audio][AudioServer][Benchmark] Mixing many buses with effects" * doctest::skip()) {
+	AudioServer *audio_server = AudioServer::get_singleton();
+	const int frames = audio_server->thread_get_mix_buffer_size() * 860;
+
+	for (int parallel = 0; parallel < 2; parallel++) {
+		audio_server->set_enable_parallel_bus_processing(parallel);
+		Vector<Ref<AudioStreamPlayback>> playbacks = create_bus_tree(8, 8, 4);
+
+		uint64_t begin = OS::get_singleton()->get_ticks_usec();
+		mix(frames);
+		uint64_t elapsed = OS::get_singleton()->get_ticks_usec() - begin;
+		MESSAGE(vformat("%s: %.1f ms to mix 10 seconds of audio on 72 buses with 256 voices.", parallel ? "Parallel" : "Serial", elapsed / 1000.0));
+
+		stop_playbacks(playbacks);
+	}
+
+	audio_server->set_enable_parallel_bus_processing(false);
+	audio_server->set_bus_count(1);
+}
+
+TEST_CASE("[Audio][AudioServer][Benchmark] Voices that fit in the mix budget" * doctest::skip()) {
+	AudioServer *audio_server = AudioServer::get_singleton();
+	audio_server->set_bus_count(1);
+
+	// Voices are added until mixing takes more than a quarter of the duration of the audio.
+	const double budget = 0.25;
+	const int mix_steps = 86; // About one second.
+	const int step_frames = audio_server->thread_get_mix_buffer_size();
+
+	// Generators at half the mix rate, so every voice goes through the cubic resampler.
+	Ref<AudioStreamGenerator> generator;
+	generator.instantiate();
+	generator->set_mix_rate(audio_server->get_mix_rate() / 2);
+	generator->set_buffer_length(0.1);
+
+	PackedVector2Array tone;
+	tone.resize(step_frames / 2);
+	for (int i = 0; i < tone.size(); i++) {
+		float sample = Math::sin(Math_TAU * 440 * i / (audio_server->get_mix_rate() / 2));
+		tone.write[i] = Vector2(sample, sample);
+	}
+
+	Vector<AudioFrame> volume;
+	volume.resize(AudioServer::MAX_CHANNELS_PER_BUS);
+	volume.fill(AudioFrame(0.01, 0.01));
+
+	Vector<Ref<AudioStreamPlayback>> playbacks;
+	int voices_in_budget = 0;
+	while (playbacks.size() < 4096) {
+		for (int i = 0; i < 32; i++) {
+			Ref<AudioStreamPlayback> playback = generator->instantiate_playback();
+			audio_server->start_playback_stream(playback, "Master", volume);
+			playbacks.push_back(playback);
+		}
+
+		uint64_t mix_usec = 0;
+		for (int step = 0; step < mix_steps; step++) {
+			for (const Ref<AudioStreamGeneratorPlayback> playback : playbacks) {
+				playback->push_buffer(tone);
+			}
+			uint64_t begin = OS::get_singleton()->get_ticks_usec();
+			mix(step_frames);
+			mix_usec += OS::get_singleton()->get_ticks_usec() - begin;
+		}
+
+		if (mix_usec > budget * 1000000.0 * mix_steps * step_frames / audio_server->get_mix_rate()) {
+			break;
+		}
+		voices_in_budget = playbacks.size();
+	}
+	MESSAGE(vformat("%d voices fit in %d%% of the mix time.", voices_in_budget, int(budget * 100)));
+
+	stop_playbacks(playbacks);
+}
+
+} // namespace TestAudioServer
+
+#endif // TEST_AUDIO_SERVER_H
@@ -0,0 +1,141 @@
+/**************************************************************************/
+/*  test_frame_arena_stats.h                                              */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#ifndef TEST_FRAME_ARENA_STATS_H
+#define TEST_FRAME_ARENA_STATS_H
+
+#include "core/templates/frame_arena.h"
+#include "servers/physics_3d/godot_physics_server_3d.h"
+#include "servers/rendering_server.h"
+
+#include "tests/test_macros.h"
+
+namespace TestFrameArenaStats {
+
+// Frame statistics of the servers that use FrameArena for their scratch buffers. The counts are
+// the baseline for the steady state, once the arena of the calling thread has grown.
+
+TEST_CASE("[FrameArena] Physics step") {
+	GodotPhysicsServer3D *physics_server = memnew(GodotPhysicsServer3D(false));
+	physics_server->init();
+	physics_server->set_active(true);
+
+	RID space = physics_server->space_create();
+	physics_server->space_set_active(space, true);
+	RID shape = physics_server->sphere_shape_create();
+	physics_server->shape_set_data(shape, 0.5);
+
+	// Far enough apart to never touch, so each body is an island without constraints.
+	const int body_count = 4;
+	LocalVector<RID> bodies;
+	for (int i = 0; i < body_count; i++) {
+		RID body = physics_server->body_create();
+		physics_server->body_set_mode(body, PhysicsServer3D::BODY_MODE_RIGID);
+		physics_server->body_add_shape(body, shape);
+		physics_server->body_set_state(body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(i * 10, 0, 0)));
+		physics_server->body_set_space(body, space);
+		bodies.push_back(body);
+	}
+
+	// The first frames may allocate or shrink the chunk of this thread.
+	FrameArena::Stats stats;
+	for (int i = 0; i < 4; i++) {
+		FrameArena::end_frame();
+		physics_server->step(1.0 / 60.0);
+		FrameArena::end_frame();
+		stats = FrameArena::get_last_frame_stats();
+	}
+
+	// The island lists and the constraint list, a body list per island, and the
+	// constraint list that the islands share because all of them end up empty.
+	CHECK_MESSAGE(stats.allocations == 3 + body_count + 1, vformat("Arena blocks per step: %d.", stats.allocations));
+	CHECK_MESSAGE(stats.chunk_allocations == 0, vformat("Arena chunks per step: %d.", stats.chunk_allocations));
+
+	for (const RID &body : bodies) {
+		physics_server->free(body);
+	}
+	physics_server->free(shape);
+	physics_server->free(space);
+	physics_server->finish();
+	memdelete(physics_server);
+}
+
+TEST_CASE("[FrameArena][SceneTree] Cull pass") {
+	RenderingServer *rendering_server = RenderingServer::get_singleton();
+
+	RID scenario = rendering_server->scenario_create();
+	RID light = rendering_server->directional_light_create();
+	rendering_server->light_set_shadow(light, true);
+	RID light_instance = rendering_server->instance_create2(light, scenario);
+	RID mesh = rendering_server->mesh_create();
+	LocalVector<RID> instances;
+	for (int i = 0; i < 16; i++) {
+		RID instance = rendering_server->instance_create2(mesh, scenario);
+		rendering_server->instance_set_transform(instance, Transform3D(Basis(), Vector3(i, 0, -5)));
+		instances.push_back(instance);
+	}
+
+	RID camera = rendering_server->camera_create();
+	rendering_server->camera_set_perspective(camera, 75.0, 0.05, 100.0);
+	RID viewport = rendering_server->viewport_create();
+	rendering_server->viewport_set_size(viewport, 64, 64);
+	rendering_server->viewport_set_scenario(viewport, scenario);
+	rendering_server->viewport_attach_camera(viewport, camera);
+	rendering_server->viewport_set_update_mode(viewport, RenderingServer::VIEWPORT_UPDATE_ALWAYS);
+	rendering_server->viewport_set_active(viewport, true);
+
+	FrameArena::Stats stats;
+	for (int i = 0; i < 4; i++) {
+		FrameArena::end_frame();
+		rendering_server->draw(false);
+		FrameArena::end_frame();
+		stats = FrameArena::get_last_frame_stats();
+	}
+
+	// The dummy renderer has no shadows, so there are no shadow casters to collect. With shadows,
+	// each light shadow update adds a block for its casters, and the list of shadowed directional
+	// lights adds one per frame.
+	CHECK_MESSAGE(stats.allocations == 0, vformat("Arena blocks per frame: %d.", stats.allocations));
+	CHECK_MESSAGE(stats.chunk_allocations == 0, vformat("Arena chunks per frame: %d.", stats.chunk_allocations));
+
+	rendering_server->free(viewport);
+	rendering_server->free(camera);
+	for (const RID &instance : instances) {
+		rendering_server->free(instance);
+	}
+	rendering_server->free(mesh);
+	rendering_server->free(light_instance);
+	rendering_server->free(light);
+	rendering_server->free(scenario);
+}
+
+} // namespace TestFrameArenaStats
+
+#endif // TEST_FRAME_ARENA_STATS_H